@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+"""Generates password_strength_unicode.h from Python's Unicode database.
+
+The tables cover what the UTF-8 validators in password_strength.c need:
+general-category classes, NFKC decompositions, canonical combining
+classes, canonical compositions and simple lowercase mappings. Hangul
+syllables are decomposed and composed algorithmically and are left out.
+
+Usage: python3 make_unicode_tables.py > password_strength_unicode.h
+"""
+
+import sys
+import unicodedata
+
+MAX_CODE_POINT = 0x10FFFF
+HANGUL_FIRST, HANGUL_LAST = 0xAC00, 0xD7A3
+SURROGATE_FIRST, SURROGATE_LAST = 0xD800, 0xDFFF
+
+# Bits of UNICODE_CLASS_*; the first three equal CLASS_UPPER, CLASS_LOWER, CLASS_DIGIT
+UPPER, LOWER, DIGIT, LETTER, MARK, STABLE = 0x01, 0x02, 0x04, 0x08, 0x10, 0x20
+CATEGORY_CLASS = {
+    "Lu": UPPER | LETTER, "Lt": UPPER | LETTER, "Ll": LOWER | LETTER,
+    "Lm": LETTER, "Lo": LETTER, "Nd": DIGIT,
+    "Mn": MARK, "Mc": MARK, "Me": MARK,
+}
+
+
+def scalar_values():
+    for code in range(MAX_CODE_POINT + 1):
+        if not SURROGATE_FIRST <= code <= SURROGATE_LAST:
+            yield code
+
+
+def transitions(value_of):
+    """Returns (start, value) pairs where value_of changes, starting at 0."""
+    starts, values, previous = [], [], None
+    for code in range(MAX_CODE_POINT + 1):
+        value = value_of(code)
+        if value != previous:
+            starts.append(code)
+            values.append(value)
+            previous = value
+    return starts, values
+
+
+def composition_seconds():
+    """Code points that can join a preceding starter during composition."""
+    seconds = set(range(0x1161, 0x1161 + 21)) | set(range(0x11A8, 0x11A8 + 27))  # Hangul V and T jamo
+    for key, _ in compositions():
+        seconds.add(key & 0x1FFFFF)
+    return seconds
+
+
+def class_of(seconds):
+    """Category bits, plus STABLE for code points NFKC leaves alone in any context.
+
+    These have NFKC_Quick_Check=Yes and combining class 0, so a string made
+    only of them is already in NFKC.
+    """
+    def value_of(code):
+        if SURROGATE_FIRST <= code <= SURROGATE_LAST:
+            return 0
+        value = CATEGORY_CLASS.get(unicodedata.category(chr(code)), 0)
+        if (code not in seconds and unicodedata.combining(chr(code)) == 0
+                and unicodedata.is_normalized("NFKC", chr(code))):
+            value |= STABLE
+        return value
+    return value_of
+
+
+def combining_class(code):
+    return unicodedata.combining(chr(code))
+
+
+def decompositions():
+    keys, starts, data = [], [0], []
+    for code in scalar_values():
+        if HANGUL_FIRST <= code <= HANGUL_LAST:
+            continue
+        decomposed = unicodedata.normalize("NFKD", chr(code))
+        if decomposed != chr(code):
+            keys.append(code)
+            data.extend(ord(c) for c in decomposed)
+            starts.append(len(data))
+    return keys, starts, data
+
+
+def compositions():
+    pairs = []
+    for code in scalar_values():
+        mapping = unicodedata.decomposition(chr(code))
+        if not mapping or mapping.startswith("<"):
+            continue
+        parts = [int(part, 16) for part in mapping.split()]
+        # Singletons and composition exclusions do not survive NFC
+        if len(parts) == 2 and unicodedata.normalize("NFC", chr(parts[0]) + chr(parts[1])) == chr(code):
+            pairs.append(((parts[0] << 21) | parts[1], code))
+    pairs.sort()
+    return pairs
+
+
+def lowercase_mappings():
+    pairs = []
+    for code in scalar_values():
+        lower = chr(code).lower()
+        if len(lower) == 1 and lower != chr(code):
+            pairs.append((code, ord(lower)))
+    return pairs
+
+
+def max_decomposed_per_byte(keys, starts):
+    ratio = 3 / 3  # Hangul syllables: 3 jamo from 3 bytes
+    for i, code in enumerate(keys):
+        ratio = max(ratio, (starts[i + 1] - starts[i]) / len(chr(code).encode()))
+    return int(ratio + 0.999999)
+
+
+def emit_array(out, ctype, name, values, comment, per_line=8, fmt="0x{:X}"):
+    out.write(f" /* {comment} */\n")
+    out.write(f" static const {ctype} {name}[{len(values)}] = {{\n")
+    for i in range(0, len(values), per_line):
+        row = ", ".join(fmt.format(v) for v in values[i:i + per_line])
+        out.write(f"     {row},\n")
+    out.write(" };\n \n")
+
+
+def main():
+    out = sys.stdout
+    class_starts, class_values = transitions(class_of(composition_seconds()))
+    combining_starts, combining_values = transitions(combining_class)
+    keys, starts, data = decompositions()
+    pairs = compositions()
+    lowers = lowercase_mappings()
+
+    out.write("/**\n")
+    out.write(" * @file password_strength_unicode.h\n")
+    out.write(" * @brief Unicode tables for the UTF-8 validators\n")
+    out.write(" * \n")
+    out.write(f" * Generated by make_unicode_tables.py from the Unicode {unicodedata.unidata_version}\n")
+    out.write(" * character database; do not edit. Included only by password_strength.c.\n")
+    out.write(" */\n\n")
+    out.write(" #ifndef PASSWORD_STRENGTH_UNICODE_H\n")
+    out.write(" #define PASSWORD_STRENGTH_UNICODE_H\n \n")
+    out.write(f' #define UNICODE_TABLES_VERSION "{unicodedata.unidata_version}"\n \n')
+    out.write(" /* Bits of unicodeClassValues; the first three match the CLASS_* bits */\n")
+    out.write(f" #define UNICODE_CLASS_UPPER 0x{UPPER:02X}   // Lu, Lt\n")
+    out.write(f" #define UNICODE_CLASS_LOWER 0x{LOWER:02X}   // Ll\n")
+    out.write(f" #define UNICODE_CLASS_DIGIT 0x{DIGIT:02X}   // Nd\n")
+    out.write(f" #define UNICODE_CLASS_LETTER 0x{LETTER:02X}  // Lu, Lt, Ll, Lm, Lo\n")
+    out.write(f" #define UNICODE_CLASS_MARK 0x{MARK:02X}    // Mn, Mc, Me\n")
+    out.write(f" #define UNICODE_CLASS_STABLE 0x{STABLE:02X}  // NFKC_Quick_Check=Yes with combining class 0\n \n")
+    out.write(" /* Most code points the NFKC decomposition of one input byte can produce */\n")
+    out.write(f" #define UNICODE_MAX_DECOMPOSED_PER_BYTE {max_decomposed_per_byte(keys, starts)}\n \n")
+
+    emit_array(out, "uint32_t", "unicodeClassStarts", class_starts,
+               "First code point of each run of equal classes")
+    emit_array(out, "unsigned char", "unicodeClassValues", class_values,
+               "UNICODE_CLASS_* bits of each run", per_line=16, fmt="0x{:02X}")
+    emit_array(out, "uint32_t", "combiningClassStarts", combining_starts,
+               "First code point of each run of equal canonical combining classes")
+    emit_array(out, "unsigned char", "combiningClassValues", combining_values,
+               "Canonical combining class of each run", per_line=16, fmt="{}")
+    emit_array(out, "uint32_t", "decompositionKeys", keys,
+               "Code points whose NFKD differs from themselves, Hangul syllables excepted")
+    emit_array(out, "uint16_t", "decompositionStarts", starts,
+               "Decomposition of decompositionKeys[i] is decompositionData[starts[i] .. starts[i + 1])",
+               per_line=12, fmt="{}")
+    emit_array(out, "uint32_t", "decompositionData", data, "Fully decomposed, canonically ordered code points")
+    emit_array(out, "uint64_t", "compositionKeys", [key for key, _ in pairs],
+               "(first << 21) | second of each primary composite's canonical pair", per_line=4,
+               fmt="0x{:X}ull")
+    emit_array(out, "uint32_t", "compositionValues", [value for _, value in pairs],
+               "Composite for each compositionKeys entry")
+    emit_array(out, "uint32_t", "lowercaseKeys", [code for code, _ in lowers],
+               "Code points with a single code point lowercase form")
+    emit_array(out, "uint32_t", "lowercaseValues", [lower for _, lower in lowers],
+               "Lowercase form of each lowercaseKeys entry")
+
+    out.write(" #endif /* PASSWORD_STRENGTH_UNICODE_H */\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -2,62 +2,5131 @@
  * @file password_strength.c
  * @brief Password strength meter and default password generator
  * 
- * This program allows users to create strong passwords by enforcing
- * strength requirements and offering a secure password generator.
- * It implements two password strength standards:
+ * Implementation of libpasswordstrength. It enforces two password
+ * strength standards and offers a secure password generator:
  * 1. Strong passwords (with string requirements)
  * 2. Default passwords (simplified requirements)
+ * The interactive program and bulk tools live in password_strength_cli.c.
  * 
  * @author Original: Hady Tinawi
  * @date February 27, 2025
  */
 
+ #include "password_strength.h"
+ #include "password_strength_unicode.h"
+ 
  #include <stdio.h>
- #include <ctype.h>
  #include <string.h>
- #include <stdbool.h>
- #include <time.h>
  #include <stdlib.h>
+ #include <errno.h>
+ #include <math.h>
+ #include <time.h>
+ #include <pthread.h>
+ #include <unistd.h>
+ #include <fcntl.h>
+ #include <sys/mman.h>
+ #include <sys/stat.h>
+ #include <sys/random.h>
+ #include <sys/eventfd.h>
+ 
+ #if defined(__SSE2__)
+ #include <immintrin.h>
+ #elif defined(__aarch64__) && defined(__ARM_NEON)
+ #include <arm_neon.h>
+ #endif
+ 
+ /*
+  * Locale-free ASCII character tables
+  *
+  * The ctype functions consult the thread's locale on every call and are
+  * undefined for negative char values. These tables are expanded by the
+  * preprocessor at compile time and indexed by the byte value, so the
+  * validators behave identically whatever locale the host process sets.
+  */
+ #define ASCII_CLASS(c) (((c) >= 'A' && (c) <= 'Z') ? CLASS_UPPER : \
+                         ((c) >= 'a' && (c) <= 'z') ? CLASS_LOWER : \
+                         ((c) >= '0' && (c) <= '9') ? CLASS_DIGIT : 0)
+ #define ASCII_FOLD(c) (((c) >= 'A' && (c) <= 'Z') ? (c) + ('a' - 'A') : (c))
+ 
+ #define TABLE_ROW4(f, c) f(c), f((c) + 1), f((c) + 2), f((c) + 3)
+ #define TABLE_ROW16(f, c) TABLE_ROW4(f, c), TABLE_ROW4(f, (c) + 4), \
+                           TABLE_ROW4(f, (c) + 8), TABLE_ROW4(f, (c) + 12)
+ #define TABLE_ROW64(f, c) TABLE_ROW16(f, c), TABLE_ROW16(f, (c) + 16), \
+                           TABLE_ROW16(f, (c) + 32), TABLE_ROW16(f, (c) + 48)
+ #define TABLE_256(f) { TABLE_ROW64(f, 0), TABLE_ROW64(f, 64), \
+                        TABLE_ROW64(f, 128), TABLE_ROW64(f, 192) }
+ 
+ /* CLASS_* bits of every byte value; 0 for characters that are not alphanumeric */
+ static const unsigned char asciiClassTable[256] = TABLE_256(ASCII_CLASS);
+ 
+ /* Lowercase form of every byte value; only 'A'-'Z' are changed */
+ static const unsigned char asciiFoldTable[256] = TABLE_256(ASCII_FOLD);
+ 
+ /**
+  * @brief Byte-at-a-time classifier, used as fallback and as reference for the SIMD kernels
+  *
+  * The password does not need to be NUL-terminated.
+  *
+  * @param pwd Password bytes to classify
+  * @param length Number of bytes in pwd
+  * @param features Output record
+  */
+ void classifyPasswordBytesScalar(const char* pwd, size_t length, PasswordFeatures* features) {
+     unsigned int classes = 0;
+     size_t alphaRun = 0;
+     size_t longestAlphaRun = 0;
+     bool hasNonAlnum = false;
+     
+     for (size_t i = 0; i < length; i++) {
+         unsigned int charClass = asciiClassTable[(unsigned char)pwd[i]];
+         
+         classes |= charClass;
+         if (charClass & CLASS_ALPHA) {
+             alphaRun++;
+             if (alphaRun > longestAlphaRun) {
+                 longestAlphaRun = alphaRun;
+             }
+         } else {
+             alphaRun = 0;
+             if (charClass == 0) {
+                 hasNonAlnum = true;
+             }
+         }
+     }
+     
+     features->length = length;
+     features->classes = classes;
+     features->longestAlphaRun = longestAlphaRun;
+     features->hasNonAlnum = hasNonAlnum;
+ }
+ 
+ /*
+  * SIMD classification kernels
+  *
+  * Each kernel turns a block of 16 or 32 bytes into upper/lower/digit bit
+  * masks (bit i describes byte i) and folds them into a running feature
+  * record with accumulateClassMasks(). The ranges are the ASCII letters and
+  * digits, matching asciiClassTable. A trailing partial block is copied into a zeroed buffer
+  * so no kernel ever reads past the end of the password.
+  */
+ 
+ /**
+  * @brief Running state shared by the SIMD kernels
+  */
+ typedef struct {
+     unsigned int classes;
+     size_t alphaRun;         // Letters at the end of the bytes seen so far
+     size_t longestAlphaRun;
+     bool hasNonAlnum;
+ } ClassifyState;
+ 
+ /**
+  * @brief Folds the class masks of one block into the running state
+  *
+  * Letter runs inside the block are measured by repeatedly and-ing the mask
+  * with itself shifted by one; runs crossing block boundaries are carried in
+  * state->alphaRun.
+  *
+  * @param state Running classification state
+  * @param upper Uppercase mask of the block
+  * @param lower Lowercase mask of the block
+  * @param digit Digit mask of the block
+  * @param width Number of valid bytes in the block (1 to 32)
+  */
+ static inline void accumulateClassMasks(ClassifyState* state, uint32_t upper, uint32_t lower,
+                                         uint32_t digit, unsigned int width) {
+     uint32_t valid = width == 32 ? UINT32_MAX : (UINT32_C(1) << width) - 1;
+     uint32_t alpha = upper | lower;
+     
+     if (upper != 0) {
+         state->classes |= CLASS_UPPER;
+     }
+     if (lower != 0) {
+         state->classes |= CLASS_LOWER;
+     }
+     if (digit != 0) {
+         state->classes |= CLASS_DIGIT;
+     }
+     if ((alpha | digit) != valid) {
+         state->hasNonAlnum = true;
+     }
+     
+     if (alpha == valid) {
+         state->alphaRun += width;
+         if (state->alphaRun > state->longestAlphaRun) {
+             state->longestAlphaRun = state->alphaRun;
+         }
+         return;
+     }
+     
+     // Close the run carried in from the previous block
+     state->alphaRun += (size_t)__builtin_ctz(~alpha);
+     if (state->alphaRun > state->longestAlphaRun) {
+         state->longestAlphaRun = state->alphaRun;
+     }
+     
+     // Longest run fully inside this block
+     size_t innerRun = 0;
+     for (uint32_t run = alpha; run != 0; run &= run >> 1) {
+         innerRun++;
+     }
+     if (innerRun > state->longestAlphaRun) {
+         state->longestAlphaRun = innerRun;
+     }
+     
+     // Letters at the top of the block start the next carried run
+     uint32_t nonAlpha = ~alpha & valid;
+     state->alphaRun = width - 1 - (31 - (unsigned int)__builtin_clz(nonAlpha));
+ }
+ 
+ /**
+  * @brief Copies the running state into a feature record
+  */
+ static inline void finishClassifyState(const ClassifyState* state, size_t length,
+                                        PasswordFeatures* features) {
+     features->length = length;
+     features->classes = state->classes;
+     features->longestAlphaRun = state->longestAlphaRun;
+     features->hasNonAlnum = state->hasNonAlnum;
+ }
+ 
+ #if defined(__SSE2__)
+ 
+ /**
+  * @brief Builds the mask of bytes in [first, first + count) for one 16-byte block
+  *
+  * Adding (0x80 - first) maps the range onto the bottom of the signed byte
+  * range, so a single signed compare replaces two unsigned ones.
+  */
+ static inline uint32_t rangeMaskSse2(__m128i block, char first, int count) {
+     __m128i shifted = _mm_add_epi8(block, _mm_set1_epi8((char)(0x80 - first)));
+     __m128i inRange = _mm_cmplt_epi8(shifted, _mm_set1_epi8((char)(-128 + count)));
+     return (uint32_t)_mm_movemask_epi8(inRange);
+ }
+ 
+ /**
+  * @brief SSE2 classifier processing 16 bytes per step
+  *
+  * @param pwd Password bytes to classify
+  * @param length Number of bytes in pwd
+  * @param features Output record
+  */
+ static void classifyPasswordBytesSse2(const char* pwd, size_t length, PasswordFeatures* features) {
+     ClassifyState state = {0, 0, 0, false};
+     size_t i = 0;
+     
+     for (; i + 16 <= length; i += 16) {
+         __m128i block = _mm_loadu_si128((const __m128i*)(pwd + i));
+         accumulateClassMasks(&state, rangeMaskSse2(block, 'A', 26), rangeMaskSse2(block, 'a', 26),
+                              rangeMaskSse2(block, '0', 10), 16);
+     }
+     
+     if (i < length) {
+         char tail[16] = {0};
+         memcpy(tail, pwd + i, length - i);
+         __m128i block = _mm_loadu_si128((const __m128i*)tail);
+         accumulateClassMasks(&state, rangeMaskSse2(block, 'A', 26), rangeMaskSse2(block, 'a', 26),
+                              rangeMaskSse2(block, '0', 10), (unsigned int)(length - i));
+     }
+     
+     finishClassifyState(&state, length, features);
+ }
+ 
+ /**
+  * @brief Builds the mask of bytes in [first, first + count) for one 32-byte block
+  */
+ __attribute__((target("avx2")))
+ static inline uint32_t rangeMaskAvx2(__m256i block, char first, int count) {
+     __m256i shifted = _mm256_add_epi8(block, _mm256_set1_epi8((char)(0x80 - first)));
+     __m256i inRange = _mm256_cmpgt_epi8(_mm256_set1_epi8((char)(-128 + count)), shifted);
+     return (uint32_t)_mm256_movemask_epi8(inRange);
+ }
+ 
+ /**
+  * @brief AVX2 classifier processing 32 bytes per step
+  *
+  * @param pwd Password bytes to classify
+  * @param length Number of bytes in pwd
+  * @param features Output record
+  */
+ __attribute__((target("avx2")))
+ static void classifyPasswordBytesAvx2(const char* pwd, size_t length, PasswordFeatures* features) {
+     ClassifyState state = {0, 0, 0, false};
+     size_t i = 0;
+     
+     for (; i + 32 <= length; i += 32) {
+         __m256i block = _mm256_loadu_si256((const __m256i*)(pwd + i));
+         accumulateClassMasks(&state, rangeMaskAvx2(block, 'A', 26), rangeMaskAvx2(block, 'a', 26),
+                              rangeMaskAvx2(block, '0', 10), 32);
+     }
+     
+     if (i < length) {
+         char tail[32] = {0};
+         memcpy(tail, pwd + i, length - i);
+         __m256i block = _mm256_loadu_si256((const __m256i*)tail);
+         accumulateClassMasks(&state, rangeMaskAvx2(block, 'A', 26), rangeMaskAvx2(block, 'a', 26),
+                              rangeMaskAvx2(block, '0', 10), (unsigned int)(length - i));
+     }
+     
+     finishClassifyState(&state, length, features);
+ }
+ 
+ #elif defined(__aarch64__) && defined(__ARM_NEON)
+ 
+ /**
+  * @brief Builds the mask of bytes in [first, first + count) for one 16-byte block
+  *
+  * NEON has no movemask, so each lane is weighted by its bit and the two
+  * halves are summed horizontally.
+  */
+ static inline uint32_t rangeMaskNeon(uint8x16_t block, uint8_t first, uint8_t count) {
+     static const uint8_t laneBits[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+     uint8x16_t inRange = vcltq_u8(vsubq_u8(block, vdupq_n_u8(first)), vdupq_n_u8(count));
+     uint8x16_t bits = vandq_u8(inRange, vld1q_u8(laneBits));
+     return (uint32_t)vaddv_u8(vget_low_u8(bits)) | ((uint32_t)vaddv_u8(vget_high_u8(bits)) << 8);
+ }
+ 
+ /**
+  * @brief NEON classifier processing 16 bytes per step
+  *
+  * @param pwd Password bytes to classify
+  * @param length Number of bytes in pwd
+  * @param features Output record
+  */
+ static void classifyPasswordBytesNeon(const char* pwd, size_t length, PasswordFeatures* features) {
+     ClassifyState state = {0, 0, 0, false};
+     size_t i = 0;
+     
+     for (; i + 16 <= length; i += 16) {
+         uint8x16_t block = vld1q_u8((const uint8_t*)(pwd + i));
+         accumulateClassMasks(&state, rangeMaskNeon(block, 'A', 26), rangeMaskNeon(block, 'a', 26),
+                              rangeMaskNeon(block, '0', 10), 16);
+     }
+     
+     if (i < length) {
+         uint8_t tail[16] = {0};
+         memcpy(tail, pwd + i, length - i);
+         uint8x16_t block = vld1q_u8(tail);
+         accumulateClassMasks(&state, rangeMaskNeon(block, 'A', 26), rangeMaskNeon(block, 'a', 26),
+                              rangeMaskNeon(block, '0', 10), (unsigned int)(length - i));
+     }
+     
+     finishClassifyState(&state, length, features);
+ }
+ 
+ #endif
+ 
+ /*
+  * Bounded-length classifiers
+  *
+  * Default passwords are at most 15 bytes and most chosen ones are under
+  * 16, so classifyPasswordBytes() hands passwords of up to 16 and 64
+  * bytes to kernels specialized for those bounds. Each builds the upper,
+  * lower and digit masks of the whole password as single 64-bit words in
+  * registers. Up to 16 bytes are gathered with at most four overlapping
+  * loads, and longer passwords use a fixed, unrolled number of 16-byte
+  * blocks whose last one overlaps the one before. Neither copies to a
+  * buffer, and no state is carried between blocks: letter runs are
+  * measured on the finished mask.
+  */
+ 
+ #if (defined(__SSE2__) || (defined(__aarch64__) && defined(__ARM_NEON))) && \
+     __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+ #define BOUNDED_CLASSIFIERS
+ 
+ /* Longest passwords the two bounded kernels accept */
+ #define BOUNDED_SHORT_LENGTH 16
+ #define BOUNDED_LONG_LENGTH 64
+ 
+ /**
+  * @brief Class masks of a password, bit i describing byte i
+  */
+ typedef struct {
+     uint64_t upper;
+     uint64_t lower;
+     uint64_t digit;
+ } ClassMasks;
+ 
+ /* Masks of 16 bytes given as two little-endian words */
+ static inline ClassMasks wordClassMasks(uint64_t low, uint64_t high) {
+ #if defined(__SSE2__)
+     __m128i block = _mm_set_epi64x((long long)high, (long long)low);
+     return (ClassMasks){rangeMaskSse2(block, 'A', 26), rangeMaskSse2(block, 'a', 26), rangeMaskSse2(block, '0', 10)};
+ #else
+     uint8x16_t block = vcombine_u8(vcreate_u8(low), vcreate_u8(high));
+     return (ClassMasks){rangeMaskNeon(block, 'A', 26), rangeMaskNeon(block, 'a', 26), rangeMaskNeon(block, '0', 10)};
+ #endif
+ }
+ 
+ /* Masks of the 16 bytes at block */
+ static inline ClassMasks blockClassMasks(const char* block) {
+     uint64_t words[2];
+     memcpy(words, block, sizeof(words));
+     return wordClassMasks(words[0], words[1]);
+ }
+ 
+ /* Loads up to 8 bytes as a little-endian word */
+ static inline uint64_t loadWord(const char* bytes, size_t count) {
+     uint64_t word = 0;
+     memcpy(&word, bytes, count);
+     return word;
+ }
+ 
+ /* Longest run of set bits */
+ static inline size_t longestRun64(uint64_t bits) {
+     size_t longest = 0;
+     while (bits != 0) {
+         bits >>= __builtin_ctzll(bits);
+         if (bits == UINT64_MAX) {
+             return 64;
+         }
+         size_t run = (size_t)__builtin_ctzll(~bits);
+         longest = run > longest ? run : longest;
+         bits >>= run;
+     }
+     return longest;
+ }
+ 
+ /* Turns the masks of a whole password into its feature record */
+ static inline void finishClassMasks(ClassMasks masks, size_t length, PasswordFeatures* features) {
+     uint64_t valid = length == 64 ? UINT64_MAX : (UINT64_C(1) << length) - 1;
+     uint64_t alpha = masks.upper | masks.lower;
+     
+     features->length = length;
+     features->classes = (masks.upper != 0 ? CLASS_UPPER : 0) | (masks.lower != 0 ? CLASS_LOWER : 0) |
+                         (masks.digit != 0 ? CLASS_DIGIT : 0);
+     features->longestAlphaRun = longestRun64(alpha);
+     features->hasNonAlnum = (alpha | masks.digit) != valid;
+ }
+ 
+ /**
+  * @brief Classifier for passwords of at most BOUNDED_SHORT_LENGTH bytes
+  *
+  * The bytes are gathered into two words with fixed-size loads: the first
+  * and last 8 of 9-16 bytes, the first and last 4 of 4-8 bytes, or the
+  * first, middle and last of 1-3 bytes. Overlapping loads OR the same
+  * byte into the same position, so no byte past the end is read.
+  *
+  * @param pwd Password bytes to classify
+  * @param length Number of bytes in pwd, at most BOUNDED_SHORT_LENGTH
+  * @param features Output record
+  */
+ static void classifyPasswordBytes16(const char* pwd, size_t length, PasswordFeatures* features) {
+     uint64_t low = 0;
+     uint64_t high = 0;
+     if (length > 8) {
+         low = loadWord(pwd, 8);
+         high = loadWord(pwd + length - 8, 8) >> (8 * (16 - length));
+     } else if (length >= 4) {
+         low = loadWord(pwd, 4) | (loadWord(pwd + length - 4, 4) << (8 * (length - 4)));
+     } else if (length > 0) {
+         low = (uint64_t)(unsigned char)pwd[0] | ((uint64_t)(unsigned char)pwd[length / 2] << (8 * (length / 2))) |
+               ((uint64_t)(unsigned char)pwd[length - 1] << (8 * (length - 1)));
+     }
+     finishClassMasks(wordClassMasks(low, high), length, features);
+ }
+ 
+ /**
+  * @brief Classifier for passwords of BOUNDED_SHORT_LENGTH to BOUNDED_LONG_LENGTH bytes
+  *
+  * Up to four whole blocks are classified in place. When the length is not
+  * a multiple of 16, the last block is the final 16 bytes of the password
+  * and its masks are shifted into position over the previous block.
+  *
+  * @param pwd Password bytes to classify
+  * @param length Number of bytes in pwd, from BOUNDED_SHORT_LENGTH to BOUNDED_LONG_LENGTH
+  * @param features Output record
+  */
+ static void classifyPasswordBytes64(const char* pwd, size_t length, PasswordFeatures* features) {
+     ClassMasks masks = {0, 0, 0};
+     size_t blocks = length / 16;
+     
+ #pragma GCC unroll 4
+     for (size_t b = 0; b < BOUNDED_LONG_LENGTH / 16; b++) {
+         if (b < blocks) {
+             ClassMasks block = blockClassMasks(pwd + 16 * b);
+             masks.upper |= block.upper << (16 * b);
+             masks.lower |= block.lower << (16 * b);
+             masks.digit |= block.digit << (16 * b);
+         }
+     }
+     if (length % 16 != 0) {
+         ClassMasks last = blockClassMasks(pwd + length - 16);
+         masks.upper |= last.upper << (length - 16);
+         masks.lower |= last.lower << (length - 16);
+         masks.digit |= last.digit << (length - 16);
+     }
+     finishClassMasks(masks, length, features);
+ }
+ 
+ #endif
+ 
+ /* Classifier kernel used by classifyPasswordBytes(), chosen once at startup */
+ typedef void (*ClassifyKernel)(const char* pwd, size_t length, PasswordFeatures* features);
+ 
+ #if defined(__SSE2__)
+ static ClassifyKernel classifyKernel = classifyPasswordBytesSse2;
+ #elif defined(__aarch64__) && defined(__ARM_NEON)
+ static ClassifyKernel classifyKernel = classifyPasswordBytesNeon;
+ #else
+ static ClassifyKernel classifyKernel = classifyPasswordBytesScalar;
+ #endif
+ 
+ /**
+  * @brief Selects the widest classifier kernel the CPU supports
+  *
+  * Runs before main() so later reads of classifyKernel never race with it.
+  */
+ __attribute__((constructor))
+ static void selectClassifyKernel(void) {
+ #if defined(__SSE2__)
+     __builtin_cpu_init();
+     if (__builtin_cpu_supports("avx2")) {
+         classifyKernel = classifyPasswordBytesAvx2;
+     }
+ #endif
+ }
+ 
+ /**
+  * @brief Scans a password of known length once and records its composition features
+  *
+  * Passwords of up to 64 bytes go to the bounded-length kernels; longer
+  * ones to the fastest available classifier kernel. The password does not
+  * need to be NUL-terminated.
+  *
+  * @param pwd Password bytes to classify
+  * @param length Number of bytes in pwd
+  * @param features Output record
+  */
+ void classifyPasswordBytes(const char* pwd, size_t length, PasswordFeatures* features) {
+ #if defined(BOUNDED_CLASSIFIERS)
+     if (length <= BOUNDED_SHORT_LENGTH) {
+         classifyPasswordBytes16(pwd, length, features);
+         return;
+     }
+     if (length <= BOUNDED_LONG_LENGTH) {
+         classifyPasswordBytes64(pwd, length, features);
+         return;
+     }
+ #endif
+     classifyKernel(pwd, length, features);
+ }
+ 
+ /**
+  * @brief Scans a password once and records all of its composition features
+  *
+  * @param pwd Password string to classify
+  * @param features Output record
+  */
+ void classifyPassword(const char* pwd, PasswordFeatures* features) {
+     classifyPasswordBytes(pwd, strlen(pwd), features);
+ }
+ 
+ /**
+  * @brief Maps the missing required character classes to RULE_MISSING_* bits
+  */
+ static inline unsigned int missingClassFailures(unsigned int classes) {
+     return ((classes & CLASS_UPPER) ? 0 : RULE_MISSING_UPPER) |
+            ((classes & CLASS_LOWER) ? 0 : RULE_MISSING_LOWER) |
+            ((classes & CLASS_DIGIT) ? 0 : RULE_MISSING_DIGIT);
+ }
+ 
+ /**
+  * @brief Lists every strong password composition rule a feature record fails
+  *
+  * Covers every strong password criterion except the username check.
+  *
+  * @param features Feature record from classifyPassword()
+  * @return Mask of RULE_* bits, 0 if all composition rules pass
+  */
+ unsigned int strongRuleFailures(const PasswordFeatures* features) {
+     return (features->length >= STRONG_MIN_LENGTH ? 0 : RULE_TOO_SHORT) |
+            missingClassFailures(features->classes) |
+            (features->hasNonAlnum ? RULE_SPECIAL_CHARACTER : 0) |
+            (features->longestAlphaRun >= MIN_CONSECUTIVE_LETTERS ? 0 : RULE_NO_LETTER_RUN);
+ }
+ 
+ /**
+  * @brief Lists every default password rule a feature record fails
+  *
+  * @param features Feature record from classifyPassword()
+  * @return Mask of RULE_* bits, 0 if all default password rules pass
+  */
+ unsigned int defaultRuleFailures(const PasswordFeatures* features) {
+     return (features->length <= DEFAULT_MAX_LENGTH ? 0 : RULE_TOO_LONG) |
+            missingClassFailures(features->classes) |
+            (features->hasNonAlnum ? RULE_SPECIAL_CHARACTER : 0);
+ }
+ 
+ /**
+  * @brief Evaluates the composition rules of a strong password
+  *
+  * Covers every strong password criterion except the username check.
+  *
+  * @param features Feature record from classifyPassword()
+  * @return true if all composition rules pass, false otherwise
+  */
+ bool meetsStrongRules(const PasswordFeatures* features) {
+     return strongRuleFailures(features) == 0;
+ }
+ 
+ /**
+  * @brief Evaluates the default password rules
+  *
+  * @param features Feature record from classifyPassword()
+  * @return true if all default password rules pass, false otherwise
+  */
+ bool meetsDefaultRules(const PasswordFeatures* features) {
+     return defaultRuleFailures(features) == 0;
+ }
+ 
+ #define STRINGIFY_VALUE(x) #x
+ #define STRINGIFY(x) STRINGIFY_VALUE(x)
+ 
+ /**
+  * @brief Describes one RULE_* bit of the built-in rules for display to the user
+  *
+  * The limits quoted are those of the strong and default rules; describe
+  * failures of a configured policy with policyRuleFailureMessage().
+  *
+  * @param rule A single RULE_* bit
+  * @return Static, human-readable description, or "unknown rule"
+  */
+ const char* ruleFailureMessage(unsigned int rule) {
+     switch (rule) {
+         case RULE_TOO_SHORT:         return "must be at least " STRINGIFY(STRONG_MIN_LENGTH) " characters long";
+         case RULE_TOO_LONG:          return "must be " STRINGIFY(DEFAULT_MAX_LENGTH) " characters or fewer";
+         case RULE_MISSING_UPPER:     return "must contain an uppercase letter";
+         case RULE_MISSING_LOWER:     return "must contain a lowercase letter";
+         case RULE_MISSING_DIGIT:     return "must contain a digit";
+         case RULE_SPECIAL_CHARACTER: return "must contain only letters and digits";
+         case RULE_NO_LETTER_RUN:     return "must contain at least " STRINGIFY(MIN_CONSECUTIVE_LETTERS) " letters in a row";
+         case RULE_CONTAINS_USERNAME: return "must not contain the username";
+         case RULE_BREACHED:          return "must not appear in a known breach";
+         case RULE_DENYLISTED:        return "must not contain a previous password or personal detail";
+         case RULE_REUSED:            return "must not be one of your recent passwords";
+         case RULE_SIMILAR:           return "must not be too similar to the username or a previous password";
+         case RULE_INVALID_UTF8:      return "must be valid UTF-8 text";
+         default:                     return "unknown rule";
+     }
+ }
+ 
+ /*
+  * Runtime statistics
+  *
+  * When enabled with setPasswordStatsEnabled(), every strong password check
+  * adds to counters owned by the calling thread: checks, rejections and
+  * one counter per failed rule. One check in STATS_LATENCY_SAMPLE_INTERVAL
+  * is also timed into a log-linear (HDR-style) histogram, so reading the
+  * clock costs a fraction of a nanosecond per check on average. Owners
+  * update their counters with relaxed atomic stores and never take a lock;
+  * passwordStatsSnapshot() sums all live threads plus the totals of
+  * threads that have exited. With statistics disabled each check pays a
+  * single predictable branch.
+  */
+ 
+ typedef struct StatsThread {
+     PasswordStats stats;
+     uint32_t untilSample;       // Checks left before the next timed one
+     struct StatsThread* prev;
+     struct StatsThread* next;
+ } StatsThread;
+ 
+ static bool passwordStatsEnabled = false;
+ static _Thread_local StatsThread* threadStats __attribute__((tls_model("initial-exec")));
+ static StatsThread* liveStats;          // Threads with counters, guarded by statsLock
+ static PasswordStats retiredStats;      // Totals of exited threads, guarded by statsLock
+ static pthread_mutex_t statsLock = PTHREAD_MUTEX_INITIALIZER;
+ static pthread_key_t statsKey;
+ static pthread_once_t statsKeyOnce = PTHREAD_ONCE_INIT;
+ static uint64_t statsClockOverhead;     // Cost of one clock read, subtracted from samples
+ 
+ /* Adds to a counter only its owning thread writes */
+ #define STATS_ADD(counter, amount) \
+     __atomic_store_n(&(counter), __atomic_load_n(&(counter), __ATOMIC_RELAXED) + (amount), __ATOMIC_RELAXED)
+ 
+ /**
+  * @brief Adds every counter of one record into another
+  */
+ static void addPasswordStats(PasswordStats* total, const PasswordStats* stats) {
+     const uint64_t* from = (const uint64_t*)stats;
+     uint64_t* to = (uint64_t*)total;
+     for (size_t i = 0; i < sizeof(PasswordStats) / sizeof(uint64_t); i++) {
+         to[i] += __atomic_load_n(&from[i], __ATOMIC_RELAXED);
+     }
+ }
+ 
+ /**
+  * @brief Folds an exiting thread's counters into the retired totals
+  */
+ static void retireStatsThread(void* arg) {
+     StatsThread* node = arg;
+     
+     pthread_mutex_lock(&statsLock);
+     addPasswordStats(&retiredStats, &node->stats);
+     if (node->prev != NULL) {
+         node->prev->next = node->next;
+     } else {
+         liveStats = node->next;
+     }
+     if (node->next != NULL) {
+         node->next->prev = node->prev;
+     }
+     pthread_mutex_unlock(&statsLock);
+     free(node);
+ }
+ 
+ static inline uint64_t statsClockNs(void) {
+     struct timespec now;
+     clock_gettime(CLOCK_MONOTONIC, &now);
+     return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+ }
+ 
+ static void createStatsKey(void) {
+     pthread_key_create(&statsKey, retireStatsThread);
+     
+     uint64_t fastest = UINT64_MAX;
+     for (int i = 0; i < 64; i++) {
+         uint64_t before = statsClockNs();
+         uint64_t delta = statsClockNs() - before;
+         fastest = delta < fastest ? delta : fastest;
+     }
+     statsClockOverhead = fastest;
+ }
+ 
+ /**
+  * @brief Returns the calling thread's counters, registering them on first use
+  *
+  * @return The counters, or NULL if they could not be allocated
+  */
+ static StatsThread* currentStatsThread(void) {
+     if (threadStats != NULL) {
+         return threadStats;
+     }
+     
+     pthread_once(&statsKeyOnce, createStatsKey);
+     StatsThread* node = calloc(1, sizeof(StatsThread));
+     if (node == NULL) {
+         return NULL;
+     }
+     node->untilSample = 1;
+     
+     pthread_mutex_lock(&statsLock);
+     node->next = liveStats;
+     if (liveStats != NULL) {
+         liveStats->prev = node;
+     }
+     liveStats = node;
+     pthread_mutex_unlock(&statsLock);
+     
+     pthread_setspecific(statsKey, node);
+     threadStats = node;
+     return node;
+ }
+ 
+ /**
+  * @brief Maps a latency to its histogram bucket
+  *
+  * Values below 16 ns get one bucket each; above that every power of two
+  * is split into 8 equal sub-buckets, so each bucket is within 12.5% of
+  * the values it holds.
+  */
+ static inline size_t latencyBucket(uint64_t ns) {
+     if (ns < 16) {
+         return (size_t)ns;
+     }
+     int exponent = 63 - __builtin_clzll(ns);
+     size_t bucket = 16 + (size_t)(exponent - 4) * 8 + (size_t)((ns >> (exponent - 3)) & 7);
+     return bucket < STATS_LATENCY_BUCKETS ? bucket : STATS_LATENCY_BUCKETS - 1;
+ }
+ 
+ /**
+  * @brief Smallest latency that falls into a histogram bucket
+  *
+  * @param bucket Bucket index below STATS_LATENCY_BUCKETS
+  * @return Lower bound in nanoseconds
+  */
+ uint64_t latencyBucketLowerBound(size_t bucket) {
+     if (bucket < 16) {
+         return bucket;
+     }
+     size_t exponent = 4 + (bucket - 16) / 8;
+     return (8 + (uint64_t)((bucket - 16) % 8)) << (exponent - 3);
+ }
+ 
+ /**
+  * @brief Starts instrumenting one check
+  *
+  * @param start Set to the start time when this check is sampled, 0 otherwise
+  * @return The thread's counters, or NULL when statistics are off
+  */
+ static inline StatsThread* beginStatsCheck(uint64_t* start) {
+     *start = 0;
+     if (!__atomic_load_n(&passwordStatsEnabled, __ATOMIC_RELAXED)) {
+         return NULL;
+     }
+     StatsThread* node = currentStatsThread();
+     if (node != NULL && --node->untilSample == 0) {
+         node->untilSample = STATS_LATENCY_SAMPLE_INTERVAL;
+         *start = statsClockNs();
+     }
+     return node;
+ }
+ 
+ /**
+  * @brief Records the outcome, and for sampled checks the latency, of one check
+  */
+ static inline void endStatsCheck(StatsThread* node, uint64_t start, unsigned int failures) {
+     if (node == NULL) {
+         return;
+     }
+     if (start != 0) {
+         uint64_t elapsed = statsClockNs() - start;
+         elapsed = elapsed > statsClockOverhead ? elapsed - statsClockOverhead : 0;
+         STATS_ADD(node->stats.latencySamples, 1);
+         STATS_ADD(node->stats.latencyBuckets[latencyBucket(elapsed)], 1);
+     }
+     STATS_ADD(node->stats.checks, 1);
+     if (failures != 0) {
+         STATS_ADD(node->stats.rejected, 1);
+         for (unsigned int bits = failures & ((1u << STATS_RULE_COUNT) - 1); bits != 0; bits &= bits - 1) {
+             STATS_ADD(node->stats.ruleFailures[__builtin_ctz(bits)], 1);
+         }
+     }
+ }
+ 
+ /**
+  * @brief Counts one generated default password
+  */
+ static inline void recordGeneratedPassword(void) {
+     if (__atomic_load_n(&passwordStatsEnabled, __ATOMIC_RELAXED)) {
+         StatsThread* node = currentStatsThread();
+         if (node != NULL) {
+             STATS_ADD(node->stats.generated, 1);
+         }
+     }
+ }
+ 
+ /**
+  * @brief Turns statistics collection on or off for all threads
+  */
+ void setPasswordStatsEnabled(bool enabled) {
+     __atomic_store_n(&passwordStatsEnabled, enabled, __ATOMIC_RELAXED);
+ }
+ 
+ /**
+  * @brief Sums the counters of every thread that has recorded statistics
+  *
+  * Counters are read while their owners keep running, so a snapshot taken
+  * under load may be a few events behind, but every counter is consistent
+  * on its own.
+  *
+  * @param snapshot Output totals
+  */
+ void passwordStatsSnapshot(PasswordStats* snapshot) {
+     memset(snapshot, 0, sizeof(*snapshot));
+     pthread_mutex_lock(&statsLock);
+     addPasswordStats(snapshot, &retiredStats);
+     for (const StatsThread* node = liveStats; node != NULL; node = node->next) {
+         addPasswordStats(snapshot, &node->stats);
+     }
+     pthread_mutex_unlock(&statsLock);
+ }
+ 
+ /**
+  * @brief Estimates a latency percentile from a snapshot's histogram
+  *
+  * @param stats Snapshot from passwordStatsSnapshot()
+  * @param quantile Fraction between 0 and 1, e.g. 0.99
+  * @return Lower bound of the bucket holding the quantile, in nanoseconds; 0 without samples
+  */
+ uint64_t passwordStatsLatencyPercentile(const PasswordStats* stats, double quantile) {
+     if (stats->latencySamples == 0) {
+         return 0;
+     }
+     uint64_t rank = (uint64_t)ceil(quantile * (double)stats->latencySamples);
+     uint64_t seen = 0;
+     for (size_t i = 0; i < STATS_LATENCY_BUCKETS; i++) {
+         seen += stats->latencyBuckets[i];
+         if (seen >= rank && seen > 0) {
+             return latencyBucketLowerBound(i);
+         }
+     }
+     return latencyBucketLowerBound(STATS_LATENCY_BUCKETS - 1);
+ }
+ 
+ /**
+  * @brief Writes a snapshot as "name value" lines
+  *
+  * @param out Stream to write to
+  * @param stats Snapshot from passwordStatsSnapshot()
+  */
+ void printPasswordStats(FILE* out, const PasswordStats* stats) {
+     static const char* const ruleNames[STATS_RULE_COUNT] = {
+         "too_short", "too_long", "missing_upper", "missing_lower", "missing_digit",
+         "special_character", "no_letter_run", "contains_username",
+     };
+     
+     fprintf(out, "checks %llu\n", (unsigned long long)stats->checks);
+     fprintf(out, "rejected %llu\n", (unsigned long long)stats->rejected);
+     for (size_t i = 0; i < STATS_RULE_COUNT; i++) {
+         fprintf(out, "rule_%s %llu\n", ruleNames[i], (unsigned long long)stats->ruleFailures[i]);
+     }
+     fprintf(out, "generated %llu\n", (unsigned long long)stats->generated);
+     fprintf(out, "latency_samples %llu\n", (unsigned long long)stats->latencySamples);
+     fprintf(out, "latency_p50_ns %llu\n", (unsigned long long)passwordStatsLatencyPercentile(stats, 0.50));
+     fprintf(out, "latency_p90_ns %llu\n", (unsigned long long)passwordStatsLatencyPercentile(stats, 0.90));
+     fprintf(out, "latency_p99_ns %llu\n", (unsigned long long)passwordStatsLatencyPercentile(stats, 0.99));
+     fprintf(out, "latency_p999_ns %llu\n", (unsigned long long)passwordStatsLatencyPercentile(stats, 0.999));
+ }
+ 
+ /*
+  * Scratch arenas
+  *
+  * Per-check scratch memory (today the search tables of usernames longer
+  * than USERNAME_INLINE_CAPACITY) comes from a bump allocator instead of
+  * malloc. Each thread owns one arena, reached through
+  * threadScratchArena(); allocations only advance an offset and are
+  * discarded together when the batch that made them ends. A request that
+  * does not fit the main block spills into a heap chunk, and the next
+  * reset replaces the block with one large enough for the peak, so a
+  * steady workload stops touching the heap after its first few batches.
+  */
+ 
+ /* Main block of a thread's arena, allocated on first use */
+ #define THREAD_ARENA_CAPACITY (16 * 1024)
+ 
+ /* Alignment of every arena allocation */
+ #define ARENA_ALIGNMENT 16
+ 
+ struct ScratchChunk {
+     struct ScratchChunk* next;
+     size_t size;
+     max_align_t data[];
+ };
+ 
+ static _Thread_local ScratchArena threadArena __attribute__((tls_model("initial-exec")));
+ static pthread_key_t arenaKey;
+ static pthread_once_t arenaKeyOnce = PTHREAD_ONCE_INIT;
+ 
+ /**
+  * @brief Prepares an arena with a main block of the given size
+  *
+  * @param arena Arena to initialize
+  * @param capacity Bytes in the main block; 0 to defer until the first reset
+  * @return true on success, false if the block could not be allocated
+  */
+ bool initScratchArena(ScratchArena* arena, size_t capacity) {
+     memset(arena, 0, sizeof(*arena));
+     if (capacity == 0) {
+         return true;
+     }
+     arena->base = malloc(capacity);
+     if (arena->base == NULL) {
+         return false;
+     }
+     arena->capacity = capacity;
+     return true;
+ }
+ 
+ /**
+  * @brief Allocates scratch memory that lives until the arena is reset
+  *
+  * @param arena Arena to allocate from
+  * @param size Bytes needed
+  * @return Memory aligned to 16 bytes, or NULL if a spill chunk could not be allocated
+  */
+ void* arenaAllocate(ScratchArena* arena, size_t size) {
+     size_t offset = (arena->used + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+     void* memory;
+     
+     if (offset <= arena->capacity && size <= arena->capacity - offset) {
+         memory = arena->base + offset;
+         arena->used = offset + size;
+     } else {
+         ScratchChunk* chunk = malloc(sizeof(ScratchChunk) + size);
+         if (chunk == NULL) {
+             return NULL;
+         }
+         chunk->next = arena->spill;
+         chunk->size = size;
+         arena->spill = chunk;
+         arena->spilled += size + ARENA_ALIGNMENT;
+         memory = chunk->data;
+     }
+     
+     size_t inUse = arena->used + arena->spilled;
+     arena->peak = inUse > arena->peak ? inUse : arena->peak;
+     return memory;
+ }
+ 
+ /**
+  * @brief Records the arena's position so later allocations can be released together
+  */
+ ScratchArenaMark markScratchArena(const ScratchArena* arena) {
+     ScratchArenaMark mark = {arena->used, arena->spill};
+     return mark;
+ }
+ 
+ /**
+  * @brief Discards every allocation made since mark
+  *
+  * Releasing back to an empty arena is a full resetScratchArena().
+  */
+ void releaseScratchArena(ScratchArena* arena, ScratchArenaMark mark) {
+     if (mark.used == 0 && mark.spill == NULL) {
+         resetScratchArena(arena);
+         return;
+     }
+     while (arena->spill != mark.spill) {
+         ScratchChunk* chunk = arena->spill;
+         arena->spill = chunk->next;
+         arena->spilled -= chunk->size + ARENA_ALIGNMENT;
+         free(chunk);
+     }
+     arena->used = mark.used;
+ }
+ 
+ /**
+  * @brief Discards every allocation, growing the main block if the last batch spilled
+  *
+  * If the larger block cannot be allocated the old one is kept.
+  */
+ void resetScratchArena(ScratchArena* arena) {
+     bool spilled = arena->spill != NULL;
+     while (arena->spill != NULL) {
+         ScratchChunk* chunk = arena->spill;
+         arena->spill = chunk->next;
+         free(chunk);
+     }
+     
+     if (spilled) {
+         size_t capacity = arena->capacity > 0 ? arena->capacity : ARENA_ALIGNMENT;
+         while (capacity < arena->peak && capacity <= SIZE_MAX / 2) {
+             capacity *= 2;
+         }
+         unsigned char* base = malloc(capacity);
+         if (base != NULL) {
+             free(arena->base);
+             arena->base = base;
+             arena->capacity = capacity;
+         }
+     }
+     arena->used = 0;
+     arena->spilled = 0;
+     arena->peak = 0;
+ }
+ 
+ /**
+  * @brief Releases the main block and every spill chunk
+  */
+ void freeScratchArena(ScratchArena* arena) {
+     while (arena->spill != NULL) {
+         ScratchChunk* chunk = arena->spill;
+         arena->spill = chunk->next;
+         free(chunk);
+     }
+     free(arena->base);
+     memset(arena, 0, sizeof(*arena));
+ }
+ 
+ static void releaseThreadArena(void* arg) {
+     freeScratchArena(arg);
+ }
+ 
+ static void createArenaKey(void) {
+     pthread_key_create(&arenaKey, releaseThreadArena);
+ }
+ 
+ /**
+  * @brief Returns the calling thread's arena, allocating its main block on first use
+  *
+  * The arena is freed when the thread exits. If its block cannot be
+  * allocated every allocation spills until a later reset succeeds.
+  */
+ ScratchArena* threadScratchArena(void) {
+     if (threadArena.capacity == 0) {
+         pthread_once(&arenaKeyOnce, createArenaKey);
+         pthread_setspecific(arenaKey, &threadArena);
+         threadArena.base = malloc(THREAD_ARENA_CAPACITY);
+         threadArena.capacity = threadArena.base != NULL ? THREAD_ARENA_CAPACITY : 0;
+     }
+     return &threadArena;
+ }
+ 
+ /**
+  * @brief Checks if password contains at least 4 consecutive alphabetic characters
+  *
+  * @param pwd Password string to check
+  * @return true if contains 4+ consecutive letters, false otherwise
+  */
+ bool containsString(const char* pwd) {
+     PasswordFeatures features;
+     classifyPassword(pwd, &features);
+     return features.longestAlphaRun >= MIN_CONSECUTIVE_LETTERS;
+ }
+ 
+ /**
+  * @brief Checks if password contains at least one uppercase letter
+  *
+  * @param pwd Password string to check
+  * @return true if contains uppercase, false otherwise
+  */
+ bool hasUpper(const char* pwd) {
+     PasswordFeatures features;
+     classifyPassword(pwd, &features);
+     return (features.classes & CLASS_UPPER) != 0;
+ }
+ 
+ /**
+  * @brief Checks if password contains at least one digit
+  *
+  * @param pwd Password string to check
+  * @return true if contains digit, false otherwise
+  */
+ bool hasDigit(const char* pwd) {
+     PasswordFeatures features;
+     classifyPassword(pwd, &features);
+     return (features.classes & CLASS_DIGIT) != 0;
+ }
+ 
+ /**
+  * @brief Checks if password contains at least one lowercase letter
+  *
+  * @param pwd Password string to check
+  * @return true if contains lowercase, false otherwise
+  */
+ bool hasLower(const char* pwd) {
+     PasswordFeatures features;
+     classifyPassword(pwd, &features);
+     return (features.classes & CLASS_LOWER) != 0;
+ }
+ 
+ /**
+  * @brief Checks if password meets minimum length requirement (8 characters)
+  *
+  * @param pwd Password string to check
+  * @return true if length is sufficient, false otherwise
+  */
+ bool hasMinimumLength(const char* pwd) {
+     return strlen(pwd) >= STRONG_MIN_LENGTH;
+ }
+ 
+ /**
+  * @brief Checks if password contains only alphanumeric characters
+  *
+  * @param pwd Password string to check
+  * @return true if alphanumeric only, false if contains special characters
+  */
+ bool isAlphanumericOnly(const char* pwd) {
+     PasswordFeatures features;
+     classifyPassword(pwd, &features);
+     return !features.hasNonAlnum;
+ }
+ 
+ /**
+  * @brief Fills a matcher's folded username and failure table, whose storage is already set
+  */
+ static void buildMatcherTables(UsernameMatcher* matcher, const char* username, size_t length) {
+     matcher->length = length;
+     for (size_t i = 0; i < length; i++) {
+         matcher->folded[i] = (char)asciiFoldTable[(unsigned char)username[i]];
+     }
+     
+     // failure[i] is the length of the longest proper border of folded[0..i]
+     size_t border = 0;
+     if (length > 0) {
+         matcher->failure[0] = 0;
+     }
+     for (size_t i = 1; i < length; i++) {
+         while (border > 0 && matcher->folded[i] != matcher->folded[border]) {
+             border = matcher->failure[border - 1];
+         }
+         if (matcher->folded[i] == matcher->folded[border]) {
+             border++;
+         }
+         matcher->failure[i] = border;
+     }
+ }
+ 
+ /**
+  * @brief Builds the search table for a username of known length
+  *
+  * The username does not need to be NUL-terminated. Usernames of up to
+  * USERNAME_INLINE_CAPACITY bytes never allocate.
+  *
+  * @param matcher Matcher to initialize
+  * @param username Username bytes to search for
+  * @param length Number of bytes in username
+  * @return true on success, false if memory could not be allocated
+  */
+ bool initUsernameMatcherBytes(UsernameMatcher* matcher, const char* username, size_t length) {
+     matcher->ownsTables = length > USERNAME_INLINE_CAPACITY;
+     if (!matcher->ownsTables) {
+         matcher->folded = matcher->inlineFolded;
+         matcher->failure = matcher->inlineFailure;
+     } else {
+         matcher->folded = malloc(length);
+         matcher->failure = malloc(length * sizeof(size_t));
+         if (matcher->folded == NULL || matcher->failure == NULL) {
+             free(matcher->folded);
+             free(matcher->failure);
+             matcher->folded = NULL;
+             matcher->failure = NULL;
+             matcher->length = 0;
+             matcher->ownsTables = false;
+             return false;
+         }
+     }
+     
+     buildMatcherTables(matcher, username, length);
+     return true;
+ }
+ 
+ /**
+  * @brief Builds the search table for a username, taking long tables from an arena
+  *
+  * Like initUsernameMatcherBytes(), but a username longer than
+  * USERNAME_INLINE_CAPACITY gets its tables from arena instead of the
+  * heap. They stay valid until the arena is reset or released past this
+  * call; freeUsernameMatcher() does not free them.
+  *
+  * @param matcher Matcher to initialize
+  * @param username Username bytes to search for
+  * @param length Number of bytes in username
+  * @param arena Arena for the tables of long usernames
+  * @return true on success, false if memory could not be allocated
+  */
+ bool initUsernameMatcherArena(UsernameMatcher* matcher, const char* username, size_t length,
+                               ScratchArena* arena) {
+     matcher->ownsTables = false;
+     if (length <= USERNAME_INLINE_CAPACITY) {
+         matcher->folded = matcher->inlineFolded;
+         matcher->failure = matcher->inlineFailure;
+     } else {
+         matcher->failure = arenaAllocate(arena, length * sizeof(size_t));
+         matcher->folded = arenaAllocate(arena, length);
+         if (matcher->folded == NULL || matcher->failure == NULL) {
+             matcher->folded = NULL;
+             matcher->failure = NULL;
+             matcher->length = 0;
+             return false;
+         }
+     }
+     
+     buildMatcherTables(matcher, username, length);
+     return true;
+ }
+ 
+ /**
+  * @brief Builds the search table for a username
+  *
+  * @param matcher Matcher to initialize
+  * @param username Username to search for
+  * @return true on success, false if memory could not be allocated
+  */
+ bool initUsernameMatcher(UsernameMatcher* matcher, const char* username) {
+     return initUsernameMatcherBytes(matcher, username, strlen(username));
+ }
+ 
+ /**
+  * @brief Releases any memory held by a username matcher
+  *
+  * @param matcher Matcher previously initialized with initUsernameMatcher()
+  */
+ void freeUsernameMatcher(UsernameMatcher* matcher) {
+     if (matcher->ownsTables) {
+         free(matcher->folded);
+         free(matcher->failure);
+     }
+     matcher->folded = NULL;
+     matcher->failure = NULL;
+     matcher->length = 0;
+     matcher->ownsTables = false;
+ }
+ 
+ /**
+  * @brief Checks if a password of known length contains the matcher's username
+  *
+  * Case-insensitive; runs in O(length) regardless of the username length.
+  * The password does not need to be NUL-terminated.
+  *
+  * @param matcher Matcher built with initUsernameMatcher()
+  * @param password Password bytes to analyze
+  * @param length Number of bytes in password
+  * @return true if password contains username, false otherwise
+  */
+ bool matcherFindsUsernameBytes(const UsernameMatcher* matcher, const char* password, size_t length) {
+     if (matcher->length == 0 || matcher->length > length) {
+         return false;  // Empty or longer username can't be contained
+     }
+     
+     size_t matched = 0;
+     for (size_t i = 0; i < length; i++) {
+         char c = (char)asciiFoldTable[(unsigned char)password[i]];
+         
+         while (matched > 0 && c != matcher->folded[matched]) {
+             matched = matcher->failure[matched - 1];
+         }
+         if (c == matcher->folded[matched]) {
+             matched++;
+             if (matched == matcher->length) {
+                 return true;  // Username found in password
+             }
+         }
+     }
+     
+     return false;
+ }
+ 
+ /**
+  * @brief Checks if password contains the matcher's username (case-insensitive)
+  *
+  * @param matcher Matcher built with initUsernameMatcher()
+  * @param password Password to analyze
+  * @return true if password contains username, false otherwise
+  */
+ bool matcherFindsUsername(const UsernameMatcher* matcher, const char* password) {
+     return matcherFindsUsernameBytes(matcher, password, strlen(password));
+ }
+ 
+ /**
+  * @brief Checks if a password of known length contains a username of known length
+  *
+  * Case-insensitive; neither string needs to be NUL-terminated. The search
+  * table of a username longer than USERNAME_INLINE_CAPACITY bytes comes
+  * from the thread's scratch arena and is released before returning. If it
+  * cannot be allocated the password is reported as containing the
+  * username, so validation fails closed.
+  *
+  * @param username Username bytes to check against
+  * @param usernameLength Number of bytes in username
+  * @param password Password bytes to analyze
+  * @param passwordLength Number of bytes in password
+  * @return true if password contains username, false otherwise
+  */
+ bool containsUsernameBytes(const char* username, size_t usernameLength,
+                            const char* password, size_t passwordLength) {
+     if (usernameLength == 0 || usernameLength > passwordLength) {
+         return false;  // Empty or longer username can't be contained
+     }
+     
+     UsernameMatcher matcher;
+     if (usernameLength <= USERNAME_INLINE_CAPACITY) {
+         initUsernameMatcherBytes(&matcher, username, usernameLength);  // Inline tables, cannot fail
+         return matcherFindsUsernameBytes(&matcher, password, passwordLength);
+     }
+     
+     ScratchArena* arena = threadScratchArena();
+     ScratchArenaMark mark = markScratchArena(arena);
+     bool found = !initUsernameMatcherArena(&matcher, username, usernameLength, arena) ||
+                  matcherFindsUsernameBytes(&matcher, password, passwordLength);
+     releaseScratchArena(arena, mark);
+     return found;
+ }
+ 
+ /**
+  * @brief Checks if password contains username (case-insensitive)
+  *
+  * If the search table for a very long username cannot be allocated the
+  * password is reported as containing the username, so validation fails
+  * closed.
+  *
+  * @param username Username to check against
+  * @param password Password to analyze
+  * @return true if password contains username, false otherwise
+  */
+ bool containsUsername(const char* username, const char* password) {
+     return containsUsernameBytes(username, strlen(username), password, strlen(password));
+ }
+ 
+ /**
+  * @brief Validates if a password meets strong password criteria
+  * 
+  * A strong password must:
+  * - Be at least 8 characters long
+  * - Contain at least one uppercase letter
+  * - Contain at least one lowercase letter
+  * - Contain at least one digit
+  * - Contain only alphanumeric characters
+  * - Contain at least 4 consecutive letters
+  * - Not contain the username
+  *
+  * @param username User's username (to ensure it's not in the password)
+  * @param password Password to validate
+  * @return true if password meets all criteria, false otherwise
+  */
+ bool isStrongPassword(const char* username, const char* password) {
+     return isStrongPasswordBytes(username, strlen(username), password, strlen(password));
+ }
+ 
+ /**
+  * @brief Validates a password of known length against strong password criteria
+  *
+  * Same rules as isStrongPassword(); neither string needs to be
+  * NUL-terminated, so records can be checked in place inside a larger
+  * buffer. The username is only searched for once every composition rule
+  * has passed, so most weak passwords cost a single classification pass.
+  * While statistics are enabled it is always searched for, so the
+  * recorded mask is the complete one strongPasswordFailuresBytes() would
+  * record.
+  *
+  * @param username Username bytes
+  * @param usernameLength Number of bytes in username
+  * @param password Password bytes to validate
+  * @param passwordLength Number of bytes in password
+  * @return true if password meets all criteria, false otherwise
+  */
+ bool isStrongPasswordBytes(const char* username, size_t usernameLength,
+                            const char* password, size_t passwordLength) {
+     uint64_t start;
+     StatsThread* stats = beginStatsCheck(&start);
+     PasswordFeatures features;
+     classifyPasswordBytes(password, passwordLength, &features);
+     
+     unsigned int failures = strongRuleFailures(&features);
+     if ((failures == 0 || stats != NULL) &&
+         containsUsernameBytes(username, usernameLength, password, passwordLength)) {
+         failures |= RULE_CONTAINS_USERNAME;
+     }
+     endStatsCheck(stats, start, failures);
+     return failures == 0;
+ }
+ 
+ /**
+  * @brief Lists every strong password rule a password of known length fails
+  *
+  * One classification pass plus the username search; unlike
+  * isStrongPasswordBytes() the username is checked even when a composition
+  * rule already failed, so the mask is complete.
+  *
+  * @param username Username bytes
+  * @param usernameLength Number of bytes in username
+  * @param password Password bytes to validate
+  * @param passwordLength Number of bytes in password
+  * @return Mask of RULE_* bits, 0 if the password is strong
+  */
+ unsigned int strongPasswordFailuresBytes(const char* username, size_t usernameLength,
+                                          const char* password, size_t passwordLength) {
+     uint64_t start;
+     StatsThread* stats = beginStatsCheck(&start);
+     PasswordFeatures features;
+     classifyPasswordBytes(password, passwordLength, &features);
+     
+     unsigned int failures = strongRuleFailures(&features);
+     if (containsUsernameBytes(username, usernameLength, password, passwordLength)) {
+         failures |= RULE_CONTAINS_USERNAME;
+     }
+     endStatsCheck(stats, start, failures);
+     return failures;
+ }
+ 
+ /**
+  * @brief Lists every strong password rule a password fails
+  *
+  * @param username User's username
+  * @param password Password to validate
+  * @return Mask of RULE_* bits, 0 if the password is strong
+  */
+ unsigned int strongPasswordFailures(const char* username, const char* password) {
+     return strongPasswordFailuresBytes(username, strlen(username), password, strlen(password));
+ }
+ 
+ /*
+  * UTF-8 validation
+  *
+  * The byte validators count bytes and treat every byte above 0x7F as a
+  * special character, so "Müller2024" fails as non-alphanumeric and
+  * "Ünïcødé" is measured in bytes. The UTF-8 validators decode the
+  * password, bring it to Normalization Form KC, so that precomposed and
+  * combining accents, fullwidth forms and ligatures compare equal, and
+  * classify each code point by its general category: Lu and Lt are
+  * uppercase, Ll lowercase, Nd digits, and every letter category counts
+  * towards the letter run. Combining marks belong to the character before
+  * them, so lengths are counted in characters. The tables come from the
+  * Unicode character database through make_unicode_tables.py; Hangul
+  * syllables are handled arithmetically, and text whose code points all
+  * pass the NFKC quick check with combining class 0 is left as it is.
+  * Input that is pure ASCII, which isAsciiBytes() checks 16 bytes at a
+  * time, is already normalized and classified identically by the byte
+  * validators, so it goes straight to them.
+  */
+ 
+ /* Hangul syllable arithmetic from section 3.12 of the Unicode standard */
+ #define HANGUL_S_BASE 0xAC00
+ #define HANGUL_L_BASE 0x1100
+ #define HANGUL_V_BASE 0x1161
+ #define HANGUL_T_BASE 0x11A7
+ #define HANGUL_L_COUNT 19
+ #define HANGUL_V_COUNT 21
+ #define HANGUL_T_COUNT 28
+ #define HANGUL_N_COUNT (HANGUL_V_COUNT * HANGUL_T_COUNT)
+ #define HANGUL_S_COUNT (HANGUL_L_COUNT * HANGUL_N_COUNT)
+ 
+ /* Longer runs of combining marks are put in canonical order with a counting sort */
+ #define MARK_RUN_INSERTION_LIMIT 32
+ 
+ /* Results of normalizeUtf8Codes() that are not code point counts */
+ #define UTF8_INVALID SIZE_MAX
+ #define UTF8_NO_MEMORY (SIZE_MAX - 1)
+ 
+ /**
+  * @brief Checks if text contains only 7-bit ASCII bytes
+  *
+  * ORs the text together 16 bytes at a time with SSE2 or NEON, then 8 at
+  * a time, and tests the high bits once at the end.
+  *
+  * @param text Bytes to check
+  * @param length Number of bytes in text
+  * @return true if no byte is above 0x7F
+  */
+ bool isAsciiBytes(const char* text, size_t length) {
+     size_t i = 0;
+ #if defined(__SSE2__)
+     __m128i seen = _mm_setzero_si128();
+     for (; i + 16 <= length; i += 16) {
+         seen = _mm_or_si128(seen, _mm_loadu_si128((const __m128i*)(text + i)));
+     }
+     if (_mm_movemask_epi8(seen) != 0) {
+         return false;
+     }
+ #elif defined(__aarch64__) && defined(__ARM_NEON)
+     uint8x16_t seen = vdupq_n_u8(0);
+     for (; i + 16 <= length; i += 16) {
+         seen = vorrq_u8(seen, vld1q_u8((const uint8_t*)(text + i)));
+     }
+     if (vmaxvq_u8(seen) >= 0x80) {
+         return false;
+     }
+ #endif
+     
+     uint64_t seenWords = 0;
+     for (; i + 8 <= length; i += 8) {
+         uint64_t word;
+         memcpy(&word, text + i, sizeof(word));
+         seenWords |= word;
+     }
+     for (; i < length; i++) {
+         seenWords |= (unsigned char)text[i];
+     }
+     return (seenWords & 0x8080808080808080ull) == 0;
+ }
+ 
+ /**
+  * @brief Decodes UTF-8 into code points, rejecting malformed input
+  *
+  * Overlong forms, surrogates, values above U+10FFFF and truncated
+  * sequences are all errors.
+  *
+  * @return Number of code points written to codes, or UTF8_INVALID
+  */
+ static size_t decodeUtf8(const char* text, size_t length, uint32_t* codes) {
+     const unsigned char* bytes = (const unsigned char*)text;
+     size_t count = 0;
+     size_t i = 0;
+     
+     while (i < length) {
+         uint32_t code = bytes[i];
+         if (code < 0x80) {
+             codes[count++] = code;
+             i++;
+             continue;
+         }
+         
+         size_t width;
+         uint32_t minimum;
+         if (code >= 0xC2 && code <= 0xDF) {
+             width = 2;
+             minimum = 0x80;
+             code &= 0x1F;
+         } else if (code >= 0xE0 && code <= 0xEF) {
+             width = 3;
+             minimum = 0x800;
+             code &= 0x0F;
+         } else if (code >= 0xF0 && code <= 0xF4) {
+             width = 4;
+             minimum = 0x10000;
+             code &= 0x07;
+         } else {
+             return UTF8_INVALID;
+         }
+         if (length - i < width) {
+             return UTF8_INVALID;
+         }
+         for (size_t k = 1; k < width; k++) {
+             if ((bytes[i + k] & 0xC0) != 0x80) {
+                 return UTF8_INVALID;
+             }
+             code = (code << 6) | (bytes[i + k] & 0x3F);
+         }
+         if (code < minimum || code > 0x10FFFF || (code >= 0xD800 && code <= 0xDFFF)) {
+             return UTF8_INVALID;
+         }
+         codes[count++] = code;
+         i += width;
+     }
+     return count;
+ }
+ 
+ /**
+  * @brief Writes one code point as UTF-8
+  *
+  * @return Number of bytes written, 1 to 4
+  */
+ static inline size_t encodeUtf8(uint32_t code, char* out) {
+     unsigned char* bytes = (unsigned char*)out;
+     if (code < 0x80) {
+         bytes[0] = (unsigned char)code;
+         return 1;
+     }
+     if (code < 0x800) {
+         bytes[0] = (unsigned char)(0xC0 | (code >> 6));
+         bytes[1] = (unsigned char)(0x80 | (code & 0x3F));
+         return 2;
+     }
+     if (code < 0x10000) {
+         bytes[0] = (unsigned char)(0xE0 | (code >> 12));
+         bytes[1] = (unsigned char)(0x80 | ((code >> 6) & 0x3F));
+         bytes[2] = (unsigned char)(0x80 | (code & 0x3F));
+         return 3;
+     }
+     bytes[0] = (unsigned char)(0xF0 | (code >> 18));
+     bytes[1] = (unsigned char)(0x80 | ((code >> 12) & 0x3F));
+     bytes[2] = (unsigned char)(0x80 | ((code >> 6) & 0x3F));
+     bytes[3] = (unsigned char)(0x80 | (code & 0x3F));
+     return 4;
+ }
+ 
+ /* Value of the run containing code, in a table of run starts beginning at 0 */
+ static inline unsigned int runTableValue(const uint32_t* starts, const unsigned char* values, size_t count,
+                                          uint32_t code) {
+     size_t low = 0;
+     size_t high = count;  // starts[low] <= code < starts[high]
+     while (high - low > 1) {
+         size_t middle = low + (high - low) / 2;
+         if (starts[middle] <= code) {
+             low = middle;
+         } else {
+             high = middle;
+         }
+     }
+     return values[low];
+ }
+ 
+ /* Index of key in a sorted table, or SIZE_MAX */
+ static inline size_t findCodeKey(const uint32_t* keys, size_t count, uint32_t key) {
+     size_t low = 0;
+     size_t high = count;
+     while (low < high) {
+         size_t middle = low + (high - low) / 2;
+         if (keys[middle] < key) {
+             low = middle + 1;
+         } else {
+             high = middle;
+         }
+     }
+     return low < count && keys[low] == key ? low : SIZE_MAX;
+ }
+ 
+ /* UNICODE_CLASS_* bits of a code point */
+ static inline unsigned int unicodeClass(uint32_t code) {
+     if (code < 0x80) {
+         unsigned int classes = asciiClassTable[code] | UNICODE_CLASS_STABLE;
+         return (classes & CLASS_ALPHA) != 0 ? classes | UNICODE_CLASS_LETTER : classes;
+     }
+     return runTableValue(unicodeClassStarts, unicodeClassValues,
+                          sizeof(unicodeClassStarts) / sizeof(unicodeClassStarts[0]), code);
+ }
+ 
+ /* Canonical combining class of a code point; 0 for starters */
+ static inline unsigned int combiningClass(uint32_t code) {
+     if (code < 0x300) {
+         return 0;
+     }
+     return runTableValue(combiningClassStarts, combiningClassValues,
+                          sizeof(combiningClassStarts) / sizeof(combiningClassStarts[0]), code);
+ }
+ 
+ /* Simple lowercase mapping of a code point */
+ static inline uint32_t lowercaseCode(uint32_t code) {
+     if (code < 0x80) {
+         return asciiFoldTable[code];
+     }
+     size_t index = findCodeKey(lowercaseKeys, sizeof(lowercaseKeys) / sizeof(lowercaseKeys[0]), code);
+     return index != SIZE_MAX ? lowercaseValues[index] : code;
+ }
+ 
+ /**
+  * @brief Replaces every code point with its full compatibility decomposition
+  *
+  * @param codes Decoded code points
+  * @param count Number of code points
+  * @param out Room for UNICODE_MAX_DECOMPOSED_PER_BYTE code points per input byte
+  * @return Number of code points written to out
+  */
+ static size_t decomposeNfkd(const uint32_t* codes, size_t count, uint32_t* out) {
+     size_t written = 0;
+     for (size_t i = 0; i < count; i++) {
+         uint32_t code = codes[i];
+         if (code < 0xA0) {
+             out[written++] = code;  // Nothing below NO-BREAK SPACE decomposes
+             continue;
+         }
+         
+         uint32_t syllable = code - HANGUL_S_BASE;
+         if (syllable < HANGUL_S_COUNT) {
+             out[written++] = HANGUL_L_BASE + syllable / HANGUL_N_COUNT;
+             out[written++] = HANGUL_V_BASE + syllable % HANGUL_N_COUNT / HANGUL_T_COUNT;
+             if (syllable % HANGUL_T_COUNT != 0) {
+                 out[written++] = HANGUL_T_BASE + syllable % HANGUL_T_COUNT;
+             }
+             continue;
+         }
+         
+         size_t index = findCodeKey(decompositionKeys, sizeof(decompositionKeys) / sizeof(decompositionKeys[0]), code);
+         if (index == SIZE_MAX) {
+             out[written++] = code;
+             continue;
+         }
+         for (size_t k = decompositionStarts[index]; k < decompositionStarts[index + 1]; k++) {
+             out[written++] = decompositionData[k];
+         }
+     }
+     return written;
+ }
+ 
+ /**
+  * @brief Sorts every run of combining marks by combining class, keeping equal classes in order
+  *
+  * Short runs use insertion sort; longer ones, which only adversarial
+  * input contains, a counting sort in arena memory so the cost stays
+  * linear.
+  *
+  * @return false if the arena could not provide memory for a long run
+  */
+ static bool orderCombiningMarks(uint32_t* codes, size_t count, ScratchArena* arena) {
+     size_t i = 0;
+     while (i < count) {
+         if (combiningClass(codes[i]) == 0) {
+             i++;
+             continue;
+         }
+         size_t end = i + 1;
+         while (end < count && combiningClass(codes[end]) != 0) {
+             end++;
+         }
+         
+         if (end - i <= MARK_RUN_INSERTION_LIMIT) {
+             for (size_t k = i + 1; k < end; k++) {
+                 uint32_t code = codes[k];
+                 unsigned int codeClass = combiningClass(code);
+                 size_t j = k;
+                 while (j > i && combiningClass(codes[j - 1]) > codeClass) {
+                     codes[j] = codes[j - 1];
+                     j--;
+                 }
+                 codes[j] = code;
+             }
+         } else {
+             size_t runLength = end - i;
+             ScratchArenaMark mark = markScratchArena(arena);
+             uint32_t* sorted = arenaAllocate(arena, runLength * sizeof(uint32_t));
+             unsigned char* classes = arenaAllocate(arena, runLength);
+             if (sorted == NULL || classes == NULL) {
+                 releaseScratchArena(arena, mark);
+                 return false;
+             }
+             
+             size_t offsets[256] = {0};
+             for (size_t k = 0; k < runLength; k++) {
+                 classes[k] = (unsigned char)combiningClass(codes[i + k]);
+                 offsets[classes[k]]++;
+             }
+             size_t total = 0;
+             for (size_t c = 0; c < 256; c++) {
+                 size_t bucket = offsets[c];
+                 offsets[c] = total;
+                 total += bucket;
+             }
+             for (size_t k = 0; k < runLength; k++) {
+                 sorted[offsets[classes[k]]++] = codes[i + k];
+             }
+             memcpy(codes + i, sorted, runLength * sizeof(uint32_t));
+             releaseScratchArena(arena, mark);
+         }
+         i = end;
+     }
+     return true;
+ }
+ 
+ /* Primary composite of a starter and a following code point, or 0 */
+ static uint32_t composePair(uint32_t first, uint32_t second) {
+     uint32_t leading = first - HANGUL_L_BASE;
+     uint32_t vowel = second - HANGUL_V_BASE;
+     if (leading < HANGUL_L_COUNT && vowel < HANGUL_V_COUNT) {
+         return HANGUL_S_BASE + (leading * HANGUL_V_COUNT + vowel) * HANGUL_T_COUNT;
+     }
+     uint32_t syllable = first - HANGUL_S_BASE;
+     uint32_t trailing = second - HANGUL_T_BASE;
+     if (syllable < HANGUL_S_COUNT && syllable % HANGUL_T_COUNT == 0 && trailing - 1 < HANGUL_T_COUNT - 1) {
+         return first + trailing;
+     }
+     
+     uint64_t key = ((uint64_t)first << 21) | second;
+     size_t low = 0;
+     size_t high = sizeof(compositionKeys) / sizeof(compositionKeys[0]);
+     while (low < high) {
+         size_t middle = low + (high - low) / 2;
+         if (compositionKeys[middle] < key) {
+             low = middle + 1;
+         } else {
+             high = middle;
+         }
+     }
+     return low < sizeof(compositionKeys) / sizeof(compositionKeys[0]) && compositionKeys[low] == key
+                ? compositionValues[low] : 0;
+ }
+ 
+ /**
+  * @brief Canonically composes a decomposed, canonically ordered sequence in place
+  *
+  * A code point joins the last starter unless a code point between them
+  * has a combining class of 0 or at least its own.
+  *
+  * @return Number of code points left
+  */
+ static size_t composeCanonical(uint32_t* codes, size_t count) {
+     if (count == 0) {
+         return 0;
+     }
+     size_t starter = combiningClass(codes[0]) == 0 ? 0 : SIZE_MAX;
+     unsigned int lastClass = 0;
+     size_t written = 1;
+     
+     for (size_t i = 1; i < count; i++) {
+         uint32_t code = codes[i];
+         unsigned int codeClass = combiningClass(code);
+         bool adjacent = starter == written - 1;
+         if (starter != SIZE_MAX && (adjacent || (lastClass != 0 && lastClass < codeClass))) {
+             uint32_t composite = composePair(codes[starter], code);
+             if (composite != 0) {
+                 codes[starter] = composite;
+                 continue;
+             }
+         }
+         if (codeClass == 0) {
+             starter = written;
+         }
+         lastClass = codeClass;
+         codes[written++] = code;
+     }
+     return written;
+ }
+ 
+ /**
+  * @brief Decodes UTF-8 text into NFKC code points in arena memory
+  *
+  * @param text UTF-8 bytes
+  * @param length Number of bytes in text
+  * @param arena Arena the code points are allocated from
+  * @param codes Receives the normalized code points
+  * @return Number of code points, UTF8_INVALID or UTF8_NO_MEMORY
+  */
+ static size_t normalizeUtf8Codes(const char* text, size_t length, ScratchArena* arena, uint32_t** codes) {
+     if (length > SIZE_MAX / (sizeof(uint32_t) * (UNICODE_MAX_DECOMPOSED_PER_BYTE + 1))) {
+         return UTF8_NO_MEMORY;
+     }
+     uint32_t* decoded = arenaAllocate(arena, length * sizeof(uint32_t));
+     uint32_t* normalized = arenaAllocate(arena, length * UNICODE_MAX_DECOMPOSED_PER_BYTE * sizeof(uint32_t));
+     if (decoded == NULL || normalized == NULL) {
+         return UTF8_NO_MEMORY;
+     }
+     
+     size_t count = decodeUtf8(text, length, decoded);
+     if (count == UTF8_INVALID) {
+         return UTF8_INVALID;
+     }
+     
+     // Text made only of stable code points is already in NFKC
+     size_t stable = 0;
+     while (stable < count && (unicodeClass(decoded[stable]) & UNICODE_CLASS_STABLE) != 0) {
+         stable++;
+     }
+     if (stable == count) {
+         *codes = decoded;
+         return count;
+     }
+     
+     count = decomposeNfkd(decoded, count, normalized);
+     if (!orderCombiningMarks(normalized, count, arena)) {
+         return UTF8_NO_MEMORY;
+     }
+     *codes = normalized;
+     return composeCanonical(normalized, count);
+ }
+ 
+ /**
+  * @brief Normalizes UTF-8 text to Unicode Normalization Form KC
+  *
+  * Useful for storing or fingerprinting passwords the way the UTF-8
+  * validators compare them. Works like snprintf(): the result is written
+  * only if it fits, without a terminator, and its length is returned
+  * either way. Scratch memory comes from the thread's arena.
+  *
+  * @param text UTF-8 bytes
+  * @param length Number of bytes in text
+  * @param out Output buffer
+  * @param capacity Bytes available in out
+  * @return Length of the normalized text, or SIZE_MAX if text is not valid UTF-8 or memory ran out
+  */
+ size_t normalizeUtf8Nfkc(const char* text, size_t length, char* out, size_t capacity) {
+     if (isAsciiBytes(text, length)) {
+         if (length <= capacity) {
+             memcpy(out, text, length);
+         }
+         return length;
+     }
+     
+     ScratchArena* arena = threadScratchArena();
+     ScratchArenaMark mark = markScratchArena(arena);
+     uint32_t* codes = NULL;
+     size_t count = normalizeUtf8Codes(text, length, arena, &codes);
+     size_t written = SIZE_MAX;
+     if (count != UTF8_INVALID && count != UTF8_NO_MEMORY) {
+         char encoded[4];
+         written = 0;
+         for (size_t i = 0; i < count; i++) {
+             size_t width = encodeUtf8(codes[i], encoded);
+             if (written + width <= capacity) {
+                 memcpy(out + written, encoded, width);
+             }
+             written += width;
+         }
+     }
+     releaseScratchArena(arena, mark);
+     return written;
+ }
+ 
+ /**
+  * @brief Fills a feature record from normalized code points
+  *
+  * A combining mark adds nothing to the character it follows; one at
+  * the start counts as a special character.
+  */
+ static void classifyCodes(const uint32_t* codes, size_t count, PasswordFeatures* features) {
+     size_t characters = 0;
+     size_t alphaRun = 0;
+     size_t longestAlphaRun = 0;
+     unsigned int classes = 0;
+     bool hasNonAlnum = false;
+     
+     for (size_t i = 0; i < count; i++) {
+         unsigned int codeClass = unicodeClass(codes[i]);
+         if ((codeClass & UNICODE_CLASS_MARK) != 0 && characters > 0) {
+             continue;
+         }
+         characters++;
+         classes |= codeClass & CLASS_REQUIRED;
+         if ((codeClass & UNICODE_CLASS_LETTER) != 0) {
+             alphaRun++;
+             longestAlphaRun = alphaRun > longestAlphaRun ? alphaRun : longestAlphaRun;
+         } else {
+             alphaRun = 0;
+             hasNonAlnum |= (codeClass & UNICODE_CLASS_DIGIT) == 0;
+         }
+     }
+     
+     features->length = characters;
+     features->classes = classes;
+     features->longestAlphaRun = longestAlphaRun;
+     features->hasNonAlnum = hasNonAlnum;
+ }
+ 
+ /**
+  * @brief Scans a UTF-8 password and records its composition features
+  *
+  * Like classifyPasswordBytes() but on the NFKC form, with lengths in
+  * characters and classes taken from the Unicode general categories.
+  *
+  * @param pwd UTF-8 password bytes
+  * @param length Number of bytes in pwd
+  * @param features Output record
+  * @return false if the password is not valid UTF-8 or scratch memory ran out
+  */
+ bool classifyPasswordUtf8(const char* pwd, size_t length, PasswordFeatures* features) {
+     if (isAsciiBytes(pwd, length)) {
+         classifyPasswordBytes(pwd, length, features);
+         return true;
+     }
+     
+     ScratchArena* arena = threadScratchArena();
+     ScratchArenaMark mark = markScratchArena(arena);
+     uint32_t* codes = NULL;
+     size_t count = normalizeUtf8Codes(pwd, length, arena, &codes);
+     bool classified = count != UTF8_INVALID && count != UTF8_NO_MEMORY;
+     if (classified) {
+         classifyCodes(codes, count, features);
+     }
+     releaseScratchArena(arena, mark);
+     return classified;
+ }
+ 
+ /**
+  * @brief Case-insensitive search for one code point sequence in another
+  *
+  * Lowercases both sequences in place, then runs Knuth-Morris-Pratt.
+  *
+  * @return true if word occurs in text, or if the failure table could not be allocated
+  */
+ static bool codesContainFolded(uint32_t* text, size_t textCount, uint32_t* word, size_t wordCount,
+                                ScratchArena* arena) {
+     if (wordCount == 0 || wordCount > textCount) {
+         return false;
+     }
+     size_t* failure = arenaAllocate(arena, wordCount * sizeof(size_t));
+     if (failure == NULL) {
+         return true;  // Fail closed, as containsUsernameBytes() does
+     }
+     for (size_t i = 0; i < textCount; i++) {
+         text[i] = lowercaseCode(text[i]);
+     }
+     for (size_t i = 0; i < wordCount; i++) {
+         word[i] = lowercaseCode(word[i]);
+     }
+     
+     failure[0] = 0;
+     for (size_t i = 1, k = 0; i < wordCount; i++) {
+         while (k > 0 && word[i] != word[k]) {
+             k = failure[k - 1];
+         }
+         if (word[i] == word[k]) {
+             k++;
+         }
+         failure[i] = k;
+     }
+     for (size_t i = 0, k = 0; i < textCount; i++) {
+         while (k > 0 && text[i] != word[k]) {
+             k = failure[k - 1];
+         }
+         if (text[i] == word[k] && ++k == wordCount) {
+             return true;
+         }
+     }
+     return false;
+ }
+ 
+ /**
+  * @brief Lists every strong password rule a UTF-8 password fails
+  *
+  * The strong rules applied to the NFKC forms of both strings, with the
+  * username compared case-insensitively by simple lowercase mapping.
+  * When both are pure ASCII this is strongPasswordFailuresBytes().
+  * A password that is not valid UTF-8 gets RULE_INVALID_UTF8 alone; a
+  * username that is not valid UTF-8 is searched for byte by byte. If
+  * scratch memory runs out the password is rejected with RULE_TOO_LONG.
+  *
+  * @param username Username bytes
+  * @param usernameLength Number of bytes in username
+  * @param password UTF-8 password bytes to validate
+  * @param passwordLength Number of bytes in password
+  * @return Mask of RULE_* bits, 0 if the password is strong
+  */
+ unsigned int strongPasswordFailuresUtf8(const char* username, size_t usernameLength,
+                                         const char* password, size_t passwordLength) {
+     if (isAsciiBytes(password, passwordLength) && isAsciiBytes(username, usernameLength)) {
+         return strongPasswordFailuresBytes(username, usernameLength, password, passwordLength);
+     }
+     
+     uint64_t start;
+     StatsThread* stats = beginStatsCheck(&start);
+     ScratchArena* arena = threadScratchArena();
+     ScratchArenaMark mark = markScratchArena(arena);
+     uint32_t* passwordCodes = NULL;
+     uint32_t* usernameCodes = NULL;
+     size_t passwordCount = normalizeUtf8Codes(password, passwordLength, arena, &passwordCodes);
+     size_t usernameCount = passwordCount < UTF8_NO_MEMORY
+                                ? normalizeUtf8Codes(username, usernameLength, arena, &usernameCodes)
+                                : 0;
+     
+     unsigned int failures;
+     if (passwordCount == UTF8_INVALID) {
+         failures = RULE_INVALID_UTF8;
+     } else if (passwordCount == UTF8_NO_MEMORY || usernameCount == UTF8_NO_MEMORY) {
+         failures = RULE_TOO_LONG;
+     } else {
+         PasswordFeatures features;
+         classifyCodes(passwordCodes, passwordCount, &features);
+         failures = strongRuleFailures(&features);
+         bool found = usernameCount == UTF8_INVALID
+                          ? containsUsernameBytes(username, usernameLength, password, passwordLength)
+                          : codesContainFolded(passwordCodes, passwordCount, usernameCodes, usernameCount, arena);
+         if (found) {
+             failures |= RULE_CONTAINS_USERNAME;
+         }
+     }
+     releaseScratchArena(arena, mark);
+     endStatsCheck(stats, start, failures);
+     return failures;
+ }
+ 
+ /**
+  * @brief Validates a UTF-8 password against the strong criteria
+  *
+  * @param username User's username
+  * @param password UTF-8 password to validate
+  * @return true if strongPasswordFailuresUtf8() finds no failure
+  */
+ bool isStrongPasswordUtf8(const char* username, const char* password) {
+     return strongPasswordFailuresUtf8(username, strlen(username), password, strlen(password)) == 0;
+ }
+ 
+ /*
+  * Constant-time validation
+  *
+  * strongPasswordFailuresConstantTime() computes the strong password mask
+  * with a fixed amount of work: it always visits CONSTANT_TIME_MAX_LENGTH
+  * positions, compares the username at every one of them, and combines
+  * the results with arithmetic masks instead of branches or table
+  * lookups. Neither the time taken nor the addresses touched depend on
+  * the password's contents or on which rule failed; the length only
+  * decides which of the password's own bytes are loaded. The username is
+  * treated as public. Passwords longer than CONSTANT_TIME_MAX_LENGTH are
+  * rejected up front, which reveals only that the cap was exceeded.
+  * Statistics are not recorded, since the per-rule counters would branch
+  * on the result.
+  */
+ 
+ /* All ones if x < y, else 0; both must be below 2^31 */
+ static inline uint32_t ctLess(uint32_t x, uint32_t y) {
+     return 0u - ((x - y) >> 31);
+ }
+ 
+ /* All ones if x is 0, else 0 */
+ static inline uint64_t ctIsZero(uint64_t x) {
+     return 0u - (((x | (0u - x)) >> 63) ^ 1u);
+ }
+ 
+ /* High bit of each byte set where low <= byte <= high; bytes of 0x80 and above never match */
+ static inline uint64_t ctBytesInRange(uint64_t bytes, unsigned char low, unsigned char high) {
+     const uint64_t ones = UINT64_C(0x0101010101010101);
+     uint64_t low7 = bytes & ones * 0x7F;           // Adding below cannot carry between bytes
+     uint64_t atLeastLow = low7 + ones * (0x80 - low);
+     uint64_t aboveHigh = low7 + ones * (0x7F - high);
+     return atLeastLow & ~aboveHigh & ~bytes & ones * 0x80;
+ }
+ 
+ /* Packs the high bit of each byte into bit 0..7 */
+ static inline uint64_t ctByteBits(uint64_t highBits) {
+     return ((highBits >> 7) * UINT64_C(0x0102040810204080)) >> 56;
+ }
+ 
+ /**
+  * @brief Lists every strong password rule a password fails, in constant time
+  *
+  * Same mask as strongPasswordFailuresBytes() for passwords of up to
+  * CONSTANT_TIME_MAX_LENGTH bytes; longer ones return RULE_TOO_LONG. Takes
+  * several times longer than the fast path, so use it where response time
+  * is observable by an attacker.
+  *
+  * @param username Username bytes
+  * @param usernameLength Number of bytes in username
+  * @param password Password bytes to validate
+  * @param passwordLength Number of bytes in password
+  * @return Mask of RULE_* bits, 0 if the password is strong
+  */
+ unsigned int strongPasswordFailuresConstantTime(const char* username, size_t usernameLength,
+                                                 const char* password, size_t passwordLength) {
+     if (passwordLength > CONSTANT_TIME_MAX_LENGTH) {
+         return RULE_TOO_LONG;
+     }
+     
+     enum { WORDS = CONSTANT_TIME_MAX_LENGTH / 8 };
+     static const unsigned char empty = 0;
+     const unsigned char* bytes = passwordLength > 0 ? (const unsigned char*)password : &empty;
+     uint32_t length = (uint32_t)passwordLength;
+     uint64_t padded[WORDS];
+     uint64_t folded[2 * WORDS];                    // Zero upper half lets every window be read
+     
+     for (uint32_t i = 0; i < CONSTANT_TIME_MAX_LENGTH; i++) {
+         uint32_t inside = ctLess(i, length);
+         ((unsigned char*)padded)[i] = (unsigned char)(bytes[i & inside] & inside);  // Past the end, load byte 0 and drop it
+     }
+     
+     // Bit i of each mask describes password byte i
+     uint64_t upper = 0;
+     uint64_t lower = 0;
+     uint64_t digit = 0;
+     for (uint32_t w = 0; w < WORDS; w++) {
+         uint64_t isUpper = ctBytesInRange(padded[w], 'A', 'Z');
+         upper |= ctByteBits(isUpper) << (8 * w);
+         lower |= ctByteBits(ctBytesInRange(padded[w], 'a', 'z')) << (8 * w);
+         digit |= ctByteBits(ctBytesInRange(padded[w], '0', '9')) << (8 * w);
+         folded[w] = padded[w] | (isUpper >> 2);
+         folded[WORDS + w] = 0;
+     }
+     uint64_t inside = (((uint64_t)1 << (length & 63)) - 1) | (0u - (uint64_t)(length >> 6));
+     uint64_t letters = upper | lower;
+     uint64_t other = inside & ~(letters | digit);
+     uint64_t letterRuns = letters;
+     for (uint32_t k = 1; k < MIN_CONSECUTIVE_LETTERS; k++) {
+         letterRuns &= letters >> k;
+     }
+     
+     // The username is public, so the work may depend on its length
+     uint32_t nameLength = usernameLength <= CONSTANT_TIME_MAX_LENGTH ? (uint32_t)usernameLength : 0;
+     uint64_t name[WORDS] = {0};
+     uint64_t nameMask[WORDS] = {0};
+     for (uint32_t j = 0; j < nameLength; j++) {
+         ((unsigned char*)name)[j] = asciiFoldTable[(unsigned char)username[j]];
+         ((unsigned char*)nameMask)[j] = 0xFF;
+     }
+     uint32_t nameWords = (nameLength + 7) / 8;
+     
+     uint64_t found = 0;
+     for (uint32_t start = 0; start < CONSTANT_TIME_MAX_LENGTH; start++) {
+         uint64_t differ = 0;
+         for (uint32_t w = 0; w < nameWords; w++) {
+             uint64_t window;
+             memcpy(&window, (const unsigned char*)folded + start + 8 * w, sizeof(window));
+             differ |= (window ^ name[w]) & nameMask[w];
+         }
+         found |= ctIsZero(differ) & ctLess(start + nameLength, length + 1);
+     }
+     found &= ~ctIsZero(nameLength);
+     
+     unsigned int failures = (RULE_TOO_SHORT & ctLess(length, STRONG_MIN_LENGTH)) |
+                             (RULE_MISSING_UPPER & ctIsZero(upper)) |
+                             (RULE_MISSING_LOWER & ctIsZero(lower)) |
+                             (RULE_MISSING_DIGIT & ctIsZero(digit)) |
+                             (RULE_SPECIAL_CHARACTER & ~ctIsZero(other)) |
+                             (RULE_NO_LETTER_RUN & ctIsZero(letterRuns)) |
+                             (RULE_CONTAINS_USERNAME & found);
+     
+     volatile uint64_t* wipePadded = padded;
+     volatile uint64_t* wipeFolded = folded;
+     for (uint32_t w = 0; w < WORDS; w++) {
+         wipePadded[w] = 0;
+         wipeFolded[w] = 0;
+     }
+     return failures;
+ }
+ 
+ /**
+  * @brief Validates a password against strong password criteria in constant time
+  *
+  * @param username Username bytes
+  * @param usernameLength Number of bytes in username
+  * @param password Password bytes to validate
+  * @param passwordLength Number of bytes in password
+  * @return true if password meets all criteria, false otherwise
+  */
+ bool isStrongPasswordConstantTime(const char* username, size_t usernameLength,
+                                   const char* password, size_t passwordLength) {
+     return strongPasswordFailuresConstantTime(username, usernameLength, password, passwordLength) == 0;
+ }
+ 
+ /**
+  * @brief Validates a password against strong password criteria using a prebuilt matcher
+  *
+  * Equivalent to isStrongPassword() but reuses the username search table,
+  * which is cheaper when checking many candidate passwords for one account.
+  * As in isStrongPasswordBytes(), the username is always searched for while
+  * statistics are enabled.
+  *
+  * @param matcher Matcher built from the user's username
+  * @param password Password to validate
+  * @return true if password meets all criteria, false otherwise
+  */
+ bool isStrongPasswordWithMatcher(const UsernameMatcher* matcher, const char* password) {
+     uint64_t start;
+     StatsThread* stats = beginStatsCheck(&start);
+     PasswordFeatures features;
+     classifyPassword(password, &features);
+     
+     unsigned int failures = strongRuleFailures(&features);
+     if ((failures == 0 || stats != NULL) && matcherFindsUsername(matcher, password)) {
+         failures |= RULE_CONTAINS_USERNAME;
+     }
+     endStatsCheck(stats, start, failures);
+     return failures == 0;
+ }
+ 
+ /**
+  * @brief Lists every default password rule a password fails
+  *
+  * @param username User's username (unused but kept for API consistency)
+  * @param password Password to validate
+  * @return Mask of RULE_* bits, 0 if the password meets the default criteria
+  */
+ unsigned int defaultPasswordFailures(const char* username, const char* password) {
+     (void)username;
+     PasswordFeatures features;
+     classifyPassword(password, &features);
+     
+     return defaultRuleFailures(&features);
+ }
+ 
+ /**
+  * @brief Validates if a password meets default password criteria
+  * 
+  * A default password must:
+  * - Be 15 characters or fewer
+  * - Contain at least one uppercase letter
+  * - Contain at least one lowercase letter
+  * - Contain at least one digit
+  * - Contain only alphanumeric characters
+  *
+  * @param username User's username (unused but kept for API consistency)
+  * @param password Password to validate
+  * @return true if password meets all criteria, false otherwise
+  */
+ bool isStrongDefaultPassword(const char* username, const char* password) {
+     return defaultPasswordFailures(username, password) == 0;
+ }
+ 
+ /**
+  * @brief Validates many passwords stored in one packed buffer
+  *
+  * Password i occupies lengths[i] bytes starting at buffer + offsets[i] and
+  * does not need to be NUL-terminated. It is checked against the strong
+  * password criteria with usernames[i]; consecutive entries that share the
+  * same username pointer reuse one search table, and the tables of long
+  * usernames come from the thread's scratch arena for the duration of the
+  * batch. The result for password i is bit (i % 8) of results[i / 8], set
+  * when the password is strong. The results array must hold at least
+  * (count + 7) / 8 bytes. Statistics count every password as one check,
+  * with the same complete mask validatePasswordBatchFailures() reports.
+  *
+  * @param buffer Packed password bytes
+  * @param offsets Start offset of each password within buffer
+  * @param lengths Length of each password in bytes
+  * @param usernames Username to check each password against
+  * @param count Number of passwords
+  * @param results Output bitmap of strong passwords
+  */
+ void validatePasswordBatch(const char* buffer, const size_t* offsets, const size_t* lengths,
+                            const char* const* usernames, size_t count, unsigned char* results) {
+     ScratchArena* arena = threadScratchArena();
+     ScratchArenaMark mark = markScratchArena(arena);
+     UsernameMatcher matcher;
+     const char* matcherUsername = NULL;
+     bool matcherReady = false;
+     
+     memset(results, 0, (count + 7) / 8);
+     
+     for (size_t i = 0; i < count; i++) {
+         const char* password = buffer + offsets[i];
+         uint64_t start;
+         StatsThread* stats = beginStatsCheck(&start);
+         PasswordFeatures features;
+         
+         classifyPasswordBytes(password, lengths[i], &features);
+         unsigned int failures = strongRuleFailures(&features);
+         if (failures == 0 || stats != NULL) {
+             if (usernames[i] != matcherUsername) {
+                 matcherUsername = usernames[i];
+                 matcherReady = initUsernameMatcherArena(&matcher, matcherUsername, strlen(matcherUsername), arena);
+             }
+             
+             // A username whose table could not be built fails closed
+             if (!matcherReady || matcherFindsUsernameBytes(&matcher, password, lengths[i])) {
+                 failures |= RULE_CONTAINS_USERNAME;
+             }
+         }
+         endStatsCheck(stats, start, failures);
+         
+         if (failures == 0) {
+             results[i / 8] |= (unsigned char)(1u << (i % 8));
+         }
+     }
+     
+     releaseScratchArena(arena, mark);
+ }
+ 
+ /**
+  * @brief Lists the failed strong password rules of many packed passwords
+  *
+  * Same layout and username reuse as validatePasswordBatch(), but instead
+  * of a bitmap it writes the complete RULE_* mask of password i to
+  * failures[i], so callers can explain every rejection without running the
+  * checks again. A username whose search table cannot be built is reported
+  * as RULE_CONTAINS_USERNAME. Statistics count every password as one check.
+  *
+  * @param buffer Packed password bytes
+  * @param offsets Start offset of each password within buffer
+  * @param lengths Length of each password in bytes
+  * @param usernames Username to check each password against
+  * @param count Number of passwords
+  * @param failures Output mask per password, 0 when strong
+  */
+ void validatePasswordBatchFailures(const char* buffer, const size_t* offsets, const size_t* lengths,
+                                    const char* const* usernames, size_t count, uint16_t* failures) {
+     ScratchArena* arena = threadScratchArena();
+     ScratchArenaMark mark = markScratchArena(arena);
+     UsernameMatcher matcher;
+     const char* matcherUsername = NULL;
+     bool matcherReady = false;
+     
+     for (size_t i = 0; i < count; i++) {
+         const char* password = buffer + offsets[i];
+         uint64_t start;
+         StatsThread* stats = beginStatsCheck(&start);
+         PasswordFeatures features;
+         
+         classifyPasswordBytes(password, lengths[i], &features);
+         unsigned int mask = strongRuleFailures(&features);
+         
+         if (usernames[i] != matcherUsername) {
+             matcherUsername = usernames[i];
+             matcherReady = initUsernameMatcherArena(&matcher, matcherUsername, strlen(matcherUsername), arena);
+         }
+         
+         if (!matcherReady || matcherFindsUsernameBytes(&matcher, password, lengths[i])) {
+             mask |= RULE_CONTAINS_USERNAME;
+         }
+         endStatsCheck(stats, start, mask);
+         failures[i] = (uint16_t)mask;
+     }
+     
+     releaseScratchArena(arena, mark);
+ }
+ 
+ /*
+  * Configurable password policies
+  *
+  * A PasswordPolicy describes one tenant's rules. compilePasswordPolicy()
+  * turns it into a CompiledPolicy once: the allowed character set becomes
+  * a 256-entry byte table, unbounded limits become SIZE_MAX, and a
+  * classification kernel is chosen for the policy's shape. Policies that
+  * allow no symbols, or every symbol, run on the same vectorized
+  * classifier as the built-in validators; only policies with a specific
+  * symbol whitelist need the table-driven scan. Validating a password is
+  * then one pass plus fixed comparisons, with nothing re-read from the
+  * configuration.
+  */
+ 
+ /* Byte table flag for characters a compiled policy rejects */
+ #define BYTE_DISALLOWED 0x80
+ 
+ /* Fills features for a policy; hasNonAlnum is set when a disallowed byte is present */
+ typedef void (*PolicyClassifyKernel)(const CompiledPolicy* policy, const char* pwd, size_t length,
+                                      PasswordFeatures* features);
+ 
+ struct CompiledPolicy {
+     size_t minLength;
+     size_t maxLength;                // SIZE_MAX when unbounded
+     unsigned int requiredClasses;
+     size_t minLetterRun;
+     bool rejectUsername;
+     PolicyClassifyKernel classify;   // Kernel specialized for the allowed character set
+     unsigned char byteTable[256];    // CLASS_* bits, or BYTE_DISALLOWED
+ };
+ 
+ /**
+  * @brief Kernel for policies that allow only letters and digits
+  */
+ static void classifyForStrictPolicy(const CompiledPolicy* policy, const char* pwd, size_t length,
+                                     PasswordFeatures* features) {
+     (void)policy;
+     classifyPasswordBytes(pwd, length, features);
+ }
+ 
+ /**
+  * @brief Kernel for policies that allow every byte
+  */
+ static void classifyForOpenPolicy(const CompiledPolicy* policy, const char* pwd, size_t length,
+                                   PasswordFeatures* features) {
+     (void)policy;
+     classifyPasswordBytes(pwd, length, features);
+     features->hasNonAlnum = false;
+ }
+ 
+ /**
+  * @brief Kernel for policies with a symbol whitelist, driven by the compiled byte table
+  */
+ static void classifyForCharsetPolicy(const CompiledPolicy* policy, const char* pwd, size_t length,
+                                      PasswordFeatures* features) {
+     unsigned int flags = 0;
+     size_t alphaRun = 0;
+     size_t longestAlphaRun = 0;
+     
+     for (size_t i = 0; i < length; i++) {
+         unsigned int byteFlags = policy->byteTable[(unsigned char)pwd[i]];
+         
+         flags |= byteFlags;
+         if (byteFlags & CLASS_ALPHA) {
+             alphaRun++;
+             if (alphaRun > longestAlphaRun) {
+                 longestAlphaRun = alphaRun;
+             }
+         } else {
+             alphaRun = 0;
+         }
+     }
+     
+     features->length = length;
+     features->classes = flags & CLASS_REQUIRED;
+     features->longestAlphaRun = longestAlphaRun;
+     features->hasNonAlnum = (flags & BYTE_DISALLOWED) != 0;
+ }
+ 
+ /**
+  * @brief Prepares a policy for repeated validation
+  *
+  * @param policy Rules to compile; allowedSymbols is copied and need not outlive the call
+  * @return The compiled policy (release with freeCompiledPolicy()), or NULL
+  *         if the policy is contradictory (minimum above maximum, or unknown
+  *         class bits) or memory runs out
+  */
+ CompiledPolicy* compilePasswordPolicy(const PasswordPolicy* policy) {
+     if ((policy->requiredClasses & ~(unsigned int)CLASS_REQUIRED) != 0 ||
+         (policy->maxLength != 0 && policy->minLength > policy->maxLength)) {
+         return NULL;
+     }
+     CompiledPolicy* compiled = malloc(sizeof(CompiledPolicy));
+     if (compiled == NULL) {
+         return NULL;
+     }
+     
+     compiled->minLength = policy->minLength;
+     compiled->maxLength = policy->maxLength != 0 ? policy->maxLength : SIZE_MAX;
+     compiled->requiredClasses = policy->requiredClasses;
+     compiled->minLetterRun = policy->minLetterRun;
+     compiled->rejectUsername = policy->rejectUsername;
+     
+     bool hasSymbols = policy->allowedSymbols != NULL && policy->allowedSymbols[0] != '\0';
+     for (int b = 0; b < 256; b++) {
+         unsigned char charClass = asciiClassTable[b];
+         compiled->byteTable[b] = (charClass != 0 || policy->allowAnySymbol) ? charClass : BYTE_DISALLOWED;
+     }
+     if (hasSymbols && !policy->allowAnySymbol) {
+         for (const char* c = policy->allowedSymbols; *c != '\0'; c++) {
+             compiled->byteTable[(unsigned char)*c] = asciiClassTable[(unsigned char)*c];
+         }
+     }
+     
+     if (policy->allowAnySymbol) {
+         compiled->classify = classifyForOpenPolicy;
+     } else if (hasSymbols) {
+         compiled->classify = classifyForCharsetPolicy;
+     } else {
+         compiled->classify = classifyForStrictPolicy;
+     }
+     return compiled;
+ }
+ 
+ /**
+  * @brief Releases a policy from compilePasswordPolicy()
+  *
+  * @param policy Policy to free; NULL is ignored
+  */
+ void freeCompiledPolicy(CompiledPolicy* policy) {
+     free(policy);
+ }
+ 
+ /**
+  * @brief Describes one RULE_* bit of a compiled policy for display to the user
+  *
+  * Length and letter-run failures quote the policy's own limits, and
+  * RULE_SPECIAL_CHARACTER lists the symbols it allows; every other bit
+  * reads as in ruleFailureMessage(). Longer text is truncated.
+  *
+  * @param policy Policy from compilePasswordPolicy() that reported the failure
+  * @param rule A single RULE_* bit
+  * @param buffer Receives the NUL-terminated description
+  * @param size Size of buffer in bytes, at least 1; RULE_MESSAGE_SIZE fits every message but a long symbol list
+  * @return buffer
+  */
+ const char* policyRuleFailureMessage(const CompiledPolicy* policy, unsigned int rule, char* buffer, size_t size) {
+     switch (rule) {
+         case RULE_TOO_SHORT:
+             snprintf(buffer, size, "must be at least %zu characters long", policy->minLength);
+             break;
+         case RULE_TOO_LONG:
+             snprintf(buffer, size, "must be %zu characters or fewer", policy->maxLength);
+             break;
+         case RULE_NO_LETTER_RUN:
+             snprintf(buffer, size, "must contain at least %zu letters in a row", policy->minLetterRun);
+             break;
+         case RULE_SPECIAL_CHARACTER: {
+             char symbols[256];
+             size_t count = 0;
+             for (int b = 1; b < 256; b++) {
+                 if (asciiClassTable[b] == 0 && policy->byteTable[b] != BYTE_DISALLOWED) {
+                     symbols[count++] = (char)b;
+                 }
+             }
+             symbols[count] = '\0';
+             if (count == 0) {
+                 snprintf(buffer, size, "%s", ruleFailureMessage(rule));
+             } else {
+                 snprintf(buffer, size, "must contain only letters, digits and the symbols %s", symbols);
+             }
+             break;
+         }
+         default:
+             snprintf(buffer, size, "%s", ruleFailureMessage(rule));
+             break;
+     }
+     return buffer;
+ }
+ 
+ /**
+  * @brief Lists every rule of a compiled policy that a password of known length fails
+  *
+  * RULE_TOO_SHORT and RULE_TOO_LONG refer to the policy's own limits and
+  * RULE_SPECIAL_CHARACTER to any byte outside its allowed set. Statistics
+  * count the check like a strong one, under the same RULE_* bits.
+  *
+  * @param policy Policy from compilePasswordPolicy()
+  * @param username Username bytes; ignored unless the policy rejects usernames
+  * @param usernameLength Number of bytes in username
+  * @param password Password bytes to validate
+  * @param passwordLength Number of bytes in password
+  * @return Mask of RULE_* bits, 0 if the password satisfies the policy
+  */
+ unsigned int passwordPolicyFailuresBytes(const CompiledPolicy* policy,
+                                          const char* username, size_t usernameLength,
+                                          const char* password, size_t passwordLength) {
+     uint64_t start;
+     StatsThread* stats = beginStatsCheck(&start);
+     PasswordFeatures features;
+     policy->classify(policy, password, passwordLength, &features);
+     
+     unsigned int failures = missingClassFailures(features.classes | ~policy->requiredClasses);
+     if (features.length < policy->minLength) {
+         failures |= RULE_TOO_SHORT;
+     }
+     if (features.length > policy->maxLength) {
+         failures |= RULE_TOO_LONG;
+     }
+     if (features.hasNonAlnum) {
+         failures |= RULE_SPECIAL_CHARACTER;
+     }
+     if (features.longestAlphaRun < policy->minLetterRun) {
+         failures |= RULE_NO_LETTER_RUN;
+     }
+     if (policy->rejectUsername &&
+         containsUsernameBytes(username, usernameLength, password, passwordLength)) {
+         failures |= RULE_CONTAINS_USERNAME;
+     }
+     endStatsCheck(stats, start, failures);
+     return failures;
+ }
+ 
+ /**
+  * @brief Lists every rule of a compiled policy that a password fails
+  *
+  * @param policy Policy from compilePasswordPolicy()
+  * @param username User's username
+  * @param password Password to validate
+  * @return Mask of RULE_* bits, 0 if the password satisfies the policy
+  */
+ unsigned int passwordPolicyFailures(const CompiledPolicy* policy, const char* username, const char* password) {
+     return passwordPolicyFailuresBytes(policy, username, strlen(username), password, strlen(password));
+ }
+ 
+ /**
+  * @brief Checks a password against a compiled policy
+  *
+  * @return true if the password satisfies every rule of the policy
+  */
+ bool meetsPasswordPolicy(const CompiledPolicy* policy, const char* username, const char* password) {
+     return passwordPolicyFailures(policy, username, password) == 0;
+ }
+ 
+ /*
+  * Constructive default password generation
+  *
+  * The original generator drew a length in 1-15 and random characters, and
+  * retried until isStrongDefaultPassword() passed. That produces each length
+  * L with probability proportional to the fraction of valid strings of
+  * length L, and every valid string of a given length equally often. The
+  * tables below reproduce exactly that distribution without rejection:
+  * pick L, pick how many upper/lower/digit characters to use (weighted by
+  * how many valid strings have that composition), shuffle the class slots
+  * and fill each slot uniformly from its class.
+  */
+ 
+ /* Largest number of (upper, lower, digit) compositions of one length */
+ #define MAX_COMPOSITIONS (((DEFAULT_MAX_LENGTH - 1) * (DEFAULT_MAX_LENGTH - 2)) / 2)
+ 
+ typedef struct {
+     double lengthCdf[DEFAULT_MAX_LENGTH + 1];                         // Cumulative length weights
+     int compositionCount[DEFAULT_MAX_LENGTH + 1];
+     double compositionCdf[DEFAULT_MAX_LENGTH + 1][MAX_COMPOSITIONS];  // Cumulative, per length
+     unsigned char composition[DEFAULT_MAX_LENGTH + 1][MAX_COMPOSITIONS][3];
+ } GeneratorTables;
+ 
+ static GeneratorTables generatorTables;
+ 
+ /**
+  * @brief Fills the generator tables before main() runs
+  *
+  * A composition of nu upper, nl lower and nd digit characters of length L
+  * is weighted by L! / (nu! nl! nd!) * (26/62)^nu * (26/62)^nl * (10/62)^nd,
+  * the probability that L random characters have exactly that mix.
+  */
+ __attribute__((constructor))
+ static void buildGeneratorTables(void) {
+     const double letterShare = 26.0 / 62.0;
+     const double digitShare = 10.0 / 62.0;
+     double factorial[DEFAULT_MAX_LENGTH + 1];
+     double lengthTotal = 0.0;
+     
+     factorial[0] = 1.0;
+     for (int i = 1; i <= DEFAULT_MAX_LENGTH; i++) {
+         factorial[i] = factorial[i - 1] * i;
+     }
+     
+     generatorTables.lengthCdf[0] = 0.0;
+     for (int length = 1; length <= DEFAULT_MAX_LENGTH; length++) {
+         double compositionTotal = 0.0;
+         int count = 0;
+         
+         for (int nu = 1; nu <= length - 2; nu++) {
+             for (int nl = 1; nu + nl <= length - 1; nl++) {
+                 int nd = length - nu - nl;
+                 double weight = factorial[length] / (factorial[nu] * factorial[nl] * factorial[nd]) *
+                                 pow(letterShare, nu + nl) * pow(digitShare, nd);
+                 
+                 compositionTotal += weight;
+                 generatorTables.compositionCdf[length][count] = compositionTotal;
+                 generatorTables.composition[length][count][0] = (unsigned char)nu;
+                 generatorTables.composition[length][count][1] = (unsigned char)nl;
+                 generatorTables.composition[length][count][2] = (unsigned char)nd;
+                 count++;
+             }
+         }
+         
+         // Every length is drawn with probability 1/15 before rejection
+         lengthTotal += compositionTotal;
+         generatorTables.compositionCount[length] = count;
+         generatorTables.lengthCdf[length] = lengthTotal;
+     }
+ }
+ 
+ /*
+  * Buffered CSPRNG
+  *
+  * Random bytes come from a ChaCha20 keystream keyed from getrandom(). Each
+  * refill produces RANDOM_BUFFER_SIZE bytes at once and immediately replaces
+  * the key with the first 32 bytes of the new output (fast key erasure), so
+  * earlier output cannot be recovered from a later state.
+  *
+  * All generator state lives in a PasswordGenerator context that callers
+  * pass to the *From() generation functions, so each worker thread can own
+  * its own stream and never contend on a lock. createPasswordGenerator()
+  * keys a new context from the OS; initPasswordGenerator() rekeys one from
+  * the OS and seedPasswordGenerator() from a fixed seed, when a test needs
+  * reproducible output. The legacy functions use a lazily seeded per-thread
+  * default context.
+  *
+  * A forked child inherits every context byte for byte and would repeat
+  * the parent's passwords. The child side of a pthread_atfork() handler
+  * wipes the forking thread's default context and advances
+  * forkGeneration; an OS-keyed context that was keyed in an earlier
+  * generation takes a fresh key before its next password. Refills also
+  * compare the process id, which catches children created without the
+  * fork handlers (a raw clone()) at the next refill at the latest.
+  * Seeded contexts are left alone, since their output is meant to repeat.
+  */
+ 
+ #define RANDOM_BUFFER_SIZE 4096
+ #define CHACHA_BLOCK_SIZE 64
+ #define CHACHA_KEY_SIZE 32
+ 
+ struct PasswordGenerator {
+     uint32_t key[8];                           // Current ChaCha20 key
+     unsigned char buffer[RANDOM_BUFFER_SIZE];  // Buffered keystream
+     size_t position;                           // Next unused byte in buffer
+     bool seeded;                               // true once a key has been set
+     bool fromEntropy;                          // Keyed by initPasswordGenerator(), so rekeyed after fork()
+     unsigned int forkGeneration;               // Fork count of the process when keyed
+     pid_t processId;                           // Process that keyed it
+ };
+ 
+ static _Thread_local PasswordGenerator threadGenerator;
+ 
+ /* Number of fork() calls this process descends from, counted in each child */
+ static unsigned int forkGeneration;
+ 
+ #define ROTL32(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+ 
+ #define CHACHA_QUARTER_ROUND(a, b, c, d)           \
+     do {                                           \
+         a += b; d ^= a; d = ROTL32(d, 16);         \
+         c += d; b ^= c; b = ROTL32(b, 12);         \
+         a += b; d ^= a; d = ROTL32(d, 8);          \
+         c += d; b ^= c; b = ROTL32(b, 7);          \
+     } while (0)
+ 
+ /**
+  * @brief Computes one 64-byte ChaCha20 keystream block (RFC 8439, zero nonce)
+  *
+  * @param key 256-bit key
+  * @param counter Block counter
+  * @param out Receives the keystream block
+  */
+ static void chacha20Block(const uint32_t key[8], uint32_t counter, unsigned char out[CHACHA_BLOCK_SIZE]) {
+     uint32_t input[16] = {
+         0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+         key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+         counter, 0, 0, 0
+     };
+     uint32_t x[16];
+     
+     memcpy(x, input, sizeof(x));
+     for (int round = 0; round < 10; round++) {
+         CHACHA_QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+         CHACHA_QUARTER_ROUND(x[1], x[5], x[9], x[13]);
+         CHACHA_QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+         CHACHA_QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+         CHACHA_QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+         CHACHA_QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+         CHACHA_QUARTER_ROUND(x[2], x[7], x[8], x[13]);
+         CHACHA_QUARTER_ROUND(x[3], x[4], x[9], x[14]);
+     }
+     
+     for (int i = 0; i < 16; i++) {
+         uint32_t word = x[i] + input[i];
+         out[4 * i] = (unsigned char)word;
+         out[4 * i + 1] = (unsigned char)(word >> 8);
+         out[4 * i + 2] = (unsigned char)(word >> 16);
+         out[4 * i + 3] = (unsigned char)(word >> 24);
+     }
+ }
+ 
+ /**
+  * @brief Loads a ChaCha20 key from 32 little-endian bytes
+  */
+ static void loadChachaKey(uint32_t key[8], const unsigned char bytes[CHACHA_KEY_SIZE]) {
+     for (int i = 0; i < 8; i++) {
+         key[i] = (uint32_t)bytes[4 * i] | ((uint32_t)bytes[4 * i + 1] << 8) |
+                  ((uint32_t)bytes[4 * i + 2] << 16) | ((uint32_t)bytes[4 * i + 3] << 24);
+     }
+ }
+ 
+ /**
+  * @brief Wipes a generator's key and buffered output
+  *
+  * @param generator Generator to clear; it must be keyed again before reuse
+  */
+ static void clearPasswordGenerator(PasswordGenerator* generator) {
+     volatile unsigned char* bytes = (volatile unsigned char*)generator;
+     
+     for (size_t i = 0; i < sizeof(*generator); i++) {
+         bytes[i] = 0;
+     }
+ }
+ 
+ /**
+  * @brief Keys a generator from the operating system's entropy source
+  *
+  * getrandom() blocks until the kernel's pool is initialized; calls
+  * interrupted by a signal are retried.
+  *
+  * @param generator Generator to key
+  * @return true on success; false, with errno set and the generator left
+  *         unkeyed, if no entropy is available
+  */
+ bool initPasswordGenerator(PasswordGenerator* generator) {
+     unsigned char seed[CHACHA_KEY_SIZE];
+     size_t filled = 0;
+     
+     while (filled < sizeof(seed)) {
+         ssize_t got = getrandom(seed + filled, sizeof(seed) - filled, 0);
+         if (got < 0) {
+             if (errno == EINTR) {
+                 continue;
+             }
+             int error = errno;
+             memset(seed, 0, sizeof(seed));
+             generator->seeded = false;
+             errno = error;
+             return false;
+         }
+         filled += (size_t)got;
+     }
+     
+     loadChachaKey(generator->key, seed);
+     memset(seed, 0, sizeof(seed));
+     generator->position = RANDOM_BUFFER_SIZE;  // Force a refill on first use
+     generator->seeded = true;
+     generator->fromEntropy = true;
+     generator->forkGeneration = __atomic_load_n(&forkGeneration, __ATOMIC_RELAXED);
+     generator->processId = getpid();
+     return true;
+ }
+ 
+ /**
+  * @brief Allocates a generator keyed from the operating system's entropy source
+  *
+  * @return The generator (release with freePasswordGenerator()), or NULL if
+  *         memory or entropy is unavailable
+  */
+ PasswordGenerator* createPasswordGenerator(void) {
+     PasswordGenerator* generator = calloc(1, sizeof(PasswordGenerator));
+     if (generator != NULL && !initPasswordGenerator(generator)) {
+         int error = errno;
+         free(generator);
+         errno = error;
+         return NULL;
+     }
+     return generator;
+ }
+ 
+ /**
+  * @brief Keys a generator from the OS where a caller has no way to report failure
+  *
+  * Aborts if no entropy is available: silently falling back to a weak seed
+  * would make every generated password predictable.
+  */
+ static void initPasswordGeneratorOrAbort(PasswordGenerator* generator) {
+     if (!initPasswordGenerator(generator)) {
+         perror("getrandom");
+         abort();
+     }
+ }
+ 
+ /**
+  * @brief pthread_atfork() child handler: forgets the state copied from the parent
+  */
+ static void forgetGeneratorsAfterFork(void) {
+     __atomic_store_n(&forkGeneration, forkGeneration + 1, __ATOMIC_RELAXED);
+     clearPasswordGenerator(&threadGenerator);
+ }
+ 
+ __attribute__((constructor))
+ static void registerGeneratorForkHandler(void) {
+     pthread_atfork(NULL, NULL, forgetGeneratorsAfterFork);
+ }
+ 
+ /**
+  * @brief Keys a generator deterministically from a seed
+  *
+  * The same seed always yields the same sequence of passwords, which makes
+  * generator output reproducible in tests. Never use a fixed seed for real
+  * accounts; initPasswordGenerator() is the production entry point.
+  *
+  * @param generator Generator to key
+  * @param seed Seed value
+  */
+ void seedPasswordGenerator(PasswordGenerator* generator, uint64_t seed) {
+     unsigned char key[CHACHA_KEY_SIZE] = {0};
+     
+     for (int i = 0; i < 8; i++) {
+         key[i] = (unsigned char)(seed >> (8 * i));
+     }
+     
+     loadChachaKey(generator->key, key);
+     generator->position = RANDOM_BUFFER_SIZE;  // Force a refill on first use
+     generator->seeded = true;
+     generator->fromEntropy = false;
+ }
+ 
+ /**
+  * @brief Wipes and releases a generator from createPasswordGenerator()
+  *
+  * @param generator Generator to free; NULL is ignored
+  */
+ void freePasswordGenerator(PasswordGenerator* generator) {
+     if (generator != NULL) {
+         clearPasswordGenerator(generator);
+         free(generator);
+     }
+ }
+ 
+ /**
+  * @brief Refills a generator's buffer with fresh keystream and rotates its key
+  *
+  * An OS-keyed generator that finds itself in another process than the
+  * one that keyed it is keyed again first.
+  */
+ static void refillPasswordGenerator(PasswordGenerator* generator) {
+     if (generator->fromEntropy && generator->processId != getpid()) {
+         initPasswordGeneratorOrAbort(generator);
+     }
+     for (uint32_t block = 0; block < RANDOM_BUFFER_SIZE / CHACHA_BLOCK_SIZE; block++) {
+         chacha20Block(generator->key, block, generator->buffer + block * CHACHA_BLOCK_SIZE);
+     }
+     
+     loadChachaKey(generator->key, generator->buffer);
+     memset(generator->buffer, 0, CHACHA_KEY_SIZE);
+     generator->position = CHACHA_KEY_SIZE;
+ }
+ 
+ /**
+  * @brief Returns the calling thread's default generator, seeding it on first use
+  *
+  * Also seeds it again in a forked child. Aborts if no entropy is
+  * available.
+  */
+ PasswordGenerator* threadPasswordGenerator(void) {
+     if (!threadGenerator.seeded) {
+         initPasswordGeneratorOrAbort(&threadGenerator);
+     }
+     return &threadGenerator;
+ }
+ 
+ /**
+  * @brief Returns the next random byte of a generator
+  */
+ static inline unsigned char randomByte(PasswordGenerator* generator) {
+     if (generator->position == RANDOM_BUFFER_SIZE) {
+         refillPasswordGenerator(generator);
+     }
+     return generator->buffer[generator->position++];
+ }
+ 
+ /**
+  * @brief Returns a uniformly distributed integer in [0, bound)
+  *
+  * Scales one random byte by multiplication (Lemire's method) and rejects
+  * the few byte values that would bias the result, so the common path needs
+  * no division.
+  *
+  * @param generator Generator to draw from
+  * @param bound Exclusive upper bound, between 1 and 256
+  */
+ static unsigned int randomBelow(PasswordGenerator* generator, unsigned int bound) {
+     unsigned int product = randomByte(generator) * bound;
+     unsigned int fraction = product & 0xFF;
+     
+     if (fraction < bound) {
+         const unsigned int threshold = (256 - bound) % bound;
+         while (fraction < threshold) {
+             product = randomByte(generator) * bound;
+             fraction = product & 0xFF;
+         }
+     }
+     
+     return product >> 8;
+ }
+ 
+ /**
+  * @brief Returns a uniformly distributed double in [0, 1) with 53 random bits
+  *
+  * @param generator Generator to draw from
+  */
+ static double randomUnit(PasswordGenerator* generator) {
+     uint64_t bits = 0;
+     
+     for (int i = 0; i < 7; i++) {
+         bits = (bits << 8) | randomByte(generator);
+     }
+     
+     return (double)(bits >> 3) * (1.0 / 9007199254740992.0);
+ }
+ 
+ /**
+  * @brief Picks the index of a cumulative weight table hit by a uniform draw
+  *
+  * @param generator Generator to draw from
+  * @param cdf Ascending cumulative weights
+  * @param count Number of entries in cdf
+  * @return Index of the first entry greater than the draw
+  */
+ static int sampleCumulative(PasswordGenerator* generator, const double* cdf, int count) {
+     double target = randomUnit(generator) * cdf[count - 1];
+     int low = 0;
+     int high = count - 1;
+     
+     while (low < high) {
+         int mid = (low + high) / 2;
+         if (cdf[mid] > target) {
+             high = mid;
+         } else {
+             low = mid + 1;
+         }
+     }
+     
+     return low;
+ }
+ 
+ /**
+  * @brief Generates a default password from the given generator
+  * 
+  * Builds a random alphanumeric password that passes isStrongDefaultPassword()
+  * directly, in constant time, with the same output distribution as drawing
+  * random passwords of random length until one is valid. An OS-keyed
+  * generator copied into a forked child is keyed again first, and aborts
+  * the program if no entropy is available.
+  *
+  * @param generator Generator to draw from
+  * @param default_password Buffer to store the generated password (must be at least 16 bytes)
+  */
+ void generateDefaultPasswordFrom(PasswordGenerator* generator, char* default_password) {
+     if (generator->fromEntropy &&
+         generator->forkGeneration != __atomic_load_n(&forkGeneration, __ATOMIC_RELAXED)) {
+         initPasswordGeneratorOrAbort(generator);
+     }
+     // lengthCdf[0] is 0, so index 0 is never picked and no length is below 3
+     int passwordLength = sampleCumulative(generator, generatorTables.lengthCdf, DEFAULT_MAX_LENGTH + 1);
+     int pick = sampleCumulative(generator, generatorTables.compositionCdf[passwordLength],
+                                 generatorTables.compositionCount[passwordLength]);
+     const unsigned char* counts = generatorTables.composition[passwordLength][pick];
+     
+     // Lay out the class of every slot, then shuffle the slots (Fisher-Yates)
+     char classes[DEFAULT_MAX_LENGTH];
+     int slot = 0;
+     for (int c = 0; c < 3; c++) {
+         for (int n = 0; n < counts[c]; n++) {
+             classes[slot++] = (char)c;
+         }
+     }
+     for (int i = passwordLength - 1; i > 0; i--) {
+         int j = (int)randomBelow(generator, (unsigned int)i + 1);
+         char swap = classes[i];
+         classes[i] = classes[j];
+         classes[j] = swap;
+     }
+     
+     static const char classFirst[3] = {'A', 'a', '0'};
+     static const unsigned char classSize[3] = {26, 26, 10};
+     for (int i = 0; i < passwordLength; i++) {
+         int c = classes[i];
+         default_password[i] = (char)(classFirst[c] + randomBelow(generator, classSize[c]));
+     }
+     default_password[passwordLength] = '\0';
+     recordGeneratedPassword();
+ }
+
+ /**
+  * @brief Generates a secure default password meeting default password criteria
+  * 
+  * Creates a random alphanumeric password that passes isStrongDefaultPassword(),
+  * drawing from the calling thread's default generator.
+  *
+  * @param default_password Buffer to store the generated password (must be at least 16 bytes)
+  * @param username User's username (unused but kept for API consistency)
+  */
+ void generateDefaultPassword(char* default_password, const char* username) {
+     (void)username;
+     generateDefaultPasswordFrom(threadPasswordGenerator(), default_password);
+ }
+ 
+ /**
+  * @brief Generates many default passwords from the given generator
+  *
+  * Password i is written NUL-terminated at out_buffer + i * DEFAULT_PASSWORD_STRIDE.
+  *
+  * @param generator Generator to draw from
+  * @param count Number of passwords to generate
+  * @param out_buffer Buffer of at least count * DEFAULT_PASSWORD_STRIDE bytes
+  */
+ void generatePasswordBatchFrom(PasswordGenerator* generator, size_t count, char* out_buffer) {
+     for (size_t i = 0; i < count; i++) {
+         generateDefaultPasswordFrom(generator, out_buffer + i * DEFAULT_PASSWORD_STRIDE);
+     }
+ }
+ 
+ /**
+  * @brief Generates many default passwords into one preallocated buffer
+  *
+  * Password i is written NUL-terminated at out_buffer + i * DEFAULT_PASSWORD_STRIDE.
+  * All passwords are drawn from the calling thread's default generator, which
+  * refills in large blocks, so no system call is made per password.
+  *
+  * @param count Number of passwords to generate
+  * @param out_buffer Buffer of at least count * DEFAULT_PASSWORD_STRIDE bytes
+  */
+ void generatePasswordBatch(size_t count, char* out_buffer) {
+     generatePasswordBatchFrom(threadPasswordGenerator(), count, out_buffer);
+ }
+ 
+ /**
+  * @brief Counts the lines in a byte range, including an unterminated last line
+  */
+ size_t countPasswordFileLines(const char* begin, const char* end) {
+     size_t lines = 0;
+     const char* p = begin;
+     
+     while (p < end) {
+         const char* newline = memchr(p, '\n', (size_t)(end - p));
+         lines++;
+         if (newline == NULL) {
+             break;
+         }
+         p = newline + 1;
+     }
+     
+     return lines;
+ }
+ 
+ /**
+  * @brief Maps a whole file read-only into memory
+  *
+  * @param path File to map
+  * @param size Receives the file size in bytes
+  * @return Start of the mapping (release with unmapPasswordFile()), or NULL on error.
+  *         An empty file yields an empty, unmapped string.
+  */
+ const char* mapPasswordFile(const char* path, size_t* size) {
+     int fd = open(path, O_RDONLY);
+     if (fd < 0) {
+         return NULL;
+     }
+     
+     struct stat info;
+     if (fstat(fd, &info) != 0) {
+         close(fd);
+         return NULL;
+     }
+     
+     *size = (size_t)info.st_size;
+     if (*size == 0) {
+         close(fd);
+         return "";
+     }
+     
+     void* mapping = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+     close(fd);  // The mapping keeps the file referenced
+     if (mapping == MAP_FAILED) {
+         return NULL;
+     }
+     
+     madvise(mapping, *size, MADV_SEQUENTIAL);
+     return mapping;
+ }
+ 
+ /**
+  * @brief Releases a mapping created by mapPasswordFile()
+  */
+ void unmapPasswordFile(const char* mapping, size_t size) {
+     if (size > 0) {
+         munmap((void*)mapping, size);
+     }
+ }
+ 
+ /*
+  * Breached-password blocklist
+  *
+  * Breach corpora are stored in an xor filter (Graf & Lemire) with 16-bit
+  * fingerprints: about 2.5 bytes per entry, three memory reads per lookup
+  * and a false positive rate of 1/65536, with no false negatives. Entries
+  * are keyed by the first 64 bits of the password's SHA-1 digest, so a
+  * corpus can be either plaintext passwords or the HIBP SHA-1 list
+  * ("<40 hex digits>:<count>" per line).
+  */
+ 
+ /* Filter slots per key; 1.23 is the smallest overhead that peels reliably */
+ #define BLOCKLIST_LOAD_FACTOR 1.23
+ 
+ /* Construction attempts before giving up with a different hash seed */
+ #define BLOCKLIST_MAX_ATTEMPTS 100
+ 
+ #define SHA1_DIGEST_SIZE 20
+ 
+ /**
+  * @brief Computes the SHA-1 digest of a byte string (FIPS 180-4)
+  *
+  * @param data Bytes to hash
+  * @param length Number of bytes in data
+  * @param digest Receives the 20-byte digest
+  */
+ static void sha1(const void* data, size_t length, unsigned char digest[SHA1_DIGEST_SIZE]) {
+     const unsigned char* bytes = data;
+     uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+     unsigned char block[64];
+     uint64_t bitLength = (uint64_t)length * 8;
+     size_t offset = 0;
+     bool paddingDone = false;
+     bool lengthDone = false;
+     
+     while (!lengthDone) {
+         // Assemble the next block, appending 0x80 and the length at the end
+         size_t take = 0;
+         if (offset < length) {
+             take = length - offset < 64 ? length - offset : 64;
+             memcpy(block, bytes + offset, take);
+             offset += take;
+         }
+         if (take < 64) {
+             memset(block + take, 0, 64 - take);
+             if (!paddingDone) {
+                 block[take] = 0x80;
+                 paddingDone = true;
+                 take++;
+             }
+             if (take <= 56) {
+                 for (int i = 0; i < 8; i++) {
+                     block[56 + i] = (unsigned char)(bitLength >> (56 - 8 * i));
+                 }
+                 lengthDone = true;
+             }
+         }
+         
+         uint32_t w[80];
+         for (int i = 0; i < 16; i++) {
+             w[i] = ((uint32_t)block[4 * i] << 24) | ((uint32_t)block[4 * i + 1] << 16) |
+                    ((uint32_t)block[4 * i + 2] << 8) | (uint32_t)block[4 * i + 3];
+         }
+         for (int i = 16; i < 80; i++) {
+             w[i] = ROTL32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+         }
+         
+         uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+         for (int i = 0; i < 80; i++) {
+             uint32_t f, k;
+             if (i < 20) {
+                 f = (b & c) | (~b & d);
+                 k = 0x5A827999;
+             } else if (i < 40) {
+                 f = b ^ c ^ d;
+                 k = 0x6ED9EBA1;
+             } else if (i < 60) {
+                 f = (b & c) | (b & d) | (c & d);
+                 k = 0x8F1BBCDC;
+             } else {
+                 f = b ^ c ^ d;
+                 k = 0xCA62C1D6;
+             }
+             uint32_t temp = ROTL32(a, 5) + f + e + k + w[i];
+             e = d;
+             d = c;
+             c = ROTL32(b, 30);
+             b = a;
+             a = temp;
+         }
+         h[0] += a;
+         h[1] += b;
+         h[2] += c;
+         h[3] += d;
+         h[4] += e;
+     }
+     
+     for (int i = 0; i < 5; i++) {
+         digest[4 * i] = (unsigned char)(h[i] >> 24);
+         digest[4 * i + 1] = (unsigned char)(h[i] >> 16);
+         digest[4 * i + 2] = (unsigned char)(h[i] >> 8);
+         digest[4 * i + 3] = (unsigned char)h[i];
+     }
+ }
+ 
+ /**
+  * @brief Derives the blocklist key of a password: the first 64 bits of its SHA-1
+  */
+ static uint64_t blocklistKey(const char* password, size_t length) {
+     unsigned char digest[SHA1_DIGEST_SIZE];
+     uint64_t key = 0;
+     
+     sha1(password, length, digest);
+     for (int i = 0; i < 8; i++) {
+         key = (key << 8) | digest[i];
+     }
+     
+     return key;
+ }
+ 
+ /**
+  * @brief Finalizer of MurmurHash3, used to spread keys over the filter
+  */
+ static inline uint64_t mixKey(uint64_t key, uint64_t seed) {
+     uint64_t h = key + seed;
+     h ^= h >> 33;
+     h *= UINT64_C(0xff51afd7ed558ccd);
+     h ^= h >> 33;
+     h *= UINT64_C(0xc4ceb9fe1a85ec53);
+     h ^= h >> 33;
+     return h;
+ }
+ 
+ /**
+  * @brief Maps 32 hash bits onto [0, range) without division
+  */
+ static inline uint32_t reduceHash(uint32_t hash, uint32_t range) {
+     return (uint32_t)(((uint64_t)hash * range) >> 32);
+ }
+ 
+ /**
+  * @brief Computes the three filter slots of a mixed hash, one per segment
+  */
+ static inline void blocklistSlots(uint64_t hash, uint32_t blockLength, uint32_t slots[3]) {
+     slots[0] = reduceHash((uint32_t)hash, blockLength);
+     slots[1] = reduceHash((uint32_t)((hash << 21) | (hash >> 43)), blockLength) + blockLength;
+     slots[2] = reduceHash((uint32_t)((hash << 42) | (hash >> 22)), blockLength) + 2 * blockLength;
+ }
+ 
+ static inline uint16_t blocklistFingerprint(uint64_t hash) {
+     return (uint16_t)(hash ^ (hash >> 32));
+ }
+ 
+ /**
+  * @brief Sorts 64-bit keys with an LSD radix sort (8 passes of 8 bits)
+  *
+  * @param keys Keys to sort
+  * @param scratch Buffer of the same size as keys
+  * @param count Number of keys
+  */
+ static void radixSortKeys(uint64_t* keys, uint64_t* scratch, size_t count) {
+     for (int shift = 0; shift < 64; shift += 8) {
+         size_t buckets[257] = {0};
+         
+         for (size_t i = 0; i < count; i++) {
+             buckets[((keys[i] >> shift) & 0xFF) + 1]++;
+         }
+         for (int b = 0; b < 256; b++) {
+             buckets[b + 1] += buckets[b];
+         }
+         for (size_t i = 0; i < count; i++) {
+             scratch[buckets[(keys[i] >> shift) & 0xFF]++] = keys[i];
+         }
+         
+         uint64_t* swap = keys;
+         keys = scratch;
+         scratch = swap;
+     }
+     // After an even number of passes the sorted keys are back in the caller's array
+ }
+ 
+ /**
+  * @brief Builds a blocklist filter from 64-bit keys
+  *
+  * Duplicate keys are removed first. The keys array is reordered.
+  *
+  * @param blocklist Filter to build
+  * @param keys Keys to insert
+  * @param count Number of keys
+  * @return true on success, false if memory ran out or no seed peeled
+  */
+ static bool buildBlocklist(Blocklist* blocklist, uint64_t* keys, size_t count) {
+     memset(blocklist, 0, sizeof(*blocklist));
+     
+     uint64_t* scratch = malloc((count > 0 ? count : 1) * sizeof(uint64_t));
+     if (scratch == NULL) {
+         return false;
+     }
+     radixSortKeys(keys, scratch, count);
+     
+     size_t unique = 0;
+     for (size_t i = 0; i < count; i++) {
+         if (unique == 0 || keys[i] != keys[unique - 1]) {
+             keys[unique++] = keys[i];
+         }
+     }
+     
+     size_t capacity = 32 + (size_t)(BLOCKLIST_LOAD_FACTOR * (double)unique);
+     uint32_t blockLength = (uint32_t)(capacity / 3);
+     capacity = (size_t)blockLength * 3;
+     
+     // Per-slot xor of the hashes mapped to it and their number
+     uint64_t* slotHashes = malloc(capacity * sizeof(uint64_t));
+     uint32_t* slotCounts = malloc(capacity * sizeof(uint32_t));
+     uint32_t* queue = malloc(capacity * sizeof(uint32_t));
+     uint32_t* peeledSlots = (uint32_t*)scratch;  // scratch holds at least 2 * unique uint32_t values
+     uint64_t* peeledHashes = malloc((unique > 0 ? unique : 1) * sizeof(uint64_t));
+     uint16_t* fingerprints = calloc(capacity, sizeof(uint16_t));
+     bool built = false;
+     
+     if (slotHashes != NULL && slotCounts != NULL && queue != NULL && peeledHashes != NULL &&
+         fingerprints != NULL) {
+         uint64_t seed = UINT64_C(0x9E3779B97F4A7C15);
+         
+         for (int attempt = 0; attempt < BLOCKLIST_MAX_ATTEMPTS && !built; attempt++) {
+             seed = mixKey(seed, (uint64_t)attempt);
+             memset(slotHashes, 0, capacity * sizeof(uint64_t));
+             memset(slotCounts, 0, capacity * sizeof(uint32_t));
+             
+             for (size_t i = 0; i < unique; i++) {
+                 uint64_t hash = mixKey(keys[i], seed);
+                 uint32_t slots[3];
+                 blocklistSlots(hash, blockLength, slots);
+                 for (int j = 0; j < 3; j++) {
+                     slotHashes[slots[j]] ^= hash;
+                     slotCounts[slots[j]]++;
+                 }
+             }
+             
+             // Peel slots that hold a single key until none are left
+             size_t queueLength = 0;
+             for (size_t slot = 0; slot < capacity; slot++) {
+                 if (slotCounts[slot] == 1) {
+                     queue[queueLength++] = (uint32_t)slot;
+                 }
+             }
+             
+             size_t peeled = 0;
+             while (queueLength > 0) {
+                 uint32_t slot = queue[--queueLength];
+                 if (slotCounts[slot] != 1) {
+                     continue;
+                 }
+                 
+                 uint64_t hash = slotHashes[slot];
+                 uint32_t slots[3];
+                 blocklistSlots(hash, blockLength, slots);
+                 peeledSlots[peeled] = slot;
+                 peeledHashes[peeled] = hash;
+                 peeled++;
+                 
+                 for (int j = 0; j < 3; j++) {
+                     slotHashes[slots[j]] ^= hash;
+                     slotCounts[slots[j]]--;
+                     if (slotCounts[slots[j]] == 1) {
+                         queue[queueLength++] = slots[j];
+                     }
+                 }
+             }
+             
+             if (peeled == unique) {
+                 // Assign in reverse peel order so every key's slots xor to its fingerprint
+                 for (size_t i = peeled; i-- > 0;) {
+                     uint64_t hash = peeledHashes[i];
+                     uint32_t slots[3];
+                     blocklistSlots(hash, blockLength, slots);
+                     fingerprints[peeledSlots[i]] = 0;
+                     fingerprints[peeledSlots[i]] = blocklistFingerprint(hash) ^ fingerprints[slots[0]] ^
+                                                    fingerprints[slots[1]] ^ fingerprints[slots[2]];
+                 }
+                 blocklist->seed = seed;
+                 blocklist->blockLength = blockLength;
+                 blocklist->entryCount = unique;
+                 blocklist->fingerprints = fingerprints;
+                 built = true;
+             }
+         }
+     }
+     
+     free(slotHashes);
+     free(slotCounts);
+     free(queue);
+     free(peeledHashes);
+     free(scratch);
+     if (!built) {
+         free(fingerprints);
+     }
+     return built;
+ }
+ 
+ /**
+  * @brief Checks whether 40 bytes are SHA-1 hex digits and decodes the first 64 bits
+  */
+ static bool parseSha1Hex(const char* text, uint64_t* key) {
+     uint64_t value = 0;
+     
+     for (int i = 0; i < 2 * SHA1_DIGEST_SIZE; i++) {
+         char c = text[i];
+         unsigned int digit;
+         if (c >= '0' && c <= '9') {
+             digit = (unsigned int)(c - '0');
+         } else if (c >= 'A' && c <= 'F') {
+             digit = (unsigned int)(c - 'A' + 10);
+         } else if (c >= 'a' && c <= 'f') {
+             digit = (unsigned int)(c - 'a' + 10);
+         } else {
+             return false;
+         }
+         if (i < 16) {
+             value = (value << 4) | digit;
+         }
+     }
+     
+     *key = value;
+     return true;
+ }
+ 
+ /**
+  * @brief Loads a breach corpus text file into a blocklist filter
+  *
+  * Each non-empty line is either a SHA-1 hex digest, optionally followed by
+  * ":<count>" as in the HIBP downloads, or a plaintext password.
+  *
+  * @param blocklist Filter to build
+  * @param path Corpus file
+  * @return true on success, false if the file could not be read or memory ran out
+  */
+ bool loadBlocklistFromText(Blocklist* blocklist, const char* path) {
+     size_t size;
+     const char* contents = mapPasswordFile(path, &size);
+     if (contents == NULL) {
+         return false;
+     }
+     
+     const char* end = contents + size;
+     size_t lines = countPasswordFileLines(contents, end);
+     uint64_t* keys = malloc((lines > 0 ? lines : 1) * sizeof(uint64_t));
+     if (keys == NULL) {
+         unmapPasswordFile(contents, size);
+         return false;
+     }
+     
+     size_t count = 0;
+     for (const char* p = contents; p < end;) {
+         const char* newline = memchr(p, '\n', (size_t)(end - p));
+         const char* lineEnd = newline != NULL ? newline : end;
+         size_t length = (size_t)(lineEnd - p);
+         const char* entry = p;
+         
+         p = newline != NULL ? newline + 1 : end;
+         if (length > 0 && entry[length - 1] == '\r') {
+             length--;
+         }
+         if (length == 0) {
+             continue;
+         }
+         
+         bool isDigest = length >= 2 * SHA1_DIGEST_SIZE &&
+                         (length == 2 * SHA1_DIGEST_SIZE || entry[2 * SHA1_DIGEST_SIZE] == ':') &&
+                         parseSha1Hex(entry, &keys[count]);
+         if (!isDigest) {
+             keys[count] = blocklistKey(entry, length);
+         }
+         count++;
+     }
+     
+     unmapPasswordFile(contents, size);
+     bool built = buildBlocklist(blocklist, keys, count);
+     free(keys);
+     return built;
+ }
+ 
+ /**
+  * @brief Releases the memory or index mapping held by a blocklist
+  */
+ void freeBlocklist(Blocklist* blocklist) {
+     if (blocklist->mapping != NULL) {
+         unmapPasswordFile(blocklist->mapping, blocklist->mappingSize);
+     } else {
+         free((void*)blocklist->fingerprints);
+     }
+     memset(blocklist, 0, sizeof(*blocklist));
+ }
+ 
+ /**
+  * @brief Checks whether a password of known length appears in the blocklist
+  *
+  * @param blocklist Filter built from a breach corpus
+  * @param password Password bytes to look up
+  * @param length Number of bytes in password
+  * @return true if the password is (with probability 1 - 1/65536) in the corpus
+  */
+ bool blocklistContains(const Blocklist* blocklist, const char* password, size_t length) {
+     if (blocklist->entryCount == 0) {
+         return false;
+     }
+     
+     uint64_t hash = mixKey(blocklistKey(password, length), blocklist->seed);
+     uint32_t slots[3];
+     blocklistSlots(hash, blocklist->blockLength, slots);
+     
+     const uint16_t* f = blocklist->fingerprints;
+     return blocklistFingerprint(hash) == (uint16_t)(f[slots[0]] ^ f[slots[1]] ^ f[slots[2]]);
+ }
+ 
+ /**
+  * @brief Validates a password against strong password criteria and a breach blocklist
+  *
+  * The blocklist is only consulted for passwords that already pass every
+  * other rule.
+  *
+  * @param blocklist Filter built from a breach corpus
+  * @param username User's username (to ensure it's not in the password)
+  * @param password Password to validate
+  * @return true if password is strong and not known to be breached, false otherwise
+  */
+ bool isStrongPasswordWithBlocklist(const Blocklist* blocklist, const char* username, const char* password) {
+     return isStrongPassword(username, password) && !blocklistContains(blocklist, password, strlen(password));
+ }
+ 
+ /*
+  * Precompiled blocklist index
+  *
+  * --build-index writes a filter once so later processes can map it instead
+  * of parsing the corpus. The file is a 64-byte header followed directly by
+  * the 3 * blockLength fingerprints in host byte order. Opening an index
+  * only validates the header; the fingerprints are paged in on demand and
+  * the read-only mapping is shared through the page cache by every process
+  * that opens the same file. The full data checksum is only verified on
+  * request (--check-index), since that reads every page.
+  */
+ 
+ #define BLOCKLIST_INDEX_MAGIC "PWBLIDX"
+ #define BLOCKLIST_INDEX_VERSION 1
+ #define BLOCKLIST_INDEX_BYTE_ORDER 0x01020304u
+ 
+ typedef struct {
+     char magic[8];             // BLOCKLIST_INDEX_MAGIC, NUL-padded
+     uint32_t version;          // BLOCKLIST_INDEX_VERSION
+     uint32_t byteOrder;        // BLOCKLIST_INDEX_BYTE_ORDER as written by the builder
+     uint64_t seed;             // Filter hash seed
+     uint64_t entryCount;       // Distinct keys stored
+     uint32_t blockLength;      // Slots in each of the three segments
+     uint32_t fingerprintBits;  // Always 16
+     uint64_t dataChecksum;     // indexChecksum() of the fingerprint array
+     uint64_t reserved;         // Zero
+     uint64_t headerChecksum;   // indexChecksum() of all preceding header bytes
+ } BlocklistIndexHeader;
+ 
+ _Static_assert(sizeof(BlocklistIndexHeader) == 64, "index header must stay 64 bytes");
+ 
+ /**
+  * @brief FNV-1a style checksum over 64-bit words, with a byte-wise tail
+  */
+ static uint64_t indexChecksum(const void* data, size_t length) {
+     const unsigned char* bytes = data;
+     uint64_t hash = UINT64_C(0xcbf29ce484222325);
+     size_t i = 0;
+     
+     for (; i + 8 <= length; i += 8) {
+         uint64_t word;
+         memcpy(&word, bytes + i, sizeof(word));
+         hash = (hash ^ word) * UINT64_C(0x100000001b3);
+         hash ^= hash >> 29;
+     }
+     for (; i < length; i++) {
+         hash = (hash ^ bytes[i]) * UINT64_C(0x100000001b3);
+     }
+     
+     return hash;
+ }
+ 
+ /**
+  * @brief Writes a blocklist filter as a precompiled index file
+  *
+  * The index is written to "<path>.tmp", flushed to disk and renamed
+  * into place, so processes that already map an older index at the same
+  * path keep a consistent view and a crash never leaves a partial index
+  * under the final name.
+  *
+  * @param blocklist Filter to write
+  * @param path Destination file
+  * @return true on success, false on I/O error
+  */
+ bool writeBlocklistIndex(const Blocklist* blocklist, const char* path) {
+     size_t fingerprintCount = (size_t)blocklist->blockLength * 3;
+     BlocklistIndexHeader header;
+     
+     memset(&header, 0, sizeof(header));
+     memcpy(header.magic, BLOCKLIST_INDEX_MAGIC, sizeof(BLOCKLIST_INDEX_MAGIC));
+     header.version = BLOCKLIST_INDEX_VERSION;
+     header.byteOrder = BLOCKLIST_INDEX_BYTE_ORDER;
+     header.seed = blocklist->seed;
+     header.entryCount = blocklist->entryCount;
+     header.blockLength = blocklist->blockLength;
+     header.fingerprintBits = 16;
+     header.dataChecksum = indexChecksum(blocklist->fingerprints, fingerprintCount * sizeof(uint16_t));
+     header.headerChecksum = indexChecksum(&header, offsetof(BlocklistIndexHeader, headerChecksum));
+     
+     size_t pathLength = strlen(path);
+     char* tempPath = malloc(pathLength + sizeof(".tmp"));
+     if (tempPath == NULL) {
+         return false;
+     }
+     memcpy(tempPath, path, pathLength);
+     memcpy(tempPath + pathLength, ".tmp", sizeof(".tmp"));
+     
+     FILE* file = fopen(tempPath, "wb");
+     bool written = file != NULL &&
+                    fwrite(&header, sizeof(header), 1, file) == 1 &&
+                    fwrite(blocklist->fingerprints, sizeof(uint16_t), fingerprintCount, file) == fingerprintCount &&
+                    fflush(file) == 0 &&
+                    fsync(fileno(file)) == 0;
+     if (file != NULL && fclose(file) != 0) {
+         written = false;
+     }
+     if (written && rename(tempPath, path) != 0) {
+         written = false;
+     }
+     if (!written) {
+         remove(tempPath);
+     }
+     
+     free(tempPath);
+     return written;
+ }
+ 
+ /**
+  * @brief Opens a precompiled index file as a blocklist
+  *
+  * @param blocklist Filter to initialize; release it with freeBlocklist()
+  * @param path Index file written by writeBlocklistIndex()
+  * @param verifyData true to also verify the fingerprint checksum (reads the whole file)
+  * @return true if the index is valid, false if it is missing, corrupt or incompatible
+  */
+ bool openBlocklistIndex(Blocklist* blocklist, const char* path, bool verifyData) {
+     memset(blocklist, 0, sizeof(*blocklist));
+     
+     size_t size;
+     const char* mapping = mapPasswordFile(path, &size);
+     if (mapping == NULL) {
+         return false;
+     }
+     
+     BlocklistIndexHeader header;
+     bool valid = size >= sizeof(header);
+     if (valid) {
+         memcpy(&header, mapping, sizeof(header));
+         valid = memcmp(header.magic, BLOCKLIST_INDEX_MAGIC, sizeof(BLOCKLIST_INDEX_MAGIC)) == 0 &&
+                 header.version == BLOCKLIST_INDEX_VERSION &&
+                 header.byteOrder == BLOCKLIST_INDEX_BYTE_ORDER &&
+                 header.fingerprintBits == 16 &&
+                 header.blockLength > 0 &&
+                 header.headerChecksum == indexChecksum(&header, offsetof(BlocklistIndexHeader, headerChecksum)) &&
+                 size - sizeof(header) == (size_t)header.blockLength * 3 * sizeof(uint16_t);
+     }
+     
+     const uint16_t* fingerprints = (const uint16_t*)(mapping + sizeof(header));
+     if (valid && verifyData) {
+         valid = header.dataChecksum == indexChecksum(fingerprints, size - sizeof(header));
+     }
+     if (!valid) {
+         unmapPasswordFile(mapping, size);
+         return false;
+     }
+     
+     // Lookups touch three random slots, so sequential read-ahead would be wasted
+     madvise((void*)mapping, size, MADV_RANDOM);
+     
+     blocklist->seed = header.seed;
+     blocklist->blockLength = header.blockLength;
+     blocklist->entryCount = (size_t)header.entryCount;
+     blocklist->fingerprints = fingerprints;
+     blocklist->mapping = mapping;
+     blocklist->mappingSize = size;
+     return true;
+ }
+ 
+ /*
+  * Password history
+  *
+  * A PasswordHistory remembers the last PASSWORD_HISTORY_DEPTH passwords
+  * of each user as 64-bit SipHash-2-4 fingerprints under a caller-held
+  * 128-bit key, so the store never holds a password or an unkeyed hash
+  * of one. The user's key tag (SipHash of the username) both locates the
+  * record and salts its fingerprints, so equal passwords of different
+  * users look unrelated. Records are fixed-width and live in an
+  * open-addressed table with linear probing whose capacity is a power of
+  * two, so a lookup is one hash of each string and usually one record.
+  * The table is a 64-byte header plus the records. It is either a shared
+  * writable mapping of a file, whose pages the kernel writes back, or
+  * anonymous memory when no path is given. The key check value in the
+  * header rejects a file opened with the wrong key. One process may
+  * update a file while others only read it between updates; nothing
+  * synchronizes concurrent writers.
+  */
+ 
+ #define PASSWORD_HISTORY_MAGIC "PWHIST"
+ #define PASSWORD_HISTORY_VERSION 1
+ 
+ /* Most records a table fills before further users are refused, as a fraction of capacity */
+ #define PASSWORD_HISTORY_MAX_LOAD 0.9
+ 
+ typedef struct {
+     char magic[8];             // PASSWORD_HISTORY_MAGIC, NUL-padded
+     uint32_t version;          // PASSWORD_HISTORY_VERSION
+     uint32_t depth;            // PASSWORD_HISTORY_DEPTH when written
+     uint64_t capacity;         // Records in the table, a power of two
+     uint64_t used;             // Records holding a user
+     uint64_t keyCheck;         // SipHash of the empty string under the key
+     uint32_t byteOrder;        // BLOCKLIST_INDEX_BYTE_ORDER as written by the creator
+     uint32_t reserved[5];      // Zero
+ } PasswordHistoryHeader;
+ 
+ _Static_assert(sizeof(PasswordHistoryHeader) == 64, "history header must stay 64 bytes");
+ 
+ struct PasswordHistoryRecord {
+     uint64_t userTag;                                 // 0 marks an empty record
+     uint32_t count;                                   // Fingerprints stored, up to PASSWORD_HISTORY_DEPTH
+     uint32_t next;                                    // Slot the next fingerprint replaces
+     uint64_t fingerprints[PASSWORD_HISTORY_DEPTH];
+ };
+ 
+ static inline uint64_t rotateLeft64(uint64_t x, int bits) {
+     return (x << bits) | (x >> (64 - bits));
+ }
+ 
+ #define SIPHASH_ROUND(v0, v1, v2, v3) \
+     do { \
+         v0 += v1; v1 = rotateLeft64(v1, 13); v1 ^= v0; v0 = rotateLeft64(v0, 32); \
+         v2 += v3; v3 = rotateLeft64(v3, 16); v3 ^= v2; \
+         v0 += v3; v3 = rotateLeft64(v3, 21); v3 ^= v0; \
+         v2 += v1; v1 = rotateLeft64(v1, 17); v1 ^= v2; v2 = rotateLeft64(v2, 32); \
+     } while (0)
+ 
+ /**
+  * @brief Computes SipHash-2-4 of a byte string (Aumasson & Bernstein)
+  *
+  * @param k0 First half of the key, as a little-endian word
+  * @param k1 Second half of the key
+  */
+ static uint64_t sipHash24(uint64_t k0, uint64_t k1, const void* data, size_t length) {
+     const unsigned char* bytes = data;
+     uint64_t v0 = k0 ^ UINT64_C(0x736f6d6570736575);
+     uint64_t v1 = k1 ^ UINT64_C(0x646f72616e646f6d);
+     uint64_t v2 = k0 ^ UINT64_C(0x6c7967656e657261);
+     uint64_t v3 = k1 ^ UINT64_C(0x7465646279746573);
+     size_t i = 0;
+     
+     for (; i + 8 <= length; i += 8) {
+         uint64_t m = 0;
+         for (int b = 0; b < 8; b++) {
+             m |= (uint64_t)bytes[i + b] << (8 * b);
+         }
+         v3 ^= m;
+         SIPHASH_ROUND(v0, v1, v2, v3);
+         SIPHASH_ROUND(v0, v1, v2, v3);
+         v0 ^= m;
+     }
+     
+     uint64_t last = (uint64_t)length << 56;
+     for (int b = 0; i + (size_t)b < length; b++) {
+         last |= (uint64_t)bytes[i + b] << (8 * b);
+     }
+     v3 ^= last;
+     SIPHASH_ROUND(v0, v1, v2, v3);
+     SIPHASH_ROUND(v0, v1, v2, v3);
+     v0 ^= last;
+     
+     v2 ^= 0xff;
+     for (int r = 0; r < 4; r++) {
+         SIPHASH_ROUND(v0, v1, v2, v3);
+     }
+     return v0 ^ v1 ^ v2 ^ v3;
+ }
+ 
+ /**
+  * @brief Returns the non-zero tag that identifies a user's record
+  */
+ static uint64_t historyUserTag(const PasswordHistory* history, const char* username, size_t length) {
+     uint64_t tag = sipHash24(history->key[0], history->key[1], username, length);
+     return tag != 0 ? tag : 1;
+ }
+ 
+ /**
+  * @brief Fingerprints a password under a key salted with the user's tag
+  */
+ static uint64_t historyFingerprint(const PasswordHistory* history, uint64_t userTag,
+                                    const char* password, size_t length) {
+     return sipHash24(history->key[0] ^ userTag, history->key[1], password, length);
+ }
+ 
+ /**
+  * @brief Finds a user's record, or the empty record where it would go
+  *
+  * @return The record, or NULL if the user is absent and the table has no empty record
+  */
+ static PasswordHistoryRecord* findHistoryRecord(const PasswordHistory* history, uint64_t userTag) {
+     size_t mask = history->capacity - 1;
+     for (size_t probe = 0; probe < history->capacity; probe++) {
+         PasswordHistoryRecord* record = &history->records[(userTag + probe) & mask];
+         if (record->userTag == userTag || record->userTag == 0) {
+             return record;
+         }
+     }
+     return NULL;
+ }
+ 
+ /**
+  * @brief Checks a user's record, identified by its tag, for a password's fingerprint
+  */
+ static bool historyHasFingerprint(const PasswordHistory* history, uint64_t userTag,
+                                   const char* password, size_t length) {
+     const PasswordHistoryRecord* record = findHistoryRecord(history, userTag);
+     if (record == NULL || record->userTag != userTag) {
+         return false;
+     }
+     
+     uint64_t fingerprint = historyFingerprint(history, userTag, password, length);
+     bool found = false;
+     for (uint32_t i = 0; i < record->count && i < PASSWORD_HISTORY_DEPTH; i++) {
+         found |= record->fingerprints[i] == fingerprint;
+     }
+     return found;
+ }
+ 
+ /**
+  * @brief Maps a history table from an open descriptor, or anonymous memory if fd is negative
+  */
+ static bool mapPasswordHistory(PasswordHistory* history, int fd, size_t size) {
+     int flags = fd >= 0 ? MAP_SHARED : MAP_PRIVATE | MAP_ANONYMOUS;
+     void* mapping = mmap(NULL, size, PROT_READ | PROT_WRITE, flags, fd, 0);
+     if (mapping == MAP_FAILED) {
+         return false;
+     }
+     // Lookups touch one random record, so sequential read-ahead would be wasted
+     madvise(mapping, size, MADV_RANDOM);
+     
+     history->mapping = mapping;
+     history->mappingSize = size;
+     history->records = (PasswordHistoryRecord*)((char*)mapping + sizeof(PasswordHistoryHeader));
+     return true;
+ }
+ 
+ static inline void loadHistoryKey(PasswordHistory* history, const unsigned char key[PASSWORD_HISTORY_KEY_SIZE]) {
+     history->key[0] = 0;
+     history->key[1] = 0;
+     for (int b = 0; b < 8; b++) {
+         history->key[0] |= (uint64_t)key[b] << (8 * b);
+         history->key[1] |= (uint64_t)key[8 + b] << (8 * b);
+     }
+ }
+ 
+ /**
+  * @brief Creates an empty history table, in a file or in memory
+  *
+  * An existing file at path is replaced.
+  *
+  * @param history History to initialize; release it with closePasswordHistory()
+  * @param path File to create, or NULL to keep the table in memory
+  * @param users Number of users the table must hold
+  * @param key Secret fingerprint key; keep it outside the file
+  * @return true on success, false on I/O or allocation error
+  */
+ bool createPasswordHistory(PasswordHistory* history, const char* path, size_t users,
+                            const unsigned char key[PASSWORD_HISTORY_KEY_SIZE]) {
+     memset(history, 0, sizeof(*history));
+     loadHistoryKey(history, key);
+     
+     size_t capacity = 16;
+     while ((double)capacity * PASSWORD_HISTORY_MAX_LOAD < (double)users) {
+         if (capacity > (SIZE_MAX - sizeof(PasswordHistoryHeader)) / sizeof(PasswordHistoryRecord) / 2) {
+             return false;
+         }
+         capacity *= 2;
+     }
+     size_t size = sizeof(PasswordHistoryHeader) + capacity * sizeof(PasswordHistoryRecord);
+     
+     int fd = -1;
+     if (path != NULL) {
+         fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+         if (fd < 0 || ftruncate(fd, (off_t)size) != 0) {
+             if (fd >= 0) {
+                 close(fd);
+                 remove(path);
+             }
+             return false;
+         }
+     }
+     bool mapped = mapPasswordHistory(history, fd, size);
+     if (fd >= 0) {
+         close(fd);  // The mapping keeps the file referenced
+     }
+     if (!mapped) {
+         if (path != NULL) {
+             remove(path);
+         }
+         return false;
+     }
+     
+     PasswordHistoryHeader* header = (PasswordHistoryHeader*)history->mapping;
+     memcpy(header->magic, PASSWORD_HISTORY_MAGIC, sizeof(PASSWORD_HISTORY_MAGIC));
+     header->version = PASSWORD_HISTORY_VERSION;
+     header->depth = PASSWORD_HISTORY_DEPTH;
+     header->capacity = capacity;
+     header->keyCheck = sipHash24(history->key[0], history->key[1], "", 0);
+     header->byteOrder = BLOCKLIST_INDEX_BYTE_ORDER;
+     history->capacity = capacity;
+     return true;
+ }
+ 
+ /**
+  * @brief Opens a history file written by createPasswordHistory()
+  *
+  * @param history History to initialize; release it with closePasswordHistory()
+  * @param path History file
+  * @param key Key the file was created with
+  * @return true on success, false if the file is missing, corrupt, incompatible or keyed differently
+  */
+ bool openPasswordHistory(PasswordHistory* history, const char* path,
+                          const unsigned char key[PASSWORD_HISTORY_KEY_SIZE]) {
+     memset(history, 0, sizeof(*history));
+     loadHistoryKey(history, key);
+     
+     int fd = open(path, O_RDWR | O_CLOEXEC);
+     if (fd < 0) {
+         return false;
+     }
+     struct stat info;
+     PasswordHistoryHeader header;
+     bool valid = fstat(fd, &info) == 0 && (size_t)info.st_size >= sizeof(header) &&
+                  pread(fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header);
+     if (valid) {
+         valid = memcmp(header.magic, PASSWORD_HISTORY_MAGIC, sizeof(PASSWORD_HISTORY_MAGIC)) == 0 &&
+                 header.version == PASSWORD_HISTORY_VERSION &&
+                 header.depth == PASSWORD_HISTORY_DEPTH &&
+                 header.byteOrder == BLOCKLIST_INDEX_BYTE_ORDER &&
+                 header.keyCheck == sipHash24(history->key[0], history->key[1], "", 0) &&
+                 header.capacity > 0 && (header.capacity & (header.capacity - 1)) == 0 &&
+                 header.capacity <= ((size_t)info.st_size - sizeof(header)) / sizeof(PasswordHistoryRecord) &&
+                 (size_t)info.st_size - sizeof(header) == header.capacity * sizeof(PasswordHistoryRecord);
+     }
+     valid = valid && mapPasswordHistory(history, fd, (size_t)info.st_size);
+     close(fd);  // The mapping keeps the file referenced
+     if (!valid) {
+         memset(history, 0, sizeof(*history));
+         return false;
+     }
+     history->capacity = (size_t)header.capacity;
+     return true;
+ }
+ 
+ /**
+  * @brief Unmaps a history table and wipes its key
+  *
+  * Changes to a file-backed table are already in the page cache; the
+  * kernel writes them back.
+  */
+ void closePasswordHistory(PasswordHistory* history) {
+     if (history->mapping != NULL) {
+         munmap(history->mapping, history->mappingSize);
+     }
+     volatile uint64_t* key = history->key;
+     key[0] = 0;
+     key[1] = 0;
+     memset(history, 0, sizeof(*history));
+ }
+ 
+ /**
+  * @brief Checks whether a password of known length is one of the user's remembered passwords
+  *
+  * @param history History from createPasswordHistory() or openPasswordHistory()
+  * @param username Username bytes
+  * @param usernameLength Number of bytes in username
+  * @param password Password bytes to look up
+  * @param passwordLength Number of bytes in password
+  * @return true if the password was used before
+  */
+ bool passwordInHistoryBytes(const PasswordHistory* history, const char* username, size_t usernameLength,
+                             const char* password, size_t passwordLength) {
+     return historyHasFingerprint(history, historyUserTag(history, username, usernameLength),
+                                  password, passwordLength);
+ }
+ 
+ /**
+  * @brief Checks whether a password is one of the user's remembered passwords
+  */
+ bool passwordInHistory(const PasswordHistory* history, const char* username, const char* password) {
+     return passwordInHistoryBytes(history, username, strlen(username), password, strlen(password));
+ }
+ 
+ /**
+  * @brief Remembers a user's new password, forgetting the oldest once PASSWORD_HISTORY_DEPTH are stored
+  *
+  * Callers sharing a table, in one process or through the same file, must
+  * serialize calls with a lock of their own.
+  *
+  * @param history History from createPasswordHistory() or openPasswordHistory()
+  * @param username User's username
+  * @param password Password the user now has
+  * @return true on success, false if the table has no room for another user
+  */
+ bool addPasswordToHistory(PasswordHistory* history, const char* username, const char* password) {
+     uint64_t userTag = historyUserTag(history, username, strlen(username));
+     PasswordHistoryRecord* record = findHistoryRecord(history, userTag);
+     PasswordHistoryHeader* header = (PasswordHistoryHeader*)history->mapping;
+     
+     if (record == NULL) {
+         return false;
+     }
+     if (record->userTag == 0) {
+         if ((double)(header->used + 1) > (double)history->capacity * PASSWORD_HISTORY_MAX_LOAD) {
+             return false;  // Keep probe sequences short
+         }
+         header->used++;
+         record->userTag = userTag;
+         record->count = 0;
+         record->next = 0;
+     }
+     
+     // The indices come from the file, so bring them into range before writing through them
+     uint32_t next = record->next % PASSWORD_HISTORY_DEPTH;
+     uint32_t count = record->count < PASSWORD_HISTORY_DEPTH ? record->count + 1 : PASSWORD_HISTORY_DEPTH;
+     record->fingerprints[next] = historyFingerprint(history, userTag, password, strlen(password));
+     record->next = (next + 1) % PASSWORD_HISTORY_DEPTH;
+     record->count = count;
+     return true;
+ }
+ 
+ /**
+  * @brief Lists every strong password rule a password fails, including reuse of a remembered password
+  *
+  * @param history History to consult
+  * @param username User's username
+  * @param password Password to validate
+  * @return Mask of RULE_* bits, with RULE_REUSED if the password was used before
+  */
+ unsigned int strongPasswordFailuresWithHistory(const PasswordHistory* history, const char* username,
+                                                const char* password) {
+     size_t usernameLength = strlen(username);
+     size_t passwordLength = strlen(password);
+     unsigned int failures = strongPasswordFailuresBytes(username, usernameLength, password, passwordLength);
+     if (passwordInHistoryBytes(history, username, usernameLength, password, passwordLength)) {
+         failures |= RULE_REUSED;
+     }
+     return failures;
+ }
+ 
+ /*
+  * Aho-Corasick multi-pattern matching
+  *
+  * A PatternAutomaton finds every occurrence of a set of patterns in one
+  * left-to-right pass, case-insensitively. Failure links are resolved at
+  * build time into a flat transition table (one row of symbolCount states
+  * per state), so scanning costs one table lookup per byte whatever the
+  * number of patterns. Bytes are first mapped to a small symbol alphabet,
+  * with case folding baked in; bytes that occur in no pattern share symbol
+  * 0, which returns to the root. Every state carries the ids of all
+  * patterns that end there, including those reached through failure links.
+  */
+ 
+ /**
+  * @brief Releases an automaton built with buildPatternAutomaton()
+  */
+ void freePatternAutomaton(PatternAutomaton* automaton) {
+     free(automaton->transitions);
+     free(automaton->outputStart);
+     free(automaton->outputs);
+     free(automaton->patternLengths);
+     memset(automaton, 0, sizeof(*automaton));
+ }
+ 
+ /**
+  * @brief Builds a case-insensitive automaton for a set of patterns
+  *
+  * Pattern ids are the indices into the patterns array. Empty patterns are
+  * ignored, and patterns that are equal after case folding are reported
+  * once, under the lowest id.
+  *
+  * @param automaton Automaton to build; release it with freePatternAutomaton()
+  * @param patterns Patterns to find
+  * @param count Number of patterns
+  * @return true on success, false if memory could not be allocated
+  */
+ bool buildPatternAutomaton(PatternAutomaton* automaton, const char* const* patterns, size_t count) {
+     memset(automaton, 0, sizeof(*automaton));
+     
+     // Assign a symbol to every folded byte that occurs in a pattern
+     size_t totalLength = 0;
+     uint32_t symbols = 1;
+     for (size_t p = 0; p < count; p++) {
+         for (const char* c = patterns[p]; *c != '\0'; c++) {
+             unsigned char folded = asciiFoldTable[(unsigned char)*c];
+             if (automaton->symbolOf[folded] == 0) {
+                 automaton->symbolOf[folded] = (unsigned char)symbols++;
+             }
+             totalLength++;
+         }
+     }
+     for (int b = 0; b < 256; b++) {
+         automaton->symbolOf[b] = automaton->symbolOf[asciiFoldTable[b]];
+     }
+     
+     size_t maxStates = totalLength + 1;
+     uint32_t* transitions = calloc(maxStates * symbols, sizeof(uint32_t));
+     uint32_t* failure = calloc(maxStates, sizeof(uint32_t));
+     uint32_t* queue = malloc(maxStates * sizeof(uint32_t));
+     uint32_t* ownOutput = malloc(maxStates * sizeof(uint32_t));  // Pattern ending at the state, or UINT32_MAX
+     uint32_t* patternLengths = malloc((count > 0 ? count : 1) * sizeof(uint32_t));
+     uint32_t* outputStart = calloc(maxStates + 1, sizeof(uint32_t));
+     if (transitions == NULL || failure == NULL || queue == NULL || ownOutput == NULL ||
+         patternLengths == NULL || outputStart == NULL) {
+         free(transitions);
+         free(failure);
+         free(queue);
+         free(ownOutput);
+         free(patternLengths);
+         free(outputStart);
+         return false;
+     }
+     
+     // Insert the patterns into a trie; 0 is the root and doubles as "no child"
+     uint32_t stateCount = 1;
+     ownOutput[0] = UINT32_MAX;
+     for (size_t p = 0; p < count; p++) {
+         uint32_t state = 0;
+         patternLengths[p] = (uint32_t)strlen(patterns[p]);
+         for (const char* c = patterns[p]; *c != '\0'; c++) {
+             uint32_t* next = &transitions[state * symbols + automaton->symbolOf[(unsigned char)*c]];
+             if (*next == 0) {
+                 ownOutput[stateCount] = UINT32_MAX;
+                 *next = stateCount++;
+             }
+             state = *next;
+         }
+         if (state != 0 && ownOutput[state] == UINT32_MAX) {
+             ownOutput[state] = (uint32_t)p;  // Later duplicates keep the first (lowest) id
+         }
+     }
+     
+     // Breadth-first: resolve failure links and fill missing transitions
+     size_t head = 0;
+     size_t tail = 0;
+     for (uint32_t a = 1; a < symbols; a++) {
+         uint32_t child = transitions[a];
+         if (child != 0) {
+             failure[child] = 0;
+             queue[tail++] = child;
+         }
+     }
+     while (head < tail) {
+         uint32_t state = queue[head++];
+         for (uint32_t a = 1; a < symbols; a++) {
+             uint32_t* next = &transitions[state * symbols + a];
+             uint32_t fallback = transitions[failure[state] * symbols + a];
+             if (*next != 0) {
+                 failure[*next] = fallback;
+                 queue[tail++] = *next;
+             } else {
+                 *next = fallback;
+             }
+         }
+     }
+     
+     // Count, then flatten, every state's outputs along its failure chain
+     size_t outputCount = 0;
+     for (uint32_t state = 0; state < stateCount; state++) {
+         for (uint32_t s = state; s != 0; s = failure[s]) {
+             outputCount += ownOutput[s] != UINT32_MAX;
+         }
+     }
+     uint32_t* outputs = malloc((outputCount > 0 ? outputCount : 1) * sizeof(uint32_t));
+     if (outputs == NULL) {
+         free(transitions);
+         free(failure);
+         free(queue);
+         free(ownOutput);
+         free(patternLengths);
+         free(outputStart);
+         return false;
+     }
+     size_t written = 0;
+     for (uint32_t state = 0; state < stateCount; state++) {
+         outputStart[state] = (uint32_t)written;
+         for (uint32_t s = state; s != 0; s = failure[s]) {
+             if (ownOutput[s] != UINT32_MAX) {
+                 outputs[written++] = ownOutput[s];
+             }
+         }
+     }
+     outputStart[stateCount] = (uint32_t)written;
+     
+     free(failure);
+     free(queue);
+     free(ownOutput);
+     
+     automaton->symbolCount = symbols;
+     automaton->stateCount = stateCount;
+     automaton->transitions = transitions;
+     automaton->outputStart = outputStart;
+     automaton->outputs = outputs;
+     automaton->patternLengths = patternLengths;
+     automaton->patternCount = count;
+     return true;
+ }
+ 
+ /**
+  * @brief Reports every pattern occurrence in a text of known length
+  *
+  * @param automaton Automaton built with buildPatternAutomaton()
+  * @param text Bytes to scan; no terminator needed
+  * @param length Number of bytes in text
+  * @param callback Called with each match's pattern id and [start, end) range
+  * @param context Passed through to callback
+  */
+ void scanPatternAutomaton(const PatternAutomaton* automaton, const char* text, size_t length,
+                           PatternMatchCallback callback, void* context) {
+     const uint32_t symbols = automaton->symbolCount;
+     uint32_t state = 0;
+     
+     if (automaton->stateCount == 0) {
+         return;
+     }
+     
+     for (size_t i = 0; i < length; i++) {
+         state = automaton->transitions[state * symbols + automaton->symbolOf[(unsigned char)text[i]]];
+         for (uint32_t o = automaton->outputStart[state]; o < automaton->outputStart[state + 1]; o++) {
+             uint32_t id = automaton->outputs[o];
+             if (!callback(context, id, i + 1 - automaton->patternLengths[id], i + 1)) {
+                 return;
+             }
+         }
+     }
+ }
+ 
+ /*
+  * Near-duplicate detection
+  *
+  * containsUsername() and the denylist only find exact copies, so
+  * "j0hnsm1th" or "Password2025" after "Password2024" pass them. A
+  * NearMatcher finds the smallest Levenshtein distance between a word and
+  * any substring of a password with Myers' bit-parallel algorithm (in
+  * Hyyrö's formulation): the word's column of the dynamic programming
+  * matrix lives in two 64-bit vectors of positive and negative vertical
+  * deltas, so each password byte costs a handful of word operations
+  * whatever the word length. Both sides are first folded through
+  * leetFoldTable, which lowercases letters and maps common leetspeak
+  * substitutions to the letter they stand for. Words are limited to
+  * NEAR_MATCH_MAX_LENGTH bytes and, like the automaton, map bytes to a
+  * small symbol alphabet first.
+  */
+ 
+ #define LEET_FOLD(c) (((c) == '0') ? 'o' : \
+                       ((c) == '1' || (c) == '!' || (c) == '|' || (c) == 'l' || (c) == 'L') ? 'i' : \
+                       ((c) == '3') ? 'e' : \
+                       ((c) == '4' || (c) == '@') ? 'a' : \
+                       ((c) == '5' || (c) == '$') ? 's' : \
+                       ((c) == '7' || (c) == '+') ? 't' : \
+                       ((c) == '8') ? 'b' : ASCII_FOLD(c))
+ 
+ /* Byte after case and leetspeak folding; 'l' and '1' both become 'i' */
+ static const unsigned char leetFoldTable[256] = TABLE_256(LEET_FOLD);
+ 
+ /**
+  * @brief Prepares a word for near-duplicate search
+  *
+  * The word matches when some substring of a password is within
+  * length / NEAR_MATCH_CHARS_PER_EDIT edits of it, after folding.
+  *
+  * @param matcher Matcher to initialize; it holds no heap memory
+  * @param word Word bytes
+  * @param length Number of bytes in word, 1 to NEAR_MATCH_MAX_LENGTH
+  * @return true on success, false if the word is empty or too long
+  */
+ bool initNearMatcher(NearMatcher* matcher, const char* word, size_t length) {
+     if (length == 0 || length > NEAR_MATCH_MAX_LENGTH) {
+         return false;
+     }
+     
+     memset(matcher->symbolOf, 0, sizeof(matcher->symbolOf));
+     memset(matcher->peq, 0, sizeof(matcher->peq));
+     
+     // Symbol 0 stands for every byte not in the word
+     unsigned int symbols = 1;
+     unsigned char symbolOfFolded[256] = {0};
+     for (size_t i = 0; i < length; i++) {
+         unsigned char folded = leetFoldTable[(unsigned char)word[i]];
+         if (symbolOfFolded[folded] == 0) {
+             symbolOfFolded[folded] = (unsigned char)symbols++;
+         }
+         matcher->peq[symbolOfFolded[folded]] |= (uint64_t)1 << i;
+     }
+     for (unsigned int b = 0; b < 256; b++) {
+         matcher->symbolOf[b] = symbolOfFolded[leetFoldTable[b]];
+     }
+     
+     matcher->length = length;
+     matcher->maxDistance = length / NEAR_MATCH_CHARS_PER_EDIT;
+     return true;
+ }
+ 
+ /**
+  * @brief Smallest edit distance between the matcher's word and any substring of a text
+  *
+  * @param matcher Matcher built with initNearMatcher()
+  * @param text Text bytes, usually a password
+  * @param length Number of bytes in text
+  * @return Edit distance after folding; the word length if nothing matches better
+  */
+ size_t nearMatchDistance(const NearMatcher* matcher, const char* text, size_t length) {
+     const uint64_t last = (uint64_t)1 << (matcher->length - 1);
+     uint64_t positive = ~(uint64_t)0;   // Vertical deltas of +1
+     uint64_t negative = 0;              // Vertical deltas of -1
+     size_t score = matcher->length;
+     size_t best = score;
+     
+     for (size_t i = 0; i < length; i++) {
+         uint64_t equal = matcher->peq[matcher->symbolOf[(unsigned char)text[i]]];
+         uint64_t verticalX = equal | negative;
+         uint64_t horizontalX = (((equal & positive) + positive) ^ positive) | equal;
+         uint64_t horizontalPositive = negative | ~(horizontalX | positive);
+         uint64_t horizontalNegative = positive & horizontalX;
+         
+         score += (horizontalPositive & last) != 0;
+         score -= (horizontalNegative & last) != 0;
+         best = score < best ? score : best;
+         
+         // The top row stays 0, so a match may start anywhere in the text
+         horizontalPositive <<= 1;
+         horizontalNegative <<= 1;
+         positive = horizontalNegative | ~(verticalX | horizontalPositive);
+         negative = horizontalPositive & verticalX;
+     }
+     return best;
+ }
+ 
+ /**
+  * @brief Checks if a text contains a near copy of the matcher's word
+  *
+  * @return true if nearMatchDistance() is at most the word's allowed edits
+  */
+ bool nearMatchFinds(const NearMatcher* matcher, const char* text, size_t length) {
+     return nearMatchDistance(matcher, text, length) <= matcher->maxDistance;
+ }
+ 
+ /*
+  * Subject contexts
+  *
+  * A password-change flow checks many candidates against the same account.
+  * initSubjectContext() does the per-account work once: it folds the
+  * username and builds its search table, and compiles the account's
+  * denylist (previous passwords, the local part of the e-mail address,
+  * other personal words) into one PatternAutomaton, and prepares a
+  * NearMatcher for the username and each of those words. Each check then
+  * costs the classification pass plus one scan per structure. A SubjectCache
+  * keeps the contexts of recently seen accounts, evicting the least
+  * recently used one when full; it is meant for a few dozen to a few
+  * hundred entries and is searched linearly.
+  */
+ 
+ /* Marks the end of a cache recency list */
+ #define SUBJECT_CACHE_NONE UINT32_MAX
+ 
+ typedef struct {
+     char* username;              // Key, or NULL if the entry is unused
+     uint64_t hash;               // indexChecksum() of the key
+     SubjectContext context;
+     uint32_t newer;              // Neighbours in recency order
+     uint32_t older;
+ } SubjectCacheEntry;
+ 
+ struct SubjectCache {
+     SubjectCacheEntry* entries;
+     size_t capacity;
+     size_t count;
+     uint32_t newest;
+     uint32_t oldest;
+ };
+ 
+ /* Adds a near matcher for a word if its length suits one */
+ static inline void addNearWord(SubjectContext* context, const char* word, size_t length) {
+     if (length >= SUBJECT_MIN_DENIED_LENGTH && initNearMatcher(&context->near[context->nearCount], word, length)) {
+         context->nearCount++;
+     }
+ }
+ 
+ /**
+  * @brief Prepares the per-account state used by the subject validators
+  *
+  * The e-mail local part is taken up to the first '+' or '@'. Denylist
+  * words shorter than SUBJECT_MIN_DENIED_LENGTH bytes are ignored, since
+  * they would reject too many unrelated passwords.
+  *
+  * @param context Context to initialize; release it with freeSubjectContext()
+  * @param username User's username
+  * @param email User's e-mail address, or NULL
+  * @param denied Previous passwords and other personal words, or NULL
+  * @param deniedCount Number of entries in denied
+  * @return true on success, false if memory could not be allocated
+  */
+ bool initSubjectContext(SubjectContext* context, const char* username, const char* email,
+                         const char* const* denied, size_t deniedCount) {
+     memset(context, 0, sizeof(*context));
+     if (!initUsernameMatcher(&context->username, username)) {
+         return false;
+     }
+     
+     const char** words = malloc((deniedCount + 1) * sizeof(const char*));
+     char* localPart = NULL;
+     if (words == NULL) {
+         freeUsernameMatcher(&context->username);
+         return false;
+     }
+     
+     bool built = true;
+     size_t wordCount = 0;
+     for (size_t i = 0; i < deniedCount; i++) {
+         if (strlen(denied[i]) >= SUBJECT_MIN_DENIED_LENGTH) {
+             words[wordCount++] = denied[i];
+         }
+     }
+     size_t localLength = email != NULL ? strcspn(email, "+@") : 0;
+     if (localLength >= SUBJECT_MIN_DENIED_LENGTH) {
+         localPart = malloc(localLength + 1);
+         built = localPart != NULL;
+         if (built) {
+             memcpy(localPart, email, localLength);
+             localPart[localLength] = '\0';
+             words[wordCount++] = localPart;
+         }
+     }
+     
+     if (built && wordCount > 0) {
+         built = buildPatternAutomaton(&context->denylist, words, wordCount);
+         context->hasDenylist = built;
+     }
+     if (built) {
+         context->near = malloc((wordCount + 1) * sizeof(NearMatcher));
+         built = context->near != NULL;
+     }
+     if (built) {
+         addNearWord(context, username, strlen(username));
+         for (size_t i = 0; i < wordCount; i++) {
+             addNearWord(context, words[i], strlen(words[i]));
+         }
+     }
+     free(localPart);
+     free(words);
+     
+     if (!built) {
+         freeSubjectContext(context);
+         return false;
+     }
+     return true;
+ }
+ 
+ /**
+  * @brief Releases the memory held by a subject context
+  */
+ void freeSubjectContext(SubjectContext* context) {
+     freeUsernameMatcher(&context->username);
+     if (context->hasDenylist) {
+         freePatternAutomaton(&context->denylist);
+     }
+     context->hasDenylist = false;
+     free(context->near);
+     context->near = NULL;
+     context->nearCount = 0;
+ }
+ 
+ /**
+  * @brief Makes a context's checks also reject the user's remembered passwords
+  *
+  * The user's record tag is computed once here, so each check costs one
+  * fingerprint of the password.
+  *
+  * @param context Context built with initSubjectContext()
+  * @param history History to consult, which must outlive the context; NULL to detach
+  * @param username Username the history is keyed by
+  */
+ void attachPasswordHistory(SubjectContext* context, const PasswordHistory* history, const char* username) {
+     context->history = history;
+     context->historyTag = history != NULL ? historyUserTag(history, username, strlen(username)) : 0;
+ }
+ 
+ /* Stops the denylist scan at the first match */
+ static bool noteDenylistMatch(void* context, size_t patternId, size_t start, size_t end) {
+     (void)patternId;
+     (void)start;
+     (void)end;
+     *(bool*)context = true;
+     return false;
+ }
+ 
+ /**
+  * @brief Adds the denylist, history and near-match failures of a password to a mask
+  *
+  * @param failures Failures found so far; RULE_SIMILAR is only tested while
+  *                 none of the exact account rules is among them
+  * @return failures with RULE_DENYLISTED, RULE_REUSED and RULE_SIMILAR added as found
+  */
+ static unsigned int addSubjectWordFailures(const SubjectContext* context, const char* password, size_t length,
+                                            unsigned int failures) {
+     if (context->hasDenylist) {
+         bool found = false;
+         scanPatternAutomaton(&context->denylist, password, length, noteDenylistMatch, &found);
+         if (found) {
+             failures |= RULE_DENYLISTED;
+         }
+     }
+     if (context->history != NULL && historyHasFingerprint(context->history, context->historyTag, password, length)) {
+         failures |= RULE_REUSED;
+     }
+     if ((failures & (RULE_CONTAINS_USERNAME | RULE_DENYLISTED | RULE_REUSED)) == 0) {
+         for (size_t i = 0; i < context->nearCount; i++) {
+             if (nearMatchFinds(&context->near[i], password, length)) {
+                 failures |= RULE_SIMILAR;
+                 break;
+             }
+         }
+     }
+     return failures;
+ }
+ 
+ /**
+  * @brief Lists every strong password rule a password of known length fails for one account
+  *
+  * Same mask as strongPasswordFailuresBytes() with the context's username,
+  * plus RULE_DENYLISTED if the password contains a denylist word,
+  * case-insensitively, and RULE_REUSED if it is in an attached history.
+  * RULE_SIMILAR is added when no exact rule caught the password but it
+  * contains a near copy of the username or a denylist word: within
+  * NearMatcher.maxDistance edits after leetspeak folding.
+  *
+  * @param context Context built with initSubjectContext()
+  * @param password Password bytes to validate
+  * @param length Number of bytes in password
+  * @return Mask of RULE_* bits, 0 if the password is strong
+  */
+ unsigned int subjectPasswordFailuresBytes(const SubjectContext* context, const char* password, size_t length) {
+     uint64_t start;
+     StatsThread* stats = beginStatsCheck(&start);
+     PasswordFeatures features;
+     classifyPasswordBytes(password, length, &features);
+     
+     unsigned int failures = strongRuleFailures(&features);
+     if (matcherFindsUsernameBytes(&context->username, password, length)) {
+         failures |= RULE_CONTAINS_USERNAME;
+     }
+     failures = addSubjectWordFailures(context, password, length, failures);
+     endStatsCheck(stats, start, failures);
+     return failures;
+ }
+ 
+ /**
+  * @brief Lists every strong password rule a password fails for one account
+  *
+  * @param context Context built with initSubjectContext()
+  * @param password Password to validate
+  * @return Mask of RULE_* bits, 0 if the password is strong
+  */
+ unsigned int subjectPasswordFailures(const SubjectContext* context, const char* password) {
+     return subjectPasswordFailuresBytes(context, password, strlen(password));
+ }
+ 
+ /**
+  * @brief Lists every strong password rule a UTF-8 password fails for one account
+  *
+  * The rules of strongPasswordFailuresUtf8() with the context's username,
+  * then the denylist, history and near-match checks of
+  * subjectPasswordFailuresBytes() on the password's NFKC form. Record the
+  * NFKC form from normalizeUtf8Nfkc() in the history so later checks see
+  * the same bytes. When both the password and the username are ASCII this
+  * is subjectPasswordFailuresBytes().
+  *
+  * @param context Context built with initSubjectContext()
+  * @param password UTF-8 password bytes to validate
+  * @param length Number of bytes in password
+  * @return Mask of RULE_* bits, 0 if the password is strong
+  */
+ unsigned int subjectPasswordFailuresUtf8(const SubjectContext* context, const char* password, size_t length) {
+     const UsernameMatcher* username = &context->username;
+     if (isAsciiBytes(password, length) && isAsciiBytes(username->folded, username->length)) {
+         return subjectPasswordFailuresBytes(context, password, length);
+     }
+     
+     uint64_t start;
+     StatsThread* stats = beginStatsCheck(&start);
+     ScratchArena* arena = threadScratchArena();
+     ScratchArenaMark mark = markScratchArena(arena);
+     uint32_t* passwordCodes = NULL;
+     uint32_t* usernameCodes = NULL;
+     size_t passwordCount = normalizeUtf8Codes(password, length, arena, &passwordCodes);
+     size_t usernameCount = passwordCount < UTF8_NO_MEMORY
+                                ? normalizeUtf8Codes(username->folded, username->length, arena, &usernameCodes)
+                                : 0;
+     // Each code point takes at most 4 bytes of UTF-8
+     char* normalized = passwordCount < UTF8_NO_MEMORY ? arenaAllocate(arena, 4 * passwordCount + 1) : NULL;
+     
+     unsigned int failures;
+     if (passwordCount == UTF8_INVALID) {
+         failures = RULE_INVALID_UTF8;
+     } else if (passwordCount == UTF8_NO_MEMORY || usernameCount == UTF8_NO_MEMORY || normalized == NULL) {
+         failures = RULE_TOO_LONG;
+     } else {
+         size_t normalizedLength = 0;
+         for (size_t i = 0; i < passwordCount; i++) {
+             normalizedLength += encodeUtf8(passwordCodes[i], normalized + normalizedLength);
+         }
+         PasswordFeatures features;
+         classifyCodes(passwordCodes, passwordCount, &features);
+         failures = strongRuleFailures(&features);
+         bool found = usernameCount == UTF8_INVALID
+                          ? matcherFindsUsernameBytes(username, password, length)
+                          : codesContainFolded(passwordCodes, passwordCount, usernameCodes, usernameCount, arena);
+         if (found) {
+             failures |= RULE_CONTAINS_USERNAME;
+         }
+         failures = addSubjectWordFailures(context, normalized, normalizedLength, failures);
+     }
+     releaseScratchArena(arena, mark);
+     endStatsCheck(stats, start, failures);
+     return failures;
+ }
+ 
+ /**
+  * @brief Validates a password against the strong criteria and the account's denylist
+  *
+  * @param context Context built with initSubjectContext()
+  * @param password Password to validate
+  * @return true if password meets all criteria, false otherwise
+  */
+ bool isStrongPasswordForSubject(const SubjectContext* context, const char* password) {
+     return subjectPasswordFailures(context, password) == 0;
+ }
+ 
+ /**
+  * @brief Creates an empty cache holding at most capacity accounts
+  *
+  * A cache is not synchronized; give each thread its own or lock around it.
+  *
+  * @return The cache, or NULL if it could not be allocated
+  */
+ SubjectCache* createSubjectCache(size_t capacity) {
+     if (capacity == 0 || capacity >= SUBJECT_CACHE_NONE) {
+         return NULL;
+     }
+     SubjectCache* cache = calloc(1, sizeof(SubjectCache));
+     if (cache == NULL) {
+         return NULL;
+     }
+     cache->entries = calloc(capacity, sizeof(SubjectCacheEntry));
+     if (cache->entries == NULL) {
+         free(cache);
+         return NULL;
+     }
+     cache->capacity = capacity;
+     cache->newest = SUBJECT_CACHE_NONE;
+     cache->oldest = SUBJECT_CACHE_NONE;
+     return cache;
+ }
+ 
+ /**
+  * @brief Unlinks an entry from the recency list
+  */
+ static void unlinkSubjectEntry(SubjectCache* cache, uint32_t index) {
+     SubjectCacheEntry* entry = &cache->entries[index];
+     if (entry->newer != SUBJECT_CACHE_NONE) {
+         cache->entries[entry->newer].older = entry->older;
+     } else {
+         cache->newest = entry->older;
+     }
+     if (entry->older != SUBJECT_CACHE_NONE) {
+         cache->entries[entry->older].newer = entry->newer;
+     } else {
+         cache->oldest = entry->newer;
+     }
+ }
+ 
+ /**
+  * @brief Links an entry in as the most recently used
+  */
+ static void pushNewestSubjectEntry(SubjectCache* cache, uint32_t index) {
+     SubjectCacheEntry* entry = &cache->entries[index];
+     entry->newer = SUBJECT_CACHE_NONE;
+     entry->older = cache->newest;
+     if (cache->newest != SUBJECT_CACHE_NONE) {
+         cache->entries[cache->newest].newer = index;
+     } else {
+         cache->oldest = index;
+     }
+     cache->newest = index;
+ }
+ 
+ /**
+  * @brief Frees an entry's context and key and unlinks it
+  */
+ static void dropSubjectEntry(SubjectCache* cache, uint32_t index) {
+     SubjectCacheEntry* entry = &cache->entries[index];
+     unlinkSubjectEntry(cache, index);
+     freeSubjectContext(&entry->context);
+     free(entry->username);
+     entry->username = NULL;
+     cache->count--;
+ }
+ 
+ /**
+  * @brief Finds a cached account
+  *
+  * @return Entry index, or SUBJECT_CACHE_NONE if the account is not cached
+  */
+ static uint32_t findSubjectEntry(const SubjectCache* cache, const char* username, uint64_t hash) {
+     for (size_t i = 0; i < cache->capacity; i++) {
+         const SubjectCacheEntry* entry = &cache->entries[i];
+         if (entry->username != NULL && entry->hash == hash && strcmp(entry->username, username) == 0) {
+             return (uint32_t)i;
+         }
+     }
+     return SUBJECT_CACHE_NONE;
+ }
+ 
+ /**
+  * @brief Releases a cache and every context in it
+  */
+ void freeSubjectCache(SubjectCache* cache) {
+     for (size_t i = 0; i < cache->capacity; i++) {
+         if (cache->entries[i].username != NULL) {
+             freeSubjectContext(&cache->entries[i].context);
+             free(cache->entries[i].username);
+         }
+     }
+     free(cache->entries);
+     free(cache);
+ }
+ 
+ /**
+  * @brief Returns the cached context of an account and marks it most recently used
+  *
+  * @return The context, valid until the account is replaced, forgotten or
+  *         evicted, or NULL if it is not cached
+  */
+ const SubjectContext* lookupSubjectContext(SubjectCache* cache, const char* username) {
+     uint32_t index = findSubjectEntry(cache, username, indexChecksum(username, strlen(username)));
+     if (index == SUBJECT_CACHE_NONE) {
+         return NULL;
+     }
+     unlinkSubjectEntry(cache, index);
+     pushNewestSubjectEntry(cache, index);
+     return &cache->entries[index].context;
+ }
+ 
+ /**
+  * @brief Builds an account's context and caches it, replacing any previous one
+  *
+  * Call it again after the account's password or e-mail changes. When the
+  * cache is full the least recently used account is evicted.
+  *
+  * @param cache Cache from createSubjectCache()
+  * @param username User's username, also the cache key
+  * @param email User's e-mail address, or NULL
+  * @param denied Previous passwords and other personal words, or NULL
+  * @param deniedCount Number of entries in denied
+  * @return The context, valid until the account is replaced, forgotten or
+  *         evicted, or NULL if memory could not be allocated
+  */
+ const SubjectContext* cacheSubjectContext(SubjectCache* cache, const char* username, const char* email,
+                                           const char* const* denied, size_t deniedCount) {
+     size_t usernameLength = strlen(username);
+     uint64_t hash = indexChecksum(username, usernameLength);
+     
+     uint32_t index = findSubjectEntry(cache, username, hash);
+     if (index != SUBJECT_CACHE_NONE) {
+         dropSubjectEntry(cache, index);
+     } else if (cache->count == cache->capacity) {
+         index = cache->oldest;
+         dropSubjectEntry(cache, index);
+     } else {
+         for (index = 0; cache->entries[index].username != NULL; index++) {
+         }
+     }
+     
+     SubjectCacheEntry* entry = &cache->entries[index];
+     entry->username = malloc(usernameLength + 1);
+     if (entry->username == NULL) {
+         return NULL;
+     }
+     if (!initSubjectContext(&entry->context, username, email, denied, deniedCount)) {
+         free(entry->username);
+         entry->username = NULL;
+         return NULL;
+     }
+     memcpy(entry->username, username, usernameLength + 1);
+     entry->hash = hash;
+     pushNewestSubjectEntry(cache, index);
+     cache->count++;
+     return &entry->context;
+ }
+ 
+ /**
+  * @brief Drops an account from the cache, if present
+  */
+ void forgetSubjectContext(SubjectCache* cache, const char* username) {
+     uint32_t index = findSubjectEntry(cache, username, indexChecksum(username, strlen(username)));
+     if (index != SUBJECT_CACHE_NONE) {
+         dropSubjectEntry(cache, index);
+     }
+ }
+ 
+ /*
+  * Strength scoring
+  *
+  * A zxcvbn-style estimate of how many guesses an attacker needs. Pattern
+  * matchers (common passwords and words, the username, keyboard walks,
+  * repeats, sequences and years/dates) collect candidate matches with a
+  * guess count each. A dynamic program then picks the cover of the password
+  * with the fewest total guesses, filling the gaps by brute force over the
+  * character classes reported by classifyPasswordBytes(). Only the first
+  * SCORE_MAX_LENGTH bytes are matched and at most SCORE_MAX_MATCHES matches
+  * are kept, so adversarial inputs cost a bounded amount of work. Bytes
+  * past the limit add no guesses: they are unanalyzed and may well continue
+  * a pattern, and pricing them as brute force would let padding a repeat or
+  * a word raise its score. Years are priced by their distance from the
+  * current year, read once when the library loads.
+  */
+ 
+ #define SCORE_MAX_LENGTH 64
+ #define SCORE_MAX_MATCHES 512
+ #define SCORE_FALLBACK_YEAR 2025  // Reference year when the clock cannot be read
+ #define SCORE_MIN_YEAR_SPACE 20
+ 
+ typedef struct {
+     unsigned char start;   // First byte of the match
+     unsigned char end;     // One past the last byte
+     unsigned char pattern; // PATTERN_* bit
+     double guessesLog10;
+ } ScoreMatch;
+ 
+ typedef struct {
+     ScoreMatch matches[SCORE_MAX_MATCHES];
+     size_t count;
+ } ScoreMatchList;
+ 
+ /* Common passwords and words, most common first; the rank is the guess count */
+ static const char* const scoreDictionary[] = {
+     "password", "123456", "qwerty", "letmein", "welcome", "admin", "monkey", "dragon",
+     "football", "baseball", "iloveyou", "master", "sunshine", "princess", "shadow", "login",
+     "abc123", "passw0rd", "starwars", "trustno1", "superman", "batman", "hello", "freedom",
+     "whatever", "michael", "jordan", "charlie", "summer", "winter", "spring", "autumn",
+     "secret", "love", "pass", "strong", "default", "user", "test", "guest", "root",
+     "changeme", "company", "account", "computer", "internet", "service", "office", "london",
+     "berlin", "paris", "soccer", "hockey", "killer", "pepper", "ginger", "cookie", "flower",
+     "orange", "banana", "purple", "silver", "golden", "diamond", "tiger", "angel", "lucky",
+     "happy", "money", "access", "hunter", "ranger", "buster", "thomas", "robert",
+     "daniel", "andrew", "jessica", "ashley", "nicole", "matrix", "mustang", "corvette",
+     "samsung", "google", "apple", "windows", "linux", "server", "network", "security",
+     "system", "manager", "support", "qazwsx", "zaq12wsx", "asdf", "zxcv", "abcd", "1234"
+ };
+ 
+ /* US QWERTY rows, unshifted and shifted, and each row's horizontal offset in quarter keys */
+ static const char* const keyboardRows[4] = {
+     "`1234567890-=", "qwertyuiop[]\\", "asdfghjkl;'", "zxcvbnm,./"
+ };
+ static const char* const keyboardShiftedRows[4] = {
+     "~!@#$%^&*()_+", "QWERTYUIOP{}|", "ASDFGHJKL:\"", "ZXCVBNM<>?"
+ };
+ static const int keyboardRowOffset[4] = {0, 6, 7, 9};
+ 
+ /**
+  * @brief Records a candidate match unless the list is full
+  *
+  * @return false once SCORE_MAX_MATCHES matches have been collected
+  */
+ static bool addScoreMatch(ScoreMatchList* list, size_t start, size_t end, unsigned int pattern,
+                           double guessesLog10) {
+     if (list->count == SCORE_MAX_MATCHES) {
+         return false;
+     }
+     
+     ScoreMatch* match = &list->matches[list->count++];
+     match->start = (unsigned char)start;
+     match->end = (unsigned char)end;
+     match->pattern = (unsigned char)pattern;
+     match->guessesLog10 = guessesLog10 > 0.0 ? guessesLog10 : 0.0;
+     return true;
+ }
+ 
+ /**
+  * @brief log10 of the number of ways to capitalize a lowercase word the way it appears
+  */
+ static double uppercaseVariationsLog10(const char* word, size_t length) {
+     size_t upper = 0;
+     size_t lower = 0;
+     
+     for (size_t i = 0; i < length; i++) {
+         unsigned int charClass = asciiClassTable[(unsigned char)word[i]];
+         upper += (charClass & CLASS_UPPER) != 0;
+         lower += (charClass & CLASS_LOWER) != 0;
+     }
+     
+     if (upper == 0) {
+         return 0.0;
+     }
+     if (lower == 0 || (upper == 1 && (asciiClassTable[(unsigned char)word[0]] & CLASS_UPPER))) {
+         return log10(2.0);  // All caps or only the first letter capitalized
+     }
+     
+     // Sum of C(upper + lower, i) for i up to the smaller count
+     double variations = 0.0;
+     double binomial = 1.0;
+     size_t letters = upper + lower;
+     size_t smaller = upper < lower ? upper : lower;
+     for (size_t i = 1; i <= smaller; i++) {
+         binomial = binomial * (double)(letters - i + 1) / (double)i;
+         variations += binomial;
+     }
+     return log10(variations);
+ }
+ 
+ /* Year that years in passwords are priced against */
+ static int scoreReferenceYear = SCORE_FALLBACK_YEAR;
+ 
+ __attribute__((constructor))
+ static void readScoreReferenceYear(void) {
+     time_t now = time(NULL);
+     struct tm calendar;
+     if (now != (time_t)-1 && gmtime_r(&now, &calendar) != NULL) {
+         scoreReferenceYear = calendar.tm_year + 1900;
+     }
+ }
+ 
+ /* Automaton over scoreDictionary, built once at startup; pattern ids are ranks */
+ static PatternAutomaton dictionaryAutomaton;
+ 
+ __attribute__((constructor))
+ static void buildDictionaryAutomaton(void) {
+     // On allocation failure the automaton stays empty and finds nothing
+     buildPatternAutomaton(&dictionaryAutomaton, scoreDictionary,
+                           sizeof(scoreDictionary) / sizeof(scoreDictionary[0]));
+ }
  
- /* Function Prototypes */
- bool isStrongPassword(const char* username, const char* password);
- bool isStrongDefaultPassword(const char* username, const char* password);
- void generateDefaultPassword(char* default_password, const char* username);
- bool promptForNewPassword(char* customPassword, const char* username);
+ typedef struct {
+     ScoreMatchList* list;
+     const char* password;
+ } DictionaryScan;
  
  /**
-  * @brief Checks if password contains at least 4 consecutive alphabetic characters
-  *
-  * @param pwd Password string to check
-  * @return true if contains 4+ consecutive letters, false otherwise
+  * @brief Turns one automaton hit into a dictionary match priced by rank and capitalization
   */
- bool containsString(const char* pwd) {
-     int consecutiveLetters = 0;
+ static bool addDictionaryMatch(void* context, size_t patternId, size_t start, size_t end) {
+     DictionaryScan* scan = context;
+     double guessesLog10 = log10((double)(patternId + 1)) +
+                           uppercaseVariationsLog10(scan->password + start, end - start);
+     return addScoreMatch(scan->list, start, end, PATTERN_DICTIONARY, guessesLog10);
+ }
+ 
+ /**
+  * @brief Finds dictionary words anywhere in the password, case-insensitively, in one pass
+  */
+ static void matchDictionary(ScoreMatchList* list, const char* password, size_t length) {
+     DictionaryScan scan = {list, password};
+     scanPatternAutomaton(&dictionaryAutomaton, password, length, addDictionaryMatch, &scan);
+ }
+ 
+ /**
+  * @brief Finds every occurrence of the username with the containsUsername() matcher tables
+  */
+ static void matchUsername(ScoreMatchList* list, const char* username, size_t usernameLength,
+                           const char* password, const char* folded, size_t length) {
+     ScratchArena* arena = threadScratchArena();
+     ScratchArenaMark mark = markScratchArena(arena);
+     UsernameMatcher matcher;
+     
+     if (usernameLength == 0 || usernameLength > length ||
+         !initUsernameMatcherArena(&matcher, username, usernameLength, arena)) {
+         releaseScratchArena(arena, mark);
+         return;
+     }
      
-     while (*pwd != '\0') {
-         if (isalpha(*pwd)) {
-             consecutiveLetters++;
-             if (consecutiveLetters >= 4) {
-                 return true;
+     size_t matched = 0;
+     for (size_t i = 0; i < length; i++) {
+         while (matched > 0 && folded[i] != matcher.folded[matched]) {
+             matched = matcher.failure[matched - 1];
+         }
+         if (folded[i] == matcher.folded[matched]) {
+             matched++;
+         }
+         if (matched == matcher.length) {
+             size_t start = i + 1 - matcher.length;
+             if (!addScoreMatch(list, start, i + 1, PATTERN_USERNAME,
+                                uppercaseVariationsLog10(password + start, matcher.length))) {
+                 break;
              }
-         } else {
-             consecutiveLetters = 0;
+             matched = matcher.failure[matched - 1];
          }
-         pwd++;
      }
      
-     return false;
+     releaseScratchArena(arena, mark);
  }
  
  /**
-  * @brief Checks if password contains at least one uppercase letter
+  * @brief Looks up a character's key position in quarter-key units
   *
-  * @param pwd Password string to check
-  * @return true if contains uppercase, false otherwise
+  * @return false if the character is not on the main QWERTY block
   */
- bool hasUpper(const char* pwd) {
-     for (int i = 0; pwd[i] != '\0'; i++) {
-         if (isupper(pwd[i])) {
+ static bool keyboardPosition(char c, int* row, int* x) {
+     if (c == '\0') {
+         return false;
+     }
+     
+     for (int r = 0; r < 4; r++) {
+         const char* unshifted = strchr(keyboardRows[r], c);
+         const char* shifted = strchr(keyboardShiftedRows[r], c);
+         const char* found = unshifted != NULL ? unshifted : shifted;
+         
+         if (found != NULL) {
+             const char* rowStart = unshifted != NULL ? keyboardRows[r] : keyboardShiftedRows[r];
+             *row = r;
+             *x = 4 * (int)(found - rowStart) + keyboardRowOffset[r];
              return true;
          }
      }
@@ -66,246 +5135,631 @@
  }
  
  /**
-  * @brief Checks if password contains at least one digit
-  *
-  * @param pwd Password string to check
-  * @return true if contains digit, false otherwise
+  * @brief Finds runs of three or more physically adjacent keys
   */
- bool hasDigit(const char* pwd) {
-     for (int i = 0; pwd[i] != '\0'; i++) {
-         if (isdigit(pwd[i])) {
-             return true;
+ static void matchKeyboardWalks(ScoreMatchList* list, const char* password, size_t length) {
+     size_t start = 0;
+     int previousRow = 0;
+     int previousX = 0;
+     bool previousOnKeyboard = false;
+     
+     for (size_t i = 0; i <= length; i++) {
+         int row = 0;
+         int x = 0;
+         bool onKeyboard = i < length && keyboardPosition(password[i], &row, &x);
+         bool adjacent = false;
+         
+         if (onKeyboard && previousOnKeyboard) {
+             int dx = x > previousX ? x - previousX : previousX - x;
+             int dy = row > previousRow ? row - previousRow : previousRow - row;
+             adjacent = (dy == 0 && dx == 4) || (dy == 1 && dx < 4);
          }
+         
+         if (!adjacent) {
+             // A key has about four neighbours; a walk can start on any of 47 keys
+             if (i - start >= 3 &&
+                 !addScoreMatch(list, start, i, PATTERN_KEYBOARD,
+                                log10(47.0) + (double)(i - start - 1) * log10(4.0))) {
+                 return;
+             }
+             start = i;
+         }
+         
+         previousOnKeyboard = onKeyboard;
+         previousRow = row;
+         previousX = x;
      }
+ }
+ 
+ /**
+  * @brief Number of symbols in a character's class, used to price repeats and gaps
+  */
+ static double classCardinality(unsigned char c) {
+     unsigned int charClass = asciiClassTable[c];
      
-     return false;
+     if (charClass & CLASS_ALPHA) {
+         return 26.0;
+     }
+     if (charClass & CLASS_DIGIT) {
+         return 10.0;
+     }
+     return 33.0;
  }
  
  /**
-  * @brief Checks if password contains at least one lowercase letter
-  *
-  * @param pwd Password string to check
-  * @return true if contains lowercase, false otherwise
+  * @brief Finds repeated characters ("aaa") and repeated short blocks ("abcabc")
   */
- bool hasLower(const char* pwd) {
-     for (int i = 0; pwd[i] != '\0'; i++) {
-         if (islower(pwd[i])) {
-             return true;
+ static void matchRepeats(ScoreMatchList* list, const char* password, size_t length) {
+     for (size_t period = 1; period <= 4; period++) {
+         // password[i] == password[i - period] for every i in [runStart, i)
+         size_t runStart = period;
+         
+         for (size_t i = period; i <= length; i++) {
+             if (i < length && password[i] == password[i - period]) {
+                 continue;
+             }
+             
+             size_t start = runStart - period;
+             size_t span = i - start;
+             if (i > runStart && span >= 2 * period && span >= 3) {
+                 double unitLog10 = 0.0;
+                 for (size_t k = 0; k < period; k++) {
+                     unitLog10 += log10(classCardinality((unsigned char)password[start + k]));
+                 }
+                 if (!addScoreMatch(list, start, i, PATTERN_REPEAT,
+                                    unitLog10 + log10((double)span / (double)period))) {
+                     return;
+                 }
+             }
+             runStart = i + 1;
          }
      }
+ }
+ 
+ /**
+  * @brief Finds ascending or descending runs such as "abcd", "6543" or "XYZ"
+  */
+ static void matchSequences(ScoreMatchList* list, const char* password, size_t length) {
+     size_t start = 0;
      
-     return false;
+     while (start + 2 < length) {
+         unsigned char first = (unsigned char)password[start];
+         unsigned int charClass = asciiClassTable[first];
+         int delta = (int)(unsigned char)password[start + 1] - (int)first;
+         size_t end = start + 1;
+         
+         if (charClass != 0 && (delta == 1 || delta == -1)) {
+             while (end < length &&
+                    asciiClassTable[(unsigned char)password[end]] == charClass &&
+                    (int)(unsigned char)password[end] - (int)(unsigned char)password[end - 1] == delta) {
+                 end++;
+             }
+         }
+         
+         if (end - start >= 3) {
+             // Runs starting at an obvious point ('a', 'z', '0', '1', '9') are tried first
+             bool obvious = strchr("aAzZ019", (char)first) != NULL;
+             double base = obvious ? 4.0 : (charClass & CLASS_DIGIT) ? 10.0 : 26.0;
+             double guesses = base * (double)(end - start) * (delta < 0 ? 2.0 : 1.0);
+             if (!addScoreMatch(list, start, end, PATTERN_SEQUENCE, log10(guesses))) {
+                 return;
+             }
+             start = end;
+         } else {
+             start++;
+         }
+     }
  }
  
  /**
-  * @brief Checks if password meets minimum length requirement (8 characters)
-  *
-  * @param pwd Password string to check
-  * @return true if length is sufficient, false otherwise
+  * @brief Years from 1900 to 2099 are priced by their distance from the current year
   */
- bool hasMinimumLength(const char* pwd) {
-     return strlen(pwd) >= 8;
+ static double yearGuessesLog10(int year) {
+     int space = year > scoreReferenceYear ? year - scoreReferenceYear : scoreReferenceYear - year;
+     return log10((double)(space > SCORE_MIN_YEAR_SPACE ? space : SCORE_MIN_YEAR_SPACE));
  }
  
  /**
-  * @brief Checks if password contains only alphanumeric characters
-  *
-  * @param pwd Password string to check
-  * @return true if alphanumeric only, false if contains special characters
+  * @brief Parses n decimal digits
   */
- bool isAlphanumericOnly(const char* pwd) {
-     for (int i = 0; pwd[i] != '\0'; i++) {
-         if (!isalnum(pwd[i])) {
-             return false;
+ static int parseDigits(const char* digits, size_t n) {
+     int value = 0;
+     for (size_t i = 0; i < n; i++) {
+         value = value * 10 + (digits[i] - '0');
+     }
+     return value;
+ }
+ 
+ /**
+  * @brief Checks a day/month pair for plausibility
+  */
+ static bool isPlausibleDayMonth(int day, int month) {
+     return month >= 1 && month <= 12 && day >= 1 && day <= 31;
+ }
+ 
+ /**
+  * @brief Finds 4-digit years and 6/8-digit dates (DDMMYY, MMDDYY, YYYYMMDD, DDMMYYYY)
+  */
+ static void matchDates(ScoreMatchList* list, const char* password, size_t length) {
+     for (size_t start = 0; start < length; start++) {
+         size_t digits = 0;
+         while (start + digits < length && (asciiClassTable[(unsigned char)password[start + digits]] & CLASS_DIGIT)) {
+             digits++;
+         }
+         
+         for (size_t n = 4; n <= 8 && n <= digits; n += 2) {
+             const char* d = password + start;
+             double guessesLog10 = -1.0;
+             
+             if (n == 4) {
+                 int year = parseDigits(d, 4);
+                 if (year >= 1900 && year <= 2099) {
+                     guessesLog10 = yearGuessesLog10(year);
+                 }
+             } else if (n == 6) {
+                 int year = parseDigits(d + 4, 2);
+                 year += year < 50 ? 2000 : 1900;
+                 if (isPlausibleDayMonth(parseDigits(d, 2), parseDigits(d + 2, 2)) ||
+                     isPlausibleDayMonth(parseDigits(d + 2, 2), parseDigits(d, 2))) {
+                     guessesLog10 = log10(365.0) + yearGuessesLog10(year);
+                 }
+             } else {
+                 int leadingYear = parseDigits(d, 4);
+                 int trailingYear = parseDigits(d + 4, 4);
+                 if (leadingYear >= 1900 && leadingYear <= 2099 &&
+                     isPlausibleDayMonth(parseDigits(d + 6, 2), parseDigits(d + 4, 2))) {
+                     guessesLog10 = log10(365.0) + yearGuessesLog10(leadingYear);
+                 } else if (trailingYear >= 1900 && trailingYear <= 2099 &&
+                            (isPlausibleDayMonth(parseDigits(d, 2), parseDigits(d + 2, 2)) ||
+                             isPlausibleDayMonth(parseDigits(d + 2, 2), parseDigits(d, 2)))) {
+                     guessesLog10 = log10(365.0) + yearGuessesLog10(trailingYear);
+                 }
+             }
+             
+             if (guessesLog10 >= 0.0 && !addScoreMatch(list, start, start + n, PATTERN_DATE, guessesLog10)) {
+                 return;
+             }
          }
      }
-     
-     return true;
  }
  
  /**
-  * @brief Checks if password contains username (case-insensitive)
+  * @brief Maps a guess estimate onto the 0-4 score scale used by zxcvbn
+  */
+ static int scoreFromGuesses(double guessesLog10) {
+     if (guessesLog10 < 3.0) {
+         return 0;
+     }
+     if (guessesLog10 < 6.0) {
+         return 1;
+     }
+     if (guessesLog10 < 8.0) {
+         return 2;
+     }
+     if (guessesLog10 < 10.0) {
+         return 3;
+     }
+     return 4;
+ }
+ 
+ /**
+  * @brief Estimates the strength of a password of known length
   *
-  * @param username Username to check against
-  * @param password Password to analyze
-  * @return true if password contains username, false otherwise
+  * Neither string needs to be NUL-terminated.
+  *
+  * @param username Username bytes, matched as a pattern of its own
+  * @param usernameLength Number of bytes in username
+  * @param password Password bytes to score
+  * @param length Number of bytes in password
+  * @param score Output estimate
   */
- bool containsUsername(const char* username, const char* password) {
-     if (strlen(username) == 0) {
-         return false;  // Empty username can't be contained
+ void scorePasswordBytes(const char* username, size_t usernameLength,
+                         const char* password, size_t length, PasswordScore* score) {
+     PasswordFeatures features;
+     classifyPasswordBytes(password, length, &features);
+     
+     // Brute force cardinality of the whole password, as in zxcvbn
+     double cardinality = 0.0;
+     cardinality += (features.classes & CLASS_UPPER) ? 26.0 : 0.0;
+     cardinality += (features.classes & CLASS_LOWER) ? 26.0 : 0.0;
+     cardinality += (features.classes & CLASS_DIGIT) ? 10.0 : 0.0;
+     cardinality += features.hasNonAlnum ? 33.0 : 0.0;
+     double bruteforceLog10 = cardinality > 0.0 ? log10(cardinality) : 0.0;
+     
+     size_t analyzed = length < SCORE_MAX_LENGTH ? length : SCORE_MAX_LENGTH;
+     char folded[SCORE_MAX_LENGTH] = {0};
+     for (size_t i = 0; i < analyzed; i++) {
+         folded[i] = (char)asciiFoldTable[(unsigned char)password[i]];
      }
      
-     for (int i = 0; i <= strlen(password) - strlen(username); i++) {
-         int j;
-         for (j = 0; j < strlen(username); j++) {
-             if (tolower(password[i + j]) != tolower(username[j])) {
-                 break;
+     ScoreMatchList list;
+     list.count = 0;
+     matchUsername(&list, username, usernameLength, password, folded, analyzed);
+     matchDictionary(&list, password, analyzed);
+     matchKeyboardWalks(&list, password, analyzed);
+     matchRepeats(&list, password, analyzed);
+     matchSequences(&list, password, analyzed);
+     matchDates(&list, password, analyzed);
+     
+     // best[k] is the cheapest cover of the first k bytes; via[k] is how it ends
+     double best[SCORE_MAX_LENGTH + 1];
+     int via[SCORE_MAX_LENGTH + 1];
+     best[0] = 0.0;
+     for (size_t k = 1; k <= analyzed; k++) {
+         best[k] = best[k - 1] + bruteforceLog10;
+         via[k] = -1;
+         for (size_t m = 0; m < list.count; m++) {
+             const ScoreMatch* match = &list.matches[m];
+             if (match->end == k && best[match->start] + match->guessesLog10 < best[k]) {
+                 best[k] = best[match->start] + match->guessesLog10;
+                 via[k] = (int)m;
              }
          }
-         if (j == strlen(username)) {
-             return true;  // Username found in password
+     }
+     
+     unsigned int patterns = 0;
+     for (size_t k = analyzed; k > 0;) {
+         if (via[k] < 0) {
+             patterns |= PATTERN_BRUTEFORCE;
+             k--;
+         } else {
+             patterns |= list.matches[via[k]].pattern;
+             k = list.matches[via[k]].start;
          }
      }
      
-     return false;
+     score->guessesLog10 = best[analyzed];
+     score->score = scoreFromGuesses(score->guessesLog10);
+     score->patterns = patterns;
  }
  
  /**
-  * @brief Validates if a password meets strong password criteria
-  * 
-  * A strong password must:
-  * - Be at least 8 characters long
-  * - Contain at least one uppercase letter
-  * - Contain at least one lowercase letter
-  * - Contain at least one digit
-  * - Contain only alphanumeric characters
-  * - Contain at least 4 consecutive letters
-  * - Not contain the username
+  * @brief Estimates the strength of a password
   *
-  * @param username User's username (to ensure it's not in the password)
-  * @param password Password to validate
-  * @return true if password meets all criteria, false otherwise
+  * @param username User's username, which makes matching parts of the password cheap
+  * @param password Password to score
+  * @param score Output estimate
   */
- bool isStrongPassword(const char* username, const char* password) {
-     if (!hasMinimumLength(password)) {
-         return false;
-     }
+ void scorePassword(const char* username, const char* password, PasswordScore* score) {
+     scorePasswordBytes(username, strlen(username), password, strlen(password), score);
+ }
+ 
+ /*
+  * Asynchronous validation
+  *
+  * A ValidationQueue lets a single-threaded event loop hand checks to a
+  * library-owned worker pool without ever waiting on them. Requests are
+  * copied into one of a fixed number of slots, so the caller's buffers can
+  * be reused as soon as submitValidations() returns; when every slot is in
+  * flight the call accepts fewer requests instead of blocking, which is the
+  * backpressure signal. Workers take requests in batches, run the strong
+  * password rules, the optional blocklist lookup and the optional scorer,
+  * and append completions to a ring the caller drains with
+  * pollValidations(). Each worker resets its scratch arena after every
+  * batch. The eventfd from validationQueueEventFd() is readable whenever
+  * completions are waiting, so it can sit in the host's epoll set. Only
+  * short critical sections are shared between the caller and the workers;
+  * no lock is held while a password is being checked.
+  */
+ 
+ /* Requests a worker takes from the queue per lock acquisition */
+ #define VALIDATION_WORKER_BATCH 32
+ 
+ /* Username plus password bytes stored inline in a slot; longer requests use a heap buffer the slot keeps */
+ #define VALIDATION_INLINE_BYTES 192
+ 
+ typedef struct {
+     uint64_t tag;
+     char* data;                              // Username bytes followed by password bytes
+     size_t dataCapacity;                     // Bytes available at data
+     size_t usernameLength;
+     size_t passwordLength;
+     ValidationCompletion completion;
+     char inlineData[VALIDATION_INLINE_BYTES];
+ } ValidationSlot;
+ 
+ /* Fixed-capacity FIFO of slot indices */
+ typedef struct {
+     uint32_t* items;
+     size_t head;
+     size_t count;
+ } SlotRing;
+ 
+ struct ValidationQueue {
+     ValidationQueueOptions options;
+     ValidationSlot* slots;
+     uint32_t* freeSlots;                     // Stack of unused slot indices
+     size_t freeCount;
+     SlotRing pending;                        // Submitted, not yet taken by a worker
+     SlotRing completed;                      // Checked, not yet polled
+     pthread_mutex_t lock;
+     pthread_cond_t workAvailable;
+     bool stopping;
+     int eventFd;
+     pthread_t* threads;
+     size_t threadCount;                      // Workers actually started
+ };
+ 
+ static inline void pushSlot(SlotRing* ring, size_t capacity, uint32_t slot) {
+     ring->items[(ring->head + ring->count) % capacity] = slot;
+     ring->count++;
+ }
+ 
+ static inline uint32_t popSlot(SlotRing* ring, size_t capacity) {
+     uint32_t slot = ring->items[ring->head];
+     ring->head = (ring->head + 1) % capacity;
+     ring->count--;
+     return slot;
+ }
+ 
+ /**
+  * @brief Runs every configured stage for one request
+  */
+ static void runValidationStages(const ValidationQueueOptions* options, ValidationSlot* slot) {
+     const char* username = slot->data;
+     const char* password = slot->data + slot->usernameLength;
+     unsigned int failures = strongPasswordFailuresBytes(username, slot->usernameLength,
+                                                         password, slot->passwordLength);
      
-     if (!hasUpper(password) || !hasLower(password) || !hasDigit(password)) {
-         return false;
+     if (options->blocklist != NULL && blocklistContains(options->blocklist, password, slot->passwordLength)) {
+         failures |= RULE_BREACHED;
      }
-     
-     if (!isAlphanumericOnly(password)) {
-         return false;
+     if (options->score) {
+         scorePasswordBytes(username, slot->usernameLength, password, slot->passwordLength,
+                            &slot->completion.score);
+     } else {
+         memset(&slot->completion.score, 0, sizeof(slot->completion.score));
      }
+     slot->completion.tag = slot->tag;
+     slot->completion.failures = (uint16_t)failures;
+ }
+ 
+ /**
+  * @brief Worker loop: take a batch, check it without the lock, publish the completions
+  */
+ static void* validationWorker(void* arg) {
+     ValidationQueue* queue = arg;
+     const size_t capacity = queue->options.capacity;
+     uint32_t batch[VALIDATION_WORKER_BATCH];
      
-     if (!containsString(password)) {
-         return false;
+     pthread_mutex_lock(&queue->lock);
+     for (;;) {
+         while (queue->pending.count == 0 && !queue->stopping) {
+             pthread_cond_wait(&queue->workAvailable, &queue->lock);
+         }
+         if (queue->pending.count == 0) {
+             break;  // Stopping and nothing left to do
+         }
+         
+         size_t taken = 0;
+         while (taken < VALIDATION_WORKER_BATCH && queue->pending.count > 0) {
+             batch[taken++] = popSlot(&queue->pending, capacity);
+         }
+         pthread_mutex_unlock(&queue->lock);
+         
+         for (size_t i = 0; i < taken; i++) {
+             runValidationStages(&queue->options, &queue->slots[batch[i]]);
+         }
+         resetScratchArena(threadScratchArena());
+         
+         pthread_mutex_lock(&queue->lock);
+         bool wasEmpty = queue->completed.count == 0;
+         for (size_t i = 0; i < taken; i++) {
+             pushSlot(&queue->completed, capacity, batch[i]);
+         }
+         if (wasEmpty) {
+             uint64_t one = 1;
+             ssize_t written = write(queue->eventFd, &one, sizeof(one));
+             (void)written;  // Cannot fail: the counter is drained whenever the ring empties
+         }
      }
-     
-     if (containsUsername(username, password)) {
-         return false;
+     pthread_mutex_unlock(&queue->lock);
+     return NULL;
+ }
+ 
+ /**
+  * @brief Releases a queue's memory and descriptors; workers must already be stopped
+  */
+ static void freeValidationQueue(ValidationQueue* queue) {
+     if (queue->slots != NULL) {
+         for (size_t i = 0; i < queue->options.capacity; i++) {
+             if (queue->slots[i].data != queue->slots[i].inlineData) {
+                 free(queue->slots[i].data);
+             }
+         }
      }
-     
-     return true;
+     if (queue->eventFd >= 0) {
+         close(queue->eventFd);
+     }
+     pthread_cond_destroy(&queue->workAvailable);
+     pthread_mutex_destroy(&queue->lock);
+     free(queue->slots);
+     free(queue->freeSlots);
+     free(queue->pending.items);
+     free(queue->completed.items);
+     free(queue->threads);
+     free(queue);
  }
  
  /**
-  * @brief Validates if a password meets default password criteria
-  * 
-  * A default password must:
-  * - Be 15 characters or fewer
-  * - Contain at least one uppercase letter
-  * - Contain at least one lowercase letter
-  * - Contain at least one digit
-  * - Contain only alphanumeric characters
+  * @brief Creates a validation queue and starts its workers
   *
-  * @param username User's username (unused but kept for API consistency)
-  * @param password Password to validate
-  * @return true if password meets all criteria, false otherwise
+  * @param options Capacity, worker count and the stages to run; the
+  *        blocklist, if any, must outlive the queue
+  * @return The queue, or NULL if it could not be created
   */
- bool isStrongDefaultPassword(const char* username, const char* password) {
-     if (strlen(password) > 15) {
-         return false;
+ ValidationQueue* createValidationQueue(const ValidationQueueOptions* options) {
+     if (options->capacity == 0 || options->capacity > UINT32_MAX || options->threadCount == 0) {
+         return NULL;
      }
      
-     if (!hasUpper(password) || !hasLower(password) || !hasDigit(password)) {
-         return false;
+     ValidationQueue* queue = calloc(1, sizeof(ValidationQueue));
+     if (queue == NULL) {
+         return NULL;
      }
+     queue->options = *options;
+     queue->eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+     pthread_mutex_init(&queue->lock, NULL);
+     pthread_cond_init(&queue->workAvailable, NULL);
      
-     if (!isAlphanumericOnly(password)) {
-         return false;
+     size_t capacity = options->capacity;
+     queue->slots = calloc(capacity, sizeof(ValidationSlot));
+     queue->freeSlots = malloc(capacity * sizeof(uint32_t));
+     queue->pending.items = malloc(capacity * sizeof(uint32_t));
+     queue->completed.items = malloc(capacity * sizeof(uint32_t));
+     queue->threads = calloc(options->threadCount, sizeof(pthread_t));
+     if (queue->eventFd < 0 || queue->slots == NULL || queue->freeSlots == NULL ||
+         queue->pending.items == NULL || queue->completed.items == NULL || queue->threads == NULL) {
+         freeValidationQueue(queue);
+         return NULL;
+     }
+     for (size_t i = 0; i < capacity; i++) {
+         queue->slots[i].data = queue->slots[i].inlineData;
+         queue->slots[i].dataCapacity = VALIDATION_INLINE_BYTES;
+         queue->freeSlots[i] = (uint32_t)(capacity - 1 - i);
      }
+     queue->freeCount = capacity;
      
-     return true;
+     for (; queue->threadCount < options->threadCount; queue->threadCount++) {
+         if (pthread_create(&queue->threads[queue->threadCount], NULL, validationWorker, queue) != 0) {
+             break;
+         }
+     }
+     if (queue->threadCount == 0) {
+         freeValidationQueue(queue);
+         return NULL;
+     }
+     return queue;
  }
  
  /**
-  * @brief Generates a secure default password meeting default password criteria
-  * 
-  * Creates a random alphanumeric password that passes isStrongDefaultPassword()
+  * @brief Stops the workers after they finish every submitted request, then frees the queue
   *
-  * @param default_password Buffer to store the generated password (must be at least 16 bytes)
-  * @param username User's username (used for validation)
+  * Completions that were never polled are discarded.
   */
- void generateDefaultPassword(char* default_password, const char* username) {
-     const char validCharacters[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
-     const int numValidChars = strlen(validCharacters);
+ void destroyValidationQueue(ValidationQueue* queue) {
+     pthread_mutex_lock(&queue->lock);
+     queue->stopping = true;
+     pthread_cond_broadcast(&queue->workAvailable);
+     pthread_mutex_unlock(&queue->lock);
      
-     // Seed random number generator
-     srand(time(NULL));
+     for (size_t i = 0; i < queue->threadCount; i++) {
+         pthread_join(queue->threads[i], NULL);
+     }
+     freeValidationQueue(queue);
+ }
+ 
+ /**
+  * @brief Queues requests for validation without blocking
+  *
+  * Requests are copied, so their buffers may be reused on return. Fewer
+  * than count requests are accepted when the queue is near capacity (or a
+  * long request cannot be copied); the caller should retry the rest after
+  * polling some completions.
+  *
+  * @param queue Queue from createValidationQueue()
+  * @param requests Requests to submit, in order
+  * @param count Number of requests
+  * @return Number of leading requests accepted
+  */
+ size_t submitValidations(ValidationQueue* queue, const ValidationRequest* requests, size_t count) {
+     const size_t capacity = queue->options.capacity;
+     size_t accepted = 0;
      
-     do {
-         // Generate random password length (1-15 characters)
-         int passwordLength = rand() % 15 + 1;
+     pthread_mutex_lock(&queue->lock);
+     while (accepted < count && queue->freeCount > 0) {
+         const ValidationRequest* request = &requests[accepted];
+         uint32_t index = queue->freeSlots[queue->freeCount - 1];
+         ValidationSlot* slot = &queue->slots[index];
+         size_t needed = request->usernameLength + request->passwordLength;
          
-         // Fill with random valid characters
-         for (int i = 0; i < passwordLength; i++) {
-             default_password[i] = validCharacters[rand() % numValidChars];
+         if (needed > slot->dataCapacity) {
+             char* data = malloc(needed);
+             if (data == NULL) {
+                 break;
+             }
+             if (slot->data != slot->inlineData) {
+                 free(slot->data);
+             }
+             slot->data = data;
+             slot->dataCapacity = needed;
          }
-         default_password[passwordLength] = '\0';
+         memcpy(slot->data, request->username, request->usernameLength);
+         memcpy(slot->data + request->usernameLength, request->password, request->passwordLength);
+         slot->tag = request->tag;
+         slot->usernameLength = request->usernameLength;
+         slot->passwordLength = request->passwordLength;
          
-     } while (!isStrongDefaultPassword(username, default_password));
+         queue->freeCount--;
+         pushSlot(&queue->pending, capacity, index);
+         accepted++;
+     }
+     if (accepted > 0) {
+         pthread_cond_broadcast(&queue->workAvailable);
+     }
+     pthread_mutex_unlock(&queue->lock);
+     return accepted;
  }
  
  /**
-  * @brief Prompts user to enter a new password and validates it
+  * @brief Takes finished validations without blocking
   *
-  * @param customPassword Buffer to store the entered password
-  * @param username User's username (for validation)
-  * @return true if entered password meets requirements, false otherwise
+  * Completions come back in the order workers finish them, which is not
+  * necessarily submission order; match them by tag. The queue's eventfd
+  * is reset once no completions remain.
+  *
+  * @param queue Queue from createValidationQueue()
+  * @param completions Output array
+  * @param max Capacity of completions
+  * @return Number of completions written, 0 if none are ready
   */
- bool promptForNewPassword(char* customPassword, const char* username) {
-     printf("Enter new password: ");
-     scanf("%s", customPassword);
+ size_t pollValidations(ValidationQueue* queue, ValidationCompletion* completions, size_t max) {
+     const size_t capacity = queue->options.capacity;
+     size_t taken = 0;
      
-     if (isStrongPassword(username, customPassword)) {
-         printf("Strong password!\n");
-         return true;
-     } else {
-         printf("Your password is weak. Try again!\n");
-         return false;
+     pthread_mutex_lock(&queue->lock);
+     while (taken < max && queue->completed.count > 0) {
+         uint32_t index = popSlot(&queue->completed, capacity);
+         completions[taken++] = queue->slots[index].completion;
+         queue->freeSlots[queue->freeCount++] = index;
      }
+     if (queue->completed.count == 0) {
+         uint64_t value;
+         ssize_t drained = read(queue->eventFd, &value, sizeof(value));
+         (void)drained;  // EAGAIN when it was already reset
+     }
+     pthread_mutex_unlock(&queue->lock);
+     return taken;
  }
  
  /**
-  * @brief Main program function
-  * 
-  * Controls program flow:
-  * 1. Prompts for username
-  * 2. Generates a default password
-  * 3. Allows user to create a custom password if desired
-  *
-  * @return 0 on successful execution
-  */
- int main(void) {
-     char username[100];
-     char default_password[16];  // Max 15 chars + null terminator
-     char customPassword[100];
-     
-     // Get username
-     printf("Enter username: ");
-     scanf("%s", username);
-     
-     // Generate and display default password
-     generateDefaultPassword(default_password, username);
-     printf("Generating a default password...\n");
-     printf("Generated default password: %s\n", default_password);
-     
-     // Ask if user wants to manually set password
-     printf("Manually change password? (y/n): ");
-     char choice[3];
-     scanf(" %s", choice);
-     
-     if (strcmp(choice, "y") == 0 || strcmp(choice, "Y") == 0) {
-         // Keep prompting until a strong password is provided
-         while (!promptForNewPassword(customPassword, username)) {
-             // Loop body is empty because promptForNewPassword handles everything
-         }
-         printf("Successfully created password: %s\n", customPassword);
-     } else {
-         printf("You chose not to change your password.\n");
-     }
+  * @brief Delivers finished validations to a callback on the calling thread
+  *
+  * @param queue Queue from createValidationQueue()
+  * @param callback Called once per completion
+  * @param context Passed through to callback
+  * @return Number of completions delivered
+  */
+ size_t dispatchValidations(ValidationQueue* queue, ValidationCallback callback, void* context) {
+     ValidationCompletion completions[VALIDATION_WORKER_BATCH];
+     size_t total = 0;
+     size_t taken;
      
-     return 0;
- }
\ No newline at end of file
+     while ((taken = pollValidations(queue, completions, VALIDATION_WORKER_BATCH)) > 0) {
+         for (size_t i = 0; i < taken; i++) {
+             callback(context, &completions[i]);
+         }
+         total += taken;
+     }
+     return total;
+ }
+ 
+ /**
+  * @brief Descriptor that is readable while completions are waiting
+  *
+  * Add it to the host's epoll or poll set and call pollValidations() or
+  * dispatchValidations() when it fires. Do not read or close it.
+  */
+ int validationQueueEventFd(const ValidationQueue* queue) {
+     return queue->eventFd;
+ }
@@ -0,0 +1,509 @@
+/**
+ * @file password_strength.h
+ * @brief Public interface of libpasswordstrength
+ * 
+ * Password validation (strong and default rules, configurable policies,
+ * rejection reasons), secure default password generation, breach
+ * blocklists and strength scoring. Link with -lpasswordstrength -lm
+ * -pthread. Every function is safe to call from several threads at once
+ * as long as each thread passes its own matcher, generator or output
+ * buffers.
+ */
+
+ #ifndef PASSWORD_STRENGTH_H
+ #define PASSWORD_STRENGTH_H
+ 
+ #include <stdbool.h>
+ #include <stddef.h>
+ #include <stdint.h>
+ #include <stdio.h>
+ 
+ #ifdef __cplusplus
+ extern "C" {
+ #endif
+ 
+ /* Marks the exported interface; everything else in the shared library is hidden */
+ #if defined(__GNUC__)
+ #define PASSWORD_STRENGTH_API __attribute__((visibility("default")))
+ #else
+ #define PASSWORD_STRENGTH_API
+ #endif
+ 
+ /* Password rule thresholds */
+ #define STRONG_MIN_LENGTH 8          // Minimum length of a strong password
+ #define DEFAULT_MAX_LENGTH 15        // Maximum length of a default password
+ #define MIN_CONSECUTIVE_LETTERS 4    // Required run of alphabetic characters
+ #define CONSTANT_TIME_MAX_LENGTH 64  // Longest password the constant-time validator examines
+ 
+ /* Character class bits recorded in PasswordFeatures.classes */
+ #define CLASS_UPPER 0x01
+ #define CLASS_LOWER 0x02
+ #define CLASS_DIGIT 0x04
+ #define CLASS_REQUIRED (CLASS_UPPER | CLASS_LOWER | CLASS_DIGIT)
+ #define CLASS_ALPHA (CLASS_UPPER | CLASS_LOWER)
+ 
+ /* Rule failure bits; a password passes a policy when its failure mask is 0 */
+ #define RULE_TOO_SHORT 0x0001           // Shorter than STRONG_MIN_LENGTH
+ #define RULE_TOO_LONG 0x0002            // Longer than DEFAULT_MAX_LENGTH
+ #define RULE_MISSING_UPPER 0x0004       // No uppercase letter
+ #define RULE_MISSING_LOWER 0x0008       // No lowercase letter
+ #define RULE_MISSING_DIGIT 0x0010       // No digit
+ #define RULE_SPECIAL_CHARACTER 0x0020   // Contains a non-alphanumeric character
+ #define RULE_NO_LETTER_RUN 0x0040       // No run of MIN_CONSECUTIVE_LETTERS letters
+ #define RULE_CONTAINS_USERNAME 0x0080   // Contains the username, case-insensitively
+ #define RULE_BREACHED 0x0100            // Found in the breach blocklist
+ #define RULE_DENYLISTED 0x0200          // Contains a word from the account's denylist
+ #define RULE_REUSED 0x0400              // One of the user's remembered previous passwords
+ #define RULE_SIMILAR 0x0800             // Within a few edits of the username or a denylist word
+ #define RULE_INVALID_UTF8 0x1000        // Not well-formed UTF-8 (UTF-8 validators only)
+ 
+ /**
+  * @brief Per-password feature record filled by a single scan
+  *
+  * Every composition rule of isStrongPassword() and isStrongDefaultPassword()
+  * can be answered from these fields without touching the password again.
+  */
+ typedef struct {
+     size_t length;           // Number of characters before the terminator
+     unsigned int classes;    // Bitmask of CLASS_* values seen
+     size_t longestAlphaRun;  // Longest run of consecutive alphabetic characters
+     bool hasNonAlnum;        // true if any non-alphanumeric character was seen
+ } PasswordFeatures;
+ 
+ /* Usernames up to this length are matched without heap allocation */
+ #define USERNAME_INLINE_CAPACITY 64
+ 
+ /**
+  * @brief Precomputed case-insensitive search table for one username
+  *
+  * Holds the lowercased username and its KMP failure table so the username
+  * can be searched for in any number of passwords in linear time. The
+  * structure may point into its own inline storage, so it must not be
+  * copied; always pass it by pointer.
+  */
+ typedef struct {
+     size_t length;                                // Username length
+     char* folded;                                 // Lowercased username
+     size_t* failure;                              // KMP failure table
+     char inlineFolded[USERNAME_INLINE_CAPACITY];
+     size_t inlineFailure[USERNAME_INLINE_CAPACITY];
+     bool ownsTables;                              // Tables were allocated by initUsernameMatcherBytes()
+ } UsernameMatcher;
+ 
+ /**
+  * @brief Bump allocator for per-batch scratch memory
+  *
+  * arenaAllocate() only advances an offset; nothing is freed on its own.
+  * resetScratchArena() discards everything at once. Requests that do not
+  * fit spill into heap chunks, and the next reset grows the main block to
+  * the peak, so a steady workload stops allocating after a few batches.
+  */
+ typedef struct ScratchChunk ScratchChunk;
+ typedef struct {
+     unsigned char* base;                          // Main block
+     size_t capacity;                              // Bytes in the main block
+     size_t used;                                  // Bytes handed out from the main block
+     ScratchChunk* spill;                          // Chunks for requests that did not fit, newest first
+     size_t spilled;                               // Bytes held in spill chunks
+     size_t peak;                                  // Most bytes in use since the last reset
+ } ScratchArena;
+ 
+ /* Position returned by markScratchArena() */
+ typedef struct {
+     size_t used;
+     ScratchChunk* spill;
+ } ScratchArenaMark;
+ 
+ /**
+  * @brief Password rules supplied by the caller
+  */
+ typedef struct {
+     size_t minLength;              // Minimum length in bytes; 0 for none
+     size_t maxLength;              // Maximum length in bytes; 0 for none
+     unsigned int requiredClasses;  // CLASS_* bits that must all appear
+     const char* allowedSymbols;    // Non-alphanumeric bytes permitted; NULL or "" for none
+     bool allowAnySymbol;           // true to permit every byte, ignoring allowedSymbols
+     size_t minLetterRun;           // Required run of consecutive letters; 0 for none
+     bool rejectUsername;           // true to reject passwords containing the username
+ } PasswordPolicy;
+ 
+ /* The built-in rules, expressed as policies */
+ #define STRONG_PASSWORD_POLICY { STRONG_MIN_LENGTH, 0, CLASS_REQUIRED, NULL, false, MIN_CONSECUTIVE_LETTERS, true }
+ #define DEFAULT_PASSWORD_POLICY { 0, DEFAULT_MAX_LENGTH, CLASS_REQUIRED, NULL, false, 0, false }
+ 
+ /* Buffer size for policyRuleFailureMessage() */
+ #define RULE_MESSAGE_SIZE 128
+ 
+ /* Opaque policy prepared by compilePasswordPolicy() */
+ typedef struct CompiledPolicy CompiledPolicy;
+ 
+ /*
+  * Opaque ChaCha20 random stream owned by one thread, made by
+  * createPasswordGenerator() and released with freePasswordGenerator()
+  */
+ typedef struct PasswordGenerator PasswordGenerator;
+ 
+ /* Bytes reserved for each password written by generatePasswordBatch() */
+ #define DEFAULT_PASSWORD_STRIDE (DEFAULT_MAX_LENGTH + 1)
+ 
+ /**
+  * @brief Xor filter holding a breach corpus
+  */
+ typedef struct {
+     uint64_t seed;                 // Hash seed that made the filter peelable
+     uint32_t blockLength;          // Slots in each of the three segments
+     size_t entryCount;             // Distinct keys stored
+     const uint16_t* fingerprints;  // 3 * blockLength fingerprints
+     const char* mapping;           // Index file mapping, or NULL if fingerprints are on the heap
+     size_t mappingSize;            // Size of the index file mapping
+ } Blocklist;
+ 
+ /* Previous passwords remembered per user, and the size of the fingerprint key */
+ #define PASSWORD_HISTORY_DEPTH 10
+ #define PASSWORD_HISTORY_KEY_SIZE 16
+ 
+ typedef struct PasswordHistoryRecord PasswordHistoryRecord;
+ 
+ /**
+  * @brief Keyed fingerprints of each user's recent passwords in a mapped fixed-width table
+  *
+  * Concurrent lookups are safe. addPasswordToHistory() is not: while other
+  * threads or processes use the same table or file, the caller must hold a
+  * lock of its own that excludes them for the duration of the call.
+  */
+ typedef struct {
+     uint64_t key[2];               // SipHash-2-4 key
+     void* mapping;                 // Header followed by the records
+     size_t mappingSize;
+     PasswordHistoryRecord* records;
+     size_t capacity;               // Records in the table, a power of two
+ } PasswordHistory;
+ 
+ /**
+  * @brief Case-insensitive Aho-Corasick automaton over a set of patterns
+  */
+ typedef struct {
+     unsigned char symbolOf[256];  // Byte -> symbol after case folding; 0 if unused
+     uint32_t symbolCount;         // Symbols including the shared symbol 0
+     uint32_t stateCount;
+     uint32_t* transitions;        // stateCount * symbolCount next states
+     uint32_t* outputStart;        // Outputs of state s are outputs[outputStart[s] .. outputStart[s + 1])
+     uint32_t* outputs;            // Pattern ids
+     uint32_t* patternLengths;     // Length of each pattern
+     size_t patternCount;
+ } PatternAutomaton;
+ 
+ /* Longest word a NearMatcher accepts, one bit per byte */
+ #define NEAR_MATCH_MAX_LENGTH 64
+ /* A near match may differ by one edit per this many bytes of the word */
+ #define NEAR_MATCH_CHARS_PER_EDIT 6
+ 
+ /**
+  * @brief Word prepared for bit-parallel approximate substring search
+  */
+ typedef struct {
+     unsigned char symbolOf[256];                // Byte -> symbol after leetspeak folding; 0 if not in the word
+     uint64_t peq[NEAR_MATCH_MAX_LENGTH + 1];    // Positions of each symbol in the word
+     size_t length;                              // Word length in bytes
+     size_t maxDistance;                         // Edits a near match may need
+ } NearMatcher;
+ 
+ /* Denylist words shorter than this are ignored; they would reject too many passwords */
+ #define SUBJECT_MIN_DENIED_LENGTH 4
+ 
+ /**
+  * @brief Per-account state prepared once for repeated checks
+  *
+  * Holds the folded username with its search table and an automaton over
+  * the account's denylist (previous passwords, e-mail local part, other
+  * personal words), near matchers for the username and those words, and
+  * optionally the user's PasswordHistory record tag.
+  * Like UsernameMatcher it must not be copied.
+  */
+ typedef struct {
+     UsernameMatcher username;         // Folded username and its search table
+     PatternAutomaton denylist;        // Words the password must not contain
+     bool hasDenylist;                 // false when no denylist word was long enough
+     NearMatcher* near;                // Username and denylist words for RULE_SIMILAR
+     size_t nearCount;
+     const PasswordHistory* history;   // Attached with attachPasswordHistory(), or NULL
+     uint64_t historyTag;              // The user's record tag in history
+ } SubjectContext;
+ 
+ /* Opaque least-recently-used cache of subject contexts keyed by username */
+ typedef struct SubjectCache SubjectCache;
+ 
+ /**
+  * @brief Called for every match found by scanPatternAutomaton()
+  *
+  * @return false to stop the scan
+  */
+ typedef bool (*PatternMatchCallback)(void* context, size_t patternId, size_t start, size_t end);
+ 
+ /* Pattern bits reported in PasswordScore.patterns */
+ #define PATTERN_DICTIONARY 0x01
+ #define PATTERN_USERNAME 0x02
+ #define PATTERN_KEYBOARD 0x04
+ #define PATTERN_REPEAT 0x08
+ #define PATTERN_SEQUENCE 0x10
+ #define PATTERN_DATE 0x20
+ #define PATTERN_BRUTEFORCE 0x40
+ 
+ /**
+  * @brief Result of scorePassword()
+  */
+ typedef struct {
+     double guessesLog10;    // log10 of the estimated number of guesses
+     int score;              // 0 (too guessable) to 4 (very unguessable)
+     unsigned int patterns;  // PATTERN_* bits used by the cheapest cover
+ } PasswordScore;
+ 
+ /* Rule counters in PasswordStats.ruleFailures, indexed by RULE_* bit position (RULE_TOO_SHORT .. RULE_CONTAINS_USERNAME) */
+ #define STATS_RULE_COUNT 8
+ 
+ /* Histogram buckets: 16 exact, then 8 per power of two up to about 2^40 ns */
+ #define STATS_LATENCY_BUCKETS 304
+ 
+ /* One strong password check in this many is timed, per thread */
+ #define STATS_LATENCY_SAMPLE_INTERVAL 64
+ 
+ /**
+  * @brief Counters collected while setPasswordStatsEnabled(true) is in effect
+  *
+  * Every strong, UTF-8, subject and compiled policy check counts once,
+  * including each record of a batch, with its complete RULE_* mask. The
+  * constant-time validators record nothing, since counting would branch
+  * on the result, and neither do the default password checks. Only 64-bit
+  * counters, so snapshots can be summed field by field.
+  */
+ typedef struct {
+     uint64_t checks;                                // Validator checks
+     uint64_t rejected;                              // Checks that failed any rule
+     uint64_t ruleFailures[STATS_RULE_COUNT];        // Failures of each RULE_* bit
+     uint64_t generated;                             // Default passwords generated
+     uint64_t latencySamples;                        // Timed checks
+     uint64_t latencyBuckets[STATS_LATENCY_BUCKETS]; // Timed checks per latency bucket
+ } PasswordStats;
+ 
+ /**
+  * @brief One check submitted to a ValidationQueue
+  */
+ typedef struct {
+     uint64_t tag;                 // Caller's identifier, returned in the completion
+     const char* username;
+     size_t usernameLength;
+     const char* password;
+     size_t passwordLength;
+ } ValidationRequest;
+ 
+ /**
+  * @brief Result of one queued check
+  */
+ typedef struct {
+     uint64_t tag;                 // Tag of the request
+     uint16_t failures;            // RULE_* mask, including RULE_BREACHED; 0 if strong
+     PasswordScore score;          // Filled when the queue scores passwords, zero otherwise
+ } ValidationCompletion;
+ 
+ /**
+  * @brief Configuration of a ValidationQueue
+  */
+ typedef struct {
+     size_t capacity;              // Requests in flight (queued, running or unpolled) at most
+     size_t threadCount;           // Worker threads
+     const Blocklist* blocklist;   // Breach filter to consult, or NULL
+     bool score;                   // true to run scorePasswordBytes() on every request
+ } ValidationQueueOptions;
+ 
+ /* Opaque handle of a worker pool and its queues */
+ typedef struct ValidationQueue ValidationQueue;
+ 
+ /* Receives completions from dispatchValidations() */
+ typedef void (*ValidationCallback)(void* context, const ValidationCompletion* completion);
+ 
+ /* Character classification */
+ PASSWORD_STRENGTH_API void classifyPassword(const char* pwd, PasswordFeatures* features);
+ PASSWORD_STRENGTH_API void classifyPasswordBytes(const char* pwd, size_t length, PasswordFeatures* features);
+ PASSWORD_STRENGTH_API void classifyPasswordBytesScalar(const char* pwd, size_t length, PasswordFeatures* features);
+ 
+ /* Rule checks on a feature record */
+ PASSWORD_STRENGTH_API unsigned int strongRuleFailures(const PasswordFeatures* features);
+ PASSWORD_STRENGTH_API unsigned int defaultRuleFailures(const PasswordFeatures* features);
+ PASSWORD_STRENGTH_API bool meetsStrongRules(const PasswordFeatures* features);
+ PASSWORD_STRENGTH_API bool meetsDefaultRules(const PasswordFeatures* features);
+ PASSWORD_STRENGTH_API const char* ruleFailureMessage(unsigned int rule);
+ 
+ /* Single-rule helpers */
+ PASSWORD_STRENGTH_API bool containsString(const char* pwd);
+ PASSWORD_STRENGTH_API bool hasUpper(const char* pwd);
+ PASSWORD_STRENGTH_API bool hasDigit(const char* pwd);
+ PASSWORD_STRENGTH_API bool hasLower(const char* pwd);
+ PASSWORD_STRENGTH_API bool hasMinimumLength(const char* pwd);
+ PASSWORD_STRENGTH_API bool isAlphanumericOnly(const char* pwd);
+ 
+ /* Scratch arenas */
+ PASSWORD_STRENGTH_API bool initScratchArena(ScratchArena* arena, size_t capacity);
+ PASSWORD_STRENGTH_API void* arenaAllocate(ScratchArena* arena, size_t size);
+ PASSWORD_STRENGTH_API ScratchArenaMark markScratchArena(const ScratchArena* arena);
+ PASSWORD_STRENGTH_API void releaseScratchArena(ScratchArena* arena, ScratchArenaMark mark);
+ PASSWORD_STRENGTH_API void resetScratchArena(ScratchArena* arena);
+ PASSWORD_STRENGTH_API void freeScratchArena(ScratchArena* arena);
+ PASSWORD_STRENGTH_API ScratchArena* threadScratchArena(void);
+ 
+ /* Username matching */
+ PASSWORD_STRENGTH_API bool initUsernameMatcherBytes(UsernameMatcher* matcher, const char* username, size_t length);
+ PASSWORD_STRENGTH_API bool initUsernameMatcher(UsernameMatcher* matcher, const char* username);
+ PASSWORD_STRENGTH_API bool initUsernameMatcherArena(UsernameMatcher* matcher, const char* username, size_t length,
+                                                     ScratchArena* arena);
+ PASSWORD_STRENGTH_API void freeUsernameMatcher(UsernameMatcher* matcher);
+ PASSWORD_STRENGTH_API bool matcherFindsUsernameBytes(const UsernameMatcher* matcher, const char* password, size_t length);
+ PASSWORD_STRENGTH_API bool matcherFindsUsername(const UsernameMatcher* matcher, const char* password);
+ PASSWORD_STRENGTH_API bool containsUsernameBytes(const char* username, size_t usernameLength,
+                                                  const char* password, size_t passwordLength);
+ PASSWORD_STRENGTH_API bool containsUsername(const char* username, const char* password);
+ 
+ /* Validation */
+ PASSWORD_STRENGTH_API bool isStrongPassword(const char* username, const char* password);
+ PASSWORD_STRENGTH_API bool isStrongPasswordBytes(const char* username, size_t usernameLength,
+                                                  const char* password, size_t passwordLength);
+ PASSWORD_STRENGTH_API bool isStrongPasswordWithMatcher(const UsernameMatcher* matcher, const char* password);
+ PASSWORD_STRENGTH_API bool isStrongDefaultPassword(const char* username, const char* password);
+ PASSWORD_STRENGTH_API unsigned int strongPasswordFailures(const char* username, const char* password);
+ PASSWORD_STRENGTH_API unsigned int strongPasswordFailuresBytes(const char* username, size_t usernameLength,
+                                                                const char* password, size_t passwordLength);
+ PASSWORD_STRENGTH_API unsigned int strongPasswordFailuresConstantTime(const char* username, size_t usernameLength,
+                                                                       const char* password, size_t passwordLength);
+ PASSWORD_STRENGTH_API bool isStrongPasswordConstantTime(const char* username, size_t usernameLength,
+                                                         const char* password, size_t passwordLength);
+ PASSWORD_STRENGTH_API unsigned int strongPasswordFailuresUtf8(const char* username, size_t usernameLength,
+                                                               const char* password, size_t passwordLength);
+ PASSWORD_STRENGTH_API bool isStrongPasswordUtf8(const char* username, const char* password);
+ PASSWORD_STRENGTH_API unsigned int defaultPasswordFailures(const char* username, const char* password);
+ PASSWORD_STRENGTH_API void validatePasswordBatch(const char* buffer, const size_t* offsets, const size_t* lengths,
+                                                  const char* const* usernames, size_t count, unsigned char* results);
+ PASSWORD_STRENGTH_API void validatePasswordBatchFailures(const char* buffer, const size_t* offsets, const size_t* lengths,
+                                                          const char* const* usernames, size_t count, uint16_t* failures);
+ 
+ /* Configurable policies */
+ PASSWORD_STRENGTH_API CompiledPolicy* compilePasswordPolicy(const PasswordPolicy* policy);
+ PASSWORD_STRENGTH_API void freeCompiledPolicy(CompiledPolicy* policy);
+ PASSWORD_STRENGTH_API unsigned int passwordPolicyFailuresBytes(const CompiledPolicy* policy,
+                                                                const char* username, size_t usernameLength,
+                                                                const char* password, size_t passwordLength);
+ PASSWORD_STRENGTH_API unsigned int passwordPolicyFailures(const CompiledPolicy* policy, const char* username,
+                                                           const char* password);
+ PASSWORD_STRENGTH_API bool meetsPasswordPolicy(const CompiledPolicy* policy, const char* username, const char* password);
+ PASSWORD_STRENGTH_API const char* policyRuleFailureMessage(const CompiledPolicy* policy, unsigned int rule,
+                                                            char* buffer, size_t size);
+ 
+ /*
+  * Default password generation
+  *
+  * createPasswordGenerator() returns NULL and initPasswordGenerator() false
+  * if the OS has no entropy to give. The other functions have no way to
+  * report that, so when they need to key a generator from the OS (the
+  * thread's default generator on first use, or an OS-keyed generator after
+  * fork()) and cannot, they abort the program rather than fall back to a
+  * predictable key.
+  */
+ PASSWORD_STRENGTH_API PasswordGenerator* createPasswordGenerator(void);
+ PASSWORD_STRENGTH_API bool initPasswordGenerator(PasswordGenerator* generator);
+ PASSWORD_STRENGTH_API void seedPasswordGenerator(PasswordGenerator* generator, uint64_t seed);
+ PASSWORD_STRENGTH_API void freePasswordGenerator(PasswordGenerator* generator);
+ PASSWORD_STRENGTH_API PasswordGenerator* threadPasswordGenerator(void);
+ PASSWORD_STRENGTH_API void generateDefaultPasswordFrom(PasswordGenerator* generator, char* default_password);
+ PASSWORD_STRENGTH_API void generateDefaultPassword(char* default_password, const char* username);
+ PASSWORD_STRENGTH_API void generatePasswordBatchFrom(PasswordGenerator* generator, size_t count, char* out_buffer);
+ PASSWORD_STRENGTH_API void generatePasswordBatch(size_t count, char* out_buffer);
+ 
+ /* Read-only mappings of password list files */
+ PASSWORD_STRENGTH_API size_t countPasswordFileLines(const char* begin, const char* end);
+ PASSWORD_STRENGTH_API const char* mapPasswordFile(const char* path, size_t* size);
+ PASSWORD_STRENGTH_API void unmapPasswordFile(const char* mapping, size_t size);
+ 
+ /* Breached-password blocklist */
+ PASSWORD_STRENGTH_API bool loadBlocklistFromText(Blocklist* blocklist, const char* path);
+ PASSWORD_STRENGTH_API bool writeBlocklistIndex(const Blocklist* blocklist, const char* path);
+ PASSWORD_STRENGTH_API bool openBlocklistIndex(Blocklist* blocklist, const char* path, bool verifyData);
+ PASSWORD_STRENGTH_API void freeBlocklist(Blocklist* blocklist);
+ PASSWORD_STRENGTH_API bool blocklistContains(const Blocklist* blocklist, const char* password, size_t length);
+ PASSWORD_STRENGTH_API bool isStrongPasswordWithBlocklist(const Blocklist* blocklist, const char* username,
+                                                          const char* password);
+ 
+ /* Password history */
+ PASSWORD_STRENGTH_API bool createPasswordHistory(PasswordHistory* history, const char* path, size_t users,
+                                                  const unsigned char key[PASSWORD_HISTORY_KEY_SIZE]);
+ PASSWORD_STRENGTH_API bool openPasswordHistory(PasswordHistory* history, const char* path,
+                                                const unsigned char key[PASSWORD_HISTORY_KEY_SIZE]);
+ PASSWORD_STRENGTH_API void closePasswordHistory(PasswordHistory* history);
+ PASSWORD_STRENGTH_API bool passwordInHistoryBytes(const PasswordHistory* history, const char* username,
+                                                   size_t usernameLength, const char* password,
+                                                   size_t passwordLength);
+ PASSWORD_STRENGTH_API bool passwordInHistory(const PasswordHistory* history, const char* username,
+                                              const char* password);
+ PASSWORD_STRENGTH_API bool addPasswordToHistory(PasswordHistory* history, const char* username,
+                                                 const char* password);
+ PASSWORD_STRENGTH_API unsigned int strongPasswordFailuresWithHistory(const PasswordHistory* history,
+                                                                      const char* username, const char* password);
+ 
+ /* Multi-pattern matching */
+ PASSWORD_STRENGTH_API bool buildPatternAutomaton(PatternAutomaton* automaton, const char* const* patterns, size_t count);
+ PASSWORD_STRENGTH_API void freePatternAutomaton(PatternAutomaton* automaton);
+ PASSWORD_STRENGTH_API void scanPatternAutomaton(const PatternAutomaton* automaton, const char* text, size_t length,
+                                                 PatternMatchCallback callback, void* context);
+ 
+ /* UTF-8 text */
+ PASSWORD_STRENGTH_API bool isAsciiBytes(const char* text, size_t length);
+ PASSWORD_STRENGTH_API size_t normalizeUtf8Nfkc(const char* text, size_t length, char* out, size_t capacity);
+ PASSWORD_STRENGTH_API bool classifyPasswordUtf8(const char* pwd, size_t length, PasswordFeatures* features);
+ 
+ /* Near-duplicate detection */
+ PASSWORD_STRENGTH_API bool initNearMatcher(NearMatcher* matcher, const char* word, size_t length);
+ PASSWORD_STRENGTH_API size_t nearMatchDistance(const NearMatcher* matcher, const char* text, size_t length);
+ PASSWORD_STRENGTH_API bool nearMatchFinds(const NearMatcher* matcher, const char* text, size_t length);
+ 
+ /* Subject contexts */
+ PASSWORD_STRENGTH_API bool initSubjectContext(SubjectContext* context, const char* username, const char* email,
+                                               const char* const* denied, size_t deniedCount);
+ PASSWORD_STRENGTH_API void freeSubjectContext(SubjectContext* context);
+ PASSWORD_STRENGTH_API void attachPasswordHistory(SubjectContext* context, const PasswordHistory* history,
+                                                  const char* username);
+ PASSWORD_STRENGTH_API unsigned int subjectPasswordFailuresBytes(const SubjectContext* context,
+                                                                 const char* password, size_t length);
+ PASSWORD_STRENGTH_API unsigned int subjectPasswordFailures(const SubjectContext* context, const char* password);
+ PASSWORD_STRENGTH_API unsigned int subjectPasswordFailuresUtf8(const SubjectContext* context, const char* password,
+                                                               size_t length);
+ PASSWORD_STRENGTH_API bool isStrongPasswordForSubject(const SubjectContext* context, const char* password);
+ PASSWORD_STRENGTH_API SubjectCache* createSubjectCache(size_t capacity);
+ PASSWORD_STRENGTH_API void freeSubjectCache(SubjectCache* cache);
+ PASSWORD_STRENGTH_API const SubjectContext* lookupSubjectContext(SubjectCache* cache, const char* username);
+ PASSWORD_STRENGTH_API const SubjectContext* cacheSubjectContext(SubjectCache* cache, const char* username,
+                                                                 const char* email, const char* const* denied,
+                                                                 size_t deniedCount);
+ PASSWORD_STRENGTH_API void forgetSubjectContext(SubjectCache* cache, const char* username);
+ 
+ /* Runtime statistics */
+ PASSWORD_STRENGTH_API void setPasswordStatsEnabled(bool enabled);
+ PASSWORD_STRENGTH_API void passwordStatsSnapshot(PasswordStats* snapshot);
+ PASSWORD_STRENGTH_API uint64_t passwordStatsLatencyPercentile(const PasswordStats* stats, double quantile);
+ PASSWORD_STRENGTH_API uint64_t latencyBucketLowerBound(size_t bucket);
+ PASSWORD_STRENGTH_API void printPasswordStats(FILE* out, const PasswordStats* stats);
+ 
+ /* Strength scoring */
+ PASSWORD_STRENGTH_API void scorePasswordBytes(const char* username, size_t usernameLength,
+                                               const char* password, size_t length, PasswordScore* score);
+ PASSWORD_STRENGTH_API void scorePassword(const char* username, const char* password, PasswordScore* score);
+ 
+ /* Asynchronous validation */
+ PASSWORD_STRENGTH_API ValidationQueue* createValidationQueue(const ValidationQueueOptions* options);
+ PASSWORD_STRENGTH_API void destroyValidationQueue(ValidationQueue* queue);
+ PASSWORD_STRENGTH_API size_t submitValidations(ValidationQueue* queue, const ValidationRequest* requests, size_t count);
+ PASSWORD_STRENGTH_API size_t pollValidations(ValidationQueue* queue, ValidationCompletion* completions, size_t max);
+ PASSWORD_STRENGTH_API size_t dispatchValidations(ValidationQueue* queue, ValidationCallback callback, void* context);
+ PASSWORD_STRENGTH_API int validationQueueEventFd(const ValidationQueue* queue);
+ 
+ #ifdef __cplusplus
+ }
+ #endif
+ 
+ #endif /* PASSWORD_STRENGTH_H */
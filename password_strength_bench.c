@@ -0,0 +1,640 @@
+/**
+ * @file password_strength_bench.c
+ * @brief Microbenchmarks for the libpasswordstrength validators and generator
+ * 
+ * Every benchmark runs one function over a fixed, deterministic input set
+ * and reports nanoseconds per password and input bytes per second as one
+ * JSON object per line, so results can be collected and compared between
+ * builds. The default inputs model a breach corpus: lengths follow the
+ * distribution of leaked password lists (most between 6 and 10
+ * characters), built from common words, names, digits and keyboard runs.
+ * The adversarial sets pair long, nearly matching usernames with long
+ * passwords to exercise the worst case of the username search. The
+ * uniform sets repeat one early-failing or one strong password, so the
+ * fast and constant-time validators can be compared at both extremes.
+ * Given --baseline with the output of an earlier run, every benchmark
+ * that became slower than its baseline by more than --threshold percent
+ * is reported on stderr and the program exits with status 1.
+ */
+
+ #include "password_strength.h"
+ 
+ #include <stdio.h>
+ #include <string.h>
+ #include <stdlib.h>
+ #include <time.h>
+ 
+ /* Passwords in each input set */
+ #define BENCH_SET_SIZE 16384
+ 
+ /* Minimum measured time per sample */
+ #define BENCH_MIN_SAMPLE_NS 100000000.0
+ 
+ /* Samples per benchmark; the median is reported */
+ #define BENCH_SAMPLES 5
+ 
+ /* Allowed slowdown against the baseline, in percent, unless --threshold is given */
+ #define BENCH_DEFAULT_THRESHOLD 10.0
+ 
+ /* Longest benchmark or input set name read from a baseline */
+ #define BENCH_NAME_SIZE 64
+ 
+ /**
+  * @brief A set of (username, password) inputs
+  */
+ typedef struct {
+     const char* name;           // Reported as "inputs"
+     char** usernames;
+     char** passwords;
+     size_t* passwordLengths;
+     char* packed;               // All passwords back to back, for the batch API
+     size_t* offsets;            // Offset of each password within packed
+     size_t count;
+     size_t totalBytes;          // Sum of password lengths
+ } BenchInputs;
+ 
+ /* Runs one pass over the inputs and returns a value that depends on every result */
+ typedef size_t (*BenchFunction)(const BenchInputs* inputs);
+ 
+ typedef struct {
+     const char* name;
+     BenchFunction run;
+ } Benchmark;
+ 
+ /* Deterministic input generation, independent of the library's CSPRNG */
+ static uint64_t benchState = 0x9e3779b97f4a7c15ull;
+ 
+ static inline uint32_t benchRandom(uint32_t bound) {
+     benchState ^= benchState << 13;
+     benchState ^= benchState >> 7;
+     benchState ^= benchState << 17;
+     return (uint32_t)((benchState >> 32) % bound);
+ }
+ 
+ static const char* const benchWords[] = {
+     "password", "love", "angel", "monkey", "dragon", "sunshine", "princess", "qwerty",
+     "football", "baseball", "master", "shadow", "michael", "jessica", "ashley", "daniel",
+     "summer", "winter", "hello", "freedom", "secret", "tigger", "iloveyou", "charlie",
+ };
+ 
+ static const char* const benchSuffixes[] = {
+     "", "1", "12", "123", "2024", "1990", "!", "69", "007", "99", "#1", "xx",
+ };
+ 
+ /* Percent of leaked passwords of each length 4-16, roughly as in public breach lists */
+ static const int benchLengthWeights[] = {1, 4, 26, 19, 20, 12, 9, 4, 2, 1, 1, 1};
+ 
+ /**
+  * @brief Picks a length from benchLengthWeights (4 + index)
+  */
+ size_t pickBenchLength(void) {
+     int total = 0;
+     for (size_t i = 0; i < sizeof(benchLengthWeights) / sizeof(benchLengthWeights[0]); i++) {
+         total += benchLengthWeights[i];
+     }
+     int pick = (int)benchRandom((uint32_t)total);
+     size_t length = 4;
+     for (size_t i = 0; pick >= benchLengthWeights[i]; i++) {
+         pick -= benchLengthWeights[i];
+         length++;
+     }
+     return length;
+ }
+ 
+ /**
+  * @brief Writes one breach-corpus-like password of the given length
+  */
+ void makeCorpusPassword(char* out, size_t length) {
+     size_t used = 0;
+     
+     switch (benchRandom(4)) {
+         case 0:  // Random alphanumerics, like generated or stronger passwords
+             while (used < length) {
+                 static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+                 out[used++] = alphabet[benchRandom(sizeof(alphabet) - 1)];
+             }
+             break;
+         case 1:  // Digits only
+             while (used < length) {
+                 out[used++] = (char)('0' + benchRandom(10));
+             }
+             break;
+         default:  // Word, optionally capitalized, plus a suffix
+             while (used < length) {
+                 const char* word = benchWords[benchRandom(sizeof(benchWords) / sizeof(benchWords[0]))];
+                 const char* suffix = benchSuffixes[benchRandom(sizeof(benchSuffixes) / sizeof(benchSuffixes[0]))];
+                 bool capitalize = benchRandom(3) == 0;
+                 for (size_t i = 0; word[i] != '\0' && used < length; i++) {
+                     char c = word[i];
+                     out[used++] = (capitalize && i == 0) ? (char)(c - 'a' + 'A') : c;
+                 }
+                 for (size_t i = 0; suffix[i] != '\0' && used < length; i++) {
+                     out[used++] = suffix[i];
+                 }
+             }
+             break;
+     }
+     out[length] = '\0';
+ }
+ 
+ /**
+  * @brief Fills in the packed copy and totals once usernames and passwords are set
+  *
+  * @return true on success, false if memory could not be allocated
+  */
+ bool packBenchInputs(BenchInputs* inputs) {
+     inputs->totalBytes = 0;
+     for (size_t i = 0; i < inputs->count; i++) {
+         inputs->passwordLengths[i] = strlen(inputs->passwords[i]);
+         inputs->offsets[i] = inputs->totalBytes;
+         inputs->totalBytes += inputs->passwordLengths[i];
+     }
+     inputs->packed = malloc(inputs->totalBytes + 1);
+     if (inputs->packed == NULL) {
+         return false;
+     }
+     for (size_t i = 0; i < inputs->count; i++) {
+         memcpy(inputs->packed + inputs->offsets[i], inputs->passwords[i], inputs->passwordLengths[i]);
+     }
+     return true;
+ }
+ 
+ /**
+  * @brief Allocates an input set of count entries
+  *
+  * @return true on success, false if memory could not be allocated
+  */
+ bool allocBenchInputs(BenchInputs* inputs, const char* name, size_t count) {
+     inputs->name = name;
+     inputs->count = count;
+     inputs->usernames = calloc(count, sizeof(char*));
+     inputs->passwords = calloc(count, sizeof(char*));
+     inputs->passwordLengths = calloc(count, sizeof(size_t));
+     inputs->offsets = calloc(count, sizeof(size_t));
+     inputs->packed = NULL;
+     return inputs->usernames != NULL && inputs->passwords != NULL &&
+            inputs->passwordLengths != NULL && inputs->offsets != NULL;
+ }
+ 
+ /**
+  * @brief Breach-corpus-like passwords with short, realistic usernames
+  *
+  * About one password in eight embeds its username.
+  */
+ bool makeCorpusInputs(BenchInputs* inputs) {
+     if (!allocBenchInputs(inputs, "corpus", BENCH_SET_SIZE)) {
+         return false;
+     }
+     for (size_t i = 0; i < inputs->count; i++) {
+         char username[32];
+         char password[64];
+         const char* word = benchWords[benchRandom(sizeof(benchWords) / sizeof(benchWords[0]))];
+         snprintf(username, sizeof(username), "%s%u", word, benchRandom(1000));
+         
+         size_t length = pickBenchLength();
+         makeCorpusPassword(password, length);
+         if (benchRandom(8) == 0) {
+             snprintf(password, sizeof(password), "%s%u", username, benchRandom(100));
+         }
+         
+         inputs->usernames[i] = strdup(username);
+         inputs->passwords[i] = strdup(password);
+         if (inputs->usernames[i] == NULL || inputs->passwords[i] == NULL) {
+             return false;
+         }
+     }
+     return packBenchInputs(inputs);
+ }
+ 
+ /**
+  * @brief Usernames of "a" * (n - 1) + "b" against passwords of "a" * 4n
+  *
+  * Every alignment matches all but the last character, which is the worst
+  * case for a naive substring search.
+  */
+ bool makeAdversarialInputs(BenchInputs* inputs, const char* name, size_t usernameLength) {
+     if (!allocBenchInputs(inputs, name, BENCH_SET_SIZE / 64)) {
+         return false;
+     }
+     char* username = malloc(usernameLength + 1);
+     char* password = malloc(4 * usernameLength + 1);
+     if (username == NULL || password == NULL) {
+         free(username);
+         free(password);
+         return false;
+     }
+     memset(username, 'a', usernameLength - 1);
+     username[usernameLength - 1] = 'b';
+     username[usernameLength] = '\0';
+     memset(password, 'a', 4 * usernameLength);
+     password[4 * usernameLength] = '\0';
+     
+     for (size_t i = 0; i < inputs->count; i++) {
+         inputs->usernames[i] = username;  // Shared; the set is never freed
+         inputs->passwords[i] = password;
+     }
+     return packBenchInputs(inputs);
+ }
+ 
+ /**
+  * @brief The same username and password repeated across the whole set
+  */
+ bool makeUniformInputs(BenchInputs* inputs, const char* name, const char* username, const char* password) {
+     if (!allocBenchInputs(inputs, name, BENCH_SET_SIZE)) {
+         return false;
+     }
+     for (size_t i = 0; i < inputs->count; i++) {
+         inputs->usernames[i] = (char*)username;  // Shared literals; the set is never freed
+         inputs->passwords[i] = (char*)password;
+     }
+     return packBenchInputs(inputs);
+ }
+ 
+ size_t benchContainsString(const BenchInputs* inputs) {
+     size_t hits = 0;
+     for (size_t i = 0; i < inputs->count; i++) {
+         hits += containsString(inputs->passwords[i]);
+     }
+     return hits;
+ }
+ 
+ size_t benchHasUpper(const BenchInputs* inputs) {
+     size_t hits = 0;
+     for (size_t i = 0; i < inputs->count; i++) {
+         hits += hasUpper(inputs->passwords[i]);
+     }
+     return hits;
+ }
+ 
+ size_t benchHasLower(const BenchInputs* inputs) {
+     size_t hits = 0;
+     for (size_t i = 0; i < inputs->count; i++) {
+         hits += hasLower(inputs->passwords[i]);
+     }
+     return hits;
+ }
+ 
+ size_t benchHasDigit(const BenchInputs* inputs) {
+     size_t hits = 0;
+     for (size_t i = 0; i < inputs->count; i++) {
+         hits += hasDigit(inputs->passwords[i]);
+     }
+     return hits;
+ }
+ 
+ size_t benchIsAlphanumericOnly(const BenchInputs* inputs) {
+     size_t hits = 0;
+     for (size_t i = 0; i < inputs->count; i++) {
+         hits += isAlphanumericOnly(inputs->passwords[i]);
+     }
+     return hits;
+ }
+ 
+ size_t benchContainsUsername(const BenchInputs* inputs) {
+     size_t hits = 0;
+     for (size_t i = 0; i < inputs->count; i++) {
+         hits += containsUsername(inputs->usernames[i], inputs->passwords[i]);
+     }
+     return hits;
+ }
+ 
+ size_t benchIsStrongPassword(const BenchInputs* inputs) {
+     size_t hits = 0;
+     for (size_t i = 0; i < inputs->count; i++) {
+         hits += isStrongPassword(inputs->usernames[i], inputs->passwords[i]);
+     }
+     return hits;
+ }
+ 
+ size_t benchIsStrongDefaultPassword(const BenchInputs* inputs) {
+     size_t hits = 0;
+     for (size_t i = 0; i < inputs->count; i++) {
+         hits += isStrongDefaultPassword(inputs->usernames[i], inputs->passwords[i]);
+     }
+     return hits;
+ }
+ 
+ size_t benchStrongPasswordFailures(const BenchInputs* inputs) {
+     size_t bits = 0;
+     for (size_t i = 0; i < inputs->count; i++) {
+         bits += strongPasswordFailures(inputs->usernames[i], inputs->passwords[i]);
+     }
+     return bits;
+ }
+ 
+ size_t benchStrongPasswordFailuresBytes(const BenchInputs* inputs) {
+     size_t bits = 0;
+     for (size_t i = 0; i < inputs->count; i++) {
+         bits += strongPasswordFailuresBytes(inputs->usernames[i], strlen(inputs->usernames[i]),
+                                             inputs->passwords[i], inputs->passwordLengths[i]);
+     }
+     return bits;
+ }
+ 
+ size_t benchStrongPasswordFailuresConstantTime(const BenchInputs* inputs) {
+     size_t bits = 0;
+     for (size_t i = 0; i < inputs->count; i++) {
+         bits += strongPasswordFailuresConstantTime(inputs->usernames[i], strlen(inputs->usernames[i]),
+                                                    inputs->passwords[i], inputs->passwordLengths[i]);
+     }
+     return bits;
+ }
+ 
+ size_t benchStrongPasswordFailuresUtf8(const BenchInputs* inputs) {
+     size_t bits = 0;
+     for (size_t i = 0; i < inputs->count; i++) {
+         bits += strongPasswordFailuresUtf8(inputs->usernames[i], strlen(inputs->usernames[i]),
+                                            inputs->passwords[i], inputs->passwordLengths[i]);
+     }
+     return bits;
+ }
+ 
+ size_t benchNearMatchUsername(const BenchInputs* inputs) {
+     size_t distance = 0;
+     NearMatcher matcher;
+     for (size_t i = 0; i < inputs->count; i++) {
+         if (initNearMatcher(&matcher, inputs->usernames[i], strlen(inputs->usernames[i]))) {
+             distance += nearMatchDistance(&matcher, inputs->passwords[i], inputs->passwordLengths[i]);
+         }
+     }
+     return distance;
+ }
+ 
+ size_t benchValidatePasswordBatch(const BenchInputs* inputs) {
+     static unsigned char results[(BENCH_SET_SIZE + 7) / 8];
+     validatePasswordBatch(inputs->packed, inputs->offsets, inputs->passwordLengths,
+                           (const char* const*)inputs->usernames, inputs->count, results);
+     size_t hits = 0;
+     for (size_t i = 0; i < (inputs->count + 7) / 8; i++) {
+         hits += (size_t)__builtin_popcount(results[i]);
+     }
+     return hits;
+ }
+ 
+ size_t benchGenerateDefaultPassword(const BenchInputs* inputs) {
+     char password[DEFAULT_PASSWORD_STRIDE];
+     size_t bytes = 0;
+     for (size_t i = 0; i < inputs->count; i++) {
+         generateDefaultPassword(password, inputs->usernames[i]);
+         bytes += (unsigned char)password[0];
+     }
+     return bytes;
+ }
+ 
+ size_t benchGeneratePasswordBatch(const BenchInputs* inputs) {
+     static char passwords[BENCH_SET_SIZE * DEFAULT_PASSWORD_STRIDE];
+     generatePasswordBatch(inputs->count, passwords);
+     return (unsigned char)passwords[0];
+ }
+ 
+ size_t benchScorePassword(const BenchInputs* inputs) {
+     PasswordScore score;
+     size_t total = 0;
+     for (size_t i = 0; i < inputs->count; i++) {
+         scorePassword(inputs->usernames[i], inputs->passwords[i], &score);
+         total += (size_t)score.score;
+     }
+     return total;
+ }
+ 
+ static const Benchmark corpusBenchmarks[] = {
+     {"containsString", benchContainsString},
+     {"hasUpper", benchHasUpper},
+     {"hasLower", benchHasLower},
+     {"hasDigit", benchHasDigit},
+     {"isAlphanumericOnly", benchIsAlphanumericOnly},
+     {"containsUsername", benchContainsUsername},
+     {"isStrongPassword", benchIsStrongPassword},
+     {"isStrongDefaultPassword", benchIsStrongDefaultPassword},
+     {"strongPasswordFailures", benchStrongPasswordFailures},
+     {"strongPasswordFailuresBytes", benchStrongPasswordFailuresBytes},
+     {"strongPasswordFailuresConstantTime", benchStrongPasswordFailuresConstantTime},
+     {"strongPasswordFailuresUtf8", benchStrongPasswordFailuresUtf8},
+     {"nearMatchUsername", benchNearMatchUsername},
+     {"validatePasswordBatch", benchValidatePasswordBatch},
+     {"generateDefaultPassword", benchGenerateDefaultPassword},
+     {"generatePasswordBatch", benchGeneratePasswordBatch},
+     {"scorePassword", benchScorePassword},
+ };
+ 
+ static const Benchmark adversarialBenchmarks[] = {
+     {"containsUsername", benchContainsUsername},
+     {"isStrongPassword", benchIsStrongPassword},
+ };
+ 
+ /* Fast path against the constant-time validator, whose cost must not depend on the input */
+ static const Benchmark timingBenchmarks[] = {
+     {"strongPasswordFailuresBytes", benchStrongPasswordFailuresBytes},
+     {"strongPasswordFailuresConstantTime", benchStrongPasswordFailuresConstantTime},
+ };
+ 
+ /* UTF-8 validator on non-ASCII input, where it normalizes instead of taking the ASCII path */
+ static const Benchmark utf8Benchmarks[] = {
+     {"strongPasswordFailuresUtf8", benchStrongPasswordFailuresUtf8},
+ };
+ 
+ /**
+  * @brief One result of an earlier run
+  */
+ typedef struct {
+     char benchmark[BENCH_NAME_SIZE];
+     char inputs[BENCH_NAME_SIZE];
+     double nsPerPassword;
+ } BaselineResult;
+ 
+ /**
+  * @brief Results to compare against, from --baseline
+  */
+ typedef struct {
+     BaselineResult* results;
+     size_t count;
+     double threshold;             // Allowed slowdown in percent
+     size_t regressions;           // Benchmarks slower than allowed so far
+ } BenchBaseline;
+ 
+ /* Keeps benchmark results observable so the calls are not optimized away */
+ static volatile size_t benchSink;
+ 
+ /* Empty unless --baseline was given */
+ static BenchBaseline baseline = {NULL, 0, BENCH_DEFAULT_THRESHOLD, 0};
+ 
+ /**
+  * @brief Reads the JSON lines of an earlier run
+  *
+  * Only the fields this program writes are understood; other lines are
+  * skipped.
+  *
+  * @param path File holding the output of an earlier run
+  * @return false if the file cannot be read or memory runs out
+  */
+ bool loadBaseline(const char* path) {
+     FILE* file = fopen(path, "r");
+     if (file == NULL) {
+         return false;
+     }
+     
+     char line[512];
+     size_t capacity = 0;
+     bool ok = true;
+     while (ok && fgets(line, sizeof(line), file) != NULL) {
+         BaselineResult result;
+         if (sscanf(line, "{\"benchmark\":\"%63[^\"]\",\"inputs\":\"%63[^\"]\",\"passwords\":%*u,"
+                          "\"passes\":%*u,\"ns_per_password\":%lf", result.benchmark, result.inputs,
+                    &result.nsPerPassword) != 3) {
+             continue;
+         }
+         if (baseline.count == capacity) {
+             capacity = capacity == 0 ? 64 : capacity * 2;
+             BaselineResult* grown = realloc(baseline.results, capacity * sizeof(BaselineResult));
+             if (grown == NULL) {
+                 ok = false;
+                 break;
+             }
+             baseline.results = grown;
+         }
+         baseline.results[baseline.count++] = result;
+     }
+     fclose(file);
+     return ok;
+ }
+ 
+ /**
+  * @brief Compares one result with its baseline and reports a regression
+  */
+ void checkBaseline(const Benchmark* benchmark, const BenchInputs* inputs, double nsPerPassword) {
+     for (size_t i = 0; i < baseline.count; i++) {
+         const BaselineResult* result = &baseline.results[i];
+         if (strcmp(result->benchmark, benchmark->name) != 0 || strcmp(result->inputs, inputs->name) != 0) {
+             continue;
+         }
+         double change = (nsPerPassword / result->nsPerPassword - 1.0) * 100.0;
+         if (change > baseline.threshold) {
+             fprintf(stderr, "Regression: %s on %s takes %.2f ns/password, %.1f%% over the baseline %.2f\n",
+                     benchmark->name, inputs->name, nsPerPassword, change, result->nsPerPassword);
+             baseline.regressions++;
+         }
+         return;
+     }
+ }
+ 
+ static inline double nowNs(void) {
+     struct timespec now;
+     clock_gettime(CLOCK_MONOTONIC, &now);
+     return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+ }
+ 
+ static int compareDoubles(const void* a, const void* b) {
+     double x = *(const double*)a;
+     double y = *(const double*)b;
+     return (x > y) - (x < y);
+ }
+ 
+ /**
+  * @brief Times one benchmark and prints its JSON result line
+  *
+  * Each sample repeats full passes over the inputs until it has run for
+  * BENCH_MIN_SAMPLE_NS; the median of BENCH_SAMPLES samples is reported.
+  * The generators report their output bytes instead of input bytes.
+  */
+ void runBenchmark(const Benchmark* benchmark, const BenchInputs* inputs) {
+     double samples[BENCH_SAMPLES];
+     size_t passes = 0;
+     
+     benchSink += benchmark->run(inputs);  // Warm caches and lazy state
+     for (int s = 0; s < BENCH_SAMPLES; s++) {
+         double start = nowNs();
+         double elapsed;
+         passes = 0;
+         do {
+             benchSink += benchmark->run(inputs);
+             passes++;
+             elapsed = nowNs() - start;
+         } while (elapsed < BENCH_MIN_SAMPLE_NS);
+         samples[s] = elapsed / (double)(passes * inputs->count);
+     }
+     qsort(samples, BENCH_SAMPLES, sizeof(double), compareDoubles);
+     
+     double nsPerPassword = samples[BENCH_SAMPLES / 2];
+     bool generator = strncmp(benchmark->name, "generate", 8) == 0;
+     double bytesPerPassword = generator ? (double)DEFAULT_MAX_LENGTH
+                                         : (double)inputs->totalBytes / (double)inputs->count;
+     printf("{\"benchmark\":\"%s\",\"inputs\":\"%s\",\"passwords\":%zu,\"passes\":%zu,"
+            "\"ns_per_password\":%.2f,\"ns_min\":%.2f,\"ns_max\":%.2f,\"bytes_per_sec\":%.0f}\n",
+            benchmark->name, inputs->name, inputs->count, passes, nsPerPassword, samples[0],
+            samples[BENCH_SAMPLES - 1], bytesPerPassword * 1e9 / nsPerPassword);
+     fflush(stdout);
+     checkBaseline(benchmark, inputs, nsPerPassword);
+ }
+ 
+ /**
+  * @brief Runs the benchmarks whose name contains filter over one input set
+  */
+ void runBenchmarks(const Benchmark* benchmarks, size_t count, const BenchInputs* inputs, const char* filter) {
+     for (size_t i = 0; i < count; i++) {
+         if (filter == NULL || strstr(benchmarks[i].name, filter) != NULL) {
+             runBenchmark(&benchmarks[i], inputs);
+         }
+     }
+ }
+ 
+ /**
+  * @brief Main program function
+  *
+  * Usage: password_strength_bench [--baseline FILE [--threshold PERCENT]] [FILTER]
+  * With FILTER, only benchmarks whose name contains it are run.
+  *
+  * @return 0 on success, 1 on a regression against the baseline or if the inputs could not be built
+  */
+ int main(int argc, char* argv[]) {
+     const char* filter = NULL;
+     for (int i = 1; i < argc; i++) {
+         if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+             if (!loadBaseline(argv[++i])) {
+                 fprintf(stderr, "Cannot read baseline: %s\n", argv[i]);
+                 return 1;
+             }
+         } else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+             baseline.threshold = strtod(argv[++i], NULL);
+         } else if (filter == NULL && strncmp(argv[i], "--", 2) != 0) {
+             filter = argv[i];
+         } else {
+             fprintf(stderr, "Usage: %s [--baseline FILE [--threshold PERCENT]] [FILTER]\n", argv[0]);
+             return 1;
+         }
+     }
+     
+     BenchInputs corpus;
+     BenchInputs adversarial64;
+     BenchInputs adversarial1024;
+     BenchInputs uniformWeak;
+     BenchInputs uniformStrong;
+     BenchInputs utf8Composed;
+     BenchInputs utf8Decomposed;
+     
+     if (!makeCorpusInputs(&corpus) ||
+         !makeAdversarialInputs(&adversarial64, "adversarial-username-64", 64) ||
+         !makeAdversarialInputs(&adversarial1024, "adversarial-username-1024", 1024) ||
+         !makeUniformInputs(&uniformWeak, "uniform-weak", "michael", "abc") ||
+         !makeUniformInputs(&uniformStrong, "uniform-strong", "michael", "Tr0ubadorHorseSt4ple") ||
+         !makeUniformInputs(&utf8Composed, "utf8-composed", "michael", "M\xc3\xbcllerStra\xc3\x9f" "e2024") ||
+         !makeUniformInputs(&utf8Decomposed, "utf8-decomposed", "michael", "Mu\xcc\x88llerStra\xc3\x9f" "e2024")) {
+         fprintf(stderr, "Out of memory\n");
+         return 1;
+     }
+     
+     runBenchmarks(corpusBenchmarks, sizeof(corpusBenchmarks) / sizeof(corpusBenchmarks[0]), &corpus, filter);
+     runBenchmarks(adversarialBenchmarks, sizeof(adversarialBenchmarks) / sizeof(adversarialBenchmarks[0]),
+                   &adversarial64, filter);
+     runBenchmarks(adversarialBenchmarks, sizeof(adversarialBenchmarks) / sizeof(adversarialBenchmarks[0]),
+                   &adversarial1024, filter);
+     runBenchmarks(timingBenchmarks, sizeof(timingBenchmarks) / sizeof(timingBenchmarks[0]), &uniformWeak, filter);
+     runBenchmarks(timingBenchmarks, sizeof(timingBenchmarks) / sizeof(timingBenchmarks[0]), &uniformStrong, filter);
+     runBenchmarks(utf8Benchmarks, sizeof(utf8Benchmarks) / sizeof(utf8Benchmarks[0]), &utf8Composed, filter);
+     runBenchmarks(utf8Benchmarks, sizeof(utf8Benchmarks) / sizeof(utf8Benchmarks[0]), &utf8Decomposed, filter);
+     
+     if (baseline.regressions > 0) {
+         fprintf(stderr, "%zu benchmarks regressed by more than %.1f%%\n", baseline.regressions, baseline.threshold);
+         return 1;
+     }
+     return 0;
+ }
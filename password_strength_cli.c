@@ -0,0 +1,677 @@
+/**
+ * @file password_strength_cli.c
+ * @brief Command-line frontend for libpasswordstrength
+ * 
+ * The interactive account setup session, the bulk audit mode and the
+ * blocklist index tools. All password logic comes from the library.
+ */
+
+ #include "password_strength.h"
+ 
+ #include <stdio.h>
+ #include <string.h>
+ #include <stdlib.h>
+ #include <errno.h>
+ #include <pthread.h>
+ #include <unistd.h>
+ 
+ /* Function Prototypes */
+ bool promptForNewPassword(char* customPassword, const SubjectContext* subject, bool utf8);
+ 
+ /**
+  * @brief Builds a precompiled index from a breach corpus text file
+  *
+  * @param corpusPath Corpus in the format accepted by loadBlocklistFromText()
+  * @param indexPath Index file to write
+  * @return 0 on success, 1 on error
+  */
+ int runBuildIndex(const char* corpusPath, const char* indexPath) {
+     Blocklist blocklist;
+     
+     if (!loadBlocklistFromText(&blocklist, corpusPath)) {
+         fprintf(stderr, "Cannot load corpus: %s\n", corpusPath);
+         return 1;
+     }
+     
+     bool written = writeBlocklistIndex(&blocklist, indexPath);
+     if (written) {
+         printf("Wrote %zu entries to %s\n", blocklist.entryCount, indexPath);
+     } else {
+         fprintf(stderr, "Cannot write index: %s\n", indexPath);
+     }
+     
+     freeBlocklist(&blocklist);
+     return written ? 0 : 1;
+ }
+ 
+ /**
+  * @brief Fully verifies a precompiled index file, including its data checksum
+  *
+  * @param indexPath Index file to check
+  * @return 0 if the index is valid, 1 otherwise
+  */
+ int runCheckIndex(const char* indexPath) {
+     Blocklist blocklist;
+     
+     if (!openBlocklistIndex(&blocklist, indexPath, true)) {
+         fprintf(stderr, "Invalid index: %s\n", indexPath);
+         return 1;
+     }
+     
+     printf("Index %s is valid: %zu entries\n", indexPath, blocklist.entryCount);
+     freeBlocklist(&blocklist);
+     return 0;
+ }
+
+ /**
+  * @brief Prompts user to enter a new password and validates it
+  *
+  * @param customPassword Buffer of at least 100 bytes to store the entered password
+  * @param subject Account the password is for, prepared once for every retry
+  * @param utf8 true to check the password as UTF-8 with subjectPasswordFailuresUtf8()
+  * @return true if entered password meets requirements, false otherwise
+  */
+ bool promptForNewPassword(char* customPassword, const SubjectContext* subject, bool utf8) {
+     printf("Enter new password: ");
+     if (scanf("%99s", customPassword) != 1) {
+         customPassword[0] = '\0';
+     }
+     
+     unsigned int failures = utf8 ? subjectPasswordFailuresUtf8(subject, customPassword, strlen(customPassword))
+                                  : subjectPasswordFailures(subject, customPassword);
+     if (failures == 0) {
+         printf("Strong password!\n");
+         return true;
+     }
+     
+     printf("Your password is weak:\n");
+     for (unsigned int rule = 1; rule <= failures; rule <<= 1) {
+         if (failures & rule) {
+             printf("  - it %s\n", ruleFailureMessage(rule));
+         }
+     }
+     printf("Try again!\n");
+     return false;
+ }
+ 
+ /* Bytes of report output each audit worker buffers before writing to stdout */
+ #define AUDIT_OUTPUT_BUFFER 65536
+ 
+ /* Longest username echoed in an audit report line */
+ #define AUDIT_MAX_REPORTED_USERNAME 256
+ 
+ /* Serializes report output from the audit workers */
+ static pthread_mutex_t auditOutputLock = PTHREAD_MUTEX_INITIALIZER;
+ 
+ /**
+  * @brief Slice of an audit file processed by one worker, and its tallies
+  */
+ typedef struct {
+     const char* begin;           // First byte of the slice (start of a line)
+     const char* end;             // One past the last byte of the slice
+     size_t firstLine;            // 1-based line number of the first line in the slice
+     const Blocklist* blocklist;  // Breach filter, or NULL to skip that check
+     size_t strong;               // Records whose password is strong
+     size_t weak;                 // Records whose password is weak
+     size_t breached;             // Strong records whose password is in the blocklist
+     size_t malformed;            // Lines without a username:password separator
+ } AuditChunk;
+ 
+ /**
+  * @brief Writes a worker's buffered report lines to stdout
+  */
+ void flushAuditOutput(char* output, size_t* used) {
+     if (*used == 0) {
+         return;
+     }
+     pthread_mutex_lock(&auditOutputLock);
+     fwrite(output, 1, *used, stdout);
+     pthread_mutex_unlock(&auditOutputLock);
+     *used = 0;
+ }
+ 
+ /**
+  * @brief Appends one report line to a worker's output buffer, flushing when full
+  */
+ void reportAuditRecord(char* output, size_t* used, size_t line, const char* status,
+                        const char* username, size_t usernameLength) {
+     if (usernameLength > AUDIT_MAX_REPORTED_USERNAME) {
+         usernameLength = AUDIT_MAX_REPORTED_USERNAME;
+     }
+     if (AUDIT_OUTPUT_BUFFER - *used < usernameLength + 64) {
+         flushAuditOutput(output, used);
+     }
+     *used += (size_t)snprintf(output + *used, AUDIT_OUTPUT_BUFFER - *used, "%zu\t%s\t%.*s\n",
+                               line, status, (int)usernameLength, username);
+ }
+ 
+ /**
+  * @brief Audit worker: validates every username:password line in its chunk
+  *
+  * Records are validated in place as (pointer, length) slices of the mapped
+  * file; nothing is copied. Weak, breached and malformed records are
+  * reported as "<line>\t<status>\t<username>".
+  *
+  * @param arg AuditChunk to process
+  * @return NULL
+  */
+ void* auditWorker(void* arg) {
+     AuditChunk* chunk = arg;
+     char output[AUDIT_OUTPUT_BUFFER];
+     size_t outputUsed = 0;
+     size_t line = chunk->firstLine;
+     
+     for (const char* p = chunk->begin; p < chunk->end; line++) {
+         const char* newline = memchr(p, '\n', (size_t)(chunk->end - p));
+         const char* lineEnd = newline != NULL ? newline : chunk->end;
+         size_t length = (size_t)(lineEnd - p);
+         const char* record = p;
+         
+         p = newline != NULL ? newline + 1 : chunk->end;
+         
+         if (length > 0 && record[length - 1] == '\r') {
+             length--;
+         }
+         if (length == 0) {
+             continue;  // Blank lines are not records
+         }
+         
+         const char* separator = memchr(record, ':', length);
+         if (separator == NULL) {
+             chunk->malformed++;
+             reportAuditRecord(output, &outputUsed, line, "malformed", "", 0);
+             continue;
+         }
+         
+         size_t usernameLength = (size_t)(separator - record);
+         size_t passwordLength = length - usernameLength - 1;
+         
+         if (!isStrongPasswordBytes(record, usernameLength, separator + 1, passwordLength)) {
+             chunk->weak++;
+             reportAuditRecord(output, &outputUsed, line, "weak", record, usernameLength);
+         } else if (chunk->blocklist != NULL &&
+                    blocklistContains(chunk->blocklist, separator + 1, passwordLength)) {
+             chunk->breached++;
+             reportAuditRecord(output, &outputUsed, line, "breached", record, usernameLength);
+         } else {
+             chunk->strong++;
+         }
+     }
+     
+     flushAuditOutput(output, &outputUsed);
+     return NULL;
+ }
+ 
+ /**
+  * @brief Audits a newline-delimited username:password file with a pool of worker threads
+  *
+  * The file is memory-mapped and split at line boundaries into one chunk
+  * per worker. Each worker checks its records with isStrongPassword() and,
+  * when a blocklist is given, against the breach corpus. Weak, breached and
+  * malformed lines are reported; aggregate counts are printed once all
+  * workers finish.
+  *
+  * @param path File to audit
+  * @param blocklist Breach filter shared read-only by the workers, or NULL
+  * @param threadCount Number of worker threads (at least 1)
+  * @return 0 on success, 1 if the file could not be read
+  */
+ int runAudit(const char* path, const Blocklist* blocklist, size_t threadCount) {
+     size_t size;
+     const char* contents = mapPasswordFile(path, &size);
+     if (contents == NULL) {
+         fprintf(stderr, "Cannot read audit file: %s\n", path);
+         return 1;
+     }
+     
+     AuditChunk* chunks = calloc(threadCount, sizeof(AuditChunk));
+     pthread_t* threads = calloc(threadCount, sizeof(pthread_t));
+     bool* started = calloc(threadCount, sizeof(bool));
+     if (chunks == NULL || threads == NULL || started == NULL) {
+         fprintf(stderr, "Out of memory\n");
+         free(chunks);
+         free(threads);
+         free(started);
+         unmapPasswordFile(contents, size);
+         return 1;
+     }
+     
+     // Cut the file into roughly equal chunks that start on a line boundary
+     const char* end = contents + size;
+     const char* begin = contents;
+     size_t line = 1;
+     for (size_t i = 0; i < threadCount; i++) {
+         const char* chunkEnd = end;
+         if (i + 1 < threadCount && (size_t)(end - begin) > size / threadCount) {
+             const char* newline = memchr(begin + size / threadCount, '\n',
+                                          (size_t)(end - begin) - size / threadCount);
+             chunkEnd = newline != NULL ? newline + 1 : end;
+         }
+         chunks[i].begin = begin;
+         chunks[i].end = chunkEnd;
+         chunks[i].firstLine = line;
+         chunks[i].blocklist = blocklist;
+         line += countPasswordFileLines(begin, chunkEnd);
+         begin = chunkEnd;
+     }
+     
+     for (size_t i = 0; i < threadCount; i++) {
+         started[i] = pthread_create(&threads[i], NULL, auditWorker, &chunks[i]) == 0;
+         if (!started[i]) {
+             auditWorker(&chunks[i]);  // Fall back to processing the chunk inline
+         }
+     }
+     
+     size_t strong = 0;
+     size_t weak = 0;
+     size_t breached = 0;
+     size_t malformed = 0;
+     for (size_t i = 0; i < threadCount; i++) {
+         if (started[i]) {
+             pthread_join(threads[i], NULL);
+         }
+         strong += chunks[i].strong;
+         weak += chunks[i].weak;
+         breached += chunks[i].breached;
+         malformed += chunks[i].malformed;
+     }
+     
+     printf("Audited %zu records: %zu strong, %zu weak, %zu breached, %zu malformed\n",
+            strong + weak + breached + malformed, strong, weak, breached, malformed);
+     
+     free(chunks);
+     free(threads);
+     free(started);
+     unmapPasswordFile(contents, size);
+     return 0;
+ }
+ 
+ /* Block size for --filter reads and writes */
+ #define FILTER_BUFFER_SIZE (1024 * 1024)
+ 
+ /**
+  * @brief Writes a whole buffer to a file descriptor, retrying short writes
+  *
+  * @return true on success, false on an I/O error
+  */
+ bool writeFully(int fd, const char* data, size_t length) {
+     while (length > 0) {
+         ssize_t written = write(fd, data, length);
+         if (written < 0) {
+             if (errno == EINTR) {
+                 continue;
+             }
+             return false;
+         }
+         data += written;
+         length -= (size_t)written;
+     }
+     return true;
+ }
+ 
+ /**
+  * @brief Appends one line to the filter output, writing the buffer out when full
+  *
+  * @return true on success, false if stdout failed
+  */
+ bool emitFilterLine(char* output, size_t* used, const char* line, size_t length) {
+     if (*used + length + 1 > FILTER_BUFFER_SIZE) {
+         if (!writeFully(STDOUT_FILENO, output, *used)) {
+             return false;
+         }
+         *used = 0;
+     }
+     memcpy(output + *used, line, length);
+     output[*used + length] = '\n';
+     *used += length + 1;
+     return true;
+ }
+ 
+ /**
+  * @brief Copies the username:password lines of stdin that pass (or fail) to stdout
+  *
+  * Reads stdin in FILTER_BUFFER_SIZE blocks and writes the selected lines
+  * with one write() per filled output block. A line is "strong" when its
+  * record passes isStrongPasswordBytes() and, with a blocklist, its password
+  * is not breached; every other non-blank line, including ones without a
+  * separator, is "weak". Lines longer than the buffer are dropped and
+  * counted on stderr.
+  *
+  * @param wantStrong true to keep strong lines, false to keep weak lines
+  * @param blocklist Breach filter, or NULL to skip that check
+  * @return 0 on success, 1 on an I/O error
+  */
+ int runFilter(bool wantStrong, const Blocklist* blocklist) {
+     char* input = malloc(FILTER_BUFFER_SIZE);
+     char* output = malloc(FILTER_BUFFER_SIZE);
+     if (input == NULL || output == NULL) {
+         fprintf(stderr, "Out of memory\n");
+         free(input);
+         free(output);
+         return 1;
+     }
+     
+     size_t inputUsed = 0;
+     size_t outputUsed = 0;
+     size_t overlong = 0;
+     bool skipping = false;  // Discarding the rest of an overlong line
+     bool ok = true;
+     bool atEnd = false;
+     
+     while (ok && !atEnd) {
+         ssize_t received = read(STDIN_FILENO, input + inputUsed, FILTER_BUFFER_SIZE - inputUsed);
+         if (received < 0) {
+             if (errno == EINTR) {
+                 continue;
+             }
+             perror("read");
+             free(input);
+             free(output);
+             return 1;
+         }
+         atEnd = received == 0;
+         inputUsed += (size_t)received;
+         
+         const char* p = input;
+         const char* end = input + inputUsed;
+         while (ok && p < end) {
+             const char* newline = memchr(p, '\n', (size_t)(end - p));
+             if (newline == NULL && !atEnd) {
+                 break;  // Incomplete line; wait for more input
+             }
+             const char* lineEnd = newline != NULL ? newline : end;
+             const char* record = p;
+             size_t length = (size_t)(lineEnd - p);
+             p = newline != NULL ? newline + 1 : end;
+             
+             if (skipping) {
+                 skipping = false;  // This was the tail of an overlong line
+                 continue;
+             }
+             
+             size_t recordLength = length > 0 && record[length - 1] == '\r' ? length - 1 : length;
+             if (recordLength == 0) {
+                 continue;
+             }
+             
+             const char* separator = memchr(record, ':', recordLength);
+             bool strong = false;
+             if (separator != NULL) {
+                 size_t usernameLength = (size_t)(separator - record);
+                 size_t passwordLength = recordLength - usernameLength - 1;
+                 strong = isStrongPasswordBytes(record, usernameLength, separator + 1, passwordLength) &&
+                          (blocklist == NULL || !blocklistContains(blocklist, separator + 1, passwordLength));
+             }
+             if (strong == wantStrong) {
+                 ok = emitFilterLine(output, &outputUsed, record, length);
+             }
+         }
+         
+         // Keep the incomplete tail; a tail that fills the whole buffer is dropped
+         size_t remaining = (size_t)(end - p);
+         if (remaining == FILTER_BUFFER_SIZE) {
+             overlong += !skipping;
+             skipping = true;
+             remaining = 0;
+         }
+         memmove(input, p, remaining);
+         inputUsed = remaining;
+     }
+     
+     if (ok) {
+         ok = writeFully(STDOUT_FILENO, output, outputUsed);
+     }
+     if (!ok) {
+         perror("write");
+     }
+     if (overlong > 0) {
+         fprintf(stderr, "Dropped %zu lines longer than %d bytes\n", overlong, FILTER_BUFFER_SIZE);
+     }
+     
+     free(input);
+     free(output);
+     return ok ? 0 : 1;
+ }
+ 
+ /* Room for the NFKC form of a 99-byte password in the common case */
+ #define NORMALIZED_PASSWORD_SIZE 512
+ 
+ /**
+  * @brief Adds a new password to the history, in the form the checks compare
+  *
+  * In UTF-8 mode the history is checked against NFKC forms, so the NFKC
+  * form is what gets recorded.
+  */
+ void recordNewPassword(PasswordHistory* history, const char* username, const char* password, bool utf8) {
+     char normalized[NORMALIZED_PASSWORD_SIZE];
+     if (utf8) {
+         size_t length = normalizeUtf8Nfkc(password, strlen(password), normalized, sizeof(normalized) - 1);
+         if (length >= sizeof(normalized)) {
+             fprintf(stderr, "Password too long to record in the history\n");
+             return;
+         }
+         normalized[length] = '\0';
+         password = normalized;
+     }
+     if (!addPasswordToHistory(history, username, password)) {
+         fprintf(stderr, "Password history is full\n");
+     }
+ }
+ 
+ /**
+  * @brief Runs the interactive password creation session
+  * 
+  * Controls program flow:
+  * 1. Prompts for username
+  * 2. Generates a default password
+  * 3. Allows user to create a custom password if desired
+  *
+  * @param history Previous passwords to reject and to record the new one in, or NULL
+  * @param utf8 true to check the new password as UTF-8 and record its NFKC form
+  * @return 0 on successful execution
+  */
+ int runInteractiveSession(PasswordHistory* history, bool utf8) {
+     char username[100];
+     char default_password[16];  // Max 15 chars + null terminator
+     char customPassword[100];
+     
+     // Get username
+     printf("Enter username: ");
+     if (scanf("%99s", username) != 1) {
+         return 1;
+     }
+     
+     // Generate and display default password
+     generateDefaultPassword(default_password, username);
+     printf("Generating a default password...\n");
+     printf("Generated default password: %s\n", default_password);
+     
+     // Ask if user wants to manually set password
+     printf("Manually change password? (y/n): ");
+     char choice[3];
+     if (scanf(" %2s", choice) != 1) {
+         return 1;
+     }
+     
+     if (strcmp(choice, "y") == 0 || strcmp(choice, "Y") == 0) {
+         // The new password must not reuse the generated one
+         const char* previous[] = {default_password};
+         SubjectContext subject;
+         if (!initSubjectContext(&subject, username, NULL, previous, 1)) {
+             fprintf(stderr, "Out of memory\n");
+             return 1;
+         }
+         attachPasswordHistory(&subject, history, username);
+         
+         // Keep prompting until a strong password is provided
+         bool created = promptForNewPassword(customPassword, &subject, utf8);
+         while (!created && !feof(stdin)) {
+             created = promptForNewPassword(customPassword, &subject, utf8);
+         }
+         freeSubjectContext(&subject);
+         if (!created) {
+             return 1;  // Input ended before a strong password was given
+         }
+         if (history != NULL) {
+             recordNewPassword(history, username, customPassword, utf8);
+         }
+         printf("Successfully created password: %s\n", customPassword);
+     } else {
+         printf("You chose not to change your password.\n");
+     }
+     
+     return 0;
+ }
+ 
+ /* Users a history file created by --history has room for */
+ #define HISTORY_FILE_USERS 65536
+ 
+ /**
+  * @brief Runs the interactive session against a password history file
+  *
+  * The fingerprint key is read from PASSWORD_HISTORY_KEY as 32 hex digits.
+  * The file is created if it does not exist.
+  *
+  * @param path History file
+  * @param utf8 true to check passwords as UTF-8
+  * @return 0 on successful execution, 1 on error
+  */
+ int runHistorySession(const char* path, bool utf8) {
+     const char* hex = getenv("PASSWORD_HISTORY_KEY");
+     unsigned char key[PASSWORD_HISTORY_KEY_SIZE];
+     
+     if (hex == NULL || strlen(hex) != 2 * PASSWORD_HISTORY_KEY_SIZE) {
+         fprintf(stderr, "PASSWORD_HISTORY_KEY must hold %d hex digits\n", 2 * PASSWORD_HISTORY_KEY_SIZE);
+         return 1;
+     }
+     for (size_t i = 0; i < PASSWORD_HISTORY_KEY_SIZE; i++) {
+         unsigned int byte;
+         if (sscanf(hex + 2 * i, "%2x", &byte) != 1) {
+             fprintf(stderr, "PASSWORD_HISTORY_KEY must hold %d hex digits\n", 2 * PASSWORD_HISTORY_KEY_SIZE);
+             return 1;
+         }
+         key[i] = (unsigned char)byte;
+     }
+     
+     PasswordHistory history;
+     bool opened = access(path, F_OK) == 0 ? openPasswordHistory(&history, path, key)
+                                           : createPasswordHistory(&history, path, HISTORY_FILE_USERS, key);
+     memset(key, 0, sizeof(key));
+     if (!opened) {
+         fprintf(stderr, "Cannot open password history (wrong key?): %s\n", path);
+         return 1;
+     }
+     
+     int status = runInteractiveSession(&history, utf8);
+     closePasswordHistory(&history);
+     return status;
+ }
+ 
+ /**
+  * @brief Prints command-line usage to stderr
+  */
+ void printUsage(const char* program) {
+     fprintf(stderr, "Usage: %s [--utf8]                     interactive session\n", program);
+     fprintf(stderr, "       %s --history FILE [--utf8]      interactive session rejecting reused passwords\n", program);
+     fprintf(stderr, "           (key: 32 hex digits in PASSWORD_HISTORY_KEY)\n");
+     fprintf(stderr, "           --utf8 checks the rules on NFKC-normalized UTF-8 characters\n");
+     fprintf(stderr, "       %s --audit FILE [--threads N] [--stats] [--blocklist CORPUS]\n", program);
+     fprintf(stderr, "           audit username:password lines, optionally against a breach corpus\n");
+     fprintf(stderr, "       %s --audit FILE [--threads N] [--stats] --blocklist-index INDEX\n", program);
+     fprintf(stderr, "           audit against a precompiled blocklist index\n");
+     fprintf(stderr, "       %s --filter strong|weak [--stats] [--blocklist CORPUS | --blocklist-index INDEX]\n", program);
+     fprintf(stderr, "           copy the username:password lines of stdin that pass (or fail)\n");
+     fprintf(stderr, "           --stats prints check counters and latency percentiles to stderr\n");
+     fprintf(stderr, "       %s --build-index CORPUS INDEX   precompile a breach corpus\n", program);
+     fprintf(stderr, "       %s --check-index INDEX          verify an index file\n", program);
+ }
+ 
+ /**
+  * @brief Main program function
+  * 
+  * Without arguments runs the interactive session, and --history FILE runs
+  * it against a password history file; either takes --utf8 to check the new
+  * password as UTF-8. With --audit FILE audits a credential file instead,
+  * optionally against a breach corpus given with --blocklist or a
+  * precompiled index given with --blocklist-index. --filter strong|weak
+  * streams stdin to stdout keeping only passing or failing lines. Both
+  * accept --stats to print runtime statistics when done. --build-index and
+  * --check-index manage index files.
+  *
+  * @return 0 on successful execution
+  */
+ int main(int argc, char* argv[]) {
+     bool utf8 = strcmp(argv[argc - 1], "--utf8") == 0;
+     if (argc == 1 || (argc == 2 && utf8)) {
+         return runInteractiveSession(NULL, utf8);
+     }
+     if (strcmp(argv[1], "--history") == 0 && argc == 3 + utf8) {
+         return runHistorySession(argv[2], utf8);
+     }
+     
+     if (strcmp(argv[1], "--build-index") == 0 && argc == 4) {
+         return runBuildIndex(argv[2], argv[3]);
+     }
+     if (strcmp(argv[1], "--check-index") == 0 && argc == 3) {
+         return runCheckIndex(argv[2]);
+     }
+     
+     const char* auditPath = NULL;
+     const char* filterMode = NULL;
+     bool printStats = false;
+     const char* blocklistPath = NULL;
+     const char* indexPath = NULL;
+     long threadCount = sysconf(_SC_NPROCESSORS_ONLN);
+     
+     for (int i = 1; i < argc; i++) {
+         if (strcmp(argv[i], "--audit") == 0 && i + 1 < argc) {
+             auditPath = argv[++i];
+         } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+             filterMode = argv[++i];
+         } else if (strcmp(argv[i], "--blocklist") == 0 && i + 1 < argc) {
+             blocklistPath = argv[++i];
+         } else if (strcmp(argv[i], "--blocklist-index") == 0 && i + 1 < argc) {
+             indexPath = argv[++i];
+         } else if (strcmp(argv[i], "--stats") == 0) {
+             printStats = true;
+         } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+             threadCount = strtol(argv[++i], NULL, 10);
+         } else {
+             printUsage(argv[0]);
+             return 1;
+         }
+     }
+     
+     bool validFilter = filterMode != NULL &&
+                        (strcmp(filterMode, "strong") == 0 || strcmp(filterMode, "weak") == 0);
+     if ((auditPath == NULL) == (filterMode == NULL) || (filterMode != NULL && !validFilter) ||
+         threadCount < 1 || (blocklistPath != NULL && indexPath != NULL)) {
+         printUsage(argv[0]);
+         return 1;
+     }
+     
+     Blocklist blocklist;
+     bool useBlocklist = blocklistPath != NULL || indexPath != NULL;
+     if (blocklistPath != NULL && !loadBlocklistFromText(&blocklist, blocklistPath)) {
+         fprintf(stderr, "Cannot load blocklist: %s\n", blocklistPath);
+         return 1;
+     }
+     if (indexPath != NULL && !openBlocklistIndex(&blocklist, indexPath, false)) {
+         fprintf(stderr, "Cannot open blocklist index: %s\n", indexPath);
+         return 1;
+     }
+     
+     setPasswordStatsEnabled(printStats);
+     int status = auditPath != NULL
+                  ? runAudit(auditPath, useBlocklist ? &blocklist : NULL, (size_t)threadCount)
+                  : runFilter(strcmp(filterMode, "strong") == 0, useBlocklist ? &blocklist : NULL);
+     if (printStats) {
+         PasswordStats stats;
+         passwordStatsSnapshot(&stats);
+         printPasswordStats(stderr, &stats);
+     }
+     if (useBlocklist) {
+         freeBlocklist(&blocklist);
+     }
+     return status;
+ }
@@ -0,0 +1,710 @@
+/**
+ * @file password_strength_fuzz.c
+ * @brief Differential fuzz driver for the libpasswordstrength validators
+ *
+ * Every optimized path of the library (SIMD and bounded-length kernels,
+ * the single-pass failure masks, compiled policies, batches, subject
+ * contexts, the constant-time and UTF-8 validators) must give exactly the
+ * answers of the original scalar validators. This driver keeps a private
+ * copy of those validators, written the way the first version of the
+ * program wrote them, and checks every entry point against it for each
+ * input. The near matcher behind RULE_SIMILAR and the denylist automaton,
+ * which have no original, are checked against the plain dynamic program
+ * for edit distance and a search at every offset. A mismatch prints the
+ * input in hex and aborts.
+ *
+ * An input is one byte holding the username length, the username, and
+ * the password in the remaining bytes. The same entry point serves
+ * libFuzzer (build with -DPASSWORD_FUZZ_LIBFUZZER -fsanitize=fuzzer), AFL
+ * (pass input files as arguments) and the standalone mode, which replays
+ * files or, without arguments, checks a stream of generated inputs that
+ * mix letters, digits, symbols, high bytes and near copies of the username.
+ */
+
+ #include "password_strength.h"
+ 
+ #include <stdio.h>
+ #include <string.h>
+ #include <stdlib.h>
+ 
+ /* Longest username an input can carry */
+ #define FUZZ_MAX_USERNAME 64
+ 
+ /* Longest input the standalone driver reads from a file or generates */
+ #define FUZZ_MAX_INPUT 4096
+ 
+ /* Generated inputs checked when no file is given */
+ #define FUZZ_DEFAULT_ITERATIONS 1000000
+ 
+ /* Patterns the automaton check derives from one username */
+ #define FUZZ_PATTERNS 9
+ 
+ /*
+  * Reference validators
+  *
+  * Transcribed from the original scalar implementation, with the ctype
+  * calls replaced by their "C" locale meaning and the username search
+  * guarded against a username longer than the password, where the
+  * original's size_t arithmetic wrapped around. They take explicit
+  * lengths so that embedded NUL bytes can be checked too; a NUL counts
+  * as a special character.
+  */
+ 
+ static bool referenceIsUpper(char c) {
+     return c >= 'A' && c <= 'Z';
+ }
+ 
+ static bool referenceIsLower(char c) {
+     return c >= 'a' && c <= 'z';
+ }
+ 
+ static bool referenceIsDigit(char c) {
+     return c >= '0' && c <= '9';
+ }
+ 
+ static bool referenceIsAlpha(char c) {
+     return referenceIsUpper(c) || referenceIsLower(c);
+ }
+ 
+ static char referenceToLower(char c) {
+     return referenceIsUpper(c) ? (char)(c + ('a' - 'A')) : c;
+ }
+ 
+ static bool referenceContainsString(const char* pwd, size_t length) {
+     int consecutiveLetters = 0;
+     for (size_t i = 0; i < length; i++) {
+         if (referenceIsAlpha(pwd[i])) {
+             consecutiveLetters++;
+             if (consecutiveLetters >= MIN_CONSECUTIVE_LETTERS) {
+                 return true;
+             }
+         } else {
+             consecutiveLetters = 0;
+         }
+     }
+     return false;
+ }
+ 
+ static bool referenceHas(const char* pwd, size_t length, bool (*test)(char)) {
+     for (size_t i = 0; i < length; i++) {
+         if (test(pwd[i])) {
+             return true;
+         }
+     }
+     return false;
+ }
+ 
+ static bool referenceIsAlphanumericOnly(const char* pwd, size_t length) {
+     for (size_t i = 0; i < length; i++) {
+         if (!referenceIsAlpha(pwd[i]) && !referenceIsDigit(pwd[i])) {
+             return false;
+         }
+     }
+     return true;
+ }
+ 
+ static bool referenceContainsUsername(const char* username, size_t usernameLength,
+                                       const char* password, size_t passwordLength) {
+     if (usernameLength == 0 || usernameLength > passwordLength) {
+         return false;
+     }
+     for (size_t i = 0; i <= passwordLength - usernameLength; i++) {
+         size_t j;
+         for (j = 0; j < usernameLength; j++) {
+             if (referenceToLower(password[i + j]) != referenceToLower(username[j])) {
+                 break;
+             }
+         }
+         if (j == usernameLength) {
+             return true;
+         }
+     }
+     return false;
+ }
+ 
+ static bool referenceIsStrongPassword(const char* username, size_t usernameLength,
+                                       const char* password, size_t passwordLength) {
+     if (passwordLength < STRONG_MIN_LENGTH) {
+         return false;
+     }
+     if (!referenceHas(password, passwordLength, referenceIsUpper) ||
+         !referenceHas(password, passwordLength, referenceIsLower) ||
+         !referenceHas(password, passwordLength, referenceIsDigit)) {
+         return false;
+     }
+     if (!referenceIsAlphanumericOnly(password, passwordLength)) {
+         return false;
+     }
+     if (!referenceContainsString(password, passwordLength)) {
+         return false;
+     }
+     return !referenceContainsUsername(username, usernameLength, password, passwordLength);
+ }
+ 
+ static bool referenceIsStrongDefaultPassword(const char* password, size_t passwordLength) {
+     if (passwordLength > DEFAULT_MAX_LENGTH) {
+         return false;
+     }
+     if (!referenceHas(password, passwordLength, referenceIsUpper) ||
+         !referenceHas(password, passwordLength, referenceIsLower) ||
+         !referenceHas(password, passwordLength, referenceIsDigit)) {
+         return false;
+     }
+     return referenceIsAlphanumericOnly(password, passwordLength);
+ }
+ 
+ /* Composition rule bits shared by the strong and default masks */
+ static unsigned int referenceClassFailures(const char* password, size_t passwordLength) {
+     return (referenceHas(password, passwordLength, referenceIsUpper) ? 0 : RULE_MISSING_UPPER) |
+            (referenceHas(password, passwordLength, referenceIsLower) ? 0 : RULE_MISSING_LOWER) |
+            (referenceHas(password, passwordLength, referenceIsDigit) ? 0 : RULE_MISSING_DIGIT) |
+            (referenceIsAlphanumericOnly(password, passwordLength) ? 0 : RULE_SPECIAL_CHARACTER);
+ }
+ 
+ static unsigned int referenceStrongFailures(const char* username, size_t usernameLength,
+                                             const char* password, size_t passwordLength) {
+     return (passwordLength >= STRONG_MIN_LENGTH ? 0 : RULE_TOO_SHORT) |
+            referenceClassFailures(password, passwordLength) |
+            (referenceContainsString(password, passwordLength) ? 0 : RULE_NO_LETTER_RUN) |
+            (referenceContainsUsername(username, usernameLength, password, passwordLength)
+                 ? RULE_CONTAINS_USERNAME : 0);
+ }
+ 
+ static unsigned int referenceDefaultFailures(const char* password, size_t passwordLength) {
+     return (passwordLength <= DEFAULT_MAX_LENGTH ? 0 : RULE_TOO_LONG) |
+            referenceClassFailures(password, passwordLength);
+ }
+ 
+ /*
+  * Reference near matcher
+  *
+  * The textbook dynamic program for the smallest edit distance between a
+  * word and any substring of a text: one column of the matrix per text
+  * byte, with a free start at every offset. Bytes are folded the way the
+  * library documents leetspeak folding, written out case by case.
+  */
+ 
+ static char referenceLeetFold(char c) {
+     switch (c) {
+         case '0':
+             return 'o';
+         case '1': case '!': case '|': case 'l': case 'L':
+             return 'i';
+         case '3':
+             return 'e';
+         case '4': case '@':
+             return 'a';
+         case '5': case '$':
+             return 's';
+         case '7': case '+':
+             return 't';
+         case '8':
+             return 'b';
+         default:
+             return referenceToLower(c);
+     }
+ }
+ 
+ static size_t referenceNearDistance(const char* word, size_t wordLength, const char* text, size_t textLength) {
+     size_t column[NEAR_MATCH_MAX_LENGTH + 1];
+     for (size_t j = 0; j <= wordLength; j++) {
+         column[j] = j;
+     }
+     size_t best = wordLength;
+     for (size_t i = 0; i < textLength; i++) {
+         size_t diagonal = column[0];  // The match may start after any byte
+         for (size_t j = 1; j <= wordLength; j++) {
+             size_t substitute = diagonal + (referenceLeetFold(word[j - 1]) != referenceLeetFold(text[i]));
+             size_t insert = column[j] + 1;
+             size_t remove = column[j - 1] + 1;
+             diagonal = column[j];
+             column[j] = substitute < insert ? substitute : insert;
+             column[j] = remove < column[j] ? remove : column[j];
+         }
+         best = column[wordLength] < best ? column[wordLength] : best;
+     }
+     return best;
+ }
+ 
+ /* Whether a pattern occurs, folding ASCII case, in text ending just before end */
+ static bool referencePatternEndsAt(const char* pattern, size_t patternLength, const char* text, size_t end) {
+     if (patternLength == 0 || patternLength > end) {
+         return false;
+     }
+     for (size_t j = 0; j < patternLength; j++) {
+         if (referenceToLower(text[end - patternLength + j]) != referenceToLower(pattern[j])) {
+             return false;
+         }
+     }
+     return true;
+ }
+ 
+ /* Whether an earlier pattern equals this one after case folding; the automaton reports only the first */
+ static bool referencePatternRepeats(const char* const* patterns, const size_t* lengths, size_t p) {
+     for (size_t q = 0; q < p; q++) {
+         if (lengths[q] == lengths[p] && referencePatternEndsAt(patterns[q], lengths[q], patterns[p], lengths[p])) {
+             return true;
+         }
+     }
+     return false;
+ }
+ 
+ /* Whether a subject context holds a near matcher for this word, as initSubjectContext() decides */
+ static bool referenceHasNearWord(size_t wordLength) {
+     return wordLength >= SUBJECT_MIN_DENIED_LENGTH && wordLength <= NEAR_MATCH_MAX_LENGTH;
+ }
+ 
+ /*
+  * Differential checks
+  */
+ 
+ /* Input being checked, for the mismatch report */
+ static const uint8_t* currentInput;
+ static size_t currentSize;
+ 
+ /**
+  * @brief Reports a disagreement with the reference and aborts
+  */
+ static void reportMismatch(const char* check, unsigned int expected, unsigned int actual) {
+     fprintf(stderr, "Mismatch in %s: expected %#x, got %#x\nInput (%zu bytes):", check, expected, actual,
+             currentSize);
+     for (size_t i = 0; i < currentSize; i++) {
+         fprintf(stderr, " %02x", currentInput[i]);
+     }
+     fprintf(stderr, "\n");
+     abort();
+ }
+ 
+ static inline void expectEqual(const char* check, unsigned int expected, unsigned int actual) {
+     if (expected != actual) {
+         reportMismatch(check, expected, actual);
+     }
+ }
+ 
+ /* Matches reported by scanPatternAutomaton() for the current input */
+ typedef struct {
+     const size_t* patternLengths;
+     bool found[FUZZ_PATTERNS][FUZZ_MAX_INPUT + 1];  // By pattern and end offset
+     size_t count;
+ } FuzzPatternMatches;
+ 
+ static bool recordPatternMatch(void* context, size_t patternId, size_t start, size_t end) {
+     FuzzPatternMatches* matches = context;
+     expectEqual("scanPatternAutomaton pattern id", 1, patternId < FUZZ_PATTERNS);
+     expectEqual("scanPatternAutomaton match length", (unsigned int)matches->patternLengths[patternId],
+                 (unsigned int)(end - start));
+     expectEqual("scanPatternAutomaton repeated match", 0, matches->found[patternId][end]);
+     matches->found[patternId][end] = true;
+     matches->count++;
+     return true;
+ }
+ 
+ /**
+  * @brief Checks the automaton against an all-offsets search
+  *
+  * The patterns are cut from the username: the whole of it, suffixes that
+  * share its end, prefixes and a middle slice that overlap it, an
+  * upper-case copy that only differs by case, and an empty pattern that
+  * must be ignored. Cuts that repeat an earlier pattern check that only
+  * the lowest id of equal patterns is reported. Generated passwords often hold the username in mixed
+  * case, so all of them occur.
+  */
+ static void checkPatternAutomaton(const char* username, size_t usernameLength, const char* text, size_t textLength) {
+     static char slices[FUZZ_PATTERNS][FUZZ_MAX_USERNAME + 1];
+     static FuzzPatternMatches matches;
+     const size_t cuts[FUZZ_PATTERNS][2] = {
+         {0, usernameLength}, {1, usernameLength}, {2, usernameLength}, {usernameLength / 2, usernameLength},
+         {0, 2}, {0, usernameLength / 2 + 1}, {1, usernameLength > 1 ? usernameLength - 1 : 1},
+         {0, usernameLength}, {0, 0}
+     };
+     const char* patterns[FUZZ_PATTERNS];
+     size_t lengths[FUZZ_PATTERNS];
+     
+     for (size_t p = 0; p < FUZZ_PATTERNS; p++) {
+         size_t start = cuts[p][0] < usernameLength ? cuts[p][0] : usernameLength;
+         size_t end = cuts[p][1] < usernameLength ? cuts[p][1] : usernameLength;
+         size_t length = end > start ? end - start : 0;
+         memcpy(slices[p], username + start, length);
+         slices[p][length] = '\0';
+         lengths[p] = strlen(slices[p]);  // A NUL byte ends the pattern early
+         patterns[p] = slices[p];
+     }
+     for (size_t i = 0; i < lengths[7]; i++) {
+         char c = slices[7][i];
+         slices[7][i] = c >= 'a' && c <= 'z' ? (char)(c - ('a' - 'A')) : c;
+     }
+     
+     PatternAutomaton automaton;
+     if (!buildPatternAutomaton(&automaton, patterns, FUZZ_PATTERNS)) {
+         return;
+     }
+     memset(matches.found, 0, sizeof(matches.found));
+     matches.patternLengths = lengths;
+     matches.count = 0;
+     scanPatternAutomaton(&automaton, text, textLength, recordPatternMatch, &matches);
+     freePatternAutomaton(&automaton);
+     
+     size_t expected = 0;
+     for (size_t p = 0; p < FUZZ_PATTERNS; p++) {
+         if (referencePatternRepeats(patterns, lengths, p)) {
+             continue;
+         }
+         for (size_t end = 1; end <= textLength; end++) {
+             if (referencePatternEndsAt(patterns[p], lengths[p], text, end)) {
+                 expectEqual("scanPatternAutomaton missed match", 1, matches.found[p][end]);
+                 expected++;
+             }
+         }
+     }
+     expectEqual("scanPatternAutomaton match count", (unsigned int)expected, (unsigned int)matches.count);
+ }
+ 
+ /**
+  * @brief Checks the near matcher for one word against the reference on one text
+  *
+  * Words outside 1 to NEAR_MATCH_MAX_LENGTH bytes must be refused.
+  */
+ static void checkNearMatcher(const char* word, size_t wordLength, const char* text, size_t textLength) {
+     NearMatcher matcher;
+     bool accepted = initNearMatcher(&matcher, word, wordLength);
+     expectEqual("initNearMatcher", wordLength > 0 && wordLength <= NEAR_MATCH_MAX_LENGTH, accepted);
+     if (!accepted) {
+         return;
+     }
+     size_t expected = referenceNearDistance(word, wordLength, text, textLength);
+     expectEqual("nearMatchDistance", (unsigned int)expected,
+                 (unsigned int)nearMatchDistance(&matcher, text, textLength));
+     expectEqual("nearMatchFinds", expected <= wordLength / NEAR_MATCH_CHARS_PER_EDIT,
+                 nearMatchFinds(&matcher, text, textLength));
+ }
+ 
+ /**
+  * @brief Checks every byte-level entry point on one username and password
+  *
+  * Neither string is NUL-terminated and either may contain NUL bytes.
+  */
+ static void checkBytes(const char* username, size_t usernameLength, const char* password, size_t passwordLength) {
+     static CompiledPolicy* strongPolicy;
+     static CompiledPolicy* defaultPolicy;
+     if (strongPolicy == NULL) {
+         PasswordPolicy strong = STRONG_PASSWORD_POLICY;
+         PasswordPolicy simple = DEFAULT_PASSWORD_POLICY;
+         strongPolicy = compilePasswordPolicy(&strong);
+         defaultPolicy = compilePasswordPolicy(&simple);
+         if (strongPolicy == NULL || defaultPolicy == NULL) {
+             fprintf(stderr, "Cannot compile the built-in policies\n");
+             abort();
+         }
+     }
+ 
+     unsigned int expected = referenceStrongFailures(username, usernameLength, password, passwordLength);
+     bool expectedContains = referenceContainsUsername(username, usernameLength, password, passwordLength);
+ 
+     PasswordFeatures fast;
+     PasswordFeatures scalar;
+     classifyPasswordBytes(password, passwordLength, &fast);
+     classifyPasswordBytesScalar(password, passwordLength, &scalar);
+     expectEqual("classifyPasswordBytes length", (unsigned int)scalar.length, (unsigned int)fast.length);
+     expectEqual("classifyPasswordBytes classes", scalar.classes, fast.classes);
+     expectEqual("classifyPasswordBytes longestAlphaRun", (unsigned int)scalar.longestAlphaRun,
+                 (unsigned int)fast.longestAlphaRun);
+     expectEqual("classifyPasswordBytes hasNonAlnum", scalar.hasNonAlnum, fast.hasNonAlnum);
+ 
+     expectEqual("strongPasswordFailuresBytes", expected,
+                 strongPasswordFailuresBytes(username, usernameLength, password, passwordLength));
+     expectEqual("isStrongPasswordBytes", expected == 0,
+                 isStrongPasswordBytes(username, usernameLength, password, passwordLength));
+     expectEqual("containsUsernameBytes", expectedContains,
+                 containsUsernameBytes(username, usernameLength, password, passwordLength));
+     expectEqual("defaultRuleFailures", referenceDefaultFailures(password, passwordLength),
+                 defaultRuleFailures(&fast));
+ 
+     UsernameMatcher matcher;
+     if (initUsernameMatcherBytes(&matcher, username, usernameLength)) {
+         expectEqual("matcherFindsUsernameBytes", expectedContains,
+                     matcherFindsUsernameBytes(&matcher, password, passwordLength));
+         freeUsernameMatcher(&matcher);
+     }
+     
+     // The password doubles as a word, which covers lengths past NEAR_MATCH_MAX_LENGTH
+     checkNearMatcher(username, usernameLength, password, passwordLength);
+     checkNearMatcher(password, passwordLength, username, usernameLength);
+     checkPatternAutomaton(username, usernameLength, password, passwordLength);
+ 
+     expectEqual("passwordPolicyFailuresBytes(STRONG_PASSWORD_POLICY)", expected,
+                 passwordPolicyFailuresBytes(strongPolicy, username, usernameLength, password, passwordLength));
+     expectEqual("passwordPolicyFailuresBytes(DEFAULT_PASSWORD_POLICY)", referenceDefaultFailures(password, passwordLength),
+                 passwordPolicyFailuresBytes(defaultPolicy, username, usernameLength, password, passwordLength));
+ 
+     if (passwordLength <= CONSTANT_TIME_MAX_LENGTH) {
+         expectEqual("strongPasswordFailuresConstantTime", expected,
+                     strongPasswordFailuresConstantTime(username, usernameLength, password, passwordLength));
+     } else {
+         unsigned int failures = strongPasswordFailuresConstantTime(username, usernameLength, password, passwordLength);
+         expectEqual("strongPasswordFailuresConstantTime RULE_TOO_LONG", RULE_TOO_LONG, failures & RULE_TOO_LONG);
+     }
+ 
+     if (isAsciiBytes(password, passwordLength) && isAsciiBytes(username, usernameLength)) {
+         expectEqual("strongPasswordFailuresUtf8", expected,
+                     strongPasswordFailuresUtf8(username, usernameLength, password, passwordLength));
+     } else {
+         // The UTF-8 path has no scalar reference; NFKC must at least be idempotent
+         static char once[FUZZ_MAX_INPUT * 16];
+         static char twice[FUZZ_MAX_INPUT * 16];
+         size_t onceLength = normalizeUtf8Nfkc(password, passwordLength, once, sizeof(once));
+         if (onceLength != SIZE_MAX && onceLength <= sizeof(once)) {
+             size_t twiceLength = normalizeUtf8Nfkc(once, onceLength, twice, sizeof(twice));
+             expectEqual("normalizeUtf8Nfkc idempotent length", (unsigned int)onceLength, (unsigned int)twiceLength);
+             expectEqual("normalizeUtf8Nfkc idempotent bytes", 0, (unsigned int)memcmp(once, twice, onceLength) != 0);
+         }
+         strongPasswordFailuresUtf8(username, usernameLength, password, passwordLength);
+     }
+ }
+ 
+ /**
+  * @brief Checks the NUL-terminated entry points on one username and password
+  */
+ static void checkStrings(const char* username, const char* password) {
+     size_t usernameLength = strlen(username);
+     size_t passwordLength = strlen(password);
+     unsigned int expected = referenceStrongFailures(username, usernameLength, password, passwordLength);
+     bool expectedStrong = referenceIsStrongPassword(username, usernameLength, password, passwordLength);
+ 
+     expectEqual("isStrongPassword", expectedStrong, isStrongPassword(username, password));
+     expectEqual("isStrongDefaultPassword", referenceIsStrongDefaultPassword(password, passwordLength),
+                 isStrongDefaultPassword(username, password));
+     expectEqual("containsUsername", referenceContainsUsername(username, usernameLength, password, passwordLength),
+                 containsUsername(username, password));
+     expectEqual("containsString", referenceContainsString(password, passwordLength), containsString(password));
+     expectEqual("isAlphanumericOnly", referenceIsAlphanumericOnly(password, passwordLength),
+                 isAlphanumericOnly(password));
+     expectEqual("strongPasswordFailures", expected, strongPasswordFailures(username, password));
+     expectEqual("defaultPasswordFailures", referenceDefaultFailures(password, passwordLength),
+                 defaultPasswordFailures(username, password));
+ 
+     UsernameMatcher matcher;
+     if (initUsernameMatcher(&matcher, username)) {
+         expectEqual("isStrongPasswordWithMatcher", expectedStrong, isStrongPasswordWithMatcher(&matcher, password));
+         freeUsernameMatcher(&matcher);
+     }
+ 
+     size_t offset = 0;
+     const char* usernames[1] = {username};
+     uint16_t failures = 0;
+     unsigned char strong = 0;
+     validatePasswordBatchFailures(password, &offset, &passwordLength, usernames, 1, &failures);
+     validatePasswordBatch(password, &offset, &passwordLength, usernames, 1, &strong);
+     expectEqual("validatePasswordBatchFailures", expected, failures);
+     expectEqual("validatePasswordBatch", expectedStrong, strong & 1);
+ 
+     // Without a denylist the only near word is the username
+     unsigned int expectedSubject = expected;
+     if ((expected & RULE_CONTAINS_USERNAME) == 0 && referenceHasNearWord(usernameLength) &&
+         referenceNearDistance(username, usernameLength, password, passwordLength) <=
+             usernameLength / NEAR_MATCH_CHARS_PER_EDIT) {
+         expectedSubject |= RULE_SIMILAR;
+     }
+     SubjectContext context;
+     if (initSubjectContext(&context, username, NULL, NULL, 0)) {
+         expectEqual("subjectPasswordFailures", expectedSubject, subjectPasswordFailures(&context, password));
+         expectEqual("subjectPasswordFailuresUtf8",
+                     strongPasswordFailuresUtf8(username, usernameLength, password, passwordLength),
+                     subjectPasswordFailuresUtf8(&context, password, passwordLength) & ~RULE_SIMILAR);
+         freeSubjectContext(&context);
+     }
+ }
+ 
+ /**
+  * @brief Checks one fuzz input
+  *
+  * @param data First byte selects the username length, then the username, then the password
+  * @param size Number of bytes in data
+  * @return 0, as libFuzzer expects
+  */
+ int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+     if (size == 0) {
+         return 0;
+     }
+     currentInput = data;
+     currentSize = size;
+ 
+     size_t usernameLength = data[0] % (FUZZ_MAX_USERNAME + 1);
+     if (usernameLength > size - 1) {
+         usernameLength = size - 1;
+     }
+     const char* username = (const char*)data + 1;
+     const char* password = username + usernameLength;
+     size_t passwordLength = size - 1 - usernameLength;
+ 
+     // Exact-size heap copies let ASan catch any read past either string
+     char* usernameCopy = malloc(usernameLength + 1);
+     char* passwordCopy = malloc(passwordLength + 1);
+     if (usernameCopy == NULL || passwordCopy == NULL) {
+         free(usernameCopy);
+         free(passwordCopy);
+         return 0;
+     }
+     memcpy(usernameCopy, username, usernameLength);
+     memcpy(passwordCopy, password, passwordLength);
+     usernameCopy[usernameLength] = '\0';
+     passwordCopy[passwordLength] = '\0';
+ 
+     checkBytes(usernameCopy, usernameLength, passwordCopy, passwordLength);
+     checkStrings(usernameCopy, passwordCopy);
+ 
+     free(usernameCopy);
+     free(passwordCopy);
+     return 0;
+ }
+ 
+ #ifndef PASSWORD_FUZZ_LIBFUZZER
+ 
+ /*
+  * Standalone driver
+  */
+ 
+ static uint64_t fuzzState = 0x9e3779b97f4a7c15ull;
+ 
+ /* Uniform value below bound from a xorshift64* stream */
+ static inline uint32_t fuzzRandom(uint32_t bound) {
+     fuzzState ^= fuzzState >> 12;
+     fuzzState ^= fuzzState << 25;
+     fuzzState ^= fuzzState >> 27;
+     return (uint32_t)(((fuzzState * 0x2545F4914F6CDD1Dull) >> 32) % bound);
+ }
+ 
+ /* A byte from one of a few alphabets, mostly alphanumeric */
+ static uint8_t fuzzByte(void) {
+     static const char alphanumeric[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+     static const char edges[] = "@[`{/:09AZaz";
+     switch (fuzzRandom(8)) {
+         case 0:  return (uint8_t)edges[fuzzRandom(sizeof(edges) - 1)];
+         case 1:  return (uint8_t)fuzzRandom(256);
+         default: return (uint8_t)alphanumeric[fuzzRandom(sizeof(alphanumeric) - 1)];
+     }
+ }
+ 
+ /* A leetspeak spelling of a byte, or the byte itself */
+ static uint8_t fuzzLeet(uint8_t c) {
+     static const char* const spellings[] = {"a4@", "b8", "e3", "i1!|lL", "l1|", "o0", "s5$", "t7+"};
+     for (size_t i = 0; i < sizeof(spellings) / sizeof(spellings[0]); i++) {
+         if ((c | 0x20) == (uint8_t)spellings[i][0]) {
+             return (uint8_t)spellings[i][fuzzRandom((uint32_t)strlen(spellings[i]))];
+         }
+     }
+     return c;
+ }
+ 
+ /**
+  * @brief Builds one structured input
+  *
+  * Passwords are mostly 0-80 bytes with an occasional long one, and often
+  * contain the username with its case changed, leetspeak substitutions,
+  * or one byte altered, dropped or duplicated.
+  *
+  * @return Number of bytes written to input
+  */
+ static size_t generateInput(uint8_t* input) {
+     size_t usernameLength = fuzzRandom(4) == 0 ? fuzzRandom(FUZZ_MAX_USERNAME + 1) : fuzzRandom(13);
+     size_t passwordLength = fuzzRandom(16) == 0 ? fuzzRandom(FUZZ_MAX_INPUT - FUZZ_MAX_USERNAME - 1)
+                                                 : fuzzRandom(81);
+     input[0] = (uint8_t)usernameLength;
+     uint8_t* username = input + 1;
+     uint8_t* password = username + usernameLength;
+ 
+     for (size_t i = 0; i < usernameLength; i++) {
+         username[i] = fuzzByte();
+     }
+     for (size_t i = 0; i < passwordLength; i++) {
+         password[i] = fuzzByte();
+     }
+     if (usernameLength > 0 && usernameLength <= passwordLength && fuzzRandom(2) == 0) {
+         size_t at = fuzzRandom((uint32_t)(passwordLength - usernameLength + 1));
+         bool leet = fuzzRandom(4) == 0;
+         for (size_t i = 0; i < usernameLength; i++) {
+             uint8_t c = username[i];
+             password[at + i] = fuzzRandom(2) == 0 && ((c | 0x20) >= 'a' && (c | 0x20) <= 'z') ? c ^ 0x20 : c;
+             if (leet && fuzzRandom(2) == 0) {
+                 password[at + i] = fuzzLeet(c);
+             }
+         }
+         size_t edit = at + fuzzRandom((uint32_t)usernameLength);
+         switch (fuzzRandom(8)) {
+             case 0:
+                 password[edit] ^= (uint8_t)(1 + fuzzRandom(255));
+                 break;
+             case 1:  // Drop a byte, shifting the rest of the password down
+                 memmove(password + edit, password + edit + 1, passwordLength - edit - 1);
+                 passwordLength--;
+                 break;
+             case 2:  // Duplicate a byte, losing the last one
+                 memmove(password + edit + 1, password + edit, passwordLength - edit - 1);
+                 break;
+             default:
+                 break;
+         }
+     }
+     return 1 + usernameLength + passwordLength;
+ }
+ 
+ /**
+  * @brief Runs one input file through the checks
+  *
+  * @return false if the file cannot be read
+  */
+ static bool replayFile(const char* path) {
+     static uint8_t input[FUZZ_MAX_INPUT];
+     FILE* file = fopen(path, "rb");
+     if (file == NULL) {
+         return false;
+     }
+     size_t size = fread(input, 1, sizeof(input), file);
+     fclose(file);
+     LLVMFuzzerTestOneInput(input, size);
+     return true;
+ }
+ 
+ /**
+  * @brief Main program function
+  *
+  * Usage: password_strength_fuzz [-n ITERATIONS] [-s SEED] [FILE...]
+  * Files are replayed once each; otherwise ITERATIONS generated inputs
+  * are checked. A mismatch aborts the program.
+  *
+  * @return 0 if every check passed, 1 on a usage or file error
+  */
+ int main(int argc, char* argv[]) {
+     unsigned long iterations = FUZZ_DEFAULT_ITERATIONS;
+     int files = 0;
+ 
+     for (int i = 1; i < argc; i++) {
+         if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+             iterations = strtoul(argv[++i], NULL, 10);
+         } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+             fuzzState = strtoull(argv[++i], NULL, 0) | 1;
+         } else if (argv[i][0] == '-') {
+             fprintf(stderr, "Usage: %s [-n ITERATIONS] [-s SEED] [FILE...]\n", argv[0]);
+             return 1;
+         } else {
+             if (!replayFile(argv[i])) {
+                 fprintf(stderr, "Cannot read %s\n", argv[i]);
+                 return 1;
+             }
+             files++;
+         }
+     }
+     if (files > 0) {
+         printf("%d inputs replayed, no mismatch\n", files);
+         return 0;
+     }
+ 
+     static uint8_t input[FUZZ_MAX_INPUT];
+     for (unsigned long i = 0; i < iterations; i++) {
+         size_t size = generateInput(input);
+         LLVMFuzzerTestOneInput(input, size);
+     }
+     printf("%lu generated inputs checked, no mismatch\n", iterations);
+     return 0;
+ }
+ 
+ #endif
@@ -0,0 +1,801 @@
+/**
+ * @file password_strength_server.c
+ * @brief Long-running validation daemon for libpasswordstrength
+ * 
+ * Serves batched strong-password checks over a Unix or TCP socket, so
+ * services written in any language can validate passwords without
+ * forking a checker per request. The breach blocklist is loaded once and
+ * stays warm for the life of the process.
+ * 
+ * Protocol (all integers little-endian). A request frame is
+ *     u32 payloadLength, then payloadLength bytes:
+ *     u32 count, then count records of
+ *         u16 usernameLength, u16 passwordLength, username bytes, password bytes
+ * and is answered, in order, by a response frame
+ *     u32 payloadLength, then payloadLength bytes:
+ *     u32 count, then count u16 result codes
+ * where each code is the RULE_* failure mask of that record (0 = strong,
+ * RULE_BREACHED when the password is in the blocklist). Any number of
+ * requests may be pipelined on one connection, and a client that
+ * half-closes after its last request still gets every response before the
+ * connection closes. A malformed or oversized frame closes the connection.
+ * With --constant-time the rules are checked by
+ * strongPasswordFailuresConstantTime(), so response time does not reveal
+ * which rule failed; passwords longer than CONSTANT_TIME_MAX_LENGTH are
+ * then rejected with RULE_TOO_LONG. With --utf8 they are checked by
+ * strongPasswordFailuresUtf8(), which counts characters and classifies
+ * non-ASCII letters and digits after NFKC normalization.
+ */
+
+ #define _GNU_SOURCE  // accept4()
+ 
+ #include "password_strength.h"
+ 
+ #include <stdio.h>
+ #include <string.h>
+ #include <stdlib.h>
+ #include <errno.h>
+ #include <signal.h>
+ #include <pthread.h>
+ #include <time.h>
+ #include <fcntl.h>
+ #include <unistd.h>
+ #include <netdb.h>
+ #include <netinet/in.h>
+ #include <netinet/tcp.h>
+ #include <sys/socket.h>
+ #include <sys/un.h>
+ #include <sys/stat.h>
+ #include <sys/epoll.h>
+ 
+ /* Largest request payload accepted; larger frames close the connection */
+ #define SERVER_MAX_FRAME (16u * 1024 * 1024)
+ 
+ /* Smallest record: two u16 lengths with empty username and password */
+ #define SERVER_MIN_RECORD 4
+ 
+ /* Initial per-connection input buffer */
+ #define SERVER_INPUT_BUFFER 65536
+ 
+ /* Unsent response bytes at which a connection stops reading new requests */
+ #define SERVER_MAX_PENDING_OUTPUT (4u * 1024 * 1024)
+ 
+ /* Events handled per epoll_wait() call */
+ #define SERVER_MAX_EVENTS 64
+ 
+ /* How often workers wake to notice a shutdown request */
+ #define SERVER_POLL_TIMEOUT_MS 200
+ 
+ /* How long a worker stops accepting after accept4() fails with no way to shed the connection */
+ #define SERVER_ACCEPT_PAUSE_MS 100
+ 
+ /* Set by SIGINT/SIGTERM */
+ static volatile sig_atomic_t serverStopping = 0;
+ 
+ /* Set by SIGUSR1 when --stats is on; the first worker prints and clears it */
+ static volatile sig_atomic_t serverStatsRequested = 0;
+ 
+ /**
+  * @brief One client connection, owned by the worker that accepted it
+  */
+ typedef struct ServerConnection {
+     int fd;
+     unsigned char* input;             // Received bytes not yet consumed
+     size_t inputUsed;
+     size_t inputCapacity;
+     unsigned char* output;            // Encoded responses not yet sent
+     size_t outputUsed;
+     size_t outputSent;                // Bytes of output already written
+     size_t outputCapacity;
+     unsigned int interest;            // EPOLL* events currently registered
+     bool peerClosed;                  // Peer shut down its side; close once output is flushed
+     struct ServerConnection* prev;    // Worker's connection list
+     struct ServerConnection* next;
+ } ServerConnection;
+ 
+ /**
+  * @brief Per-thread event loop state
+  */
+ typedef struct {
+     bool reportsStats;                // Prints snapshots on SIGUSR1
+     bool constantTime;                // Checks rules with the constant-time validator
+     bool utf8;                        // Checks rules with the UTF-8 validator
+     int listenFd;                     // Shared listening socket
+     int epollFd;                      // This worker's epoll instance
+     int spareFd;                      // Reserved descriptor for shedding connections at the fd limit, or -1
+     bool acceptPaused;                // listenFd is out of the epoll set until acceptResumeMs
+     uint64_t acceptResumeMs;
+     const Blocklist* blocklist;       // Breach filter, or NULL
+     ServerConnection* connections;    // Open connections, for cleanup
+ } ServerWorker;
+ 
+ static inline uint32_t readLe32(const unsigned char* p) {
+     return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+ }
+ 
+ static inline uint16_t readLe16(const unsigned char* p) {
+     return (uint16_t)(p[0] | (p[1] << 8));
+ }
+ 
+ static inline void writeLe32(unsigned char* p, uint32_t v) {
+     p[0] = (unsigned char)v;
+     p[1] = (unsigned char)(v >> 8);
+     p[2] = (unsigned char)(v >> 16);
+     p[3] = (unsigned char)(v >> 24);
+ }
+ 
+ static inline void writeLe16(unsigned char* p, uint16_t v) {
+     p[0] = (unsigned char)v;
+     p[1] = (unsigned char)(v >> 8);
+ }
+ 
+ /**
+  * @brief Stops the workers at their next wakeup
+  */
+ void handleStopSignal(int signal) {
+     (void)signal;
+     serverStopping = 1;
+ }
+ 
+ /**
+  * @brief Asks the first worker to print a statistics snapshot
+  */
+ void handleStatsSignal(int signal) {
+     (void)signal;
+     serverStatsRequested = 1;
+ }
+ 
+ /**
+  * @brief Prints a statistics snapshot to stderr
+  */
+ void dumpServerStats(void) {
+     PasswordStats stats;
+     passwordStatsSnapshot(&stats);
+     printPasswordStats(stderr, &stats);
+ }
+ 
+ /**
+  * @brief Grows a buffer to hold at least the requested number of bytes
+  *
+  * @return true on success, false if memory could not be allocated
+  */
+ bool reserveBuffer(unsigned char** buffer, size_t* capacity, size_t needed) {
+     if (needed <= *capacity) {
+         return true;
+     }
+     size_t grown = *capacity > 0 ? *capacity : SERVER_INPUT_BUFFER;
+     while (grown < needed) {
+         grown *= 2;
+     }
+     unsigned char* resized = realloc(*buffer, grown);
+     if (resized == NULL) {
+         return false;
+     }
+     *buffer = resized;
+     *capacity = grown;
+     return true;
+ }
+ 
+ /**
+  * @brief Validates one request payload and appends its response frame
+  *
+  * @return true on success, false if the payload is malformed or memory ran out
+  */
+ bool handleRequest(ServerWorker* worker, ServerConnection* connection,
+                    const unsigned char* payload, uint32_t length) {
+     if (length < 4) {
+         return false;
+     }
+     uint32_t count = readLe32(payload);
+     if (count > (length - 4) / SERVER_MIN_RECORD) {
+         return false;
+     }
+     
+     size_t responseLength = 4 + 2 * (size_t)count;
+     if (!reserveBuffer(&connection->output, &connection->outputCapacity,
+                        connection->outputUsed + 4 + responseLength)) {
+         return false;
+     }
+     unsigned char* response = connection->output + connection->outputUsed;
+     writeLe32(response, (uint32_t)responseLength);
+     writeLe32(response + 4, count);
+     
+     size_t position = 4;
+     for (uint32_t i = 0; i < count; i++) {
+         if (length - position < SERVER_MIN_RECORD) {
+             return false;
+         }
+         size_t usernameLength = readLe16(payload + position);
+         size_t passwordLength = readLe16(payload + position + 2);
+         position += SERVER_MIN_RECORD;
+         if (length - position < usernameLength + passwordLength) {
+             return false;
+         }
+         const char* username = (const char*)payload + position;
+         const char* password = username + usernameLength;
+         position += usernameLength + passwordLength;
+         
+         unsigned int failures;
+         if (worker->constantTime) {
+             failures = strongPasswordFailuresConstantTime(username, usernameLength, password, passwordLength);
+         } else if (worker->utf8) {
+             failures = strongPasswordFailuresUtf8(username, usernameLength, password, passwordLength);
+         } else {
+             failures = strongPasswordFailuresBytes(username, usernameLength, password, passwordLength);
+         }
+         if (worker->blocklist != NULL && blocklistContains(worker->blocklist, password, passwordLength)) {
+             failures |= RULE_BREACHED;
+         }
+         writeLe16(response + 8 + 2 * (size_t)i, (uint16_t)failures);
+     }
+     if (position != length) {
+         return false;
+     }
+     
+     connection->outputUsed += 4 + responseLength;
+     return true;
+ }
+ 
+ /**
+  * @brief Answers every complete request frame in the input buffer
+  *
+  * @return true on success, false if the connection must be closed
+  */
+ bool processRequests(ServerWorker* worker, ServerConnection* connection) {
+     size_t consumed = 0;
+     
+     while (connection->inputUsed - consumed >= 4) {
+         uint32_t length = readLe32(connection->input + consumed);
+         if (length > SERVER_MAX_FRAME) {
+             return false;
+         }
+         if (connection->inputUsed - consumed - 4 < length) {
+             break;
+         }
+         if (!handleRequest(worker, connection, connection->input + consumed + 4, length)) {
+             return false;
+         }
+         consumed += 4 + (size_t)length;
+     }
+     
+     if (consumed > 0) {
+         memmove(connection->input, connection->input + consumed, connection->inputUsed - consumed);
+         connection->inputUsed -= consumed;
+     }
+     return true;
+ }
+ 
+ /**
+  * @brief Writes as much pending output as the socket accepts
+  *
+  * @return true on success, false if the connection failed
+  */
+ bool flushConnection(ServerConnection* connection) {
+     while (connection->outputSent < connection->outputUsed) {
+         ssize_t sent = send(connection->fd, connection->output + connection->outputSent,
+                             connection->outputUsed - connection->outputSent, MSG_NOSIGNAL);
+         if (sent < 0) {
+             if (errno == EINTR) {
+                 continue;
+             }
+             return errno == EAGAIN || errno == EWOULDBLOCK;
+         }
+         connection->outputSent += (size_t)sent;
+     }
+     connection->outputUsed = 0;
+     connection->outputSent = 0;
+     return true;
+ }
+ 
+ /**
+  * @brief Reads and answers requests until the socket is drained or output backs up
+  *
+  * End of input sets peerClosed rather than failing: a client may pipeline
+  * its requests and half-close, and still expects every response. An
+  * incomplete frame left at that point is dropped.
+  *
+  * @return true on success, false if the stream is invalid or the connection failed
+  */
+ bool readConnection(ServerWorker* worker, ServerConnection* connection) {
+     while (!connection->peerClosed &&
+            connection->outputUsed - connection->outputSent < SERVER_MAX_PENDING_OUTPUT) {
+         // Make room for at least the rest of the frame currently being received
+         size_t needed = connection->inputUsed + SERVER_INPUT_BUFFER / 4;
+         if (connection->inputUsed >= 4) {
+             size_t frame = 4 + (size_t)readLe32(connection->input);
+             if (frame > 4 + (size_t)SERVER_MAX_FRAME) {
+                 return false;
+             }
+             if (frame > needed) {
+                 needed = frame;
+             }
+         }
+         if (!reserveBuffer(&connection->input, &connection->inputCapacity, needed)) {
+             return false;
+         }
+         
+         ssize_t received = recv(connection->fd, connection->input + connection->inputUsed,
+                                 connection->inputCapacity - connection->inputUsed, 0);
+         if (received == 0) {
+             connection->peerClosed = true;
+             break;
+         }
+         if (received < 0) {
+             if (errno == EINTR) {
+                 continue;
+             }
+             return errno == EAGAIN || errno == EWOULDBLOCK;
+         }
+         connection->inputUsed += (size_t)received;
+         
+         if (!processRequests(worker, connection)) {
+             return false;
+         }
+     }
+     return true;
+ }
+ 
+ /**
+  * @brief Closes a connection and releases its buffers
+  */
+ void closeConnection(ServerWorker* worker, ServerConnection* connection) {
+     epoll_ctl(worker->epollFd, EPOLL_CTL_DEL, connection->fd, NULL);
+     close(connection->fd);
+     if (connection->prev != NULL) {
+         connection->prev->next = connection->next;
+     } else {
+         worker->connections = connection->next;
+     }
+     if (connection->next != NULL) {
+         connection->next->prev = connection->prev;
+     }
+     free(connection->input);
+     free(connection->output);
+     free(connection);
+ }
+ 
+ /**
+  * @brief Registers interest in reads while output is below the limit, and in writes while any is pending
+  *
+  * A half-closed connection stays readable forever, so it is only watched
+  * for writes.
+  *
+  * @return true on success, false if epoll rejected the change
+  */
+ bool updateInterest(ServerWorker* worker, ServerConnection* connection) {
+     size_t pending = connection->outputUsed - connection->outputSent;
+     unsigned int interest = (pending < SERVER_MAX_PENDING_OUTPUT && !connection->peerClosed ? EPOLLIN : 0) |
+                             (pending > 0 ? EPOLLOUT : 0);
+     if (interest == connection->interest) {
+         return true;
+     }
+     struct epoll_event event = {.events = interest, .data.ptr = connection};
+     connection->interest = interest;
+     return epoll_ctl(worker->epollFd, EPOLL_CTL_MOD, connection->fd, &event) == 0;
+ }
+ 
+ static uint64_t monotonicMs(void) {
+     struct timespec now;
+     clock_gettime(CLOCK_MONOTONIC, &now);
+     return (uint64_t)now.tv_sec * 1000 + (uint64_t)now.tv_nsec / 1000000;
+ }
+ 
+ /**
+  * @brief Refuses one pending connection while the process is out of descriptors
+  *
+  * The listener is level-triggered, so a connection that cannot be
+  * accepted keeps it readable and the worker would spin. The worker's
+  * spare descriptor is given up to accept the connection and close it at
+  * once, then taken back. accept4() reports EMFILE even when nothing is
+  * pending, so an empty backlog shows up here as EAGAIN.
+  *
+  * @return true if a connection was shed; false with errno set otherwise:
+  *         EAGAIN once no connection is pending, EMFILE without a spare
+  */
+ bool shedConnection(ServerWorker* worker) {
+     if (worker->spareFd < 0) {
+         errno = EMFILE;
+         return false;
+     }
+     close(worker->spareFd);
+     int fd = accept4(worker->listenFd, NULL, NULL, SOCK_CLOEXEC);
+     int error = errno;
+     if (fd >= 0) {
+         close(fd);
+     }
+     worker->spareFd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+     errno = error;
+     return fd >= 0;
+ }
+ 
+ /**
+  * @brief Takes the listener out of this worker's epoll set for SERVER_ACCEPT_PAUSE_MS
+  */
+ void pauseAccepting(ServerWorker* worker) {
+     if (epoll_ctl(worker->epollFd, EPOLL_CTL_DEL, worker->listenFd, NULL) == 0) {
+         worker->acceptPaused = true;
+         worker->acceptResumeMs = monotonicMs() + SERVER_ACCEPT_PAUSE_MS;
+     }
+ }
+ 
+ /**
+  * @brief Puts the listener back once a pause has run out
+  *
+  * @return Milliseconds the worker may wait for events before calling again
+  */
+ int resumeAccepting(ServerWorker* worker) {
+     if (!worker->acceptPaused) {
+         return SERVER_POLL_TIMEOUT_MS;
+     }
+     uint64_t now = monotonicMs();
+     if (now < worker->acceptResumeMs) {
+         return (int)(worker->acceptResumeMs - now);
+     }
+     struct epoll_event event = {.events = EPOLLIN | EPOLLEXCLUSIVE, .data.ptr = NULL};
+     if (epoll_ctl(worker->epollFd, EPOLL_CTL_ADD, worker->listenFd, &event) != 0) {
+         worker->acceptResumeMs = now + SERVER_ACCEPT_PAUSE_MS;
+         return SERVER_ACCEPT_PAUSE_MS;
+     }
+     worker->acceptPaused = false;
+     return SERVER_POLL_TIMEOUT_MS;
+ }
+ 
+ /**
+  * @brief Accepts every pending connection on the listening socket
+  *
+  * At the descriptor limit (EMFILE, ENFILE) pending connections are shed
+  * with shedConnection(); when that or accept4() fails otherwise, the
+  * worker pauses accepting instead of spinning on the readable listener.
+  */
+ void acceptConnections(ServerWorker* worker) {
+     for (;;) {
+         int fd = accept4(worker->listenFd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+         if (fd < 0) {
+             int error = errno;
+             if (error == EMFILE || error == ENFILE) {
+                 if (shedConnection(worker)) {
+                     continue;
+                 }
+                 error = errno;
+             }
+             if (error == EINTR || error == ECONNABORTED) {
+                 continue;
+             }
+             if (error != EAGAIN && error != EWOULDBLOCK) {
+                 pauseAccepting(worker);
+             }
+             return;  // EAGAIN, or another worker took it
+         }
+         
+         int one = 1;
+         setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));  // Fails harmlessly on Unix sockets
+         
+         ServerConnection* connection = calloc(1, sizeof(ServerConnection));
+         if (connection == NULL) {
+             close(fd);
+             continue;
+         }
+         connection->fd = fd;
+         connection->interest = EPOLLIN;
+         
+         struct epoll_event event = {.events = EPOLLIN, .data.ptr = connection};
+         if (epoll_ctl(worker->epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+             close(fd);
+             free(connection);
+             continue;
+         }
+         connection->next = worker->connections;
+         if (worker->connections != NULL) {
+             worker->connections->prev = connection;
+         }
+         worker->connections = connection;
+     }
+ }
+ 
+ /**
+  * @brief Event loop of one worker thread
+  *
+  * Every worker waits on the shared listening socket with EPOLLEXCLUSIVE,
+  * so each new connection wakes one worker, which then serves it for its
+  * whole lifetime without any locking.
+  */
+ void* serverWorker(void* arg) {
+     ServerWorker* worker = arg;
+     struct epoll_event events[SERVER_MAX_EVENTS];
+     
+     while (!serverStopping) {
+         if (worker->reportsStats && serverStatsRequested) {
+             serverStatsRequested = 0;
+             dumpServerStats();
+         }
+         int timeout = resumeAccepting(worker);
+         int ready = epoll_wait(worker->epollFd, events, SERVER_MAX_EVENTS, timeout);
+         if (ready < 0) {
+             if (errno == EINTR) {
+                 continue;
+             }
+             perror("epoll_wait");
+             break;
+         }
+         
+         for (int i = 0; i < ready; i++) {
+             ServerConnection* connection = events[i].data.ptr;
+             if (connection == NULL) {
+                 acceptConnections(worker);
+                 continue;
+             }
+             
+             bool healthy = (events[i].events & (EPOLLERR | EPOLLHUP)) == 0 ||
+                            (events[i].events & EPOLLIN) != 0;
+             if (healthy && (events[i].events & EPOLLOUT)) {
+                 healthy = flushConnection(connection);
+             }
+             if (healthy && (events[i].events & EPOLLIN)) {
+                 healthy = readConnection(worker, connection) && flushConnection(connection);
+             }
+             if (healthy && connection->peerClosed && connection->outputUsed == connection->outputSent) {
+                 healthy = false;  // Every response has been sent
+             }
+             if (healthy) {
+                 healthy = updateInterest(worker, connection);
+             }
+             if (!healthy) {
+                 closeConnection(worker, connection);
+             }
+         }
+     }
+     
+     while (worker->connections != NULL) {
+         closeConnection(worker, worker->connections);
+     }
+     return NULL;
+ }
+ 
+ /**
+  * @brief Creates the listening socket for "unix:PATH", "tcp:PORT" or "tcp:HOST:PORT"
+  *
+  * A stale socket file at PATH is replaced; any other file is left alone
+  * and reported as an error. "tcp:PORT" listens on the loopback address.
+  *
+  * @param address Listen address
+  * @return Non-blocking listening socket, or -1 on error
+  */
+ int openListener(const char* address) {
+     int fd = -1;
+     
+     if (strncmp(address, "unix:", 5) == 0) {
+         const char* path = address + 5;
+         struct sockaddr_un local = {.sun_family = AF_UNIX};
+         struct stat info;
+         
+         if (strlen(path) >= sizeof(local.sun_path)) {
+             fprintf(stderr, "Socket path too long: %s\n", path);
+             return -1;
+         }
+         strcpy(local.sun_path, path);
+         if (stat(path, &info) == 0 && S_ISSOCK(info.st_mode)) {
+             unlink(path);
+         }
+         
+         fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+         if (fd < 0 || bind(fd, (struct sockaddr*)&local, sizeof(local)) != 0) {
+             perror(path);
+             if (fd >= 0) {
+                 close(fd);
+             }
+             return -1;
+         }
+     } else if (strncmp(address, "tcp:", 4) == 0) {
+         char host[256] = "127.0.0.1";
+         const char* port = address + 4;
+         const char* colon = strrchr(port, ':');
+         if (colon != NULL) {
+             size_t hostLength = (size_t)(colon - port);
+             if (hostLength >= sizeof(host)) {
+                 fprintf(stderr, "Host name too long: %s\n", address);
+                 return -1;
+             }
+             memcpy(host, port, hostLength);
+             host[hostLength] = '\0';
+             port = colon + 1;
+         }
+         
+         struct addrinfo hints = {.ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM, .ai_flags = AI_PASSIVE};
+         struct addrinfo* results;
+         int status = getaddrinfo(host, port, &hints, &results);
+         if (status != 0) {
+             fprintf(stderr, "%s: %s\n", address, gai_strerror(status));
+             return -1;
+         }
+         for (struct addrinfo* candidate = results; candidate != NULL; candidate = candidate->ai_next) {
+             fd = socket(candidate->ai_family, candidate->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC,
+                         candidate->ai_protocol);
+             if (fd < 0) {
+                 continue;
+             }
+             int one = 1;
+             setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+             if (bind(fd, candidate->ai_addr, candidate->ai_addrlen) == 0) {
+                 break;
+             }
+             close(fd);
+             fd = -1;
+         }
+         freeaddrinfo(results);
+         if (fd < 0) {
+             fprintf(stderr, "Cannot bind %s\n", address);
+             return -1;
+         }
+     } else {
+         fprintf(stderr, "Unknown listen address: %s\n", address);
+         return -1;
+     }
+     
+     if (listen(fd, SOMAXCONN) != 0) {
+         perror("listen");
+         close(fd);
+         return -1;
+     }
+     return fd;
+ }
+ 
+ /**
+  * @brief Serves validation requests until SIGINT or SIGTERM
+  *
+  * @param address Listen address accepted by openListener()
+  * @param blocklist Breach filter to consult, or NULL
+  * @param threadCount Number of event loop threads
+  * @param stats true to collect statistics, print them on SIGUSR1 and at shutdown
+  * @param constantTime true to check rules with strongPasswordFailuresConstantTime()
+  * @param utf8 true to check rules with strongPasswordFailuresUtf8()
+  * @return 0 on clean shutdown, 1 on error
+  */
+ int runServer(const char* address, const Blocklist* blocklist, size_t threadCount, bool stats,
+               bool constantTime, bool utf8) {
+     int listenFd = openListener(address);
+     if (listenFd < 0) {
+         return 1;
+     }
+     
+     struct sigaction stop = {.sa_handler = handleStopSignal};
+     sigemptyset(&stop.sa_mask);
+     sigaction(SIGINT, &stop, NULL);
+     sigaction(SIGTERM, &stop, NULL);
+     signal(SIGPIPE, SIG_IGN);
+     if (stats) {
+         struct sigaction report = {.sa_handler = handleStatsSignal};
+         sigemptyset(&report.sa_mask);
+         sigaction(SIGUSR1, &report, NULL);
+         setPasswordStatsEnabled(true);
+     }
+     
+     ServerWorker* workers = calloc(threadCount, sizeof(ServerWorker));
+     pthread_t* threads = calloc(threadCount, sizeof(pthread_t));
+     if (workers == NULL || threads == NULL) {
+         fprintf(stderr, "Out of memory\n");
+         free(workers);
+         free(threads);
+         close(listenFd);
+         return 1;
+     }
+     
+     size_t started = 0;
+     for (; started < threadCount; started++) {
+         ServerWorker* worker = &workers[started];
+         struct epoll_event event = {.events = EPOLLIN | EPOLLEXCLUSIVE, .data.ptr = NULL};
+         
+         worker->reportsStats = stats && started == 0;
+         worker->constantTime = constantTime;
+         worker->utf8 = utf8;
+         worker->listenFd = listenFd;
+         worker->spareFd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+         worker->blocklist = blocklist;
+         worker->epollFd = epoll_create1(EPOLL_CLOEXEC);
+         if (worker->epollFd < 0 || epoll_ctl(worker->epollFd, EPOLL_CTL_ADD, listenFd, &event) != 0 ||
+             pthread_create(&threads[started], NULL, serverWorker, worker) != 0) {
+             perror("Cannot start worker");
+             if (worker->epollFd >= 0) {
+                 close(worker->epollFd);
+             }
+             if (worker->spareFd >= 0) {
+                 close(worker->spareFd);
+             }
+             serverStopping = 1;
+             break;
+         }
+     }
+     
+     if (!serverStopping) {
+         fprintf(stderr, "Listening on %s with %zu threads\n", address, threadCount);
+     }
+     for (size_t i = 0; i < started; i++) {
+         pthread_join(threads[i], NULL);
+         close(workers[i].epollFd);
+         if (workers[i].spareFd >= 0) {
+             close(workers[i].spareFd);
+         }
+     }
+     
+     if (strncmp(address, "unix:", 5) == 0) {
+         unlink(address + 5);
+     }
+     if (stats) {
+         dumpServerStats();
+     }
+     bool failed = started < threadCount;
+     free(workers);
+     free(threads);
+     close(listenFd);
+     return failed ? 1 : 0;
+ }
+ 
+ /**
+  * @brief Prints command-line usage to stderr
+  */
+ void printUsage(const char* program) {
+     fprintf(stderr, "Usage: %s --listen unix:PATH|tcp:[HOST:]PORT [--threads N] [--stats]\n", program);
+     fprintf(stderr, "           [--constant-time | --utf8] [--blocklist CORPUS | --blocklist-index INDEX]\n");
+     fprintf(stderr, "       --stats prints statistics to stderr on SIGUSR1 and at shutdown\n");
+     fprintf(stderr, "       --constant-time checks the rules in time independent of the password\n");
+     fprintf(stderr, "       --utf8 checks the rules on NFKC-normalized UTF-8 characters\n");
+ }
+ 
+ /**
+  * @brief Main program function
+  *
+  * @return 0 on clean shutdown, 1 on error
+  */
+ int main(int argc, char* argv[]) {
+     const char* address = NULL;
+     const char* blocklistPath = NULL;
+     const char* indexPath = NULL;
+     long threadCount = sysconf(_SC_NPROCESSORS_ONLN);
+     bool stats = false;
+     bool constantTime = false;
+     bool utf8 = false;
+     
+     for (int i = 1; i < argc; i++) {
+         if (strcmp(argv[i], "--listen") == 0 && i + 1 < argc) {
+             address = argv[++i];
+         } else if (strcmp(argv[i], "--blocklist") == 0 && i + 1 < argc) {
+             blocklistPath = argv[++i];
+         } else if (strcmp(argv[i], "--blocklist-index") == 0 && i + 1 < argc) {
+             indexPath = argv[++i];
+         } else if (strcmp(argv[i], "--stats") == 0) {
+             stats = true;
+         } else if (strcmp(argv[i], "--constant-time") == 0) {
+             constantTime = true;
+         } else if (strcmp(argv[i], "--utf8") == 0) {
+             utf8 = true;
+         } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+             threadCount = strtol(argv[++i], NULL, 10);
+         } else {
+             printUsage(argv[0]);
+             return 1;
+         }
+     }
+     
+     if (address == NULL || threadCount < 1 || (blocklistPath != NULL && indexPath != NULL) ||
+         (constantTime && utf8)) {
+         printUsage(argv[0]);
+         return 1;
+     }
+     
+     Blocklist blocklist;
+     bool useBlocklist = blocklistPath != NULL || indexPath != NULL;
+     if (blocklistPath != NULL && !loadBlocklistFromText(&blocklist, blocklistPath)) {
+         fprintf(stderr, "Cannot load blocklist: %s\n", blocklistPath);
+         return 1;
+     }
+     if (indexPath != NULL && !openBlocklistIndex(&blocklist, indexPath, false)) {
+         fprintf(stderr, "Cannot open blocklist index: %s\n", indexPath);
+         return 1;
+     }
+     
+     int status = runServer(address, useBlocklist ? &blocklist : NULL, (size_t)threadCount, stats,
+                            constantTime, utf8);
+     if (useBlocklist) {
+         freeBlocklist(&blocklist);
+     }
+     return status;
+ }
@@ -0,0 +1,841 @@
+/**
+ * @file password_strength_test.c
+ * @brief Tests of libpasswordstrength run by `make check`
+ *
+ * Each test prints one "ok" or "FAILED" line with what it measured; the
+ * program exits with status 1 if any test failed. Random inputs come from
+ * fixed seeds, so every run checks the same values.
+ */
+
+ #include "password_strength.h"
+ 
+ #include <fcntl.h>
+ #include <math.h>
+ #include <poll.h>
+ #include <signal.h>
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <unistd.h>
+ #include <sys/socket.h>
+ #include <sys/stat.h>
+ #include <sys/un.h>
+ #include <sys/wait.h>
+ 
+ /* Passwords drawn by the generator distribution test */
+ #define TEST_GENERATED_PASSWORDS 400000
+ 
+ /* Standard normal quantile of the chi-square tests' significance level, 1e-4 */
+ #define TEST_CHI_SQUARE_Z 3.719
+ 
+ /* Bytes of a history file before its records, and each record's counters after its 8-byte user tag */
+ #define TEST_HISTORY_HEADER_SIZE 64
+ #define TEST_HISTORY_COUNTERS_OFFSET 8
+ 
+ /* Daemon started by the server test, relative to the directory `make check` runs in */
+ #define TEST_SERVER_PROGRAM "./password_strengthd"
+ 
+ /* Attempts, 10 ms apart, to connect to the daemon while it starts */
+ #define TEST_SERVER_CONNECT_ATTEMPTS 200
+ 
+ /* Longest password the scoring test pads a pattern to */
+ #define TEST_SCORE_MAX_PADDED 1024
+ 
+ /* Checks of each kind the allocation test runs to warm up, then again while counting */
+ #define TEST_STEADY_ROUNDS 64
+ 
+ /* Requests per queue round of the allocation test, at most the queue's capacity */
+ #define TEST_QUEUE_REQUESTS 32
+ 
+ static int failedTests = 0;
+ 
+ /*
+  * The test binary is linked with --wrap for the heap functions, so every
+  * call from the library or the tests lands here and is counted from all
+  * threads.
+  */
+ static uint64_t heapAllocations = 0;
+ 
+ void* __real_malloc(size_t size);
+ void* __real_calloc(size_t count, size_t size);
+ void* __real_realloc(void* pointer, size_t size);
+ 
+ void* __wrap_malloc(size_t size) {
+     __atomic_fetch_add(&heapAllocations, 1, __ATOMIC_RELAXED);
+     return __real_malloc(size);
+ }
+ 
+ void* __wrap_calloc(size_t count, size_t size) {
+     __atomic_fetch_add(&heapAllocations, 1, __ATOMIC_RELAXED);
+     return __real_calloc(count, size);
+ }
+ 
+ void* __wrap_realloc(void* pointer, size_t size) {
+     __atomic_fetch_add(&heapAllocations, 1, __ATOMIC_RELAXED);
+     return __real_realloc(pointer, size);
+ }
+ 
+ /**
+  * @brief Prints the outcome of one test and counts failures
+  */
+ static void report(const char* name, bool passed, const char* detail) {
+     printf("%-40s %s (%s)\n", name, passed ? "ok" : "FAILED", detail);
+     if (!passed) {
+         failedTests++;
+     }
+ }
+ 
+ /**
+  * @brief Pearson's chi-square goodness-of-fit test
+  *
+  * The critical value comes from the Wilson-Hilferty approximation, which
+  * is accurate to a fraction of a percent at these degrees of freedom. A
+  * cell the exact distribution rules out must stay empty.
+  *
+  * @param observed Count of each cell
+  * @param probability Exact probability of each cell, summing to 1
+  * @param cells Number of cells
+  * @param detail Receives the statistic and the critical value
+  * @param detailSize Size of detail in bytes
+  * @return true if the counts fit the distribution
+  */
+ static bool chiSquareFits(const uint64_t* observed, const double* probability, size_t cells,
+                           char* detail, size_t detailSize) {
+     uint64_t total = 0;
+     for (size_t i = 0; i < cells; i++) {
+         total += observed[i];
+     }
+     
+     double statistic = 0.0;
+     int freedom = -1;
+     for (size_t i = 0; i < cells; i++) {
+         if (probability[i] == 0.0) {
+             if (observed[i] != 0) {
+                 snprintf(detail, detailSize, "cell %zu has probability 0 but %llu hits", i,
+                          (unsigned long long)observed[i]);
+                 return false;
+             }
+             continue;
+         }
+         double expected = probability[i] * (double)total;
+         statistic += ((double)observed[i] - expected) * ((double)observed[i] - expected) / expected;
+         freedom++;
+     }
+     
+     double h = 2.0 / (9.0 * freedom);
+     double critical = freedom * pow(1.0 - h + TEST_CHI_SQUARE_Z * sqrt(h), 3);
+     snprintf(detail, detailSize, "chi2 %.1f, df %d, limit %.1f", statistic, freedom, critical);
+     return statistic <= critical;
+ }
+ 
+ /*
+  * Default password distribution
+  *
+  * The original generator drew a length from 1 to DEFAULT_MAX_LENGTH and
+  * that many random alphanumeric characters until the result passed the
+  * default rules, so a password of length L appears with probability
+  * proportional to valid(L) / 62^L and is uniform among the valid(L)
+  * strings of that length. valid(L) follows by inclusion-exclusion over
+  * the three required classes. The constructive generator must sample the
+  * same distribution; the tests compare its lengths, the class at every
+  * position and the frequency of every character with the exact values.
+  */
+ 
+ /* Class order of the tests: uppercase, lowercase, digit */
+ static const double classSize[3] = {26.0, 26.0, 10.0};
+ 
+ /* Alphanumeric strings of a length with at least one uppercase letter, lowercase letter and digit */
+ static double validStrings(int length) {
+     return pow(62, length) - 2.0 * pow(36, length) - pow(52, length) + 2.0 * pow(26, length) + pow(10, length);
+ }
+ 
+ /**
+  * @brief Probability that a given position of a valid string of a length holds a class
+  *
+  * Fixing one position leaves length - 1 characters that must supply the
+  * other two classes.
+  */
+ static double classAtPosition(int length, int c) {
+     double rest;
+     if (c == 2) {
+         rest = pow(62, length - 1) - 2.0 * pow(36, length - 1) + pow(10, length - 1);
+     } else {
+         rest = pow(62, length - 1) - pow(36, length - 1) - pow(52, length - 1) + pow(26, length - 1);
+     }
+     return classSize[c] * rest / validStrings(length);
+ }
+ 
+ static int characterClass(char c) {
+     return c >= 'A' && c <= 'Z' ? 0 : c >= 'a' && c <= 'z' ? 1 : 2;
+ }
+ 
+ /* Index of an alphanumeric character in A-Z, a-z, 0-9 order */
+ static int characterIndex(char c) {
+     switch (characterClass(c)) {
+         case 0:  return c - 'A';
+         case 1:  return 26 + (c - 'a');
+         default: return 52 + (c - '0');
+     }
+ }
+ 
+ static void testGeneratedPasswordDistribution(void) {
+     static uint64_t lengthCounts[DEFAULT_MAX_LENGTH + 1];
+     static uint64_t positionCounts[DEFAULT_MAX_LENGTH][3];
+     static uint64_t characterCounts[62];
+     uint64_t invalid = 0;
+     uint64_t nonAlphanumeric = 0;
+     
+     PasswordGenerator* generator = createPasswordGenerator();
+     if (generator == NULL) {
+         report("generator output is valid", false, "no generator");
+         return;
+     }
+     seedPasswordGenerator(generator, 0x5eed);
+     for (int i = 0; i < TEST_GENERATED_PASSWORDS; i++) {
+         char password[DEFAULT_PASSWORD_STRIDE];
+         generateDefaultPasswordFrom(generator, password);
+         size_t length = strlen(password);
+         if (length > DEFAULT_MAX_LENGTH || !isStrongDefaultPassword("", password)) {
+             invalid++;
+             continue;
+         }
+         lengthCounts[length]++;
+         for (size_t p = 0; p < length; p++) {
+             char c = password[p];
+             if (!((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9'))) {
+                 nonAlphanumeric++;
+                 continue;
+             }
+             positionCounts[p][characterClass(c)]++;
+             characterCounts[characterIndex(c)]++;
+         }
+     }
+     freePasswordGenerator(generator);
+     
+     char detail[128];
+     snprintf(detail, sizeof(detail), "%llu invalid of %d", (unsigned long long)invalid, TEST_GENERATED_PASSWORDS);
+     report("generator output is valid", invalid == 0 && nonAlphanumeric == 0, detail);
+     
+     // Exact length distribution
+     double lengthProbability[DEFAULT_MAX_LENGTH + 1] = {0.0};
+     double lengthTotal = 0.0;
+     for (int length = 1; length <= DEFAULT_MAX_LENGTH; length++) {
+         lengthProbability[length] = validStrings(length) / pow(62, length);
+         lengthTotal += lengthProbability[length];
+     }
+     for (int length = 1; length <= DEFAULT_MAX_LENGTH; length++) {
+         lengthProbability[length] /= lengthTotal;
+     }
+     report("generator length distribution",
+            chiSquareFits(lengthCounts, lengthProbability, DEFAULT_MAX_LENGTH + 1, detail, sizeof(detail)), detail);
+     
+     // Class at each position, over the passwords long enough to have it
+     bool positionsFit = true;
+     char worst[160] = "";
+     for (int p = 0; p < DEFAULT_MAX_LENGTH; p++) {
+         double classProbability[3] = {0.0};
+         double reach = 0.0;
+         for (int length = p + 1; length <= DEFAULT_MAX_LENGTH; length++) {
+             if (lengthProbability[length] == 0.0) {
+                 continue;  // No valid password has this length
+             }
+             reach += lengthProbability[length];
+             for (int c = 0; c < 3; c++) {
+                 classProbability[c] += lengthProbability[length] * classAtPosition(length, c);
+             }
+         }
+         if (reach == 0.0) {
+             continue;
+         }
+         for (int c = 0; c < 3; c++) {
+             classProbability[c] /= reach;
+         }
+         if (!chiSquareFits(positionCounts[p], classProbability, 3, detail, sizeof(detail))) {
+             positionsFit = false;
+             snprintf(worst, sizeof(worst), "position %d: %s", p, detail);
+         }
+     }
+     report("generator class at each position", positionsFit, positionsFit ? "15 positions" : worst);
+     
+     // Every character, pooled over all positions
+     double characterProbability[62];
+     double classShare[3] = {0.0};
+     double characters = 0.0;
+     for (int length = 1; length <= DEFAULT_MAX_LENGTH; length++) {
+         if (lengthProbability[length] == 0.0) {
+             continue;
+         }
+         characters += lengthProbability[length] * length;
+         for (int c = 0; c < 3; c++) {
+             classShare[c] += lengthProbability[length] * length * classAtPosition(length, c);
+         }
+     }
+     for (int i = 0; i < 62; i++) {
+         int c = i < 26 ? 0 : i < 52 ? 1 : 2;
+         characterProbability[i] = classShare[c] / characters / classSize[c];
+     }
+     report("generator character frequencies",
+            chiSquareFits(characterCounts, characterProbability, 62, detail, sizeof(detail)), detail);
+ }
+ 
+ /*
+  * Failure messages of a configured policy quote its own limits, not the
+  * built-in ones.
+  */
+ static void testPolicyRuleMessages(void) {
+     PasswordPolicy policy = {12, 20, CLASS_REQUIRED, "!#", false, 5, true};
+     CompiledPolicy* compiled = compilePasswordPolicy(&policy);
+     if (compiled == NULL) {
+         report("policy failure messages", false, "policy did not compile");
+         return;
+     }
+     
+     static const struct {
+         unsigned int rule;
+         const char* message;
+     } expected[] = {
+         {RULE_TOO_SHORT, "must be at least 12 characters long"},
+         {RULE_TOO_LONG, "must be 20 characters or fewer"},
+         {RULE_NO_LETTER_RUN, "must contain at least 5 letters in a row"},
+         {RULE_SPECIAL_CHARACTER, "must contain only letters, digits and the symbols !#"},
+         {RULE_CONTAINS_USERNAME, "must not contain the username"},
+     };
+     char detail[RULE_MESSAGE_SIZE + 32] = "5 rules";
+     bool passed = true;
+     for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+         char message[RULE_MESSAGE_SIZE];
+         policyRuleFailureMessage(compiled, expected[i].rule, message, sizeof(message));
+         if (strcmp(message, expected[i].message) != 0) {
+             snprintf(detail, sizeof(detail), "got \"%s\"", message);
+             passed = false;
+         }
+     }
+     freeCompiledPolicy(compiled);
+     report("policy failure messages", passed, detail);
+ }
+ 
+ /*
+  * With statistics on, the bool validator records the same complete
+  * failure mask as strongPasswordFailures(), although it stops early
+  * when they are off.
+  */
+ static void testStatsMasksAgree(void) {
+     static const char* const passwords[] = {"bob", "xbobx12", "Bobby2024", "abc", "Strong2024x"};
+     PasswordStats before;
+     PasswordStats after;
+     uint64_t viaBool[STATS_RULE_COUNT];
+     bool passed = true;
+     
+     setPasswordStatsEnabled(true);
+     for (size_t i = 0; i < sizeof(passwords) / sizeof(passwords[0]); i++) {
+         passwordStatsSnapshot(&before);
+         isStrongPassword("bob", passwords[i]);
+         passwordStatsSnapshot(&after);
+         for (size_t r = 0; r < STATS_RULE_COUNT; r++) {
+             viaBool[r] = after.ruleFailures[r] - before.ruleFailures[r];
+         }
+         
+         passwordStatsSnapshot(&before);
+         strongPasswordFailures("bob", passwords[i]);
+         passwordStatsSnapshot(&after);
+         for (size_t r = 0; r < STATS_RULE_COUNT; r++) {
+             passed = passed && viaBool[r] == after.ruleFailures[r] - before.ruleFailures[r];
+         }
+     }
+     setPasswordStatsEnabled(false);
+     report("stats record complete masks", passed, passed ? "bool and mask paths agree" : "paths disagree");
+ }
+ 
+ /*
+  * True when the counters grew by exactly one check that failed the rules
+  * in mask.
+  */
+ static bool statsRecordedMask(const PasswordStats* before, const PasswordStats* after, unsigned int mask) {
+     bool recorded = after->checks - before->checks == 1 &&
+                     after->rejected - before->rejected == (mask != 0 ? 1u : 0u);
+     for (size_t r = 0; r < STATS_RULE_COUNT; r++) {
+         recorded = recorded && after->ruleFailures[r] - before->ruleFailures[r] == ((mask >> r) & 1u);
+     }
+     return recorded;
+ }
+ 
+ /*
+  * The matcher, batch and policy validators count each password once with
+  * its complete mask, like the plain validators.
+  */
+ static void testStatsEveryValidator(void) {
+     static const char* const passwords[] = {"bob", "xbobx12", "Bobby2024", "abc", "Strong2024x"};
+     PasswordPolicy strong = STRONG_PASSWORD_POLICY;
+     CompiledPolicy* policy = compilePasswordPolicy(&strong);
+     UsernameMatcher matcher;
+     if (policy == NULL || !initUsernameMatcher(&matcher, "bob")) {
+         freeCompiledPolicy(policy);
+         report("stats count every validator", false, "setup failed");
+         return;
+     }
+     
+     const char* usernames[] = {"bob"};
+     const char* failed = NULL;
+     PasswordStats before;
+     PasswordStats after;
+     setPasswordStatsEnabled(true);
+     for (size_t i = 0; i < sizeof(passwords) / sizeof(passwords[0]) && failed == NULL; i++) {
+         const char* password = passwords[i];
+         size_t offset = 0;
+         size_t length = strlen(password);
+         unsigned int mask = strongPasswordFailures("bob", password);
+         unsigned char strongBit;
+         uint16_t batchMask;
+         
+         passwordStatsSnapshot(&before);
+         isStrongPasswordWithMatcher(&matcher, password);
+         passwordStatsSnapshot(&after);
+         if (!statsRecordedMask(&before, &after, mask)) {
+             failed = "isStrongPasswordWithMatcher";
+         }
+         
+         passwordStatsSnapshot(&before);
+         validatePasswordBatch(password, &offset, &length, usernames, 1, &strongBit);
+         passwordStatsSnapshot(&after);
+         if (failed == NULL && !statsRecordedMask(&before, &after, mask)) {
+             failed = "validatePasswordBatch";
+         }
+         
+         passwordStatsSnapshot(&before);
+         validatePasswordBatchFailures(password, &offset, &length, usernames, 1, &batchMask);
+         passwordStatsSnapshot(&after);
+         if (failed == NULL && !statsRecordedMask(&before, &after, mask)) {
+             failed = "validatePasswordBatchFailures";
+         }
+         
+         passwordStatsSnapshot(&before);
+         passwordPolicyFailures(policy, "bob", password);
+         passwordStatsSnapshot(&after);
+         if (failed == NULL && !statsRecordedMask(&before, &after, mask)) {
+             failed = "passwordPolicyFailures";
+         }
+     }
+     setPasswordStatsEnabled(false);
+     freeUsernameMatcher(&matcher);
+     freeCompiledPolicy(policy);
+     report("stats count every validator", failed == NULL, failed == NULL ? "4 paths" : failed);
+ }
+ 
+ /*
+  * The UTF-8 subject checks compare NFKC forms: a fullwidth copy of a
+  * denylist word or of a remembered password must be caught, and ASCII
+  * input must get exactly the byte validator's mask.
+  */
+ static void testSubjectUtf8(void) {
+     static const unsigned char key[PASSWORD_HISTORY_KEY_SIZE] = "subject test key";
+     static const char* const denied[] = {"Lighthouse"};
+     static const char fullwidthDenied[] = "\xef\xbc\xac\xef\xbd\x89ghthouse2024";  // Ｌｉghthouse2024
+     static const char fullwidthReused[] = "\xef\xbc\xb7inter2024";  // Ｗinter2024
+     static const char invalid[] = "Winter2024\xff";
+     SubjectContext context;
+     PasswordHistory history;
+     bool passed = createPasswordHistory(&history, NULL, 1, key);
+     
+     if (passed && !initSubjectContext(&context, "dave", NULL, denied, 1)) {
+         closePasswordHistory(&history);
+         passed = false;
+     }
+     if (passed) {
+         addPasswordToHistory(&history, "dave", "Winter2024");
+         attachPasswordHistory(&context, &history, "dave");
+         passed = (subjectPasswordFailuresUtf8(&context, fullwidthDenied, strlen(fullwidthDenied)) & RULE_DENYLISTED) &&
+                  (subjectPasswordFailuresUtf8(&context, fullwidthReused, strlen(fullwidthReused)) & RULE_REUSED) &&
+                  subjectPasswordFailuresUtf8(&context, invalid, strlen(invalid)) == RULE_INVALID_UTF8 &&
+                  subjectPasswordFailuresUtf8(&context, "Winter2024", 10) == subjectPasswordFailures(&context, "Winter2024") &&
+                  subjectPasswordFailuresUtf8(&context, "Spring2025", 10) == 0;
+         freeSubjectContext(&context);
+         closePasswordHistory(&history);
+     }
+     report("utf8 subject checks use NFKC forms", passed, passed ? "denylist, history and ASCII agree" : "mismatch");
+ }
+ 
+ /*
+  * A full cache evicts the account used least recently, where a lookup
+  * counts as a use; caching an account again replaces its context without
+  * evicting another, and a forgotten account frees its slot.
+  */
+ static void testSubjectCacheEviction(void) {
+     static const char* const denied[] = {"Lighthouse"};
+     SubjectCache* cache = createSubjectCache(3);
+     const char* failed = NULL;
+     
+     if (cache == NULL) {
+         report("subject cache evicts least recent", false, "no cache");
+         return;
+     }
+     cacheSubjectContext(cache, "amy", NULL, NULL, 0);
+     cacheSubjectContext(cache, "ben", NULL, NULL, 0);
+     cacheSubjectContext(cache, "cal", NULL, NULL, 0);
+     lookupSubjectContext(cache, "amy");               // Oldest first: ben cal amy
+     cacheSubjectContext(cache, "dee", NULL, NULL, 0);  // Evicts ben: cal amy dee
+     if (lookupSubjectContext(cache, "ben") != NULL || lookupSubjectContext(cache, "cal") == NULL) {
+         failed = "evicted the wrong account";          // Now amy dee cal
+     }
+     
+     const SubjectContext* replaced = cacheSubjectContext(cache, "amy", NULL, denied, 1);  // dee cal amy
+     if (failed == NULL && (replaced == NULL || lookupSubjectContext(cache, "dee") == NULL ||
+                            (subjectPasswordFailures(replaced, "Lighthouse99X") & RULE_DENYLISTED) == 0)) {
+         failed = "replacement lost an account or kept the old context";  // Now cal amy dee
+     }
+     
+     forgetSubjectContext(cache, "amy");                // cal dee
+     cacheSubjectContext(cache, "eve", NULL, NULL, 0);  // cal dee eve, nothing evicted
+     if (failed == NULL && (lookupSubjectContext(cache, "amy") != NULL || lookupSubjectContext(cache, "cal") == NULL ||
+                            lookupSubjectContext(cache, "dee") == NULL || lookupSubjectContext(cache, "eve") == NULL)) {
+         failed = "forgetting did not free the slot";
+     }
+     freeSubjectCache(cache);
+     report("subject cache evicts least recent", failed == NULL, failed == NULL ? "eviction, replacement and forget" : failed);
+ }
+ 
+ /*
+  * Another process may leave any values in a history file's records. With
+  * the stored count and next-slot index of every record overwritten, adding
+  * a password must stay inside the record and still be remembered.
+  */
+ static void testHistoryCorruptCounters(void) {
+     static const unsigned char key[PASSWORD_HISTORY_KEY_SIZE] = "history test key";
+     char path[] = "/tmp/password_strength_test.XXXXXX";
+     PasswordHistory history;
+     struct stat info;
+     
+     int fd = mkstemp(path);
+     bool passed = fd >= 0 && createPasswordHistory(&history, path, 1, key);
+     if (passed) {
+         addPasswordToHistory(&history, "carol", "Carol2019x");
+         closePasswordHistory(&history);
+         passed = fstat(fd, &info) == 0 && info.st_size > TEST_HISTORY_HEADER_SIZE;
+     }
+     if (passed) {
+         static const uint32_t garbage[2] = {UINT32_MAX, UINT32_MAX - 1};
+         size_t records = (size_t)info.st_size - TEST_HISTORY_HEADER_SIZE;
+         size_t stride = records / 16;  // One user fits the smallest table
+         for (size_t offset = 0; passed && offset < records; offset += stride) {
+             off_t at = (off_t)(TEST_HISTORY_HEADER_SIZE + offset + TEST_HISTORY_COUNTERS_OFFSET);
+             passed = pwrite(fd, garbage, sizeof(garbage), at) == (ssize_t)sizeof(garbage);
+         }
+     }
+     passed = passed && openPasswordHistory(&history, path, key);
+     if (passed) {
+         passed = addPasswordToHistory(&history, "carol", "Carol2020x") &&
+                  passwordInHistory(&history, "carol", "Carol2020x");
+         closePasswordHistory(&history);
+     }
+     if (fd >= 0) {
+         close(fd);
+         unlink(path);
+     }
+     report("history bounds stored counters", passed, passed ? "added inside the record" : "lost the password");
+ }
+ 
+ /*
+  * Scoring only analyzes a bounded prefix. Repeating a character or a
+  * common word past it must not make the password look stronger, while a
+  * random password of ordinary length still gets the top score.
+  */
+ static void testScorePaddedPatterns(void) {
+     static const char* const units[] = {"a", "xy", "password", "qwerty"};
+     static const size_t lengths[] = {64, 65, 72, 100, 256, TEST_SCORE_MAX_PADDED};
+     static char padded[TEST_SCORE_MAX_PADDED];
+     char detail[96] = "";
+     PasswordScore score;
+     bool passed = true;
+     
+     for (size_t u = 0; u < sizeof(units) / sizeof(units[0]); u++) {
+         size_t unitLength = strlen(units[u]);
+         for (size_t i = 0; i < TEST_SCORE_MAX_PADDED; i++) {
+             padded[i] = units[u][i % unitLength];
+         }
+         for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+             scorePasswordBytes("", 0, padded, lengths[l], &score);
+             if (score.score >= 4 && passed) {
+                 snprintf(detail, sizeof(detail), "%zu bytes of \"%s\" scored %d", lengths[l], units[u], score.score);
+                 passed = false;
+             }
+         }
+     }
+     scorePassword("", "xK7#pQ2!vL9mR4zW", &score);
+     if (passed && score.score != 4) {
+         snprintf(detail, sizeof(detail), "random password scored %d", score.score);
+         passed = false;
+     }
+     report("score ignores padding past the limit", passed, passed ? "padded patterns stay below 4" : detail);
+ }
+ 
+ /**
+  * @brief Appends one username and password record of the daemon's protocol
+  *
+  * @return Offset after the record
+  */
+ static size_t appendServerRecord(unsigned char* frame, size_t offset, const char* username, const char* password) {
+     size_t usernameLength = strlen(username);
+     size_t passwordLength = strlen(password);
+     frame[offset] = (unsigned char)usernameLength;
+     frame[offset + 1] = 0;
+     frame[offset + 2] = (unsigned char)passwordLength;
+     frame[offset + 3] = 0;
+     memcpy(frame + offset + 4, username, usernameLength);
+     memcpy(frame + offset + 4 + usernameLength, password, passwordLength);
+     return offset + 4 + usernameLength + passwordLength;
+ }
+ 
+ /*
+  * A client may pipeline its requests and shut down its sending side; the
+  * daemon must still answer every request before closing the connection.
+  * The daemon is stopped while the request and the shutdown are queued,
+  * so it reads both in one go.
+  */
+ static void testServerAnswersAfterHalfClose(void) {
+     char path[] = "/tmp/password_strength_test.sock.XXXXXX";
+     char listen[sizeof(path) + 8];
+     unsigned char frame[64];
+     unsigned char response[64];
+     size_t received = 0;
+     
+     int reserved = mkstemp(path);  // Claims a unique name for the socket
+     if (reserved >= 0) {
+         close(reserved);
+         unlink(path);
+     }
+     snprintf(listen, sizeof(listen), "unix:%s", path);
+     pid_t pid = reserved >= 0 ? fork() : -1;
+     if (pid == 0) {
+         int quiet = open("/dev/null", O_WRONLY);
+         dup2(quiet, STDOUT_FILENO);  // Keep its banner out of the report
+         dup2(quiet, STDERR_FILENO);
+         execl(TEST_SERVER_PROGRAM, TEST_SERVER_PROGRAM, "--listen", listen, "--threads", "1", (char*)NULL);
+         _exit(127);
+     }
+     
+     struct sockaddr_un address = {.sun_family = AF_UNIX};
+     memcpy(address.sun_path, path, sizeof(path));
+     int fd = -1;
+     for (int attempt = 0; pid > 0 && fd < 0 && attempt < TEST_SERVER_CONNECT_ATTEMPTS; attempt++) {
+         fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+         if (fd >= 0 && connect(fd, (struct sockaddr*)&address, sizeof(address)) != 0) {
+             close(fd);
+             fd = -1;
+             usleep(10000);
+         }
+     }
+     
+     size_t length = appendServerRecord(frame, 8, "bob", "weak");
+     length = appendServerRecord(frame, length, "alice", "Strong2024x");
+     frame[0] = (unsigned char)(length - 4);
+     frame[1] = frame[2] = frame[3] = 0;
+     frame[4] = 2;
+     frame[5] = frame[6] = frame[7] = 0;
+     bool sent = fd >= 0 && kill(pid, SIGSTOP) == 0;
+     sent = sent && write(fd, frame, length) == (ssize_t)length && shutdown(fd, SHUT_WR) == 0;
+     if (pid > 0) {
+         kill(pid, SIGCONT);
+     }
+     for (ssize_t got = 1; sent && got > 0 && received < sizeof(response); received += (size_t)got) {
+         got = read(fd, response + received, sizeof(response) - received);
+         if (got < 0) {
+             break;
+         }
+     }
+     if (fd >= 0) {
+         close(fd);
+     }
+     if (pid > 0) {
+         kill(pid, SIGTERM);
+         waitpid(pid, NULL, 0);
+     }
+     unlink(path);
+     
+     unsigned int weak = strongPasswordFailures("bob", "weak");
+     const unsigned char expected[12] = {8, 0, 0, 0, 2, 0, 0, 0, (unsigned char)weak, (unsigned char)(weak >> 8), 0, 0};
+     bool passed = received == sizeof(expected) && memcmp(response, expected, sizeof(expected)) == 0;
+     char detail[64] = "daemon did not start";
+     if (fd >= 0) {
+         snprintf(detail, sizeof(detail), "%zu of %zu response bytes", received, sizeof(expected));
+     }
+     report("server answers after half-close", passed, detail);
+ }
+ 
+ /**
+  * @brief Submits TEST_QUEUE_REQUESTS requests and waits until all complete
+  *
+  * @return true if every request was accepted and completed
+  */
+ static bool runQueueRound(ValidationQueue* queue, const ValidationRequest* requests) {
+     ValidationCompletion completions[TEST_QUEUE_REQUESTS];
+     struct pollfd ready = {validationQueueEventFd(queue), POLLIN, 0};
+     size_t completed = 0;
+     
+     if (submitValidations(queue, requests, TEST_QUEUE_REQUESTS) != TEST_QUEUE_REQUESTS) {
+         return false;
+     }
+     while (completed < TEST_QUEUE_REQUESTS) {
+         if (poll(&ready, 1, 1000) <= 0) {
+             return false;
+         }
+         completed += pollValidations(queue, completions, TEST_QUEUE_REQUESTS);
+     }
+     return true;
+ }
+ 
+ /**
+  * @brief Runs one round of every steady-state check
+  *
+  * @return false if a queue round did not complete
+  */
+ static bool runSteadyRound(ValidationQueue* queue, const char* username) {
+     static const char* const passwords[] = {"Strong2024x", "weak", "xx-longusername-is-mine-now-9X", "P@ssw0rd1999"};
+     const size_t kinds = sizeof(passwords) / sizeof(passwords[0]);
+     char buffer[128] = "";
+     size_t offsets[sizeof(passwords) / sizeof(passwords[0])];
+     size_t lengths[sizeof(passwords) / sizeof(passwords[0])];
+     const char* usernames[sizeof(passwords) / sizeof(passwords[0])];
+     unsigned char results[sizeof(passwords) / sizeof(passwords[0])];
+     uint16_t failures[sizeof(passwords) / sizeof(passwords[0])];
+     ValidationRequest requests[TEST_QUEUE_REQUESTS];
+     PasswordScore score;
+     size_t used = 0;
+     
+     for (size_t i = 0; i < kinds; i++) {
+         lengths[i] = strlen(passwords[i]);
+         offsets[i] = used;
+         usernames[i] = username;
+         memcpy(buffer + used, passwords[i], lengths[i]);
+         used += lengths[i];
+         
+         containsUsernameBytes(username, strlen(username), passwords[i], lengths[i]);
+         strongPasswordFailuresBytes(username, strlen(username), passwords[i], lengths[i]);
+         isStrongPassword(username, passwords[i]);
+         scorePassword(username, passwords[i], &score);
+     }
+     validatePasswordBatch(buffer, offsets, lengths, usernames, kinds, results);
+     validatePasswordBatchFailures(buffer, offsets, lengths, usernames, kinds, failures);
+     
+     for (size_t i = 0; i < TEST_QUEUE_REQUESTS; i++) {
+         requests[i] = (ValidationRequest){i, username, strlen(username), passwords[i % kinds], lengths[i % kinds]};
+     }
+     return runQueueRound(queue, requests);
+ }
+ 
+ /*
+  * Once the thread arenas, the queue slots and the usernames' matchers have
+  * been sized by a warm-up, checking more passwords must not touch the heap.
+  * The username is longer than the matcher's inline buffer and the queue
+  * scores every request. Creating the queue has to be counted, or the
+  * heap functions were not wrapped.
+  */
+ static void testSteadyStateAllocations(void) {
+     static const char username[] = "a-username-long-enough-to-overflow-every-inline-buffer-of-the-library";
+     ValidationQueueOptions options = {TEST_QUEUE_REQUESTS, 1, NULL, true};
+     uint64_t created = __atomic_load_n(&heapAllocations, __ATOMIC_RELAXED);
+     ValidationQueue* queue = createValidationQueue(&options);
+     bool counting = __atomic_load_n(&heapAllocations, __ATOMIC_RELAXED) != created;
+     char detail[64];
+     bool completed = queue != NULL;
+     
+     for (int round = 0; completed && round < TEST_STEADY_ROUNDS; round++) {
+         completed = runSteadyRound(queue, username);
+     }
+     uint64_t before = __atomic_load_n(&heapAllocations, __ATOMIC_RELAXED);
+     for (int round = 0; completed && round < TEST_STEADY_ROUNDS; round++) {
+         completed = runSteadyRound(queue, username);
+     }
+     uint64_t allocations = __atomic_load_n(&heapAllocations, __ATOMIC_RELAXED) - before;
+     destroyValidationQueue(queue);
+     
+     snprintf(detail, sizeof(detail), "%llu allocations after warm-up", (unsigned long long)allocations);
+     if (!counting) {
+         snprintf(detail, sizeof(detail), "heap calls are not counted");
+     } else if (!completed) {
+         snprintf(detail, sizeof(detail), "queue stalled");
+     }
+     report("steady state allocates nothing", counting && completed && allocations == 0, detail);
+ }
+ 
+ /**
+  * @brief Generates one password with the thread's generator and one with an explicit one
+  *
+  * Both strings are written to out, separated by a space.
+  */
+ static void generateAfterFork(PasswordGenerator* generator, char* out) {
+     generateDefaultPassword(out, "");
+     size_t length = strlen(out);
+     out[length] = ' ';
+     generateDefaultPasswordFrom(generator, out + length + 1);
+ }
+ 
+ /*
+  * A forked child inherits both generators with keystream left in their
+  * buffers; the passwords it draws next must differ from the parent's.
+  */
+ static void testGeneratorsAfterFork(void) {
+     PasswordGenerator* generator = createPasswordGenerator();
+     char parent[2 * DEFAULT_PASSWORD_STRIDE] = "";
+     char child[2 * DEFAULT_PASSWORD_STRIDE] = "";
+     int pipeFds[2];
+     
+     if (generator == NULL || pipe(pipeFds) != 0) {
+         freePasswordGenerator(generator);
+         report("generators rekey after fork", false, "no entropy or pipe");
+         return;
+     }
+     generateDefaultPassword(parent, "");
+     generateDefaultPasswordFrom(generator, parent);
+     
+     pid_t pid = fork();
+     if (pid == 0) {
+         close(pipeFds[0]);
+         generateAfterFork(generator, child);
+         ssize_t written = write(pipeFds[1], child, strlen(child));
+         _exit(written == (ssize_t)strlen(child) ? 0 : 1);
+     }
+     close(pipeFds[1]);
+     generateAfterFork(generator, parent);
+     ssize_t got = pid > 0 ? read(pipeFds[0], child, sizeof(child) - 1) : -1;
+     close(pipeFds[0]);
+     int status = 1;
+     if (pid > 0) {
+         waitpid(pid, &status, 0);
+     }
+     freePasswordGenerator(generator);
+     
+     char* childExplicit = got > 0 ? strchr(child, ' ') : NULL;
+     char* parentExplicit = strchr(parent, ' ');
+     bool passed = childExplicit != NULL && parentExplicit != NULL && status == 0;
+     if (passed) {
+         *childExplicit++ = '\0';
+         *parentExplicit++ = '\0';
+         passed = strcmp(child, parent) != 0 && strcmp(childExplicit, parentExplicit) != 0;
+     }
+     report("generators rekey after fork", passed, passed ? "child and parent differ" : "child repeated the parent");
+ }
+ 
+ /**
+  * @brief Main program function
+  *
+  * @return 0 if every test passed, 1 otherwise
+  */
+ int main(void) {
+     testGeneratedPasswordDistribution();
+     testGeneratorsAfterFork();
+     testPolicyRuleMessages();
+     testStatsMasksAgree();
+     testStatsEveryValidator();
+     testSubjectUtf8();
+     testSubjectCacheEviction();
+     testHistoryCorruptCounters();
+     testScorePaddedPatterns();
+     testSteadyStateAllocations();
+     testServerAnswersAfterHalfClose();
+     
+     if (failedTests > 0) {
+         printf("%d tests FAILED\n", failedTests);
+         return 1;
+     }
+     printf("all tests passed\n");
+     return 0;
+ }
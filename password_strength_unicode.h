@@ -0,0 +1,3850 @@
+/**
+ * @file password_strength_unicode.h
+ * @brief Unicode tables for the UTF-8 validators
+ * 
+ * Generated by make_unicode_tables.py from the Unicode 14.0.0
+ * character database; do not edit. Included only by password_strength.c.
+ */
+
+ #ifndef PASSWORD_STRENGTH_UNICODE_H
+ #define PASSWORD_STRENGTH_UNICODE_H
+ 
+ #define UNICODE_TABLES_VERSION "14.0.0"
+ 
+ /* Bits of unicodeClassValues; the first three match the CLASS_* bits */
+ #define UNICODE_CLASS_UPPER 0x01   // Lu, Lt
+ #define UNICODE_CLASS_LOWER 0x02   // Ll
+ #define UNICODE_CLASS_DIGIT 0x04   // Nd
+ #define UNICODE_CLASS_LETTER 0x08  // Lu, Lt, Ll, Lm, Lo
+ #define UNICODE_CLASS_MARK 0x10    // Mn, Mc, Me
+ #define UNICODE_CLASS_STABLE 0x20  // NFKC_Quick_Check=Yes with combining class 0
+ 
+ /* Most code points the NFKC decomposition of one input byte can produce */
+ #define UNICODE_MAX_DECOMPOSED_PER_BYTE 6
+ 
+ /* First code point of each run of equal classes */
+ static const uint32_t unicodeClassStarts[3312] = {
+     0x0, 0x30, 0x3A, 0x41, 0x5B, 0x61, 0x7B, 0xA0,
+     0xA1, 0xA8, 0xA9, 0xAA, 0xAB, 0xAF, 0xB0, 0xB2,
+     0xB5, 0xB6, 0xB8, 0xBA, 0xBB, 0xBC, 0xBF, 0xC0,
+     0xD7, 0xD8, 0xDF, 0xF7, 0xF8, 0x100, 0x101, 0x102,
+     0x103, 0x104, 0x105, 0x106, 0x107, 0x108, 0x109, 0x10A,
+     0x10B, 0x10C, 0x10D, 0x10E, 0x10F, 0x110, 0x111, 0x112,
+     0x113, 0x114, 0x115, 0x116, 0x117, 0x118, 0x119, 0x11A,
+     0x11B, 0x11C, 0x11D, 0x11E, 0x11F, 0x120, 0x121, 0x122,
+     0x123, 0x124, 0x125, 0x126, 0x127, 0x128, 0x129, 0x12A,
+     0x12B, 0x12C, 0x12D, 0x12E, 0x12F, 0x130, 0x131, 0x132,
+     0x133, 0x134, 0x135, 0x136, 0x137, 0x139, 0x13A, 0x13B,
+     0x13C, 0x13D, 0x13E, 0x13F, 0x140, 0x141, 0x142, 0x143,
+     0x144, 0x145, 0x146, 0x147, 0x148, 0x149, 0x14A, 0x14B,
+     0x14C, 0x14D, 0x14E, 0x14F, 0x150, 0x151, 0x152, 0x153,
+     0x154, 0x155, 0x156, 0x157, 0x158, 0x159, 0x15A, 0x15B,
+     0x15C, 0x15D, 0x15E, 0x15F, 0x160, 0x161, 0x162, 0x163,
+     0x164, 0x165, 0x166, 0x167, 0x168, 0x169, 0x16A, 0x16B,
+     0x16C, 0x16D, 0x16E, 0x16F, 0x170, 0x171, 0x172, 0x173,
+     0x174, 0x175, 0x176, 0x177, 0x178, 0x17A, 0x17B, 0x17C,
+     0x17D, 0x17E, 0x17F, 0x180, 0x181, 0x183, 0x184, 0x185,
+     0x186, 0x188, 0x189, 0x18C, 0x18E, 0x192, 0x193, 0x195,
+     0x196, 0x199, 0x19C, 0x19E, 0x19F, 0x1A1, 0x1A2, 0x1A3,
+     0x1A4, 0x1A5, 0x1A6, 0x1A8, 0x1A9, 0x1AA, 0x1AC, 0x1AD,
+     0x1AE, 0x1B0, 0x1B1, 0x1B4, 0x1B5, 0x1B6, 0x1B7, 0x1B9,
+     0x1BB, 0x1BC, 0x1BD, 0x1C0, 0x1C4, 0x1C6, 0x1C7, 0x1C9,
+     0x1CA, 0x1CC, 0x1CD, 0x1CE, 0x1CF, 0x1D0, 0x1D1, 0x1D2,
+     0x1D3, 0x1D4, 0x1D5, 0x1D6, 0x1D7, 0x1D8, 0x1D9, 0x1DA,
+     0x1DB, 0x1DC, 0x1DE, 0x1DF, 0x1E0, 0x1E1, 0x1E2, 0x1E3,
+     0x1E4, 0x1E5, 0x1E6, 0x1E7, 0x1E8, 0x1E9, 0x1EA, 0x1EB,
+     0x1EC, 0x1ED, 0x1EE, 0x1EF, 0x1F1, 0x1F3, 0x1F4, 0x1F5,
+     0x1F6, 0x1F9, 0x1FA, 0x1FB, 0x1FC, 0x1FD, 0x1FE, 0x1FF,
+     0x200, 0x201, 0x202, 0x203, 0x204, 0x205, 0x206, 0x207,
+     0x208, 0x209, 0x20A, 0x20B, 0x20C, 0x20D, 0x20E, 0x20F,
+     0x210, 0x211, 0x212, 0x213, 0x214, 0x215, 0x216, 0x217,
+     0x218, 0x219, 0x21A, 0x21B, 0x21C, 0x21D, 0x21E, 0x21F,
+     0x220, 0x221, 0x222, 0x223, 0x224, 0x225, 0x226, 0x227,
+     0x228, 0x229, 0x22A, 0x22B, 0x22C, 0x22D, 0x22E, 0x22F,
+     0x230, 0x231, 0x232, 0x233, 0x23A, 0x23C, 0x23D, 0x23F,
+     0x241, 0x242, 0x243, 0x247, 0x248, 0x249, 0x24A, 0x24B,
+     0x24C, 0x24D, 0x24E, 0x24F, 0x294, 0x295, 0x2B0, 0x2B9,
+     0x2C2, 0x2C6, 0x2D2, 0x2D8, 0x2DE, 0x2E0, 0x2E5, 0x2EC,
+     0x2ED, 0x2EE, 0x2EF, 0x300, 0x34F, 0x350, 0x370, 0x371,
+     0x372, 0x373, 0x374, 0x375, 0x376, 0x377, 0x378, 0x37A,
+     0x37B, 0x37E, 0x37F, 0x380, 0x384, 0x386, 0x387, 0x388,
+     0x38B, 0x38C, 0x38D, 0x38E, 0x390, 0x391, 0x3A2, 0x3A3,
+     0x3AC, 0x3CF, 0x3D0, 0x3D2, 0x3D5, 0x3D7, 0x3D8, 0x3D9,
+     0x3DA, 0x3DB, 0x3DC, 0x3DD, 0x3DE, 0x3DF, 0x3E0, 0x3E1,
+     0x3E2, 0x3E3, 0x3E4, 0x3E5, 0x3E6, 0x3E7, 0x3E8, 0x3E9,
+     0x3EA, 0x3EB, 0x3EC, 0x3ED, 0x3EE, 0x3EF, 0x3F0, 0x3F3,
+     0x3F4, 0x3F5, 0x3F6, 0x3F7, 0x3F8, 0x3F9, 0x3FA, 0x3FB,
+     0x3FD, 0x430, 0x460, 0x461, 0x462, 0x463, 0x464, 0x465,
+     0x466, 0x467, 0x468, 0x469, 0x46A, 0x46B, 0x46C, 0x46D,
+     0x46E, 0x46F, 0x470, 0x471, 0x472, 0x473, 0x474, 0x475,
+     0x476, 0x477, 0x478, 0x479, 0x47A, 0x47B, 0x47C, 0x47D,
+     0x47E, 0x47F, 0x480, 0x481, 0x482, 0x483, 0x488, 0x48A,
+     0x48B, 0x48C, 0x48D, 0x48E, 0x48F, 0x490, 0x491, 0x492,
+     0x493, 0x494, 0x495, 0x496, 0x497, 0x498, 0x499, 0x49A,
+     0x49B, 0x49C, 0x49D, 0x49E, 0x49F, 0x4A0, 0x4A1, 0x4A2,
+     0x4A3, 0x4A4, 0x4A5, 0x4A6, 0x4A7, 0x4A8, 0x4A9, 0x4AA,
+     0x4AB, 0x4AC, 0x4AD, 0x4AE, 0x4AF, 0x4B0, 0x4B1, 0x4B2,
+     0x4B3, 0x4B4, 0x4B5, 0x4B6, 0x4B7, 0x4B8, 0x4B9, 0x4BA,
+     0x4BB, 0x4BC, 0x4BD, 0x4BE, 0x4BF, 0x4C0, 0x4C2, 0x4C3,
+     0x4C4, 0x4C5, 0x4C6, 0x4C7, 0x4C8, 0x4C9, 0x4CA, 0x4CB,
+     0x4CC, 0x4CD, 0x4CE, 0x4D0, 0x4D1, 0x4D2, 0x4D3, 0x4D4,
+     0x4D5, 0x4D6, 0x4D7, 0x4D8, 0x4D9, 0x4DA, 0x4DB, 0x4DC,
+     0x4DD, 0x4DE, 0x4DF, 0x4E0, 0x4E1, 0x4E2, 0x4E3, 0x4E4,
+     0x4E5, 0x4E6, 0x4E7, 0x4E8, 0x4E9, 0x4EA, 0x4EB, 0x4EC,
+     0x4ED, 0x4EE, 0x4EF, 0x4F0, 0x4F1, 0x4F2, 0x4F3, 0x4F4,
+     0x4F5, 0x4F6, 0x4F7, 0x4F8, 0x4F9, 0x4FA, 0x4FB, 0x4FC,
+     0x4FD, 0x4FE, 0x4FF, 0x500, 0x501, 0x502, 0x503, 0x504,
+     0x505, 0x506, 0x507, 0x508, 0x509, 0x50A, 0x50B, 0x50C,
+     0x50D, 0x50E, 0x50F, 0x510, 0x511, 0x512, 0x513, 0x514,
+     0x515, 0x516, 0x517, 0x518, 0x519, 0x51A, 0x51B, 0x51C,
+     0x51D, 0x51E, 0x51F, 0x520, 0x521, 0x522, 0x523, 0x524,
+     0x525, 0x526, 0x527, 0x528, 0x529, 0x52A, 0x52B, 0x52C,
+     0x52D, 0x52E, 0x52F, 0x530, 0x531, 0x557, 0x559, 0x55A,
+     0x560, 0x587, 0x588, 0x589, 0x591, 0x5BE, 0x5BF, 0x5C0,
+     0x5C1, 0x5C3, 0x5C4, 0x5C6, 0x5C7, 0x5C8, 0x5D0, 0x5EB,
+     0x5EF, 0x5F3, 0x610, 0x61B, 0x620, 0x64B, 0x660, 0x66A,
+     0x66E, 0x670, 0x671, 0x675, 0x679, 0x6D4, 0x6D5, 0x6D6,
+     0x6DD, 0x6DF, 0x6E5, 0x6E7, 0x6E9, 0x6EA, 0x6EE, 0x6F0,
+     0x6FA, 0x6FD, 0x6FF, 0x700, 0x710, 0x711, 0x712, 0x730,
+     0x74B, 0x74D, 0x7A6, 0x7B1, 0x7B2, 0x7C0, 0x7CA, 0x7EB,
+     0x7F4, 0x7F6, 0x7FA, 0x7FB, 0x7FD, 0x7FE, 0x800, 0x816,
+     0x81A, 0x81B, 0x824, 0x825, 0x828, 0x829, 0x82E, 0x840,
+     0x859, 0x85C, 0x860, 0x86B, 0x870, 0x888, 0x889, 0x88F,
+     0x898, 0x8A0, 0x8CA, 0x8E2, 0x8E3, 0x900, 0x904, 0x93A,
+     0x93C, 0x93D, 0x93E, 0x94D, 0x94E, 0x950, 0x951, 0x955,
+     0x958, 0x960, 0x962, 0x964, 0x966, 0x970, 0x971, 0x981,
+     0x984, 0x985, 0x98D, 0x98F, 0x991, 0x993, 0x9A9, 0x9AA,
+     0x9B1, 0x9B2, 0x9B3, 0x9B6, 0x9BA, 0x9BC, 0x9BD, 0x9BE,
+     0x9BF, 0x9C5, 0x9C7, 0x9C9, 0x9CB, 0x9CD, 0x9CE, 0x9CF,
+     0x9D7, 0x9D8, 0x9DC, 0x9DE, 0x9DF, 0x9E0, 0x9E2, 0x9E4,
+     0x9E6, 0x9F0, 0x9F2, 0x9FC, 0x9FD, 0x9FE, 0x9FF, 0xA01,
+     0xA04, 0xA05, 0xA0B, 0xA0F, 0xA11, 0xA13, 0xA29, 0xA2A,
+     0xA31, 0xA32, 0xA33, 0xA34, 0xA35, 0xA36, 0xA37, 0xA38,
+     0xA3A, 0xA3C, 0xA3D, 0xA3E, 0xA43, 0xA47, 0xA49, 0xA4B,
+     0xA4D, 0xA4E, 0xA51, 0xA52, 0xA59, 0xA5C, 0xA5D, 0xA5E,
+     0xA5F, 0xA66, 0xA70, 0xA72, 0xA75, 0xA76, 0xA81, 0xA84,
+     0xA85, 0xA8E, 0xA8F, 0xA92, 0xA93, 0xAA9, 0xAAA, 0xAB1,
+     0xAB2, 0xAB4, 0xAB5, 0xABA, 0xABC, 0xABD, 0xABE, 0xAC6,
+     0xAC7, 0xACA, 0xACB, 0xACD, 0xACE, 0xAD0, 0xAD1, 0xAE0,
+     0xAE2, 0xAE4, 0xAE6, 0xAF0, 0xAF9, 0xAFA, 0xB00, 0xB01,
+     0xB04, 0xB05, 0xB0D, 0xB0F, 0xB11, 0xB13, 0xB29, 0xB2A,
+     0xB31, 0xB32, 0xB34, 0xB35, 0xB3A, 0xB3C, 0xB3D, 0xB3E,
+     0xB3F, 0xB45, 0xB47, 0xB49, 0xB4B, 0xB4D, 0xB4E, 0xB55,
+     0xB56, 0xB58, 0xB5C, 0xB5E, 0xB5F, 0xB62, 0xB64, 0xB66,
+     0xB70, 0xB71, 0xB72, 0xB82, 0xB83, 0xB84, 0xB85, 0xB8B,
+     0xB8E, 0xB91, 0xB92, 0xB96, 0xB99, 0xB9B, 0xB9C, 0xB9D,
+     0xB9E, 0xBA0, 0xBA3, 0xBA5, 0xBA8, 0xBAB, 0xBAE, 0xBBA,
+     0xBBE, 0xBBF, 0xBC3, 0xBC6, 0xBC9, 0xBCA, 0xBCD, 0xBCE,
+     0xBD0, 0xBD1, 0xBD7, 0xBD8, 0xBE6, 0xBF0, 0xC00, 0xC05,
+     0xC0D, 0xC0E, 0xC11, 0xC12, 0xC29, 0xC2A, 0xC3A, 0xC3C,
+     0xC3D, 0xC3E, 0xC45, 0xC46, 0xC49, 0xC4A, 0xC4D, 0xC4E,
+     0xC55, 0xC57, 0xC58, 0xC5B, 0xC5D, 0xC5E, 0xC60, 0xC62,
+     0xC64, 0xC66, 0xC70, 0xC80, 0xC81, 0xC84, 0xC85, 0xC8D,
+     0xC8E, 0xC91, 0xC92, 0xCA9, 0xCAA, 0xCB4, 0xCB5, 0xCBA,
+     0xCBC, 0xCBD, 0xCBE, 0xCC2, 0xCC3, 0xCC5, 0xCC6, 0xCC9,
+     0xCCA, 0xCCD, 0xCCE, 0xCD5, 0xCD7, 0xCDD, 0xCDF, 0xCE0,
+     0xCE2, 0xCE4, 0xCE6, 0xCF0, 0xCF1, 0xCF3, 0xD00, 0xD04,
+     0xD0D, 0xD0E, 0xD11, 0xD12, 0xD3B, 0xD3D, 0xD3E, 0xD3F,
+     0xD45, 0xD46, 0xD49, 0xD4A, 0xD4D, 0xD4E, 0xD4F, 0xD54,
+     0xD57, 0xD58, 0xD5F, 0xD62, 0xD64, 0xD66, 0xD70, 0xD7A,
+     0xD80, 0xD81, 0xD84, 0xD85, 0xD97, 0xD9A, 0xDB2, 0xDB3,
+     0xDBC, 0xDBD, 0xDBE, 0xDC0, 0xDC7, 0xDCA, 0xDCB, 0xDCF,
+     0xDD0, 0xDD5, 0xDD6, 0xDD7, 0xDD8, 0xDDF, 0xDE0, 0xDE6,
+     0xDF0, 0xDF2, 0xDF4, 0xE01, 0xE31, 0xE32, 0xE33, 0xE34,
+     0xE38, 0xE3B, 0xE40, 0xE47, 0xE48, 0xE4C, 0xE4F, 0xE50,
+     0xE5A, 0xE81, 0xE83, 0xE84, 0xE85, 0xE86, 0xE8B, 0xE8C,
+     0xEA4, 0xEA5, 0xEA6, 0xEA7, 0xEB1, 0xEB2, 0xEB3, 0xEB4,
+     0xEB8, 0xEBB, 0xEBD, 0xEBE, 0xEC0, 0xEC5, 0xEC6, 0xEC7,
+     0xEC8, 0xECC, 0xECE, 0xED0, 0xEDA, 0xEDC, 0xEDE, 0xEE0,
+     0xF00, 0xF01, 0xF0C, 0xF0D, 0xF18, 0xF1A, 0xF20, 0xF2A,
+     0xF35, 0xF36, 0xF37, 0xF38, 0xF39, 0xF3A, 0xF3E, 0xF40,
+     0xF43, 0xF44, 0xF48, 0xF49, 0xF4D, 0xF4E, 0xF52, 0xF53,
+     0xF57, 0xF58, 0xF5C, 0xF5D, 0xF69, 0xF6A, 0xF6D, 0xF71,
+     0xF7E, 0xF80, 0xF85, 0xF86, 0xF88, 0xF8D, 0xF93, 0xF94,
+     0xF98, 0xF99, 0xF9D, 0xF9E, 0xFA2, 0xFA3, 0xFA7, 0xFA8,
+     0xFAC, 0xFAD, 0xFB9, 0xFBA, 0xFBD, 0xFC6, 0xFC7, 0x1000,
+     0x102B, 0x102E, 0x102F, 0x1037, 0x1038, 0x1039, 0x103B, 0x103F,
+     0x1040, 0x104A, 0x1050, 0x1056, 0x105A, 0x105E, 0x1061, 0x1062,
+     0x1065, 0x1067, 0x106E, 0x1071, 0x1075, 0x1082, 0x108D, 0x108E,
+     0x108F, 0x1090, 0x109A, 0x109E, 0x10A0, 0x10C6, 0x10C7, 0x10C8,
+     0x10CD, 0x10CE, 0x10D0, 0x10FB, 0x10FC, 0x10FD, 0x1100, 0x1161,
+     0x1176, 0x11A8, 0x11C3, 0x1249, 0x124A, 0x124E, 0x1250, 0x1257,
+     0x1258, 0x1259, 0x125A, 0x125E, 0x1260, 0x1289, 0x128A, 0x128E,
+     0x1290, 0x12B1, 0x12B2, 0x12B6, 0x12B8, 0x12BF, 0x12C0, 0x12C1,
+     0x12C2, 0x12C6, 0x12C8, 0x12D7, 0x12D8, 0x1311, 0x1312, 0x1316,
+     0x1318, 0x135B, 0x135D, 0x1360, 0x1380, 0x1390, 0x13A0, 0x13F6,
+     0x13F8, 0x13FE, 0x1401, 0x166D, 0x166F, 0x1680, 0x1681, 0x169B,
+     0x16A0, 0x16EB, 0x16F1, 0x16F9, 0x1700, 0x1712, 0x1714, 0x1716,
+     0x171F, 0x1732, 0x1734, 0x1735, 0x1740, 0x1752, 0x1754, 0x1760,
+     0x176D, 0x176E, 0x1771, 0x1772, 0x1774, 0x1780, 0x17B4, 0x17D2,
+     0x17D3, 0x17D4, 0x17D7, 0x17D8, 0x17DC, 0x17DD, 0x17DE, 0x17E0,
+     0x17EA, 0x180B, 0x180E, 0x180F, 0x1810, 0x181A, 0x1820, 0x1879,
+     0x1880, 0x1885, 0x1887, 0x18A9, 0x18AA, 0x18AB, 0x18B0, 0x18F6,
+     0x1900, 0x191F, 0x1920, 0x192C, 0x1930, 0x1939, 0x193C, 0x1946,
+     0x1950, 0x196E, 0x1970, 0x1975, 0x1980, 0x19AC, 0x19B0, 0x19CA,
+     0x19D0, 0x19DA, 0x1A00, 0x1A17, 0x1A19, 0x1A1C, 0x1A20, 0x1A55,
+     0x1A5F, 0x1A60, 0x1A61, 0x1A75, 0x1A7D, 0x1A7F, 0x1A80, 0x1A8A,
+     0x1A90, 0x1A9A, 0x1AA7, 0x1AA8, 0x1AB0, 0x1ABE, 0x1ABF, 0x1ACF,
+     0x1B00, 0x1B05, 0x1B34, 0x1B36, 0x1B44, 0x1B45, 0x1B4D, 0x1B50,
+     0x1B5A, 0x1B6B, 0x1B74, 0x1B80, 0x1B83, 0x1BA1, 0x1BAA, 0x1BAC,
+     0x1BAE, 0x1BB0, 0x1BBA, 0x1BE6, 0x1BE7, 0x1BF2, 0x1BF4, 0x1C00,
+     0x1C24, 0x1C37, 0x1C38, 0x1C40, 0x1C4A, 0x1C4D, 0x1C50, 0x1C5A,
+     0x1C7E, 0x1C80, 0x1C89, 0x1C90, 0x1CBB, 0x1CBD, 0x1CC0, 0x1CD0,
+     0x1CD3, 0x1CD4, 0x1CE1, 0x1CE2, 0x1CE9, 0x1CED, 0x1CEE, 0x1CF4,
+     0x1CF5, 0x1CF7, 0x1CF8, 0x1CFA, 0x1CFB, 0x1D00, 0x1D2C, 0x1D2F,
+     0x1D30, 0x1D3B, 0x1D3C, 0x1D4E, 0x1D4F, 0x1D6B, 0x1D78, 0x1D79,
+     0x1D9B, 0x1DC0, 0x1E00, 0x1E01, 0x1E02, 0x1E03, 0x1E04, 0x1E05,
+     0x1E06, 0x1E07, 0x1E08, 0x1E09, 0x1E0A, 0x1E0B, 0x1E0C, 0x1E0D,
+     0x1E0E, 0x1E0F, 0x1E10, 0x1E11, 0x1E12, 0x1E13, 0x1E14, 0x1E15,
+     0x1E16, 0x1E17, 0x1E18, 0x1E19, 0x1E1A, 0x1E1B, 0x1E1C, 0x1E1D,
+     0x1E1E, 0x1E1F, 0x1E20, 0x1E21, 0x1E22, 0x1E23, 0x1E24, 0x1E25,
+     0x1E26, 0x1E27, 0x1E28, 0x1E29, 0x1E2A, 0x1E2B, 0x1E2C, 0x1E2D,
+     0x1E2E, 0x1E2F, 0x1E30, 0x1E31, 0x1E32, 0x1E33, 0x1E34, 0x1E35,
+     0x1E36, 0x1E37, 0x1E38, 0x1E39, 0x1E3A, 0x1E3B, 0x1E3C, 0x1E3D,
+     0x1E3E, 0x1E3F, 0x1E40, 0x1E41, 0x1E42, 0x1E43, 0x1E44, 0x1E45,
+     0x1E46, 0x1E47, 0x1E48, 0x1E49, 0x1E4A, 0x1E4B, 0x1E4C, 0x1E4D,
+     0x1E4E, 0x1E4F, 0x1E50, 0x1E51, 0x1E52, 0x1E53, 0x1E54, 0x1E55,
+     0x1E56, 0x1E57, 0x1E58, 0x1E59, 0x1E5A, 0x1E5B, 0x1E5C, 0x1E5D,
+     0x1E5E, 0x1E5F, 0x1E60, 0x1E61, 0x1E62, 0x1E63, 0x1E64, 0x1E65,
+     0x1E66, 0x1E67, 0x1E68, 0x1E69, 0x1E6A, 0x1E6B, 0x1E6C, 0x1E6D,
+     0x1E6E, 0x1E6F, 0x1E70, 0x1E71, 0x1E72, 0x1E73, 0x1E74, 0x1E75,
+     0x1E76, 0x1E77, 0x1E78, 0x1E79, 0x1E7A, 0x1E7B, 0x1E7C, 0x1E7D,
+     0x1E7E, 0x1E7F, 0x1E80, 0x1E81, 0x1E82, 0x1E83, 0x1E84, 0x1E85,
+     0x1E86, 0x1E87, 0x1E88, 0x1E89, 0x1E8A, 0x1E8B, 0x1E8C, 0x1E8D,
+     0x1E8E, 0x1E8F, 0x1E90, 0x1E91, 0x1E92, 0x1E93, 0x1E94, 0x1E95,
+     0x1E9A, 0x1E9C, 0x1E9E, 0x1E9F, 0x1EA0, 0x1EA1, 0x1EA2, 0x1EA3,
+     0x1EA4, 0x1EA5, 0x1EA6, 0x1EA7, 0x1EA8, 0x1EA9, 0x1EAA, 0x1EAB,
+     0x1EAC, 0x1EAD, 0x1EAE, 0x1EAF, 0x1EB0, 0x1EB1, 0x1EB2, 0x1EB3,
+     0x1EB4, 0x1EB5, 0x1EB6, 0x1EB7, 0x1EB8, 0x1EB9, 0x1EBA, 0x1EBB,
+     0x1EBC, 0x1EBD, 0x1EBE, 0x1EBF, 0x1EC0, 0x1EC1, 0x1EC2, 0x1EC3,
+     0x1EC4, 0x1EC5, 0x1EC6, 0x1EC7, 0x1EC8, 0x1EC9, 0x1ECA, 0x1ECB,
+     0x1ECC, 0x1ECD, 0x1ECE, 0x1ECF, 0x1ED0, 0x1ED1, 0x1ED2, 0x1ED3,
+     0x1ED4, 0x1ED5, 0x1ED6, 0x1ED7, 0x1ED8, 0x1ED9, 0x1EDA, 0x1EDB,
+     0x1EDC, 0x1EDD, 0x1EDE, 0x1EDF, 0x1EE0, 0x1EE1, 0x1EE2, 0x1EE3,
+     0x1EE4, 0x1EE5, 0x1EE6, 0x1EE7, 0x1EE8, 0x1EE9, 0x1EEA, 0x1EEB,
+     0x1EEC, 0x1EED, 0x1EEE, 0x1EEF, 0x1EF0, 0x1EF1, 0x1EF2, 0x1EF3,
+     0x1EF4, 0x1EF5, 0x1EF6, 0x1EF7, 0x1EF8, 0x1EF9, 0x1EFA, 0x1EFB,
+     0x1EFC, 0x1EFD, 0x1EFE, 0x1EFF, 0x1F08, 0x1F10, 0x1F16, 0x1F18,
+     0x1F1E, 0x1F20, 0x1F28, 0x1F30, 0x1F38, 0x1F40, 0x1F46, 0x1F48,
+     0x1F4E, 0x1F50, 0x1F58, 0x1F59, 0x1F5A, 0x1F5B, 0x1F5C, 0x1F5D,
+     0x1F5E, 0x1F5F, 0x1F60, 0x1F68, 0x1F70, 0x1F71, 0x1F72, 0x1F73,
+     0x1F74, 0x1F75, 0x1F76, 0x1F77, 0x1F78, 0x1F79, 0x1F7A, 0x1F7B,
+     0x1F7C, 0x1F7D, 0x1F7E, 0x1F80, 0x1F88, 0x1F90, 0x1F98, 0x1FA0,
+     0x1FA8, 0x1FB0, 0x1FB5, 0x1FB6, 0x1FB8, 0x1FBB, 0x1FBC, 0x1FBD,
+     0x1FBE, 0x1FBF, 0x1FC2, 0x1FC5, 0x1FC6, 0x1FC8, 0x1FC9, 0x1FCA,
+     0x1FCB, 0x1FCC, 0x1FCD, 0x1FD0, 0x1FD3, 0x1FD4, 0x1FD6, 0x1FD8,
+     0x1FDB, 0x1FDC, 0x1FDD, 0x1FE0, 0x1FE3, 0x1FE4, 0x1FE8, 0x1FEB,
+     0x1FEC, 0x1FED, 0x1FF0, 0x1FF2, 0x1FF5, 0x1FF6, 0x1FF8, 0x1FF9,
+     0x1FFA, 0x1FFB, 0x1FFC, 0x1FFD, 0x1FFF, 0x2000, 0x200B, 0x2011,
+     0x2012, 0x2017, 0x2018, 0x2024, 0x2027, 0x202F, 0x2030, 0x2033,
+     0x2035, 0x2036, 0x2038, 0x203C, 0x203D, 0x203E, 0x203F, 0x2047,
+     0x204A, 0x2057, 0x2058, 0x205F, 0x2060, 0x2070, 0x2071, 0x2072,
+     0x2074, 0x207F, 0x2080, 0x208F, 0x2090, 0x209D, 0x20A8, 0x20A9,
+     0x20D0, 0x20DD, 0x20E1, 0x20E2, 0x20E5, 0x20F1, 0x2100, 0x2102,
+     0x2103, 0x2104, 0x2105, 0x2107, 0x2108, 0x2109, 0x210A, 0x210B,
+     0x210E, 0x2110, 0x2113, 0x2114, 0x2115, 0x2116, 0x2117, 0x2119,
+     0x211E, 0x2120, 0x2123, 0x2124, 0x2125, 0x2126, 0x2127, 0x2128,
+     0x2129, 0x212A, 0x212E, 0x212F, 0x2130, 0x2132, 0x2133, 0x2134,
+     0x2135, 0x2139, 0x213A, 0x213B, 0x213C, 0x213E, 0x2140, 0x2141,
+     0x2145, 0x2146, 0x214A, 0x214E, 0x214F, 0x2150, 0x2180, 0x2183,
+     0x2184, 0x2185, 0x2189, 0x218A, 0x222C, 0x222E, 0x222F, 0x2231,
+     0x2329, 0x232B, 0x2460, 0x24EB, 0x2A0C, 0x2A0D, 0x2A74, 0x2A77,
+     0x2ADC, 0x2ADD, 0x2C00, 0x2C30, 0x2C60, 0x2C61, 0x2C62, 0x2C65,
+     0x2C67, 0x2C68, 0x2C69, 0x2C6A, 0x2C6B, 0x2C6C, 0x2C6D, 0x2C71,
+     0x2C72, 0x2C73, 0x2C75, 0x2C76, 0x2C7C, 0x2C7E, 0x2C81, 0x2C82,
+     0x2C83, 0x2C84, 0x2C85, 0x2C86, 0x2C87, 0x2C88, 0x2C89, 0x2C8A,
+     0x2C8B, 0x2C8C, 0x2C8D, 0x2C8E, 0x2C8F, 0x2C90, 0x2C91, 0x2C92,
+     0x2C93, 0x2C94, 0x2C95, 0x2C96, 0x2C97, 0x2C98, 0x2C99, 0x2C9A,
+     0x2C9B, 0x2C9C, 0x2C9D, 0x2C9E, 0x2C9F, 0x2CA0, 0x2CA1, 0x2CA2,
+     0x2CA3, 0x2CA4, 0x2CA5, 0x2CA6, 0x2CA7, 0x2CA8, 0x2CA9, 0x2CAA,
+     0x2CAB, 0x2CAC, 0x2CAD, 0x2CAE, 0x2CAF, 0x2CB0, 0x2CB1, 0x2CB2,
+     0x2CB3, 0x2CB4, 0x2CB5, 0x2CB6, 0x2CB7, 0x2CB8, 0x2CB9, 0x2CBA,
+     0x2CBB, 0x2CBC, 0x2CBD, 0x2CBE, 0x2CBF, 0x2CC0, 0x2CC1, 0x2CC2,
+     0x2CC3, 0x2CC4, 0x2CC5, 0x2CC6, 0x2CC7, 0x2CC8, 0x2CC9, 0x2CCA,
+     0x2CCB, 0x2CCC, 0x2CCD, 0x2CCE, 0x2CCF, 0x2CD0, 0x2CD1, 0x2CD2,
+     0x2CD3, 0x2CD4, 0x2CD5, 0x2CD6, 0x2CD7, 0x2CD8, 0x2CD9, 0x2CDA,
+     0x2CDB, 0x2CDC, 0x2CDD, 0x2CDE, 0x2CDF, 0x2CE0, 0x2CE1, 0x2CE2,
+     0x2CE3, 0x2CE5, 0x2CEB, 0x2CEC, 0x2CED, 0x2CEE, 0x2CEF, 0x2CF2,
+     0x2CF3, 0x2CF4, 0x2D00, 0x2D26, 0x2D27, 0x2D28, 0x2D2D, 0x2D2E,
+     0x2D30, 0x2D68, 0x2D6F, 0x2D70, 0x2D7F, 0x2D80, 0x2D97, 0x2DA0,
+     0x2DA7, 0x2DA8, 0x2DAF, 0x2DB0, 0x2DB7, 0x2DB8, 0x2DBF, 0x2DC0,
+     0x2DC7, 0x2DC8, 0x2DCF, 0x2DD0, 0x2DD7, 0x2DD8, 0x2DDF, 0x2DE0,
+     0x2E00, 0x2E2F, 0x2E30, 0x2E9F, 0x2EA0, 0x2EF3, 0x2EF4, 0x2F00,
+     0x2FD6, 0x3000, 0x3001, 0x3005, 0x3007, 0x302A, 0x3030, 0x3031,
+     0x3036, 0x3037, 0x3038, 0x303B, 0x303D, 0x3041, 0x3097, 0x3099,
+     0x309B, 0x309D, 0x309F, 0x30A0, 0x30A1, 0x30FB, 0x30FC, 0x30FF,
+     0x3100, 0x3105, 0x3130, 0x3131, 0x318F, 0x3192, 0x31A0, 0x31C0,
+     0x31F0, 0x3200, 0x321F, 0x3220, 0x3248, 0x3250, 0x327F, 0x3280,
+     0x3400, 0x4DC0, 0x4E00, 0xA48D, 0xA4D0, 0xA4FE, 0xA500, 0xA60D,
+     0xA610, 0xA620, 0xA62A, 0xA62C, 0xA640, 0xA641, 0xA642, 0xA643,
+     0xA644, 0xA645, 0xA646, 0xA647, 0xA648, 0xA649, 0xA64A, 0xA64B,
+     0xA64C, 0xA64D, 0xA64E, 0xA64F, 0xA650, 0xA651, 0xA652, 0xA653,
+     0xA654, 0xA655, 0xA656, 0xA657, 0xA658, 0xA659, 0xA65A, 0xA65B,
+     0xA65C, 0xA65D, 0xA65E, 0xA65F, 0xA660, 0xA661, 0xA662, 0xA663,
+     0xA664, 0xA665, 0xA666, 0xA667, 0xA668, 0xA669, 0xA66A, 0xA66B,
+     0xA66C, 0xA66D, 0xA66E, 0xA66F, 0xA670, 0xA673, 0xA674, 0xA67E,
+     0xA67F, 0xA680, 0xA681, 0xA682, 0xA683, 0xA684, 0xA685, 0xA686,
+     0xA687, 0xA688, 0xA689, 0xA68A, 0xA68B, 0xA68C, 0xA68D, 0xA68E,
+     0xA68F, 0xA690, 0xA691, 0xA692, 0xA693, 0xA694, 0xA695, 0xA696,
+     0xA697, 0xA698, 0xA699, 0xA69A, 0xA69B, 0xA69C, 0xA69E, 0xA6A0,
+     0xA6E6, 0xA6F0, 0xA6F2, 0xA717, 0xA720, 0xA722, 0xA723, 0xA724,
+     0xA725, 0xA726, 0xA727, 0xA728, 0xA729, 0xA72A, 0xA72B, 0xA72C,
+     0xA72D, 0xA72E, 0xA72F, 0xA732, 0xA733, 0xA734, 0xA735, 0xA736,
+     0xA737, 0xA738, 0xA739, 0xA73A, 0xA73B, 0xA73C, 0xA73D, 0xA73E,
+     0xA73F, 0xA740, 0xA741, 0xA742, 0xA743, 0xA744, 0xA745, 0xA746,
+     0xA747, 0xA748, 0xA749, 0xA74A, 0xA74B, 0xA74C, 0xA74D, 0xA74E,
+     0xA74F, 0xA750, 0xA751, 0xA752, 0xA753, 0xA754, 0xA755, 0xA756,
+     0xA757, 0xA758, 0xA759, 0xA75A, 0xA75B, 0xA75C, 0xA75D, 0xA75E,
+     0xA75F, 0xA760, 0xA761, 0xA762, 0xA763, 0xA764, 0xA765, 0xA766,
+     0xA767, 0xA768, 0xA769, 0xA76A, 0xA76B, 0xA76C, 0xA76D, 0xA76E,
+     0xA76F, 0xA770, 0xA771, 0xA779, 0xA77A, 0xA77B, 0xA77C, 0xA77D,
+     0xA77F, 0xA780, 0xA781, 0xA782, 0xA783, 0xA784, 0xA785, 0xA786,
+     0xA787, 0xA788, 0xA789, 0xA78B, 0xA78C, 0xA78D, 0xA78E, 0xA78F,
+     0xA790, 0xA791, 0xA792, 0xA793, 0xA796, 0xA797, 0xA798, 0xA799,
+     0xA79A, 0xA79B, 0xA79C, 0xA79D, 0xA79E, 0xA79F, 0xA7A0, 0xA7A1,
+     0xA7A2, 0xA7A3, 0xA7A4, 0xA7A5, 0xA7A6, 0xA7A7, 0xA7A8, 0xA7A9,
+     0xA7AA, 0xA7AF, 0xA7B0, 0xA7B5, 0xA7B6, 0xA7B7, 0xA7B8, 0xA7B9,
+     0xA7BA, 0xA7BB, 0xA7BC, 0xA7BD, 0xA7BE, 0xA7BF, 0xA7C0, 0xA7C1,
+     0xA7C2, 0xA7C3, 0xA7C4, 0xA7C8, 0xA7C9, 0xA7CA, 0xA7CB, 0xA7D0,
+     0xA7D1, 0xA7D2, 0xA7D3, 0xA7D4, 0xA7D5, 0xA7D6, 0xA7D7, 0xA7D8,
+     0xA7D9, 0xA7DA, 0xA7F2, 0xA7F5, 0xA7F6, 0xA7F7, 0xA7F8, 0xA7FA,
+     0xA7FB, 0xA802, 0xA803, 0xA806, 0xA807, 0xA80B, 0xA80C, 0xA823,
+     0xA828, 0xA82C, 0xA82D, 0xA840, 0xA874, 0xA880, 0xA882, 0xA8B4,
+     0xA8C4, 0xA8C5, 0xA8C6, 0xA8D0, 0xA8DA, 0xA8E0, 0xA8F2, 0xA8F8,
+     0xA8FB, 0xA8FC, 0xA8FD, 0xA8FF, 0xA900, 0xA90A, 0xA926, 0xA92B,
+     0xA92E, 0xA930, 0xA947, 0xA953, 0xA954, 0xA960, 0xA97D, 0xA980,
+     0xA984, 0xA9B3, 0xA9B4, 0xA9C0, 0xA9C1, 0xA9CF, 0xA9D0, 0xA9DA,
+     0xA9E0, 0xA9E5, 0xA9E6, 0xA9F0, 0xA9FA, 0xA9FF, 0xAA00, 0xAA29,
+     0xAA37, 0xAA40, 0xAA43, 0xAA44, 0xAA4C, 0xAA4E, 0xAA50, 0xAA5A,
+     0xAA60, 0xAA77, 0xAA7A, 0xAA7B, 0xAA7E, 0xAAB0, 0xAAB1, 0xAAB2,
+     0xAAB5, 0xAAB7, 0xAAB9, 0xAABE, 0xAAC0, 0xAAC1, 0xAAC2, 0xAAC3,
+     0xAADB, 0xAADE, 0xAAE0, 0xAAEB, 0xAAF0, 0xAAF2, 0xAAF5, 0xAAF6,
+     0xAAF7, 0xAB01, 0xAB07, 0xAB09, 0xAB0F, 0xAB11, 0xAB17, 0xAB20,
+     0xAB27, 0xAB28, 0xAB2F, 0xAB30, 0xAB5B, 0xAB5C, 0xAB60, 0xAB69,
+     0xAB6A, 0xAB70, 0xABC0, 0xABE3, 0xABEB, 0xABEC, 0xABED, 0xABEE,
+     0xABF0, 0xABFA, 0xAC00, 0xD7A4, 0xD7B0, 0xD7C7, 0xD7CB, 0xD7FC,
+     0xD800, 0xE000, 0xF900, 0xFA0E, 0xFA10, 0xFA11, 0xFA12, 0xFA13,
+     0xFA15, 0xFA1F, 0xFA20, 0xFA21, 0xFA22, 0xFA23, 0xFA25, 0xFA27,
+     0xFA2A, 0xFA6E, 0xFA70, 0xFADA, 0xFB00, 0xFB07, 0xFB13, 0xFB18,
+     0xFB1D, 0xFB1E, 0xFB1F, 0xFB29, 0xFB2A, 0xFB37, 0xFB38, 0xFB3D,
+     0xFB3E, 0xFB3F, 0xFB40, 0xFB42, 0xFB43, 0xFB45, 0xFB46, 0xFBB2,
+     0xFBD3, 0xFD3E, 0xFD50, 0xFD90, 0xFD92, 0xFDC8, 0xFDF0, 0xFDFC,
+     0xFDFD, 0xFE00, 0xFE10, 0xFE1A, 0xFE20, 0xFE30, 0xFE45, 0xFE47,
+     0xFE53, 0xFE54, 0xFE67, 0xFE68, 0xFE6C, 0xFE70, 0xFE73, 0xFE74,
+     0xFE75, 0xFE76, 0xFEFD, 0xFF01, 0xFF10, 0xFF1A, 0xFF21, 0xFF3B,
+     0xFF41, 0xFF5B, 0xFF66, 0xFFBF, 0xFFC2, 0xFFC8, 0xFFCA, 0xFFD0,
+     0xFFD2, 0xFFD8, 0xFFDA, 0xFFDD, 0xFFE0, 0xFFE7, 0xFFE8, 0xFFEF,
+     0x10000, 0x1000C, 0x1000D, 0x10027, 0x10028, 0x1003B, 0x1003C, 0x1003E,
+     0x1003F, 0x1004E, 0x10050, 0x1005E, 0x10080, 0x100FB, 0x101FD, 0x101FE,
+     0x10280, 0x1029D, 0x102A0, 0x102D1, 0x102E0, 0x102E1, 0x10300, 0x10320,
+     0x1032D, 0x10341, 0x10342, 0x1034A, 0x10350, 0x10376, 0x1037B, 0x10380,
+     0x1039E, 0x103A0, 0x103C4, 0x103C8, 0x103D0, 0x10400, 0x10428, 0x10450,
+     0x1049E, 0x104A0, 0x104AA, 0x104B0, 0x104D4, 0x104D8, 0x104FC, 0x10500,
+     0x10528, 0x10530, 0x10564, 0x10570, 0x1057B, 0x1057C, 0x1058B, 0x1058C,
+     0x10593, 0x10594, 0x10596, 0x10597, 0x105A2, 0x105A3, 0x105B2, 0x105B3,
+     0x105BA, 0x105BB, 0x105BD, 0x10600, 0x10737, 0x10740, 0x10756, 0x10760,
+     0x10768, 0x10780, 0x10781, 0x10786, 0x10787, 0x107B1, 0x107B2, 0x107BB,
+     0x10800, 0x10806, 0x10808, 0x10809, 0x1080A, 0x10836, 0x10837, 0x10839,
+     0x1083C, 0x1083D, 0x1083F, 0x10856, 0x10860, 0x10877, 0x10880, 0x1089F,
+     0x108E0, 0x108F3, 0x108F4, 0x108F6, 0x10900, 0x10916, 0x10920, 0x1093A,
+     0x10980, 0x109B8, 0x109BE, 0x109C0, 0x10A00, 0x10A01, 0x10A04, 0x10A05,
+     0x10A07, 0x10A0C, 0x10A0D, 0x10A0E, 0x10A0F, 0x10A10, 0x10A14, 0x10A15,
+     0x10A18, 0x10A19, 0x10A36, 0x10A38, 0x10A3B, 0x10A3F, 0x10A40, 0x10A60,
+     0x10A7D, 0x10A80, 0x10A9D, 0x10AC0, 0x10AC8, 0x10AC9, 0x10AE5, 0x10AE7,
+     0x10B00, 0x10B36, 0x10B40, 0x10B56, 0x10B60, 0x10B73, 0x10B80, 0x10B92,
+     0x10C00, 0x10C49, 0x10C80, 0x10CB3, 0x10CC0, 0x10CF3, 0x10D00, 0x10D24,
+     0x10D28, 0x10D30, 0x10D3A, 0x10E80, 0x10EAA, 0x10EAB, 0x10EAD, 0x10EB0,
+     0x10EB2, 0x10F00, 0x10F1D, 0x10F27, 0x10F28, 0x10F30, 0x10F46, 0x10F51,
+     0x10F70, 0x10F82, 0x10F86, 0x10FB0, 0x10FC5, 0x10FE0, 0x10FF7, 0x11000,
+     0x11003, 0x11038, 0x11046, 0x11047, 0x11066, 0x11070, 0x11071, 0x11073,
+     0x11075, 0x11076, 0x1107F, 0x11080, 0x11083, 0x110B0, 0x110B9, 0x110BB,
+     0x110C2, 0x110C3, 0x110D0, 0x110E9, 0x110F0, 0x110FA, 0x11100, 0x11103,
+     0x11127, 0x11128, 0x11133, 0x11135, 0x11136, 0x11140, 0x11144, 0x11145,
+     0x11147, 0x11148, 0x11150, 0x11173, 0x11174, 0x11176, 0x11177, 0x11180,
+     0x11183, 0x111B3, 0x111C0, 0x111C1, 0x111C5, 0x111C9, 0x111CA, 0x111CB,
+     0x111CD, 0x111CE, 0x111D0, 0x111DA, 0x111DB, 0x111DC, 0x111DD, 0x11200,
+     0x11212, 0x11213, 0x1122C, 0x11235, 0x11237, 0x11238, 0x1123E, 0x1123F,
+     0x11280, 0x11287, 0x11288, 0x11289, 0x1128A, 0x1128E, 0x1128F, 0x1129E,
+     0x1129F, 0x112A9, 0x112B0, 0x112DF, 0x112E9, 0x112EB, 0x112F0, 0x112FA,
+     0x11300, 0x11304, 0x11305, 0x1130D, 0x1130F, 0x11311, 0x11313, 0x11329,
+     0x1132A, 0x11331, 0x11332, 0x11334, 0x11335, 0x1133A, 0x1133B, 0x1133D,
+     0x1133E, 0x1133F, 0x11345, 0x11347, 0x11349, 0x1134B, 0x1134D, 0x1134E,
+     0x11350, 0x11351, 0x11357, 0x11358, 0x1135D, 0x11362, 0x11364, 0x11366,
+     0x1136D, 0x11370, 0x11375, 0x11400, 0x11435, 0x11442, 0x11443, 0x11446,
+     0x11447, 0x1144B, 0x11450, 0x1145A, 0x1145E, 0x1145F, 0x11462, 0x11480,
+     0x114B0, 0x114B1, 0x114BA, 0x114BB, 0x114BD, 0x114BE, 0x114C2, 0x114C4,
+     0x114C6, 0x114C7, 0x114C8, 0x114D0, 0x114DA, 0x11580, 0x115AF, 0x115B0,
+     0x115B6, 0x115B8, 0x115BF, 0x115C1, 0x115D8, 0x115DC, 0x115DE, 0x11600,
+     0x11630, 0x1163F, 0x11640, 0x11641, 0x11644, 0x11645, 0x11650, 0x1165A,
+     0x11680, 0x116AB, 0x116B6, 0x116B8, 0x116B9, 0x116C0, 0x116CA, 0x11700,
+     0x1171B, 0x1171D, 0x1172B, 0x1172C, 0x11730, 0x1173A, 0x11740, 0x11747,
+     0x11800, 0x1182C, 0x11839, 0x1183B, 0x118A0, 0x118C0, 0x118E0, 0x118EA,
+     0x118FF, 0x11907, 0x11909, 0x1190A, 0x1190C, 0x11914, 0x11915, 0x11917,
+     0x11918, 0x11930, 0x11931, 0x11936, 0x11937, 0x11939, 0x1193B, 0x1193D,
+     0x1193F, 0x11940, 0x11941, 0x11942, 0x11943, 0x11944, 0x11950, 0x1195A,
+     0x119A0, 0x119A8, 0x119AA, 0x119D1, 0x119D8, 0x119DA, 0x119E0, 0x119E1,
+     0x119E2, 0x119E3, 0x119E4, 0x119E5, 0x11A00, 0x11A01, 0x11A0B, 0x11A33,
+     0x11A34, 0x11A35, 0x11A3A, 0x11A3B, 0x11A3F, 0x11A47, 0x11A48, 0x11A50,
+     0x11A51, 0x11A5C, 0x11A8A, 0x11A99, 0x11A9A, 0x11A9D, 0x11A9E, 0x11AB0,
+     0x11AF9, 0x11C00, 0x11C09, 0x11C0A, 0x11C2F, 0x11C37, 0x11C38, 0x11C3F,
+     0x11C40, 0x11C41, 0x11C50, 0x11C5A, 0x11C72, 0x11C90, 0x11C92, 0x11CA8,
+     0x11CA9, 0x11CB7, 0x11D00, 0x11D07, 0x11D08, 0x11D0A, 0x11D0B, 0x11D31,
+     0x11D37, 0x11D3A, 0x11D3B, 0x11D3C, 0x11D3E, 0x11D3F, 0x11D42, 0x11D43,
+     0x11D44, 0x11D46, 0x11D47, 0x11D48, 0x11D50, 0x11D5A, 0x11D60, 0x11D66,
+     0x11D67, 0x11D69, 0x11D6A, 0x11D8A, 0x11D8F, 0x11D90, 0x11D92, 0x11D93,
+     0x11D97, 0x11D98, 0x11D99, 0x11DA0, 0x11DAA, 0x11EE0, 0x11EF3, 0x11EF7,
+     0x11FB0, 0x11FB1, 0x12000, 0x1239A, 0x12480, 0x12544, 0x12F90, 0x12FF1,
+     0x13000, 0x1342F, 0x14400, 0x14647, 0x16800, 0x16A39, 0x16A40, 0x16A5F,
+     0x16A60, 0x16A6A, 0x16A70, 0x16ABF, 0x16AC0, 0x16ACA, 0x16AD0, 0x16AEE,
+     0x16AF0, 0x16AF5, 0x16B00, 0x16B30, 0x16B37, 0x16B40, 0x16B44, 0x16B50,
+     0x16B5A, 0x16B63, 0x16B78, 0x16B7D, 0x16B90, 0x16E40, 0x16E60, 0x16E80,
+     0x16F00, 0x16F4B, 0x16F4F, 0x16F50, 0x16F51, 0x16F88, 0x16F8F, 0x16F93,
+     0x16FA0, 0x16FE0, 0x16FE2, 0x16FE3, 0x16FE4, 0x16FE5, 0x16FF0, 0x16FF2,
+     0x17000, 0x187F8, 0x18800, 0x18CD6, 0x18D00, 0x18D09, 0x1AFF0, 0x1AFF4,
+     0x1AFF5, 0x1AFFC, 0x1AFFD, 0x1AFFF, 0x1B000, 0x1B123, 0x1B150, 0x1B153,
+     0x1B164, 0x1B168, 0x1B170, 0x1B2FC, 0x1BC00, 0x1BC6B, 0x1BC70, 0x1BC7D,
+     0x1BC80, 0x1BC89, 0x1BC90, 0x1BC9A, 0x1BC9D, 0x1BC9E, 0x1BC9F, 0x1CF00,
+     0x1CF2E, 0x1CF30, 0x1CF47, 0x1D15E, 0x1D165, 0x1D16A, 0x1D16D, 0x1D173,
+     0x1D17B, 0x1D183, 0x1D185, 0x1D18C, 0x1D1AA, 0x1D1AE, 0x1D1BB, 0x1D1C1,
+     0x1D242, 0x1D245, 0x1D400, 0x1D41A, 0x1D434, 0x1D44E, 0x1D455, 0x1D456,
+     0x1D468, 0x1D482, 0x1D49C, 0x1D49D, 0x1D49E, 0x1D4A0, 0x1D4A2, 0x1D4A3,
+     0x1D4A5, 0x1D4A7, 0x1D4A9, 0x1D4AD, 0x1D4AE, 0x1D4B6, 0x1D4BA, 0x1D4BB,
+     0x1D4BC, 0x1D4BD, 0x1D4C4, 0x1D4C5, 0x1D4D0, 0x1D4EA, 0x1D504, 0x1D506,
+     0x1D507, 0x1D50B, 0x1D50D, 0x1D515, 0x1D516, 0x1D51D, 0x1D51E, 0x1D538,
+     0x1D53A, 0x1D53B, 0x1D53F, 0x1D540, 0x1D545, 0x1D546, 0x1D547, 0x1D54A,
+     0x1D551, 0x1D552, 0x1D56C, 0x1D586, 0x1D5A0, 0x1D5BA, 0x1D5D4, 0x1D5EE,
+     0x1D608, 0x1D622, 0x1D63C, 0x1D656, 0x1D670, 0x1D68A, 0x1D6A6, 0x1D6A8,
+     0x1D6C1, 0x1D6C2, 0x1D6DB, 0x1D6DC, 0x1D6E2, 0x1D6FB, 0x1D6FC, 0x1D715,
+     0x1D716, 0x1D71C, 0x1D735, 0x1D736, 0x1D74F, 0x1D750, 0x1D756, 0x1D76F,
+     0x1D770, 0x1D789, 0x1D78A, 0x1D790, 0x1D7A9, 0x1D7AA, 0x1D7C3, 0x1D7C4,
+     0x1D7CA, 0x1D7CB, 0x1D7CC, 0x1D7CE, 0x1D800, 0x1DA00, 0x1DA37, 0x1DA3B,
+     0x1DA6D, 0x1DA75, 0x1DA76, 0x1DA84, 0x1DA85, 0x1DA9B, 0x1DAA0, 0x1DAA1,
+     0x1DAB0, 0x1DF00, 0x1DF0A, 0x1DF0B, 0x1DF1F, 0x1E000, 0x1E007, 0x1E008,
+     0x1E019, 0x1E01B, 0x1E022, 0x1E023, 0x1E025, 0x1E026, 0x1E02B, 0x1E100,
+     0x1E12D, 0x1E130, 0x1E137, 0x1E13E, 0x1E140, 0x1E14A, 0x1E14E, 0x1E14F,
+     0x1E290, 0x1E2AE, 0x1E2AF, 0x1E2C0, 0x1E2EC, 0x1E2F0, 0x1E2FA, 0x1E7E0,
+     0x1E7E7, 0x1E7E8, 0x1E7EC, 0x1E7ED, 0x1E7EF, 0x1E7F0, 0x1E7FF, 0x1E800,
+     0x1E8C5, 0x1E8D0, 0x1E8D7, 0x1E900, 0x1E922, 0x1E944, 0x1E94B, 0x1E94C,
+     0x1E950, 0x1E95A, 0x1EE00, 0x1EE04, 0x1EE05, 0x1EE20, 0x1EE21, 0x1EE23,
+     0x1EE24, 0x1EE25, 0x1EE27, 0x1EE28, 0x1EE29, 0x1EE33, 0x1EE34, 0x1EE38,
+     0x1EE39, 0x1EE3A, 0x1EE3B, 0x1EE3C, 0x1EE42, 0x1EE43, 0x1EE47, 0x1EE48,
+     0x1EE49, 0x1EE4A, 0x1EE4B, 0x1EE4C, 0x1EE4D, 0x1EE50, 0x1EE51, 0x1EE53,
+     0x1EE54, 0x1EE55, 0x1EE57, 0x1EE58, 0x1EE59, 0x1EE5A, 0x1EE5B, 0x1EE5C,
+     0x1EE5D, 0x1EE5E, 0x1EE5F, 0x1EE60, 0x1EE61, 0x1EE63, 0x1EE64, 0x1EE65,
+     0x1EE67, 0x1EE6B, 0x1EE6C, 0x1EE73, 0x1EE74, 0x1EE78, 0x1EE79, 0x1EE7D,
+     0x1EE7E, 0x1EE7F, 0x1EE80, 0x1EE8A, 0x1EE8B, 0x1EE9C, 0x1EEA1, 0x1EEA4,
+     0x1EEA5, 0x1EEAA, 0x1EEAB, 0x1EEBC, 0x1F100, 0x1F10B, 0x1F110, 0x1F12F,
+     0x1F130, 0x1F150, 0x1F16A, 0x1F16D, 0x1F190, 0x1F191, 0x1F200, 0x1F203,
+     0x1F210, 0x1F23C, 0x1F240, 0x1F249, 0x1F250, 0x1F252, 0x1FBF0, 0x1FBFA,
+     0x20000, 0x2A6E0, 0x2A700, 0x2B739, 0x2B740, 0x2B81E, 0x2B820, 0x2CEA2,
+     0x2CEB0, 0x2EBE1, 0x2F800, 0x2FA1E, 0x30000, 0x3134B, 0xE0100, 0xE01F0,
+ };
+ 
+ /* UNICODE_CLASS_* bits of each run */
+ static const unsigned char unicodeClassValues[3312] = {
+     0x20, 0x24, 0x20, 0x29, 0x20, 0x2A, 0x20, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x00, 0x20, 0x00,
+     0x0A, 0x20, 0x00, 0x08, 0x20, 0x00, 0x20, 0x29, 0x20, 0x29, 0x2A, 0x20, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x09,
+     0x0A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x09, 0x0A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x0A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x0A, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x28, 0x29, 0x2A, 0x28, 0x09, 0x0A, 0x09, 0x0A, 0x09, 0x0A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x09, 0x0A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x28, 0x2A, 0x08, 0x28,
+     0x20, 0x28, 0x20, 0x00, 0x20, 0x08, 0x20, 0x28, 0x20, 0x28, 0x20, 0x10, 0x30, 0x10, 0x29, 0x2A,
+     0x29, 0x2A, 0x08, 0x20, 0x29, 0x2A, 0x20, 0x08, 0x2A, 0x00, 0x29, 0x20, 0x00, 0x29, 0x00, 0x29,
+     0x20, 0x29, 0x20, 0x29, 0x2A, 0x29, 0x20, 0x29, 0x2A, 0x29, 0x0A, 0x09, 0x0A, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x0A, 0x2A, 0x09, 0x0A, 0x20, 0x29, 0x2A, 0x09, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x20, 0x10, 0x30, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x20, 0x29, 0x20, 0x28, 0x20,
+     0x2A, 0x0A, 0x2A, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x28, 0x20,
+     0x28, 0x20, 0x10, 0x20, 0x28, 0x10, 0x24, 0x20, 0x28, 0x10, 0x28, 0x08, 0x28, 0x20, 0x28, 0x10,
+     0x20, 0x10, 0x28, 0x10, 0x20, 0x10, 0x28, 0x24, 0x28, 0x20, 0x28, 0x20, 0x28, 0x10, 0x28, 0x10,
+     0x20, 0x28, 0x30, 0x28, 0x20, 0x24, 0x28, 0x10, 0x28, 0x20, 0x28, 0x20, 0x10, 0x20, 0x28, 0x10,
+     0x28, 0x10, 0x28, 0x10, 0x28, 0x10, 0x20, 0x28, 0x10, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20,
+     0x10, 0x28, 0x10, 0x20, 0x10, 0x30, 0x28, 0x30, 0x10, 0x28, 0x30, 0x10, 0x30, 0x28, 0x10, 0x30,
+     0x08, 0x28, 0x30, 0x20, 0x24, 0x20, 0x28, 0x30, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28,
+     0x20, 0x28, 0x20, 0x28, 0x20, 0x10, 0x28, 0x10, 0x30, 0x20, 0x30, 0x20, 0x30, 0x10, 0x28, 0x20,
+     0x10, 0x20, 0x08, 0x20, 0x08, 0x28, 0x30, 0x20, 0x24, 0x28, 0x20, 0x28, 0x20, 0x10, 0x20, 0x30,
+     0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x08, 0x20, 0x28, 0x08, 0x20, 0x28,
+     0x20, 0x10, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x10, 0x20, 0x30, 0x20, 0x08, 0x28, 0x20, 0x08,
+     0x20, 0x24, 0x30, 0x28, 0x30, 0x20, 0x30, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20,
+     0x28, 0x20, 0x28, 0x20, 0x10, 0x28, 0x30, 0x20, 0x30, 0x20, 0x30, 0x10, 0x20, 0x28, 0x20, 0x28,
+     0x30, 0x20, 0x24, 0x20, 0x28, 0x30, 0x20, 0x30, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28,
+     0x20, 0x28, 0x20, 0x28, 0x20, 0x10, 0x28, 0x10, 0x30, 0x20, 0x30, 0x20, 0x30, 0x10, 0x20, 0x30,
+     0x10, 0x20, 0x08, 0x20, 0x28, 0x30, 0x20, 0x24, 0x20, 0x28, 0x20, 0x30, 0x28, 0x20, 0x28, 0x20,
+     0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20,
+     0x10, 0x30, 0x20, 0x30, 0x20, 0x30, 0x10, 0x20, 0x28, 0x20, 0x10, 0x20, 0x24, 0x20, 0x30, 0x28,
+     0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x10, 0x28, 0x30, 0x20, 0x30, 0x20, 0x30, 0x10, 0x20,
+     0x10, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x30, 0x20, 0x24, 0x20, 0x28, 0x30, 0x20, 0x28, 0x20,
+     0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x10, 0x28, 0x30, 0x10, 0x30, 0x20, 0x30, 0x20,
+     0x30, 0x10, 0x20, 0x10, 0x20, 0x28, 0x20, 0x28, 0x30, 0x20, 0x24, 0x20, 0x28, 0x20, 0x30, 0x28,
+     0x20, 0x28, 0x20, 0x28, 0x10, 0x28, 0x10, 0x30, 0x20, 0x30, 0x20, 0x30, 0x10, 0x28, 0x20, 0x28,
+     0x10, 0x20, 0x28, 0x30, 0x20, 0x24, 0x20, 0x28, 0x20, 0x30, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28,
+     0x20, 0x28, 0x20, 0x28, 0x20, 0x10, 0x20, 0x10, 0x30, 0x20, 0x30, 0x20, 0x30, 0x10, 0x20, 0x24,
+     0x20, 0x30, 0x20, 0x28, 0x30, 0x28, 0x08, 0x30, 0x10, 0x20, 0x28, 0x30, 0x10, 0x30, 0x20, 0x24,
+     0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x30, 0x28, 0x08, 0x30,
+     0x10, 0x30, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x10, 0x30, 0x20, 0x24, 0x20, 0x08, 0x28, 0x20,
+     0x28, 0x20, 0x00, 0x20, 0x10, 0x20, 0x24, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x30, 0x28,
+     0x08, 0x28, 0x20, 0x28, 0x08, 0x28, 0x08, 0x28, 0x08, 0x28, 0x08, 0x28, 0x08, 0x28, 0x20, 0x10,
+     0x30, 0x10, 0x20, 0x10, 0x28, 0x30, 0x10, 0x30, 0x20, 0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30,
+     0x10, 0x30, 0x10, 0x30, 0x20, 0x10, 0x20, 0x28, 0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0x28,
+     0x24, 0x20, 0x28, 0x30, 0x28, 0x30, 0x28, 0x30, 0x28, 0x30, 0x28, 0x30, 0x28, 0x30, 0x10, 0x28,
+     0x30, 0x24, 0x30, 0x20, 0x29, 0x20, 0x29, 0x20, 0x29, 0x20, 0x2A, 0x20, 0x08, 0x2A, 0x28, 0x08,
+     0x28, 0x08, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20,
+     0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20,
+     0x28, 0x20, 0x10, 0x20, 0x28, 0x20, 0x29, 0x20, 0x2A, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20,
+     0x28, 0x20, 0x28, 0x20, 0x28, 0x30, 0x10, 0x20, 0x28, 0x30, 0x10, 0x20, 0x28, 0x30, 0x20, 0x28,
+     0x20, 0x28, 0x20, 0x30, 0x20, 0x28, 0x30, 0x10, 0x30, 0x20, 0x28, 0x20, 0x28, 0x10, 0x20, 0x24,
+     0x20, 0x30, 0x20, 0x30, 0x24, 0x20, 0x28, 0x20, 0x28, 0x30, 0x28, 0x10, 0x28, 0x20, 0x28, 0x20,
+     0x28, 0x20, 0x30, 0x20, 0x30, 0x10, 0x20, 0x24, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20,
+     0x24, 0x20, 0x28, 0x10, 0x30, 0x20, 0x28, 0x30, 0x20, 0x10, 0x30, 0x10, 0x20, 0x10, 0x24, 0x20,
+     0x24, 0x20, 0x28, 0x20, 0x10, 0x30, 0x10, 0x20, 0x30, 0x28, 0x10, 0x30, 0x10, 0x28, 0x20, 0x24,
+     0x20, 0x10, 0x20, 0x30, 0x28, 0x30, 0x10, 0x30, 0x28, 0x24, 0x28, 0x10, 0x30, 0x10, 0x20, 0x28,
+     0x30, 0x10, 0x20, 0x24, 0x20, 0x28, 0x24, 0x28, 0x20, 0x2A, 0x20, 0x29, 0x20, 0x29, 0x20, 0x10,
+     0x20, 0x10, 0x30, 0x10, 0x28, 0x10, 0x28, 0x10, 0x28, 0x30, 0x10, 0x28, 0x20, 0x2A, 0x08, 0x28,
+     0x08, 0x28, 0x08, 0x28, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x10, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x0A, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x20, 0x29, 0x20, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x20, 0x29,
+     0x20, 0x2A, 0x20, 0x29, 0x20, 0x29, 0x20, 0x29, 0x20, 0x29, 0x2A, 0x29, 0x2A, 0x0A, 0x2A, 0x0A,
+     0x2A, 0x0A, 0x2A, 0x0A, 0x2A, 0x0A, 0x2A, 0x0A, 0x2A, 0x0A, 0x20, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x20, 0x2A, 0x29, 0x09, 0x29, 0x00, 0x0A, 0x00, 0x2A, 0x20, 0x2A, 0x29, 0x09, 0x29,
+     0x09, 0x29, 0x00, 0x2A, 0x0A, 0x20, 0x2A, 0x29, 0x09, 0x20, 0x00, 0x2A, 0x0A, 0x2A, 0x29, 0x09,
+     0x29, 0x00, 0x20, 0x2A, 0x20, 0x2A, 0x29, 0x09, 0x29, 0x09, 0x29, 0x00, 0x20, 0x00, 0x20, 0x00,
+     0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+     0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x20, 0x00, 0x08, 0x00, 0x20, 0x08, 0x20, 0x00, 0x20,
+     0x10, 0x30, 0x10, 0x30, 0x10, 0x20, 0x00, 0x09, 0x00, 0x20, 0x00, 0x09, 0x20, 0x00, 0x0A, 0x09,
+     0x0A, 0x09, 0x0A, 0x20, 0x09, 0x00, 0x20, 0x09, 0x20, 0x00, 0x20, 0x09, 0x20, 0x09, 0x20, 0x09,
+     0x20, 0x09, 0x20, 0x0A, 0x09, 0x29, 0x09, 0x0A, 0x08, 0x0A, 0x20, 0x00, 0x0A, 0x09, 0x00, 0x20,
+     0x09, 0x0A, 0x20, 0x2A, 0x20, 0x00, 0x20, 0x29, 0x2A, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20,
+     0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x08, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x20, 0x29, 0x2A, 0x29, 0x2A, 0x10, 0x29, 0x2A, 0x20, 0x2A, 0x20, 0x2A, 0x20, 0x2A, 0x20,
+     0x28, 0x20, 0x08, 0x20, 0x10, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28,
+     0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x10, 0x20, 0x28, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+     0x20, 0x00, 0x20, 0x28, 0x20, 0x10, 0x20, 0x28, 0x00, 0x20, 0x00, 0x28, 0x20, 0x28, 0x20, 0x10,
+     0x00, 0x28, 0x08, 0x20, 0x28, 0x20, 0x28, 0x08, 0x20, 0x28, 0x20, 0x08, 0x20, 0x00, 0x28, 0x20,
+     0x28, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20,
+     0x28, 0x24, 0x28, 0x20, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x28, 0x10, 0x30, 0x20, 0x10, 0x20, 0x28, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x08, 0x10, 0x28, 0x20, 0x10, 0x20, 0x28, 0x20, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x08, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29,
+     0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x28, 0x20, 0x29, 0x2A, 0x29, 0x2A, 0x28,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A,
+     0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x20, 0x29,
+     0x2A, 0x20, 0x2A, 0x20, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x20, 0x08, 0x29, 0x2A, 0x28, 0x08, 0x2A,
+     0x28, 0x30, 0x28, 0x10, 0x28, 0x30, 0x28, 0x30, 0x20, 0x10, 0x20, 0x28, 0x20, 0x30, 0x28, 0x30,
+     0x10, 0x30, 0x20, 0x24, 0x20, 0x10, 0x28, 0x20, 0x28, 0x20, 0x28, 0x30, 0x24, 0x28, 0x30, 0x10,
+     0x20, 0x28, 0x30, 0x10, 0x20, 0x28, 0x20, 0x30, 0x28, 0x10, 0x30, 0x10, 0x20, 0x28, 0x24, 0x20,
+     0x28, 0x30, 0x28, 0x24, 0x28, 0x20, 0x28, 0x30, 0x20, 0x28, 0x30, 0x28, 0x30, 0x20, 0x24, 0x20,
+     0x28, 0x20, 0x28, 0x30, 0x28, 0x10, 0x28, 0x10, 0x28, 0x10, 0x28, 0x10, 0x28, 0x10, 0x28, 0x20,
+     0x28, 0x20, 0x28, 0x30, 0x20, 0x28, 0x30, 0x10, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28,
+     0x20, 0x28, 0x20, 0x2A, 0x20, 0x08, 0x2A, 0x08, 0x20, 0x2A, 0x28, 0x30, 0x20, 0x30, 0x10, 0x20,
+     0x24, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x00, 0x20, 0x08, 0x28, 0x08, 0x28, 0x08, 0x28,
+     0x08, 0x28, 0x08, 0x28, 0x08, 0x28, 0x08, 0x28, 0x08, 0x20, 0x08, 0x20, 0x0A, 0x20, 0x0A, 0x20,
+     0x08, 0x10, 0x08, 0x00, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20,
+     0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x00, 0x20, 0x30, 0x00, 0x20, 0x10, 0x00, 0x20, 0x00,
+     0x20, 0x00, 0x20, 0x00, 0x20, 0x08, 0x28, 0x08, 0x20, 0x08, 0x20, 0x00, 0x04, 0x00, 0x09, 0x00,
+     0x0A, 0x00, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x00, 0x20, 0x00, 0x20,
+     0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x10, 0x20,
+     0x28, 0x20, 0x28, 0x20, 0x10, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x10, 0x20, 0x28,
+     0x20, 0x28, 0x20, 0x28, 0x20, 0x29, 0x2A, 0x28, 0x20, 0x24, 0x20, 0x29, 0x20, 0x2A, 0x20, 0x28,
+     0x20, 0x28, 0x20, 0x29, 0x20, 0x29, 0x20, 0x29, 0x20, 0x29, 0x20, 0x2A, 0x20, 0x2A, 0x20, 0x2A,
+     0x20, 0x2A, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20,
+     0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20,
+     0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x30, 0x20, 0x30,
+     0x20, 0x30, 0x10, 0x30, 0x10, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x10, 0x20, 0x10, 0x20, 0x28,
+     0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x10, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20,
+     0x28, 0x20, 0x29, 0x20, 0x2A, 0x20, 0x28, 0x10, 0x20, 0x24, 0x20, 0x28, 0x20, 0x10, 0x20, 0x28,
+     0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x10, 0x20, 0x28, 0x10, 0x20, 0x28, 0x20, 0x28, 0x20, 0x30,
+     0x28, 0x30, 0x10, 0x20, 0x24, 0x10, 0x28, 0x30, 0x28, 0x20, 0x10, 0x30, 0x28, 0x30, 0x10, 0x20,
+     0x30, 0x20, 0x28, 0x20, 0x24, 0x20, 0x10, 0x28, 0x10, 0x30, 0x10, 0x20, 0x24, 0x20, 0x28, 0x30,
+     0x28, 0x20, 0x28, 0x10, 0x20, 0x28, 0x20, 0x30, 0x28, 0x30, 0x10, 0x28, 0x20, 0x30, 0x10, 0x30,
+     0x20, 0x30, 0x24, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x30, 0x10, 0x30, 0x20, 0x30, 0x20,
+     0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x30, 0x10, 0x20, 0x24, 0x20,
+     0x30, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x10, 0x28,
+     0x10, 0x30, 0x20, 0x30, 0x20, 0x30, 0x10, 0x20, 0x28, 0x20, 0x10, 0x20, 0x28, 0x30, 0x20, 0x10,
+     0x20, 0x10, 0x20, 0x28, 0x30, 0x10, 0x30, 0x10, 0x28, 0x20, 0x24, 0x20, 0x10, 0x28, 0x20, 0x28,
+     0x10, 0x30, 0x10, 0x30, 0x10, 0x30, 0x10, 0x28, 0x20, 0x28, 0x20, 0x24, 0x20, 0x28, 0x10, 0x30,
+     0x20, 0x30, 0x10, 0x20, 0x28, 0x30, 0x20, 0x28, 0x30, 0x10, 0x30, 0x20, 0x28, 0x20, 0x24, 0x20,
+     0x28, 0x30, 0x10, 0x28, 0x20, 0x24, 0x20, 0x28, 0x20, 0x30, 0x10, 0x20, 0x24, 0x20, 0x28, 0x20,
+     0x28, 0x30, 0x10, 0x20, 0x29, 0x2A, 0x24, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20,
+     0x28, 0x10, 0x30, 0x20, 0x30, 0x20, 0x30, 0x10, 0x28, 0x30, 0x28, 0x30, 0x10, 0x20, 0x24, 0x20,
+     0x28, 0x20, 0x28, 0x30, 0x20, 0x30, 0x10, 0x28, 0x20, 0x28, 0x30, 0x20, 0x28, 0x30, 0x28, 0x30,
+     0x10, 0x30, 0x28, 0x30, 0x20, 0x10, 0x20, 0x28, 0x30, 0x28, 0x30, 0x10, 0x20, 0x28, 0x20, 0x28,
+     0x20, 0x28, 0x20, 0x28, 0x30, 0x20, 0x30, 0x10, 0x28, 0x20, 0x24, 0x20, 0x28, 0x20, 0x30, 0x20,
+     0x30, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x10, 0x30,
+     0x10, 0x28, 0x30, 0x20, 0x24, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x30, 0x20, 0x30, 0x20, 0x30,
+     0x10, 0x28, 0x20, 0x24, 0x20, 0x28, 0x30, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20,
+     0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x24, 0x20, 0x28, 0x20, 0x24, 0x20, 0x28, 0x20,
+     0x10, 0x20, 0x28, 0x10, 0x20, 0x28, 0x20, 0x24, 0x20, 0x28, 0x20, 0x28, 0x20, 0x29, 0x2A, 0x20,
+     0x28, 0x20, 0x30, 0x28, 0x30, 0x20, 0x30, 0x28, 0x20, 0x28, 0x20, 0x28, 0x30, 0x20, 0x10, 0x20,
+     0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20,
+     0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x30, 0x10, 0x20, 0x30,
+     0x20, 0x30, 0x20, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x00, 0x20,
+     0x10, 0x20, 0x09, 0x0A, 0x09, 0x0A, 0x20, 0x0A, 0x09, 0x0A, 0x09, 0x20, 0x09, 0x20, 0x09, 0x20,
+     0x09, 0x20, 0x09, 0x20, 0x09, 0x0A, 0x20, 0x0A, 0x20, 0x0A, 0x20, 0x0A, 0x09, 0x0A, 0x09, 0x20,
+     0x09, 0x20, 0x09, 0x20, 0x09, 0x20, 0x0A, 0x09, 0x20, 0x09, 0x20, 0x09, 0x20, 0x09, 0x20, 0x09,
+     0x20, 0x0A, 0x09, 0x0A, 0x09, 0x0A, 0x09, 0x0A, 0x09, 0x0A, 0x09, 0x0A, 0x09, 0x0A, 0x20, 0x09,
+     0x00, 0x0A, 0x00, 0x0A, 0x09, 0x00, 0x0A, 0x00, 0x0A, 0x09, 0x00, 0x0A, 0x00, 0x0A, 0x09, 0x00,
+     0x0A, 0x00, 0x0A, 0x09, 0x00, 0x0A, 0x00, 0x0A, 0x09, 0x0A, 0x20, 0x04, 0x20, 0x30, 0x20, 0x30,
+     0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x2A, 0x28, 0x2A, 0x20, 0x10, 0x20, 0x10,
+     0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x28, 0x20, 0x10, 0x28, 0x20, 0x24, 0x20, 0x28, 0x20,
+     0x28, 0x10, 0x20, 0x28, 0x10, 0x24, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28,
+     0x20, 0x10, 0x20, 0x29, 0x2A, 0x10, 0x28, 0x20, 0x24, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20,
+     0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20,
+     0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20,
+     0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20,
+     0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x00, 0x20, 0x00, 0x20,
+     0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x04, 0x20,
+     0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x28, 0x20, 0x08, 0x20, 0x28, 0x20, 0x30, 0x20,
+ };
+ 
+ /* First code point of each run of equal canonical combining classes */
+ static const uint32_t combiningClassStarts[571] = {
+     0x0, 0x300, 0x315, 0x316, 0x31A, 0x31B, 0x31C, 0x321,
+     0x323, 0x327, 0x329, 0x334, 0x339, 0x33D, 0x345, 0x346,
+     0x347, 0x34A, 0x34D, 0x34F, 0x350, 0x353, 0x357, 0x358,
+     0x359, 0x35B, 0x35C, 0x35D, 0x35F, 0x360, 0x362, 0x363,
+     0x370, 0x483, 0x488, 0x591, 0x592, 0x596, 0x597, 0x59A,
+     0x59B, 0x59C, 0x5A2, 0x5A8, 0x5AA, 0x5AB, 0x5AD, 0x5AE,
+     0x5AF, 0x5B0, 0x5B1, 0x5B2, 0x5B3, 0x5B4, 0x5B5, 0x5B6,
+     0x5B7, 0x5B8, 0x5B9, 0x5BB, 0x5BC, 0x5BD, 0x5BE, 0x5BF,
+     0x5C0, 0x5C1, 0x5C2, 0x5C3, 0x5C4, 0x5C5, 0x5C6, 0x5C7,
+     0x5C8, 0x610, 0x618, 0x619, 0x61A, 0x61B, 0x64B, 0x64C,
+     0x64D, 0x64E, 0x64F, 0x650, 0x651, 0x652, 0x653, 0x655,
+     0x657, 0x65C, 0x65D, 0x65F, 0x660, 0x670, 0x671, 0x6D6,
+     0x6DD, 0x6DF, 0x6E3, 0x6E4, 0x6E5, 0x6E7, 0x6E9, 0x6EA,
+     0x6EB, 0x6ED, 0x6EE, 0x711, 0x712, 0x730, 0x731, 0x732,
+     0x734, 0x735, 0x737, 0x73A, 0x73B, 0x73D, 0x73E, 0x73F,
+     0x742, 0x743, 0x744, 0x745, 0x746, 0x747, 0x748, 0x749,
+     0x74B, 0x7EB, 0x7F2, 0x7F3, 0x7F4, 0x7FD, 0x7FE, 0x816,
+     0x81A, 0x81B, 0x824, 0x825, 0x828, 0x829, 0x82E, 0x859,
+     0x85C, 0x898, 0x899, 0x89C, 0x8A0, 0x8CA, 0x8CF, 0x8D4,
+     0x8E2, 0x8E3, 0x8E4, 0x8E6, 0x8E7, 0x8E9, 0x8EA, 0x8ED,
+     0x8F0, 0x8F1, 0x8F2, 0x8F3, 0x8F6, 0x8F7, 0x8F9, 0x8FB,
+     0x900, 0x93C, 0x93D, 0x94D, 0x94E, 0x951, 0x952, 0x953,
+     0x955, 0x9BC, 0x9BD, 0x9CD, 0x9CE, 0x9FE, 0x9FF, 0xA3C,
+     0xA3D, 0xA4D, 0xA4E, 0xABC, 0xABD, 0xACD, 0xACE, 0xB3C,
+     0xB3D, 0xB4D, 0xB4E, 0xBCD, 0xBCE, 0xC3C, 0xC3D, 0xC4D,
+     0xC4E, 0xC55, 0xC56, 0xC57, 0xCBC, 0xCBD, 0xCCD, 0xCCE,
+     0xD3B, 0xD3D, 0xD4D, 0xD4E, 0xDCA, 0xDCB, 0xE38, 0xE3A,
+     0xE3B, 0xE48, 0xE4C, 0xEB8, 0xEBA, 0xEBB, 0xEC8, 0xECC,
+     0xF18, 0xF1A, 0xF35, 0xF36, 0xF37, 0xF38, 0xF39, 0xF3A,
+     0xF71, 0xF72, 0xF73, 0xF74, 0xF75, 0xF7A, 0xF7E, 0xF80,
+     0xF81, 0xF82, 0xF84, 0xF85, 0xF86, 0xF88, 0xFC6, 0xFC7,
+     0x1037, 0x1038, 0x1039, 0x103B, 0x108D, 0x108E, 0x135D, 0x1360,
+     0x1714, 0x1716, 0x1734, 0x1735, 0x17D2, 0x17D3, 0x17DD, 0x17DE,
+     0x18A9, 0x18AA, 0x1939, 0x193A, 0x193B, 0x193C, 0x1A17, 0x1A18,
+     0x1A19, 0x1A60, 0x1A61, 0x1A75, 0x1A7D, 0x1A7F, 0x1A80, 0x1AB0,
+     0x1AB5, 0x1ABB, 0x1ABD, 0x1ABE, 0x1ABF, 0x1AC1, 0x1AC3, 0x1AC5,
+     0x1ACA, 0x1ACB, 0x1ACF, 0x1B34, 0x1B35, 0x1B44, 0x1B45, 0x1B6B,
+     0x1B6C, 0x1B6D, 0x1B74, 0x1BAA, 0x1BAC, 0x1BE6, 0x1BE7, 0x1BF2,
+     0x1BF4, 0x1C37, 0x1C38, 0x1CD0, 0x1CD3, 0x1CD4, 0x1CD5, 0x1CDA,
+     0x1CDC, 0x1CE0, 0x1CE1, 0x1CE2, 0x1CE9, 0x1CED, 0x1CEE, 0x1CF4,
+     0x1CF5, 0x1CF8, 0x1CFA, 0x1DC0, 0x1DC2, 0x1DC3, 0x1DCA, 0x1DCB,
+     0x1DCD, 0x1DCE, 0x1DCF, 0x1DD0, 0x1DD1, 0x1DF6, 0x1DF7, 0x1DF9,
+     0x1DFA, 0x1DFB, 0x1DFC, 0x1DFD, 0x1DFE, 0x1DFF, 0x1E00, 0x20D0,
+     0x20D2, 0x20D4, 0x20D8, 0x20DB, 0x20DD, 0x20E1, 0x20E2, 0x20E5,
+     0x20E7, 0x20E8, 0x20E9, 0x20EA, 0x20EC, 0x20F0, 0x20F1, 0x2CEF,
+     0x2CF2, 0x2D7F, 0x2D80, 0x2DE0, 0x2E00, 0x302A, 0x302B, 0x302C,
+     0x302D, 0x302E, 0x3030, 0x3099, 0x309B, 0xA66F, 0xA670, 0xA674,
+     0xA67E, 0xA69E, 0xA6A0, 0xA6F0, 0xA6F2, 0xA806, 0xA807, 0xA82C,
+     0xA82D, 0xA8C4, 0xA8C5, 0xA8E0, 0xA8F2, 0xA92B, 0xA92E, 0xA953,
+     0xA954, 0xA9B3, 0xA9B4, 0xA9C0, 0xA9C1, 0xAAB0, 0xAAB1, 0xAAB2,
+     0xAAB4, 0xAAB5, 0xAAB7, 0xAAB9, 0xAABE, 0xAAC0, 0xAAC1, 0xAAC2,
+     0xAAF6, 0xAAF7, 0xABED, 0xABEE, 0xFB1E, 0xFB1F, 0xFE20, 0xFE27,
+     0xFE2E, 0xFE30, 0x101FD, 0x101FE, 0x102E0, 0x102E1, 0x10376, 0x1037B,
+     0x10A0D, 0x10A0E, 0x10A0F, 0x10A10, 0x10A38, 0x10A39, 0x10A3A, 0x10A3B,
+     0x10A3F, 0x10A40, 0x10AE5, 0x10AE6, 0x10AE7, 0x10D24, 0x10D28, 0x10EAB,
+     0x10EAD, 0x10F46, 0x10F48, 0x10F4B, 0x10F4C, 0x10F4D, 0x10F51, 0x10F82,
+     0x10F83, 0x10F84, 0x10F85, 0x10F86, 0x11046, 0x11047, 0x11070, 0x11071,
+     0x1107F, 0x11080, 0x110B9, 0x110BA, 0x110BB, 0x11100, 0x11103, 0x11133,
+     0x11135, 0x11173, 0x11174, 0x111C0, 0x111C1, 0x111CA, 0x111CB, 0x11235,
+     0x11236, 0x11237, 0x112E9, 0x112EA, 0x112EB, 0x1133B, 0x1133D, 0x1134D,
+     0x1134E, 0x11366, 0x1136D, 0x11370, 0x11375, 0x11442, 0x11443, 0x11446,
+     0x11447, 0x1145E, 0x1145F, 0x114C2, 0x114C3, 0x114C4, 0x115BF, 0x115C0,
+     0x115C1, 0x1163F, 0x11640, 0x116B6, 0x116B7, 0x116B8, 0x1172B, 0x1172C,
+     0x11839, 0x1183A, 0x1183B, 0x1193D, 0x1193F, 0x11943, 0x11944, 0x119E0,
+     0x119E1, 0x11A34, 0x11A35, 0x11A47, 0x11A48, 0x11A99, 0x11A9A, 0x11C3F,
+     0x11C40, 0x11D42, 0x11D43, 0x11D44, 0x11D46, 0x11D97, 0x11D98, 0x16AF0,
+     0x16AF5, 0x16B30, 0x16B37, 0x16FF0, 0x16FF2, 0x1BC9E, 0x1BC9F, 0x1D165,
+     0x1D167, 0x1D16A, 0x1D16D, 0x1D16E, 0x1D173, 0x1D17B, 0x1D183, 0x1D185,
+     0x1D18A, 0x1D18C, 0x1D1AA, 0x1D1AE, 0x1D242, 0x1D245, 0x1E000, 0x1E007,
+     0x1E008, 0x1E019, 0x1E01B, 0x1E022, 0x1E023, 0x1E025, 0x1E026, 0x1E02B,
+     0x1E130, 0x1E137, 0x1E2AE, 0x1E2AF, 0x1E2EC, 0x1E2F0, 0x1E8D0, 0x1E8D7,
+     0x1E944, 0x1E94A, 0x1E94B,
+ };
+ 
+ /* Canonical combining class of each run */
+ static const unsigned char combiningClassValues[571] = {
+     0, 230, 232, 220, 232, 216, 220, 202, 220, 202, 220, 1, 220, 230, 240, 230,
+     220, 230, 220, 0, 230, 220, 230, 232, 220, 230, 233, 234, 233, 234, 233, 230,
+     0, 230, 0, 220, 230, 220, 230, 222, 220, 230, 220, 230, 220, 230, 222, 228,
+     230, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 0, 23,
+     0, 24, 25, 0, 230, 220, 0, 18, 0, 230, 30, 31, 32, 0, 27, 28,
+     29, 30, 31, 32, 33, 34, 230, 220, 230, 220, 230, 220, 0, 35, 0, 230,
+     0, 230, 220, 230, 0, 230, 0, 220, 230, 220, 0, 36, 0, 230, 220, 230,
+     220, 230, 220, 230, 220, 230, 220, 230, 220, 230, 220, 230, 220, 230, 220, 230,
+     0, 230, 220, 230, 0, 220, 0, 230, 0, 230, 0, 230, 0, 230, 0, 220,
+     0, 230, 220, 230, 0, 230, 220, 230, 0, 220, 230, 220, 230, 220, 230, 220,
+     27, 28, 29, 230, 220, 230, 220, 230, 0, 7, 0, 9, 0, 230, 220, 230,
+     0, 7, 0, 9, 0, 230, 0, 7, 0, 9, 0, 7, 0, 9, 0, 7,
+     0, 9, 0, 9, 0, 7, 0, 9, 0, 84, 91, 0, 7, 0, 9, 0,
+     9, 0, 9, 0, 9, 0, 103, 9, 0, 107, 0, 118, 9, 0, 122, 0,
+     220, 0, 220, 0, 220, 0, 216, 0, 129, 130, 0, 132, 0, 130, 0, 130,
+     0, 230, 9, 0, 230, 0, 220, 0, 7, 0, 9, 0, 220, 0, 230, 0,
+     9, 0, 9, 0, 9, 0, 230, 0, 228, 0, 222, 230, 220, 0, 230, 220,
+     0, 9, 0, 230, 0, 220, 0, 230, 220, 230, 220, 0, 220, 230, 220, 230,
+     220, 230, 0, 7, 0, 9, 0, 230, 220, 230, 0, 9, 0, 7, 0, 9,
+     0, 7, 0, 230, 0, 1, 220, 230, 220, 230, 0, 1, 0, 220, 0, 230,
+     0, 230, 0, 230, 220, 230, 220, 230, 234, 214, 220, 202, 230, 232, 228, 220,
+     218, 230, 233, 220, 230, 220, 0, 230, 1, 230, 1, 230, 0, 230, 0, 1,
+     230, 220, 230, 1, 220, 230, 0, 230, 0, 9, 0, 230, 0, 218, 228, 232,
+     222, 224, 0, 8, 0, 230, 0, 230, 0, 230, 0, 230, 0, 9, 0, 9,
+     0, 9, 0, 230, 0, 220, 0, 9, 0, 7, 0, 9, 0, 230, 0, 230,
+     220, 0, 230, 0, 230, 0, 230, 0, 9, 0, 9, 0, 26, 0, 230, 220,
+     230, 0, 220, 0, 220, 0, 230, 0, 220, 0, 230, 0, 230, 1, 220, 0,
+     9, 0, 230, 220, 0, 230, 0, 230, 0, 220, 230, 220, 230, 220, 0, 230,
+     220, 230, 220, 0, 9, 0, 9, 0, 9, 0, 9, 7, 0, 230, 0, 9,
+     0, 7, 0, 9, 0, 7, 0, 9, 7, 0, 7, 9, 0, 7, 0, 9,
+     0, 230, 0, 230, 0, 9, 0, 7, 0, 230, 0, 9, 7, 0, 9, 7,
+     0, 9, 0, 9, 7, 0, 9, 0, 9, 7, 0, 9, 0, 7, 0, 9,
+     0, 9, 0, 9, 0, 9, 0, 9, 0, 7, 0, 9, 0, 9, 0, 1,
+     0, 230, 0, 6, 0, 1, 0, 216, 1, 0, 226, 216, 0, 220, 0, 230,
+     220, 0, 230, 0, 230, 0, 230, 0, 230, 0, 230, 0, 230, 0, 230, 0,
+     230, 0, 230, 0, 230, 0, 220, 0, 230, 7, 0,
+ };
+ 
+ /* Code points whose NFKD differs from themselves, Hangul syllables excepted */
+ static const uint32_t decompositionKeys[5795] = {
+     0xA0, 0xA8, 0xAA, 0xAF, 0xB2, 0xB3, 0xB4, 0xB5,
+     0xB8, 0xB9, 0xBA, 0xBC, 0xBD, 0xBE, 0xC0, 0xC1,
+     0xC2, 0xC3, 0xC4, 0xC5, 0xC7, 0xC8, 0xC9, 0xCA,
+     0xCB, 0xCC, 0xCD, 0xCE, 0xCF, 0xD1, 0xD2, 0xD3,
+     0xD4, 0xD5, 0xD6, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD,
+     0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE7, 0xE8,
+     0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF1,
+     0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF9, 0xFA, 0xFB,
+     0xFC, 0xFD, 0xFF, 0x100, 0x101, 0x102, 0x103, 0x104,
+     0x105, 0x106, 0x107, 0x108, 0x109, 0x10A, 0x10B, 0x10C,
+     0x10D, 0x10E, 0x10F, 0x112, 0x113, 0x114, 0x115, 0x116,
+     0x117, 0x118, 0x119, 0x11A, 0x11B, 0x11C, 0x11D, 0x11E,
+     0x11F, 0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x128,
+     0x129, 0x12A, 0x12B, 0x12C, 0x12D, 0x12E, 0x12F, 0x130,
+     0x132, 0x133, 0x134, 0x135, 0x136, 0x137, 0x139, 0x13A,
+     0x13B, 0x13C, 0x13D, 0x13E, 0x13F, 0x140, 0x143, 0x144,
+     0x145, 0x146, 0x147, 0x148, 0x149, 0x14C, 0x14D, 0x14E,
+     0x14F, 0x150, 0x151, 0x154, 0x155, 0x156, 0x157, 0x158,
+     0x159, 0x15A, 0x15B, 0x15C, 0x15D, 0x15E, 0x15F, 0x160,
+     0x161, 0x162, 0x163, 0x164, 0x165, 0x168, 0x169, 0x16A,
+     0x16B, 0x16C, 0x16D, 0x16E, 0x16F, 0x170, 0x171, 0x172,
+     0x173, 0x174, 0x175, 0x176, 0x177, 0x178, 0x179, 0x17A,
+     0x17B, 0x17C, 0x17D, 0x17E, 0x17F, 0x1A0, 0x1A1, 0x1AF,
+     0x1B0, 0x1C4, 0x1C5, 0x1C6, 0x1C7, 0x1C8, 0x1C9, 0x1CA,
+     0x1CB, 0x1CC, 0x1CD, 0x1CE, 0x1CF, 0x1D0, 0x1D1, 0x1D2,
+     0x1D3, 0x1D4, 0x1D5, 0x1D6, 0x1D7, 0x1D8, 0x1D9, 0x1DA,
+     0x1DB, 0x1DC, 0x1DE, 0x1DF, 0x1E0, 0x1E1, 0x1E2, 0x1E3,
+     0x1E6, 0x1E7, 0x1E8, 0x1E9, 0x1EA, 0x1EB, 0x1EC, 0x1ED,
+     0x1EE, 0x1EF, 0x1F0, 0x1F1, 0x1F2, 0x1F3, 0x1F4, 0x1F5,
+     0x1F8, 0x1F9, 0x1FA, 0x1FB, 0x1FC, 0x1FD, 0x1FE, 0x1FF,
+     0x200, 0x201, 0x202, 0x203, 0x204, 0x205, 0x206, 0x207,
+     0x208, 0x209, 0x20A, 0x20B, 0x20C, 0x20D, 0x20E, 0x20F,
+     0x210, 0x211, 0x212, 0x213, 0x214, 0x215, 0x216, 0x217,
+     0x218, 0x219, 0x21A, 0x21B, 0x21E, 0x21F, 0x226, 0x227,
+     0x228, 0x229, 0x22A, 0x22B, 0x22C, 0x22D, 0x22E, 0x22F,
+     0x230, 0x231, 0x232, 0x233, 0x2B0, 0x2B1, 0x2B2, 0x2B3,
+     0x2B4, 0x2B5, 0x2B6, 0x2B7, 0x2B8, 0x2D8, 0x2D9, 0x2DA,
+     0x2DB, 0x2DC, 0x2DD, 0x2E0, 0x2E1, 0x2E2, 0x2E3, 0x2E4,
+     0x340, 0x341, 0x343, 0x344, 0x374, 0x37A, 0x37E, 0x384,
+     0x385, 0x386, 0x387, 0x388, 0x389, 0x38A, 0x38C, 0x38E,
+     0x38F, 0x390, 0x3AA, 0x3AB, 0x3AC, 0x3AD, 0x3AE, 0x3AF,
+     0x3B0, 0x3CA, 0x3CB, 0x3CC, 0x3CD, 0x3CE, 0x3D0, 0x3D1,
+     0x3D2, 0x3D3, 0x3D4, 0x3D5, 0x3D6, 0x3F0, 0x3F1, 0x3F2,
+     0x3F4, 0x3F5, 0x3F9, 0x400, 0x401, 0x403, 0x407, 0x40C,
+     0x40D, 0x40E, 0x419, 0x439, 0x450, 0x451, 0x453, 0x457,
+     0x45C, 0x45D, 0x45E, 0x476, 0x477, 0x4C1, 0x4C2, 0x4D0,
+     0x4D1, 0x4D2, 0x4D3, 0x4D6, 0x4D7, 0x4DA, 0x4DB, 0x4DC,
+     0x4DD, 0x4DE, 0x4DF, 0x4E2, 0x4E3, 0x4E4, 0x4E5, 0x4E6,
+     0x4E7, 0x4EA, 0x4EB, 0x4EC, 0x4ED, 0x4EE, 0x4EF, 0x4F0,
+     0x4F1, 0x4F2, 0x4F3, 0x4F4, 0x4F5, 0x4F8, 0x4F9, 0x587,
+     0x622, 0x623, 0x624, 0x625, 0x626, 0x675, 0x676, 0x677,
+     0x678, 0x6C0, 0x6C2, 0x6D3, 0x929, 0x931, 0x934, 0x958,
+     0x959, 0x95A, 0x95B, 0x95C, 0x95D, 0x95E, 0x95F, 0x9CB,
+     0x9CC, 0x9DC, 0x9DD, 0x9DF, 0xA33, 0xA36, 0xA59, 0xA5A,
+     0xA5B, 0xA5E, 0xB48, 0xB4B, 0xB4C, 0xB5C, 0xB5D, 0xB94,
+     0xBCA, 0xBCB, 0xBCC, 0xC48, 0xCC0, 0xCC7, 0xCC8, 0xCCA,
+     0xCCB, 0xD4A, 0xD4B, 0xD4C, 0xDDA, 0xDDC, 0xDDD, 0xDDE,
+     0xE33, 0xEB3, 0xEDC, 0xEDD, 0xF0C, 0xF43, 0xF4D, 0xF52,
+     0xF57, 0xF5C, 0xF69, 0xF73, 0xF75, 0xF76, 0xF77, 0xF78,
+     0xF79, 0xF81, 0xF93, 0xF9D, 0xFA2, 0xFA7, 0xFAC, 0xFB9,
+     0x1026, 0x10FC, 0x1B06, 0x1B08, 0x1B0A, 0x1B0C, 0x1B0E, 0x1B12,
+     0x1B3B, 0x1B3D, 0x1B40, 0x1B41, 0x1B43, 0x1D2C, 0x1D2D, 0x1D2E,
+     0x1D30, 0x1D31, 0x1D32, 0x1D33, 0x1D34, 0x1D35, 0x1D36, 0x1D37,
+     0x1D38, 0x1D39, 0x1D3A, 0x1D3C, 0x1D3D, 0x1D3E, 0x1D3F, 0x1D40,
+     0x1D41, 0x1D42, 0x1D43, 0x1D44, 0x1D45, 0x1D46, 0x1D47, 0x1D48,
+     0x1D49, 0x1D4A, 0x1D4B, 0x1D4C, 0x1D4D, 0x1D4F, 0x1D50, 0x1D51,
+     0x1D52, 0x1D53, 0x1D54, 0x1D55, 0x1D56, 0x1D57, 0x1D58, 0x1D59,
+     0x1D5A, 0x1D5B, 0x1D5C, 0x1D5D, 0x1D5E, 0x1D5F, 0x1D60, 0x1D61,
+     0x1D62, 0x1D63, 0x1D64, 0x1D65, 0x1D66, 0x1D67, 0x1D68, 0x1D69,
+     0x1D6A, 0x1D78, 0x1D9B, 0x1D9C, 0x1D9D, 0x1D9E, 0x1D9F, 0x1DA0,
+     0x1DA1, 0x1DA2, 0x1DA3, 0x1DA4, 0x1DA5, 0x1DA6, 0x1DA7, 0x1DA8,
+     0x1DA9, 0x1DAA, 0x1DAB, 0x1DAC, 0x1DAD, 0x1DAE, 0x1DAF, 0x1DB0,
+     0x1DB1, 0x1DB2, 0x1DB3, 0x1DB4, 0x1DB5, 0x1DB6, 0x1DB7, 0x1DB8,
+     0x1DB9, 0x1DBA, 0x1DBB, 0x1DBC, 0x1DBD, 0x1DBE, 0x1DBF, 0x1E00,
+     0x1E01, 0x1E02, 0x1E03, 0x1E04, 0x1E05, 0x1E06, 0x1E07, 0x1E08,
+     0x1E09, 0x1E0A, 0x1E0B, 0x1E0C, 0x1E0D, 0x1E0E, 0x1E0F, 0x1E10,
+     0x1E11, 0x1E12, 0x1E13, 0x1E14, 0x1E15, 0x1E16, 0x1E17, 0x1E18,
+     0x1E19, 0x1E1A, 0x1E1B, 0x1E1C, 0x1E1D, 0x1E1E, 0x1E1F, 0x1E20,
+     0x1E21, 0x1E22, 0x1E23, 0x1E24, 0x1E25, 0x1E26, 0x1E27, 0x1E28,
+     0x1E29, 0x1E2A, 0x1E2B, 0x1E2C, 0x1E2D, 0x1E2E, 0x1E2F, 0x1E30,
+     0x1E31, 0x1E32, 0x1E33, 0x1E34, 0x1E35, 0x1E36, 0x1E37, 0x1E38,
+     0x1E39, 0x1E3A, 0x1E3B, 0x1E3C, 0x1E3D, 0x1E3E, 0x1E3F, 0x1E40,
+     0x1E41, 0x1E42, 0x1E43, 0x1E44, 0x1E45, 0x1E46, 0x1E47, 0x1E48,
+     0x1E49, 0x1E4A, 0x1E4B, 0x1E4C, 0x1E4D, 0x1E4E, 0x1E4F, 0x1E50,
+     0x1E51, 0x1E52, 0x1E53, 0x1E54, 0x1E55, 0x1E56, 0x1E57, 0x1E58,
+     0x1E59, 0x1E5A, 0x1E5B, 0x1E5C, 0x1E5D, 0x1E5E, 0x1E5F, 0x1E60,
+     0x1E61, 0x1E62, 0x1E63, 0x1E64, 0x1E65, 0x1E66, 0x1E67, 0x1E68,
+     0x1E69, 0x1E6A, 0x1E6B, 0x1E6C, 0x1E6D, 0x1E6E, 0x1E6F, 0x1E70,
+     0x1E71, 0x1E72, 0x1E73, 0x1E74, 0x1E75, 0x1E76, 0x1E77, 0x1E78,
+     0x1E79, 0x1E7A, 0x1E7B, 0x1E7C, 0x1E7D, 0x1E7E, 0x1E7F, 0x1E80,
+     0x1E81, 0x1E82, 0x1E83, 0x1E84, 0x1E85, 0x1E86, 0x1E87, 0x1E88,
+     0x1E89, 0x1E8A, 0x1E8B, 0x1E8C, 0x1E8D, 0x1E8E, 0x1E8F, 0x1E90,
+     0x1E91, 0x1E92, 0x1E93, 0x1E94, 0x1E95, 0x1E96, 0x1E97, 0x1E98,
+     0x1E99, 0x1E9A, 0x1E9B, 0x1EA0, 0x1EA1, 0x1EA2, 0x1EA3, 0x1EA4,
+     0x1EA5, 0x1EA6, 0x1EA7, 0x1EA8, 0x1EA9, 0x1EAA, 0x1EAB, 0x1EAC,
+     0x1EAD, 0x1EAE, 0x1EAF, 0x1EB0, 0x1EB1, 0x1EB2, 0x1EB3, 0x1EB4,
+     0x1EB5, 0x1EB6, 0x1EB7, 0x1EB8, 0x1EB9, 0x1EBA, 0x1EBB, 0x1EBC,
+     0x1EBD, 0x1EBE, 0x1EBF, 0x1EC0, 0x1EC1, 0x1EC2, 0x1EC3, 0x1EC4,
+     0x1EC5, 0x1EC6, 0x1EC7, 0x1EC8, 0x1EC9, 0x1ECA, 0x1ECB, 0x1ECC,
+     0x1ECD, 0x1ECE, 0x1ECF, 0x1ED0, 0x1ED1, 0x1ED2, 0x1ED3, 0x1ED4,
+     0x1ED5, 0x1ED6, 0x1ED7, 0x1ED8, 0x1ED9, 0x1EDA, 0x1EDB, 0x1EDC,
+     0x1EDD, 0x1EDE, 0x1EDF, 0x1EE0, 0x1EE1, 0x1EE2, 0x1EE3, 0x1EE4,
+     0x1EE5, 0x1EE6, 0x1EE7, 0x1EE8, 0x1EE9, 0x1EEA, 0x1EEB, 0x1EEC,
+     0x1EED, 0x1EEE, 0x1EEF, 0x1EF0, 0x1EF1, 0x1EF2, 0x1EF3, 0x1EF4,
+     0x1EF5, 0x1EF6, 0x1EF7, 0x1EF8, 0x1EF9, 0x1F00, 0x1F01, 0x1F02,
+     0x1F03, 0x1F04, 0x1F05, 0x1F06, 0x1F07, 0x1F08, 0x1F09, 0x1F0A,
+     0x1F0B, 0x1F0C, 0x1F0D, 0x1F0E, 0x1F0F, 0x1F10, 0x1F11, 0x1F12,
+     0x1F13, 0x1F14, 0x1F15, 0x1F18, 0x1F19, 0x1F1A, 0x1F1B, 0x1F1C,
+     0x1F1D, 0x1F20, 0x1F21, 0x1F22, 0x1F23, 0x1F24, 0x1F25, 0x1F26,
+     0x1F27, 0x1F28, 0x1F29, 0x1F2A, 0x1F2B, 0x1F2C, 0x1F2D, 0x1F2E,
+     0x1F2F, 0x1F30, 0x1F31, 0x1F32, 0x1F33, 0x1F34, 0x1F35, 0x1F36,
+     0x1F37, 0x1F38, 0x1F39, 0x1F3A, 0x1F3B, 0x1F3C, 0x1F3D, 0x1F3E,
+     0x1F3F, 0x1F40, 0x1F41, 0x1F42, 0x1F43, 0x1F44, 0x1F45, 0x1F48,
+     0x1F49, 0x1F4A, 0x1F4B, 0x1F4C, 0x1F4D, 0x1F50, 0x1F51, 0x1F52,
+     0x1F53, 0x1F54, 0x1F55, 0x1F56, 0x1F57, 0x1F59, 0x1F5B, 0x1F5D,
+     0x1F5F, 0x1F60, 0x1F61, 0x1F62, 0x1F63, 0x1F64, 0x1F65, 0x1F66,
+     0x1F67, 0x1F68, 0x1F69, 0x1F6A, 0x1F6B, 0x1F6C, 0x1F6D, 0x1F6E,
+     0x1F6F, 0x1F70, 0x1F71, 0x1F72, 0x1F73, 0x1F74, 0x1F75, 0x1F76,
+     0x1F77, 0x1F78, 0x1F79, 0x1F7A, 0x1F7B, 0x1F7C, 0x1F7D, 0x1F80,
+     0x1F81, 0x1F82, 0x1F83, 0x1F84, 0x1F85, 0x1F86, 0x1F87, 0x1F88,
+     0x1F89, 0x1F8A, 0x1F8B, 0x1F8C, 0x1F8D, 0x1F8E, 0x1F8F, 0x1F90,
+     0x1F91, 0x1F92, 0x1F93, 0x1F94, 0x1F95, 0x1F96, 0x1F97, 0x1F98,
+     0x1F99, 0x1F9A, 0x1F9B, 0x1F9C, 0x1F9D, 0x1F9E, 0x1F9F, 0x1FA0,
+     0x1FA1, 0x1FA2, 0x1FA3, 0x1FA4, 0x1FA5, 0x1FA6, 0x1FA7, 0x1FA8,
+     0x1FA9, 0x1FAA, 0x1FAB, 0x1FAC, 0x1FAD, 0x1FAE, 0x1FAF, 0x1FB0,
+     0x1FB1, 0x1FB2, 0x1FB3, 0x1FB4, 0x1FB6, 0x1FB7, 0x1FB8, 0x1FB9,
+     0x1FBA, 0x1FBB, 0x1FBC, 0x1FBD, 0x1FBE, 0x1FBF, 0x1FC0, 0x1FC1,
+     0x1FC2, 0x1FC3, 0x1FC4, 0x1FC6, 0x1FC7, 0x1FC8, 0x1FC9, 0x1FCA,
+     0x1FCB, 0x1FCC, 0x1FCD, 0x1FCE, 0x1FCF, 0x1FD0, 0x1FD1, 0x1FD2,
+     0x1FD3, 0x1FD6, 0x1FD7, 0x1FD8, 0x1FD9, 0x1FDA, 0x1FDB, 0x1FDD,
+     0x1FDE, 0x1FDF, 0x1FE0, 0x1FE1, 0x1FE2, 0x1FE3, 0x1FE4, 0x1FE5,
+     0x1FE6, 0x1FE7, 0x1FE8, 0x1FE9, 0x1FEA, 0x1FEB, 0x1FEC, 0x1FED,
+     0x1FEE, 0x1FEF, 0x1FF2, 0x1FF3, 0x1FF4, 0x1FF6, 0x1FF7, 0x1FF8,
+     0x1FF9, 0x1FFA, 0x1FFB, 0x1FFC, 0x1FFD, 0x1FFE, 0x2000, 0x2001,
+     0x2002, 0x2003, 0x2004, 0x2005, 0x2006, 0x2007, 0x2008, 0x2009,
+     0x200A, 0x2011, 0x2017, 0x2024, 0x2025, 0x2026, 0x202F, 0x2033,
+     0x2034, 0x2036, 0x2037, 0x203C, 0x203E, 0x2047, 0x2048, 0x2049,
+     0x2057, 0x205F, 0x2070, 0x2071, 0x2074, 0x2075, 0x2076, 0x2077,
+     0x2078, 0x2079, 0x207A, 0x207B, 0x207C, 0x207D, 0x207E, 0x207F,
+     0x2080, 0x2081, 0x2082, 0x2083, 0x2084, 0x2085, 0x2086, 0x2087,
+     0x2088, 0x2089, 0x208A, 0x208B, 0x208C, 0x208D, 0x208E, 0x2090,
+     0x2091, 0x2092, 0x2093, 0x2094, 0x2095, 0x2096, 0x2097, 0x2098,
+     0x2099, 0x209A, 0x209B, 0x209C, 0x20A8, 0x2100, 0x2101, 0x2102,
+     0x2103, 0x2105, 0x2106, 0x2107, 0x2109, 0x210A, 0x210B, 0x210C,
+     0x210D, 0x210E, 0x210F, 0x2110, 0x2111, 0x2112, 0x2113, 0x2115,
+     0x2116, 0x2119, 0x211A, 0x211B, 0x211C, 0x211D, 0x2120, 0x2121,
+     0x2122, 0x2124, 0x2126, 0x2128, 0x212A, 0x212B, 0x212C, 0x212D,
+     0x212F, 0x2130, 0x2131, 0x2133, 0x2134, 0x2135, 0x2136, 0x2137,
+     0x2138, 0x2139, 0x213B, 0x213C, 0x213D, 0x213E, 0x213F, 0x2140,
+     0x2145, 0x2146, 0x2147, 0x2148, 0x2149, 0x2150, 0x2151, 0x2152,
+     0x2153, 0x2154, 0x2155, 0x2156, 0x2157, 0x2158, 0x2159, 0x215A,
+     0x215B, 0x215C, 0x215D, 0x215E, 0x215F, 0x2160, 0x2161, 0x2162,
+     0x2163, 0x2164, 0x2165, 0x2166, 0x2167, 0x2168, 0x2169, 0x216A,
+     0x216B, 0x216C, 0x216D, 0x216E, 0x216F, 0x2170, 0x2171, 0x2172,
+     0x2173, 0x2174, 0x2175, 0x2176, 0x2177, 0x2178, 0x2179, 0x217A,
+     0x217B, 0x217C, 0x217D, 0x217E, 0x217F, 0x2189, 0x219A, 0x219B,
+     0x21AE, 0x21CD, 0x21CE, 0x21CF, 0x2204, 0x2209, 0x220C, 0x2224,
+     0x2226, 0x222C, 0x222D, 0x222F, 0x2230, 0x2241, 0x2244, 0x2247,
+     0x2249, 0x2260, 0x2262, 0x226D, 0x226E, 0x226F, 0x2270, 0x2271,
+     0x2274, 0x2275, 0x2278, 0x2279, 0x2280, 0x2281, 0x2284, 0x2285,
+     0x2288, 0x2289, 0x22AC, 0x22AD, 0x22AE, 0x22AF, 0x22E0, 0x22E1,
+     0x22E2, 0x22E3, 0x22EA, 0x22EB, 0x22EC, 0x22ED, 0x2329, 0x232A,
+     0x2460, 0x2461, 0x2462, 0x2463, 0x2464, 0x2465, 0x2466, 0x2467,
+     0x2468, 0x2469, 0x246A, 0x246B, 0x246C, 0x246D, 0x246E, 0x246F,
+     0x2470, 0x2471, 0x2472, 0x2473, 0x2474, 0x2475, 0x2476, 0x2477,
+     0x2478, 0x2479, 0x247A, 0x247B, 0x247C, 0x247D, 0x247E, 0x247F,
+     0x2480, 0x2481, 0x2482, 0x2483, 0x2484, 0x2485, 0x2486, 0x2487,
+     0x2488, 0x2489, 0x248A, 0x248B, 0x248C, 0x248D, 0x248E, 0x248F,
+     0x2490, 0x2491, 0x2492, 0x2493, 0x2494, 0x2495, 0x2496, 0x2497,
+     0x2498, 0x2499, 0x249A, 0x249B, 0x249C, 0x249D, 0x249E, 0x249F,
+     0x24A0, 0x24A1, 0x24A2, 0x24A3, 0x24A4, 0x24A5, 0x24A6, 0x24A7,
+     0x24A8, 0x24A9, 0x24AA, 0x24AB, 0x24AC, 0x24AD, 0x24AE, 0x24AF,
+     0x24B0, 0x24B1, 0x24B2, 0x24B3, 0x24B4, 0x24B5, 0x24B6, 0x24B7,
+     0x24B8, 0x24B9, 0x24BA, 0x24BB, 0x24BC, 0x24BD, 0x24BE, 0x24BF,
+     0x24C0, 0x24C1, 0x24C2, 0x24C3, 0x24C4, 0x24C5, 0x24C6, 0x24C7,
+     0x24C8, 0x24C9, 0x24CA, 0x24CB, 0x24CC, 0x24CD, 0x24CE, 0x24CF,
+     0x24D0, 0x24D1, 0x24D2, 0x24D3, 0x24D4, 0x24D5, 0x24D6, 0x24D7,
+     0x24D8, 0x24D9, 0x24DA, 0x24DB, 0x24DC, 0x24DD, 0x24DE, 0x24DF,
+     0x24E0, 0x24E1, 0x24E2, 0x24E3, 0x24E4, 0x24E5, 0x24E6, 0x24E7,
+     0x24E8, 0x24E9, 0x24EA, 0x2A0C, 0x2A74, 0x2A75, 0x2A76, 0x2ADC,
+     0x2C7C, 0x2C7D, 0x2D6F, 0x2E9F, 0x2EF3, 0x2F00, 0x2F01, 0x2F02,
+     0x2F03, 0x2F04, 0x2F05, 0x2F06, 0x2F07, 0x2F08, 0x2F09, 0x2F0A,
+     0x2F0B, 0x2F0C, 0x2F0D, 0x2F0E, 0x2F0F, 0x2F10, 0x2F11, 0x2F12,
+     0x2F13, 0x2F14, 0x2F15, 0x2F16, 0x2F17, 0x2F18, 0x2F19, 0x2F1A,
+     0x2F1B, 0x2F1C, 0x2F1D, 0x2F1E, 0x2F1F, 0x2F20, 0x2F21, 0x2F22,
+     0x2F23, 0x2F24, 0x2F25, 0x2F26, 0x2F27, 0x2F28, 0x2F29, 0x2F2A,
+     0x2F2B, 0x2F2C, 0x2F2D, 0x2F2E, 0x2F2F, 0x2F30, 0x2F31, 0x2F32,
+     0x2F33, 0x2F34, 0x2F35, 0x2F36, 0x2F37, 0x2F38, 0x2F39, 0x2F3A,
+     0x2F3B, 0x2F3C, 0x2F3D, 0x2F3E, 0x2F3F, 0x2F40, 0x2F41, 0x2F42,
+     0x2F43, 0x2F44, 0x2F45, 0x2F46, 0x2F47, 0x2F48, 0x2F49, 0x2F4A,
+     0x2F4B, 0x2F4C, 0x2F4D, 0x2F4E, 0x2F4F, 0x2F50, 0x2F51, 0x2F52,
+     0x2F53, 0x2F54, 0x2F55, 0x2F56, 0x2F57, 0x2F58, 0x2F59, 0x2F5A,
+     0x2F5B, 0x2F5C, 0x2F5D, 0x2F5E, 0x2F5F, 0x2F60, 0x2F61, 0x2F62,
+     0x2F63, 0x2F64, 0x2F65, 0x2F66, 0x2F67, 0x2F68, 0x2F69, 0x2F6A,
+     0x2F6B, 0x2F6C, 0x2F6D, 0x2F6E, 0x2F6F, 0x2F70, 0x2F71, 0x2F72,
+     0x2F73, 0x2F74, 0x2F75, 0x2F76, 0x2F77, 0x2F78, 0x2F79, 0x2F7A,
+     0x2F7B, 0x2F7C, 0x2F7D, 0x2F7E, 0x2F7F, 0x2F80, 0x2F81, 0x2F82,
+     0x2F83, 0x2F84, 0x2F85, 0x2F86, 0x2F87, 0x2F88, 0x2F89, 0x2F8A,
+     0x2F8B, 0x2F8C, 0x2F8D, 0x2F8E, 0x2F8F, 0x2F90, 0x2F91, 0x2F92,
+     0x2F93, 0x2F94, 0x2F95, 0x2F96, 0x2F97, 0x2F98, 0x2F99, 0x2F9A,
+     0x2F9B, 0x2F9C, 0x2F9D, 0x2F9E, 0x2F9F, 0x2FA0, 0x2FA1, 0x2FA2,
+     0x2FA3, 0x2FA4, 0x2FA5, 0x2FA6, 0x2FA7, 0x2FA8, 0x2FA9, 0x2FAA,
+     0x2FAB, 0x2FAC, 0x2FAD, 0x2FAE, 0x2FAF, 0x2FB0, 0x2FB1, 0x2FB2,
+     0x2FB3, 0x2FB4, 0x2FB5, 0x2FB6, 0x2FB7, 0x2FB8, 0x2FB9, 0x2FBA,
+     0x2FBB, 0x2FBC, 0x2FBD, 0x2FBE, 0x2FBF, 0x2FC0, 0x2FC1, 0x2FC2,
+     0x2FC3, 0x2FC4, 0x2FC5, 0x2FC6, 0x2FC7, 0x2FC8, 0x2FC9, 0x2FCA,
+     0x2FCB, 0x2FCC, 0x2FCD, 0x2FCE, 0x2FCF, 0x2FD0, 0x2FD1, 0x2FD2,
+     0x2FD3, 0x2FD4, 0x2FD5, 0x3000, 0x3036, 0x3038, 0x3039, 0x303A,
+     0x304C, 0x304E, 0x3050, 0x3052, 0x3054, 0x3056, 0x3058, 0x305A,
+     0x305C, 0x305E, 0x3060, 0x3062, 0x3065, 0x3067, 0x3069, 0x3070,
+     0x3071, 0x3073, 0x3074, 0x3076, 0x3077, 0x3079, 0x307A, 0x307C,
+     0x307D, 0x3094, 0x309B, 0x309C, 0x309E, 0x309F, 0x30AC, 0x30AE,
+     0x30B0, 0x30B2, 0x30B4, 0x30B6, 0x30B8, 0x30BA, 0x30BC, 0x30BE,
+     0x30C0, 0x30C2, 0x30C5, 0x30C7, 0x30C9, 0x30D0, 0x30D1, 0x30D3,
+     0x30D4, 0x30D6, 0x30D7, 0x30D9, 0x30DA, 0x30DC, 0x30DD, 0x30F4,
+     0x30F7, 0x30F8, 0x30F9, 0x30FA, 0x30FE, 0x30FF, 0x3131, 0x3132,
+     0x3133, 0x3134, 0x3135, 0x3136, 0x3137, 0x3138, 0x3139, 0x313A,
+     0x313B, 0x313C, 0x313D, 0x313E, 0x313F, 0x3140, 0x3141, 0x3142,
+     0x3143, 0x3144, 0x3145, 0x3146, 0x3147, 0x3148, 0x3149, 0x314A,
+     0x314B, 0x314C, 0x314D, 0x314E, 0x314F, 0x3150, 0x3151, 0x3152,
+     0x3153, 0x3154, 0x3155, 0x3156, 0x3157, 0x3158, 0x3159, 0x315A,
+     0x315B, 0x315C, 0x315D, 0x315E, 0x315F, 0x3160, 0x3161, 0x3162,
+     0x3163, 0x3164, 0x3165, 0x3166, 0x3167, 0x3168, 0x3169, 0x316A,
+     0x316B, 0x316C, 0x316D, 0x316E, 0x316F, 0x3170, 0x3171, 0x3172,
+     0x3173, 0x3174, 0x3175, 0x3176, 0x3177, 0x3178, 0x3179, 0x317A,
+     0x317B, 0x317C, 0x317D, 0x317E, 0x317F, 0x3180, 0x3181, 0x3182,
+     0x3183, 0x3184, 0x3185, 0x3186, 0x3187, 0x3188, 0x3189, 0x318A,
+     0x318B, 0x318C, 0x318D, 0x318E, 0x3192, 0x3193, 0x3194, 0x3195,
+     0x3196, 0x3197, 0x3198, 0x3199, 0x319A, 0x319B, 0x319C, 0x319D,
+     0x319E, 0x319F, 0x3200, 0x3201, 0x3202, 0x3203, 0x3204, 0x3205,
+     0x3206, 0x3207, 0x3208, 0x3209, 0x320A, 0x320B, 0x320C, 0x320D,
+     0x320E, 0x320F, 0x3210, 0x3211, 0x3212, 0x3213, 0x3214, 0x3215,
+     0x3216, 0x3217, 0x3218, 0x3219, 0x321A, 0x321B, 0x321C, 0x321D,
+     0x321E, 0x3220, 0x3221, 0x3222, 0x3223, 0x3224, 0x3225, 0x3226,
+     0x3227, 0x3228, 0x3229, 0x322A, 0x322B, 0x322C, 0x322D, 0x322E,
+     0x322F, 0x3230, 0x3231, 0x3232, 0x3233, 0x3234, 0x3235, 0x3236,
+     0x3237, 0x3238, 0x3239, 0x323A, 0x323B, 0x323C, 0x323D, 0x323E,
+     0x323F, 0x3240, 0x3241, 0x3242, 0x3243, 0x3244, 0x3245, 0x3246,
+     0x3247, 0x3250, 0x3251, 0x3252, 0x3253, 0x3254, 0x3255, 0x3256,
+     0x3257, 0x3258, 0x3259, 0x325A, 0x325B, 0x325C, 0x325D, 0x325E,
+     0x325F, 0x3260, 0x3261, 0x3262, 0x3263, 0x3264, 0x3265, 0x3266,
+     0x3267, 0x3268, 0x3269, 0x326A, 0x326B, 0x326C, 0x326D, 0x326E,
+     0x326F, 0x3270, 0x3271, 0x3272, 0x3273, 0x3274, 0x3275, 0x3276,
+     0x3277, 0x3278, 0x3279, 0x327A, 0x327B, 0x327C, 0x327D, 0x327E,
+     0x3280, 0x3281, 0x3282, 0x3283, 0x3284, 0x3285, 0x3286, 0x3287,
+     0x3288, 0x3289, 0x328A, 0x328B, 0x328C, 0x328D, 0x328E, 0x328F,
+     0x3290, 0x3291, 0x3292, 0x3293, 0x3294, 0x3295, 0x3296, 0x3297,
+     0x3298, 0x3299, 0x329A, 0x329B, 0x329C, 0x329D, 0x329E, 0x329F,
+     0x32A0, 0x32A1, 0x32A2, 0x32A3, 0x32A4, 0x32A5, 0x32A6, 0x32A7,
+     0x32A8, 0x32A9, 0x32AA, 0x32AB, 0x32AC, 0x32AD, 0x32AE, 0x32AF,
+     0x32B0, 0x32B1, 0x32B2, 0x32B3, 0x32B4, 0x32B5, 0x32B6, 0x32B7,
+     0x32B8, 0x32B9, 0x32BA, 0x32BB, 0x32BC, 0x32BD, 0x32BE, 0x32BF,
+     0x32C0, 0x32C1, 0x32C2, 0x32C3, 0x32C4, 0x32C5, 0x32C6, 0x32C7,
+     0x32C8, 0x32C9, 0x32CA, 0x32CB, 0x32CC, 0x32CD, 0x32CE, 0x32CF,
+     0x32D0, 0x32D1, 0x32D2, 0x32D3, 0x32D4, 0x32D5, 0x32D6, 0x32D7,
+     0x32D8, 0x32D9, 0x32DA, 0x32DB, 0x32DC, 0x32DD, 0x32DE, 0x32DF,
+     0x32E0, 0x32E1, 0x32E2, 0x32E3, 0x32E4, 0x32E5, 0x32E6, 0x32E7,
+     0x32E8, 0x32E9, 0x32EA, 0x32EB, 0x32EC, 0x32ED, 0x32EE, 0x32EF,
+     0x32F0, 0x32F1, 0x32F2, 0x32F3, 0x32F4, 0x32F5, 0x32F6, 0x32F7,
+     0x32F8, 0x32F9, 0x32FA, 0x32FB, 0x32FC, 0x32FD, 0x32FE, 0x32FF,
+     0x3300, 0x3301, 0x3302, 0x3303, 0x3304, 0x3305, 0x3306, 0x3307,
+     0x3308, 0x3309, 0x330A, 0x330B, 0x330C, 0x330D, 0x330E, 0x330F,
+     0x3310, 0x3311, 0x3312, 0x3313, 0x3314, 0x3315, 0x3316, 0x3317,
+     0x3318, 0x3319, 0x331A, 0x331B, 0x331C, 0x331D, 0x331E, 0x331F,
+     0x3320, 0x3321, 0x3322, 0x3323, 0x3324, 0x3325, 0x3326, 0x3327,
+     0x3328, 0x3329, 0x332A, 0x332B, 0x332C, 0x332D, 0x332E, 0x332F,
+     0x3330, 0x3331, 0x3332, 0x3333, 0x3334, 0x3335, 0x3336, 0x3337,
+     0x3338, 0x3339, 0x333A, 0x333B, 0x333C, 0x333D, 0x333E, 0x333F,
+     0x3340, 0x3341, 0x3342, 0x3343, 0x3344, 0x3345, 0x3346, 0x3347,
+     0x3348, 0x3349, 0x334A, 0x334B, 0x334C, 0x334D, 0x334E, 0x334F,
+     0x3350, 0x3351, 0x3352, 0x3353, 0x3354, 0x3355, 0x3356, 0x3357,
+     0x3358, 0x3359, 0x335A, 0x335B, 0x335C, 0x335D, 0x335E, 0x335F,
+     0x3360, 0x3361, 0x3362, 0x3363, 0x3364, 0x3365, 0x3366, 0x3367,
+     0x3368, 0x3369, 0x336A, 0x336B, 0x336C, 0x336D, 0x336E, 0x336F,
+     0x3370, 0x3371, 0x3372, 0x3373, 0x3374, 0x3375, 0x3376, 0x3377,
+     0x3378, 0x3379, 0x337A, 0x337B, 0x337C, 0x337D, 0x337E, 0x337F,
+     0x3380, 0x3381, 0x3382, 0x3383, 0x3384, 0x3385, 0x3386, 0x3387,
+     0x3388, 0x3389, 0x338A, 0x338B, 0x338C, 0x338D, 0x338E, 0x338F,
+     0x3390, 0x3391, 0x3392, 0x3393, 0x3394, 0x3395, 0x3396, 0x3397,
+     0x3398, 0x3399, 0x339A, 0x339B, 0x339C, 0x339D, 0x339E, 0x339F,
+     0x33A0, 0x33A1, 0x33A2, 0x33A3, 0x33A4, 0x33A5, 0x33A6, 0x33A7,
+     0x33A8, 0x33A9, 0x33AA, 0x33AB, 0x33AC, 0x33AD, 0x33AE, 0x33AF,
+     0x33B0, 0x33B1, 0x33B2, 0x33B3, 0x33B4, 0x33B5, 0x33B6, 0x33B7,
+     0x33B8, 0x33B9, 0x33BA, 0x33BB, 0x33BC, 0x33BD, 0x33BE, 0x33BF,
+     0x33C0, 0x33C1, 0x33C2, 0x33C3, 0x33C4, 0x33C5, 0x33C6, 0x33C7,
+     0x33C8, 0x33C9, 0x33CA, 0x33CB, 0x33CC, 0x33CD, 0x33CE, 0x33CF,
+     0x33D0, 0x33D1, 0x33D2, 0x33D3, 0x33D4, 0x33D5, 0x33D6, 0x33D7,
+     0x33D8, 0x33D9, 0x33DA, 0x33DB, 0x33DC, 0x33DD, 0x33DE, 0x33DF,
+     0x33E0, 0x33E1, 0x33E2, 0x33E3, 0x33E4, 0x33E5, 0x33E6, 0x33E7,
+     0x33E8, 0x33E9, 0x33EA, 0x33EB, 0x33EC, 0x33ED, 0x33EE, 0x33EF,
+     0x33F0, 0x33F1, 0x33F2, 0x33F3, 0x33F4, 0x33F5, 0x33F6, 0x33F7,
+     0x33F8, 0x33F9, 0x33FA, 0x33FB, 0x33FC, 0x33FD, 0x33FE, 0x33FF,
+     0xA69C, 0xA69D, 0xA770, 0xA7F2, 0xA7F3, 0xA7F4, 0xA7F8, 0xA7F9,
+     0xAB5C, 0xAB5D, 0xAB5E, 0xAB5F, 0xAB69, 0xF900, 0xF901, 0xF902,
+     0xF903, 0xF904, 0xF905, 0xF906, 0xF907, 0xF908, 0xF909, 0xF90A,
+     0xF90B, 0xF90C, 0xF90D, 0xF90E, 0xF90F, 0xF910, 0xF911, 0xF912,
+     0xF913, 0xF914, 0xF915, 0xF916, 0xF917, 0xF918, 0xF919, 0xF91A,
+     0xF91B, 0xF91C, 0xF91D, 0xF91E, 0xF91F, 0xF920, 0xF921, 0xF922,
+     0xF923, 0xF924, 0xF925, 0xF926, 0xF927, 0xF928, 0xF929, 0xF92A,
+     0xF92B, 0xF92C, 0xF92D, 0xF92E, 0xF92F, 0xF930, 0xF931, 0xF932,
+     0xF933, 0xF934, 0xF935, 0xF936, 0xF937, 0xF938, 0xF939, 0xF93A,
+     0xF93B, 0xF93C, 0xF93D, 0xF93E, 0xF93F, 0xF940, 0xF941, 0xF942,
+     0xF943, 0xF944, 0xF945, 0xF946, 0xF947, 0xF948, 0xF949, 0xF94A,
+     0xF94B, 0xF94C, 0xF94D, 0xF94E, 0xF94F, 0xF950, 0xF951, 0xF952,
+     0xF953, 0xF954, 0xF955, 0xF956, 0xF957, 0xF958, 0xF959, 0xF95A,
+     0xF95B, 0xF95C, 0xF95D, 0xF95E, 0xF95F, 0xF960, 0xF961, 0xF962,
+     0xF963, 0xF964, 0xF965, 0xF966, 0xF967, 0xF968, 0xF969, 0xF96A,
+     0xF96B, 0xF96C, 0xF96D, 0xF96E, 0xF96F, 0xF970, 0xF971, 0xF972,
+     0xF973, 0xF974, 0xF975, 0xF976, 0xF977, 0xF978, 0xF979, 0xF97A,
+     0xF97B, 0xF97C, 0xF97D, 0xF97E, 0xF97F, 0xF980, 0xF981, 0xF982,
+     0xF983, 0xF984, 0xF985, 0xF986, 0xF987, 0xF988, 0xF989, 0xF98A,
+     0xF98B, 0xF98C, 0xF98D, 0xF98E, 0xF98F, 0xF990, 0xF991, 0xF992,
+     0xF993, 0xF994, 0xF995, 0xF996, 0xF997, 0xF998, 0xF999, 0xF99A,
+     0xF99B, 0xF99C, 0xF99D, 0xF99E, 0xF99F, 0xF9A0, 0xF9A1, 0xF9A2,
+     0xF9A3, 0xF9A4, 0xF9A5, 0xF9A6, 0xF9A7, 0xF9A8, 0xF9A9, 0xF9AA,
+     0xF9AB, 0xF9AC, 0xF9AD, 0xF9AE, 0xF9AF, 0xF9B0, 0xF9B1, 0xF9B2,
+     0xF9B3, 0xF9B4, 0xF9B5, 0xF9B6, 0xF9B7, 0xF9B8, 0xF9B9, 0xF9BA,
+     0xF9BB, 0xF9BC, 0xF9BD, 0xF9BE, 0xF9BF, 0xF9C0, 0xF9C1, 0xF9C2,
+     0xF9C3, 0xF9C4, 0xF9C5, 0xF9C6, 0xF9C7, 0xF9C8, 0xF9C9, 0xF9CA,
+     0xF9CB, 0xF9CC, 0xF9CD, 0xF9CE, 0xF9CF, 0xF9D0, 0xF9D1, 0xF9D2,
+     0xF9D3, 0xF9D4, 0xF9D5, 0xF9D6, 0xF9D7, 0xF9D8, 0xF9D9, 0xF9DA,
+     0xF9DB, 0xF9DC, 0xF9DD, 0xF9DE, 0xF9DF, 0xF9E0, 0xF9E1, 0xF9E2,
+     0xF9E3, 0xF9E4, 0xF9E5, 0xF9E6, 0xF9E7, 0xF9E8, 0xF9E9, 0xF9EA,
+     0xF9EB, 0xF9EC, 0xF9ED, 0xF9EE, 0xF9EF, 0xF9F0, 0xF9F1, 0xF9F2,
+     0xF9F3, 0xF9F4, 0xF9F5, 0xF9F6, 0xF9F7, 0xF9F8, 0xF9F9, 0xF9FA,
+     0xF9FB, 0xF9FC, 0xF9FD, 0xF9FE, 0xF9FF, 0xFA00, 0xFA01, 0xFA02,
+     0xFA03, 0xFA04, 0xFA05, 0xFA06, 0xFA07, 0xFA08, 0xFA09, 0xFA0A,
+     0xFA0B, 0xFA0C, 0xFA0D, 0xFA10, 0xFA12, 0xFA15, 0xFA16, 0xFA17,
+     0xFA18, 0xFA19, 0xFA1A, 0xFA1B, 0xFA1C, 0xFA1D, 0xFA1E, 0xFA20,
+     0xFA22, 0xFA25, 0xFA26, 0xFA2A, 0xFA2B, 0xFA2C, 0xFA2D, 0xFA2E,
+     0xFA2F, 0xFA30, 0xFA31, 0xFA32, 0xFA33, 0xFA34, 0xFA35, 0xFA36,
+     0xFA37, 0xFA38, 0xFA39, 0xFA3A, 0xFA3B, 0xFA3C, 0xFA3D, 0xFA3E,
+     0xFA3F, 0xFA40, 0xFA41, 0xFA42, 0xFA43, 0xFA44, 0xFA45, 0xFA46,
+     0xFA47, 0xFA48, 0xFA49, 0xFA4A, 0xFA4B, 0xFA4C, 0xFA4D, 0xFA4E,
+     0xFA4F, 0xFA50, 0xFA51, 0xFA52, 0xFA53, 0xFA54, 0xFA55, 0xFA56,
+     0xFA57, 0xFA58, 0xFA59, 0xFA5A, 0xFA5B, 0xFA5C, 0xFA5D, 0xFA5E,
+     0xFA5F, 0xFA60, 0xFA61, 0xFA62, 0xFA63, 0xFA64, 0xFA65, 0xFA66,
+     0xFA67, 0xFA68, 0xFA69, 0xFA6A, 0xFA6B, 0xFA6C, 0xFA6D, 0xFA70,
+     0xFA71, 0xFA72, 0xFA73, 0xFA74, 0xFA75, 0xFA76, 0xFA77, 0xFA78,
+     0xFA79, 0xFA7A, 0xFA7B, 0xFA7C, 0xFA7D, 0xFA7E, 0xFA7F, 0xFA80,
+     0xFA81, 0xFA82, 0xFA83, 0xFA84, 0xFA85, 0xFA86, 0xFA87, 0xFA88,
+     0xFA89, 0xFA8A, 0xFA8B, 0xFA8C, 0xFA8D, 0xFA8E, 0xFA8F, 0xFA90,
+     0xFA91, 0xFA92, 0xFA93, 0xFA94, 0xFA95, 0xFA96, 0xFA97, 0xFA98,
+     0xFA99, 0xFA9A, 0xFA9B, 0xFA9C, 0xFA9D, 0xFA9E, 0xFA9F, 0xFAA0,
+     0xFAA1, 0xFAA2, 0xFAA3, 0xFAA4, 0xFAA5, 0xFAA6, 0xFAA7, 0xFAA8,
+     0xFAA9, 0xFAAA, 0xFAAB, 0xFAAC, 0xFAAD, 0xFAAE, 0xFAAF, 0xFAB0,
+     0xFAB1, 0xFAB2, 0xFAB3, 0xFAB4, 0xFAB5, 0xFAB6, 0xFAB7, 0xFAB8,
+     0xFAB9, 0xFABA, 0xFABB, 0xFABC, 0xFABD, 0xFABE, 0xFABF, 0xFAC0,
+     0xFAC1, 0xFAC2, 0xFAC3, 0xFAC4, 0xFAC5, 0xFAC6, 0xFAC7, 0xFAC8,
+     0xFAC9, 0xFACA, 0xFACB, 0xFACC, 0xFACD, 0xFACE, 0xFACF, 0xFAD0,
+     0xFAD1, 0xFAD2, 0xFAD3, 0xFAD4, 0xFAD5, 0xFAD6, 0xFAD7, 0xFAD8,
+     0xFAD9, 0xFB00, 0xFB01, 0xFB02, 0xFB03, 0xFB04, 0xFB05, 0xFB06,
+     0xFB13, 0xFB14, 0xFB15, 0xFB16, 0xFB17, 0xFB1D, 0xFB1F, 0xFB20,
+     0xFB21, 0xFB22, 0xFB23, 0xFB24, 0xFB25, 0xFB26, 0xFB27, 0xFB28,
+     0xFB29, 0xFB2A, 0xFB2B, 0xFB2C, 0xFB2D, 0xFB2E, 0xFB2F, 0xFB30,
+     0xFB31, 0xFB32, 0xFB33, 0xFB34, 0xFB35, 0xFB36, 0xFB38, 0xFB39,
+     0xFB3A, 0xFB3B, 0xFB3C, 0xFB3E, 0xFB40, 0xFB41, 0xFB43, 0xFB44,
+     0xFB46, 0xFB47, 0xFB48, 0xFB49, 0xFB4A, 0xFB4B, 0xFB4C, 0xFB4D,
+     0xFB4E, 0xFB4F, 0xFB50, 0xFB51, 0xFB52, 0xFB53, 0xFB54, 0xFB55,
+     0xFB56, 0xFB57, 0xFB58, 0xFB59, 0xFB5A, 0xFB5B, 0xFB5C, 0xFB5D,
+     0xFB5E, 0xFB5F, 0xFB60, 0xFB61, 0xFB62, 0xFB63, 0xFB64, 0xFB65,
+     0xFB66, 0xFB67, 0xFB68, 0xFB69, 0xFB6A, 0xFB6B, 0xFB6C, 0xFB6D,
+     0xFB6E, 0xFB6F, 0xFB70, 0xFB71, 0xFB72, 0xFB73, 0xFB74, 0xFB75,
+     0xFB76, 0xFB77, 0xFB78, 0xFB79, 0xFB7A, 0xFB7B, 0xFB7C, 0xFB7D,
+     0xFB7E, 0xFB7F, 0xFB80, 0xFB81, 0xFB82, 0xFB83, 0xFB84, 0xFB85,
+     0xFB86, 0xFB87, 0xFB88, 0xFB89, 0xFB8A, 0xFB8B, 0xFB8C, 0xFB8D,
+     0xFB8E, 0xFB8F, 0xFB90, 0xFB91, 0xFB92, 0xFB93, 0xFB94, 0xFB95,
+     0xFB96, 0xFB97, 0xFB98, 0xFB99, 0xFB9A, 0xFB9B, 0xFB9C, 0xFB9D,
+     0xFB9E, 0xFB9F, 0xFBA0, 0xFBA1, 0xFBA2, 0xFBA3, 0xFBA4, 0xFBA5,
+     0xFBA6, 0xFBA7, 0xFBA8, 0xFBA9, 0xFBAA, 0xFBAB, 0xFBAC, 0xFBAD,
+     0xFBAE, 0xFBAF, 0xFBB0, 0xFBB1, 0xFBD3, 0xFBD4, 0xFBD5, 0xFBD6,
+     0xFBD7, 0xFBD8, 0xFBD9, 0xFBDA, 0xFBDB, 0xFBDC, 0xFBDD, 0xFBDE,
+     0xFBDF, 0xFBE0, 0xFBE1, 0xFBE2, 0xFBE3, 0xFBE4, 0xFBE5, 0xFBE6,
+     0xFBE7, 0xFBE8, 0xFBE9, 0xFBEA, 0xFBEB, 0xFBEC, 0xFBED, 0xFBEE,
+     0xFBEF, 0xFBF0, 0xFBF1, 0xFBF2, 0xFBF3, 0xFBF4, 0xFBF5, 0xFBF6,
+     0xFBF7, 0xFBF8, 0xFBF9, 0xFBFA, 0xFBFB, 0xFBFC, 0xFBFD, 0xFBFE,
+     0xFBFF, 0xFC00, 0xFC01, 0xFC02, 0xFC03, 0xFC04, 0xFC05, 0xFC06,
+     0xFC07, 0xFC08, 0xFC09, 0xFC0A, 0xFC0B, 0xFC0C, 0xFC0D, 0xFC0E,
+     0xFC0F, 0xFC10, 0xFC11, 0xFC12, 0xFC13, 0xFC14, 0xFC15, 0xFC16,
+     0xFC17, 0xFC18, 0xFC19, 0xFC1A, 0xFC1B, 0xFC1C, 0xFC1D, 0xFC1E,
+     0xFC1F, 0xFC20, 0xFC21, 0xFC22, 0xFC23, 0xFC24, 0xFC25, 0xFC26,
+     0xFC27, 0xFC28, 0xFC29, 0xFC2A, 0xFC2B, 0xFC2C, 0xFC2D, 0xFC2E,
+     0xFC2F, 0xFC30, 0xFC31, 0xFC32, 0xFC33, 0xFC34, 0xFC35, 0xFC36,
+     0xFC37, 0xFC38, 0xFC39, 0xFC3A, 0xFC3B, 0xFC3C, 0xFC3D, 0xFC3E,
+     0xFC3F, 0xFC40, 0xFC41, 0xFC42, 0xFC43, 0xFC44, 0xFC45, 0xFC46,
+     0xFC47, 0xFC48, 0xFC49, 0xFC4A, 0xFC4B, 0xFC4C, 0xFC4D, 0xFC4E,
+     0xFC4F, 0xFC50, 0xFC51, 0xFC52, 0xFC53, 0xFC54, 0xFC55, 0xFC56,
+     0xFC57, 0xFC58, 0xFC59, 0xFC5A, 0xFC5B, 0xFC5C, 0xFC5D, 0xFC5E,
+     0xFC5F, 0xFC60, 0xFC61, 0xFC62, 0xFC63, 0xFC64, 0xFC65, 0xFC66,
+     0xFC67, 0xFC68, 0xFC69, 0xFC6A, 0xFC6B, 0xFC6C, 0xFC6D, 0xFC6E,
+     0xFC6F, 0xFC70, 0xFC71, 0xFC72, 0xFC73, 0xFC74, 0xFC75, 0xFC76,
+     0xFC77, 0xFC78, 0xFC79, 0xFC7A, 0xFC7B, 0xFC7C, 0xFC7D, 0xFC7E,
+     0xFC7F, 0xFC80, 0xFC81, 0xFC82, 0xFC83, 0xFC84, 0xFC85, 0xFC86,
+     0xFC87, 0xFC88, 0xFC89, 0xFC8A, 0xFC8B, 0xFC8C, 0xFC8D, 0xFC8E,
+     0xFC8F, 0xFC90, 0xFC91, 0xFC92, 0xFC93, 0xFC94, 0xFC95, 0xFC96,
+     0xFC97, 0xFC98, 0xFC99, 0xFC9A, 0xFC9B, 0xFC9C, 0xFC9D, 0xFC9E,
+     0xFC9F, 0xFCA0, 0xFCA1, 0xFCA2, 0xFCA3, 0xFCA4, 0xFCA5, 0xFCA6,
+     0xFCA7, 0xFCA8, 0xFCA9, 0xFCAA, 0xFCAB, 0xFCAC, 0xFCAD, 0xFCAE,
+     0xFCAF, 0xFCB0, 0xFCB1, 0xFCB2, 0xFCB3, 0xFCB4, 0xFCB5, 0xFCB6,
+     0xFCB7, 0xFCB8, 0xFCB9, 0xFCBA, 0xFCBB, 0xFCBC, 0xFCBD, 0xFCBE,
+     0xFCBF, 0xFCC0, 0xFCC1, 0xFCC2, 0xFCC3, 0xFCC4, 0xFCC5, 0xFCC6,
+     0xFCC7, 0xFCC8, 0xFCC9, 0xFCCA, 0xFCCB, 0xFCCC, 0xFCCD, 0xFCCE,
+     0xFCCF, 0xFCD0, 0xFCD1, 0xFCD2, 0xFCD3, 0xFCD4, 0xFCD5, 0xFCD6,
+     0xFCD7, 0xFCD8, 0xFCD9, 0xFCDA, 0xFCDB, 0xFCDC, 0xFCDD, 0xFCDE,
+     0xFCDF, 0xFCE0, 0xFCE1, 0xFCE2, 0xFCE3, 0xFCE4, 0xFCE5, 0xFCE6,
+     0xFCE7, 0xFCE8, 0xFCE9, 0xFCEA, 0xFCEB, 0xFCEC, 0xFCED, 0xFCEE,
+     0xFCEF, 0xFCF0, 0xFCF1, 0xFCF2, 0xFCF3, 0xFCF4, 0xFCF5, 0xFCF6,
+     0xFCF7, 0xFCF8, 0xFCF9, 0xFCFA, 0xFCFB, 0xFCFC, 0xFCFD, 0xFCFE,
+     0xFCFF, 0xFD00, 0xFD01, 0xFD02, 0xFD03, 0xFD04, 0xFD05, 0xFD06,
+     0xFD07, 0xFD08, 0xFD09, 0xFD0A, 0xFD0B, 0xFD0C, 0xFD0D, 0xFD0E,
+     0xFD0F, 0xFD10, 0xFD11, 0xFD12, 0xFD13, 0xFD14, 0xFD15, 0xFD16,
+     0xFD17, 0xFD18, 0xFD19, 0xFD1A, 0xFD1B, 0xFD1C, 0xFD1D, 0xFD1E,
+     0xFD1F, 0xFD20, 0xFD21, 0xFD22, 0xFD23, 0xFD24, 0xFD25, 0xFD26,
+     0xFD27, 0xFD28, 0xFD29, 0xFD2A, 0xFD2B, 0xFD2C, 0xFD2D, 0xFD2E,
+     0xFD2F, 0xFD30, 0xFD31, 0xFD32, 0xFD33, 0xFD34, 0xFD35, 0xFD36,
+     0xFD37, 0xFD38, 0xFD39, 0xFD3A, 0xFD3B, 0xFD3C, 0xFD3D, 0xFD50,
+     0xFD51, 0xFD52, 0xFD53, 0xFD54, 0xFD55, 0xFD56, 0xFD57, 0xFD58,
+     0xFD59, 0xFD5A, 0xFD5B, 0xFD5C, 0xFD5D, 0xFD5E, 0xFD5F, 0xFD60,
+     0xFD61, 0xFD62, 0xFD63, 0xFD64, 0xFD65, 0xFD66, 0xFD67, 0xFD68,
+     0xFD69, 0xFD6A, 0xFD6B, 0xFD6C, 0xFD6D, 0xFD6E, 0xFD6F, 0xFD70,
+     0xFD71, 0xFD72, 0xFD73, 0xFD74, 0xFD75, 0xFD76, 0xFD77, 0xFD78,
+     0xFD79, 0xFD7A, 0xFD7B, 0xFD7C, 0xFD7D, 0xFD7E, 0xFD7F, 0xFD80,
+     0xFD81, 0xFD82, 0xFD83, 0xFD84, 0xFD85, 0xFD86, 0xFD87, 0xFD88,
+     0xFD89, 0xFD8A, 0xFD8B, 0xFD8C, 0xFD8D, 0xFD8E, 0xFD8F, 0xFD92,
+     0xFD93, 0xFD94, 0xFD95, 0xFD96, 0xFD97, 0xFD98, 0xFD99, 0xFD9A,
+     0xFD9B, 0xFD9C, 0xFD9D, 0xFD9E, 0xFD9F, 0xFDA0, 0xFDA1, 0xFDA2,
+     0xFDA3, 0xFDA4, 0xFDA5, 0xFDA6, 0xFDA7, 0xFDA8, 0xFDA9, 0xFDAA,
+     0xFDAB, 0xFDAC, 0xFDAD, 0xFDAE, 0xFDAF, 0xFDB0, 0xFDB1, 0xFDB2,
+     0xFDB3, 0xFDB4, 0xFDB5, 0xFDB6, 0xFDB7, 0xFDB8, 0xFDB9, 0xFDBA,
+     0xFDBB, 0xFDBC, 0xFDBD, 0xFDBE, 0xFDBF, 0xFDC0, 0xFDC1, 0xFDC2,
+     0xFDC3, 0xFDC4, 0xFDC5, 0xFDC6, 0xFDC7, 0xFDF0, 0xFDF1, 0xFDF2,
+     0xFDF3, 0xFDF4, 0xFDF5, 0xFDF6, 0xFDF7, 0xFDF8, 0xFDF9, 0xFDFA,
+     0xFDFB, 0xFDFC, 0xFE10, 0xFE11, 0xFE12, 0xFE13, 0xFE14, 0xFE15,
+     0xFE16, 0xFE17, 0xFE18, 0xFE19, 0xFE30, 0xFE31, 0xFE32, 0xFE33,
+     0xFE34, 0xFE35, 0xFE36, 0xFE37, 0xFE38, 0xFE39, 0xFE3A, 0xFE3B,
+     0xFE3C, 0xFE3D, 0xFE3E, 0xFE3F, 0xFE40, 0xFE41, 0xFE42, 0xFE43,
+     0xFE44, 0xFE47, 0xFE48, 0xFE49, 0xFE4A, 0xFE4B, 0xFE4C, 0xFE4D,
+     0xFE4E, 0xFE4F, 0xFE50, 0xFE51, 0xFE52, 0xFE54, 0xFE55, 0xFE56,
+     0xFE57, 0xFE58, 0xFE59, 0xFE5A, 0xFE5B, 0xFE5C, 0xFE5D, 0xFE5E,
+     0xFE5F, 0xFE60, 0xFE61, 0xFE62, 0xFE63, 0xFE64, 0xFE65, 0xFE66,
+     0xFE68, 0xFE69, 0xFE6A, 0xFE6B, 0xFE70, 0xFE71, 0xFE72, 0xFE74,
+     0xFE76, 0xFE77, 0xFE78, 0xFE79, 0xFE7A, 0xFE7B, 0xFE7C, 0xFE7D,
+     0xFE7E, 0xFE7F, 0xFE80, 0xFE81, 0xFE82, 0xFE83, 0xFE84, 0xFE85,
+     0xFE86, 0xFE87, 0xFE88, 0xFE89, 0xFE8A, 0xFE8B, 0xFE8C, 0xFE8D,
+     0xFE8E, 0xFE8F, 0xFE90, 0xFE91, 0xFE92, 0xFE93, 0xFE94, 0xFE95,
+     0xFE96, 0xFE97, 0xFE98, 0xFE99, 0xFE9A, 0xFE9B, 0xFE9C, 0xFE9D,
+     0xFE9E, 0xFE9F, 0xFEA0, 0xFEA1, 0xFEA2, 0xFEA3, 0xFEA4, 0xFEA5,
+     0xFEA6, 0xFEA7, 0xFEA8, 0xFEA9, 0xFEAA, 0xFEAB, 0xFEAC, 0xFEAD,
+     0xFEAE, 0xFEAF, 0xFEB0, 0xFEB1, 0xFEB2, 0xFEB3, 0xFEB4, 0xFEB5,
+     0xFEB6, 0xFEB7, 0xFEB8, 0xFEB9, 0xFEBA, 0xFEBB, 0xFEBC, 0xFEBD,
+     0xFEBE, 0xFEBF, 0xFEC0, 0xFEC1, 0xFEC2, 0xFEC3, 0xFEC4, 0xFEC5,
+     0xFEC6, 0xFEC7, 0xFEC8, 0xFEC9, 0xFECA, 0xFECB, 0xFECC, 0xFECD,
+     0xFECE, 0xFECF, 0xFED0, 0xFED1, 0xFED2, 0xFED3, 0xFED4, 0xFED5,
+     0xFED6, 0xFED7, 0xFED8, 0xFED9, 0xFEDA, 0xFEDB, 0xFEDC, 0xFEDD,
+     0xFEDE, 0xFEDF, 0xFEE0, 0xFEE1, 0xFEE2, 0xFEE3, 0xFEE4, 0xFEE5,
+     0xFEE6, 0xFEE7, 0xFEE8, 0xFEE9, 0xFEEA, 0xFEEB, 0xFEEC, 0xFEED,
+     0xFEEE, 0xFEEF, 0xFEF0, 0xFEF1, 0xFEF2, 0xFEF3, 0xFEF4, 0xFEF5,
+     0xFEF6, 0xFEF7, 0xFEF8, 0xFEF9, 0xFEFA, 0xFEFB, 0xFEFC, 0xFF01,
+     0xFF02, 0xFF03, 0xFF04, 0xFF05, 0xFF06, 0xFF07, 0xFF08, 0xFF09,
+     0xFF0A, 0xFF0B, 0xFF0C, 0xFF0D, 0xFF0E, 0xFF0F, 0xFF10, 0xFF11,
+     0xFF12, 0xFF13, 0xFF14, 0xFF15, 0xFF16, 0xFF17, 0xFF18, 0xFF19,
+     0xFF1A, 0xFF1B, 0xFF1C, 0xFF1D, 0xFF1E, 0xFF1F, 0xFF20, 0xFF21,
+     0xFF22, 0xFF23, 0xFF24, 0xFF25, 0xFF26, 0xFF27, 0xFF28, 0xFF29,
+     0xFF2A, 0xFF2B, 0xFF2C, 0xFF2D, 0xFF2E, 0xFF2F, 0xFF30, 0xFF31,
+     0xFF32, 0xFF33, 0xFF34, 0xFF35, 0xFF36, 0xFF37, 0xFF38, 0xFF39,
+     0xFF3A, 0xFF3B, 0xFF3C, 0xFF3D, 0xFF3E, 0xFF3F, 0xFF40, 0xFF41,
+     0xFF42, 0xFF43, 0xFF44, 0xFF45, 0xFF46, 0xFF47, 0xFF48, 0xFF49,
+     0xFF4A, 0xFF4B, 0xFF4C, 0xFF4D, 0xFF4E, 0xFF4F, 0xFF50, 0xFF51,
+     0xFF52, 0xFF53, 0xFF54, 0xFF55, 0xFF56, 0xFF57, 0xFF58, 0xFF59,
+     0xFF5A, 0xFF5B, 0xFF5C, 0xFF5D, 0xFF5E, 0xFF5F, 0xFF60, 0xFF61,
+     0xFF62, 0xFF63, 0xFF64, 0xFF65, 0xFF66, 0xFF67, 0xFF68, 0xFF69,
+     0xFF6A, 0xFF6B, 0xFF6C, 0xFF6D, 0xFF6E, 0xFF6F, 0xFF70, 0xFF71,
+     0xFF72, 0xFF73, 0xFF74, 0xFF75, 0xFF76, 0xFF77, 0xFF78, 0xFF79,
+     0xFF7A, 0xFF7B, 0xFF7C, 0xFF7D, 0xFF7E, 0xFF7F, 0xFF80, 0xFF81,
+     0xFF82, 0xFF83, 0xFF84, 0xFF85, 0xFF86, 0xFF87, 0xFF88, 0xFF89,
+     0xFF8A, 0xFF8B, 0xFF8C, 0xFF8D, 0xFF8E, 0xFF8F, 0xFF90, 0xFF91,
+     0xFF92, 0xFF93, 0xFF94, 0xFF95, 0xFF96, 0xFF97, 0xFF98, 0xFF99,
+     0xFF9A, 0xFF9B, 0xFF9C, 0xFF9D, 0xFF9E, 0xFF9F, 0xFFA0, 0xFFA1,
+     0xFFA2, 0xFFA3, 0xFFA4, 0xFFA5, 0xFFA6, 0xFFA7, 0xFFA8, 0xFFA9,
+     0xFFAA, 0xFFAB, 0xFFAC, 0xFFAD, 0xFFAE, 0xFFAF, 0xFFB0, 0xFFB1,
+     0xFFB2, 0xFFB3, 0xFFB4, 0xFFB5, 0xFFB6, 0xFFB7, 0xFFB8, 0xFFB9,
+     0xFFBA, 0xFFBB, 0xFFBC, 0xFFBD, 0xFFBE, 0xFFC2, 0xFFC3, 0xFFC4,
+     0xFFC5, 0xFFC6, 0xFFC7, 0xFFCA, 0xFFCB, 0xFFCC, 0xFFCD, 0xFFCE,
+     0xFFCF, 0xFFD2, 0xFFD3, 0xFFD4, 0xFFD5, 0xFFD6, 0xFFD7, 0xFFDA,
+     0xFFDB, 0xFFDC, 0xFFE0, 0xFFE1, 0xFFE2, 0xFFE3, 0xFFE4, 0xFFE5,
+     0xFFE6, 0xFFE8, 0xFFE9, 0xFFEA, 0xFFEB, 0xFFEC, 0xFFED, 0xFFEE,
+     0x10781, 0x10782, 0x10783, 0x10784, 0x10785, 0x10787, 0x10788, 0x10789,
+     0x1078A, 0x1078B, 0x1078C, 0x1078D, 0x1078E, 0x1078F, 0x10790, 0x10791,
+     0x10792, 0x10793, 0x10794, 0x10795, 0x10796, 0x10797, 0x10798, 0x10799,
+     0x1079A, 0x1079B, 0x1079C, 0x1079D, 0x1079E, 0x1079F, 0x107A0, 0x107A1,
+     0x107A2, 0x107A3, 0x107A4, 0x107A5, 0x107A6, 0x107A7, 0x107A8, 0x107A9,
+     0x107AA, 0x107AB, 0x107AC, 0x107AD, 0x107AE, 0x107AF, 0x107B0, 0x107B2,
+     0x107B3, 0x107B4, 0x107B5, 0x107B6, 0x107B7, 0x107B8, 0x107B9, 0x107BA,
+     0x1109A, 0x1109C, 0x110AB, 0x1112E, 0x1112F, 0x1134B, 0x1134C, 0x114BB,
+     0x114BC, 0x114BE, 0x115BA, 0x115BB, 0x11938, 0x1D15E, 0x1D15F, 0x1D160,
+     0x1D161, 0x1D162, 0x1D163, 0x1D164, 0x1D1BB, 0x1D1BC, 0x1D1BD, 0x1D1BE,
+     0x1D1BF, 0x1D1C0, 0x1D400, 0x1D401, 0x1D402, 0x1D403, 0x1D404, 0x1D405,
+     0x1D406, 0x1D407, 0x1D408, 0x1D409, 0x1D40A, 0x1D40B, 0x1D40C, 0x1D40D,
+     0x1D40E, 0x1D40F, 0x1D410, 0x1D411, 0x1D412, 0x1D413, 0x1D414, 0x1D415,
+     0x1D416, 0x1D417, 0x1D418, 0x1D419, 0x1D41A, 0x1D41B, 0x1D41C, 0x1D41D,
+     0x1D41E, 0x1D41F, 0x1D420, 0x1D421, 0x1D422, 0x1D423, 0x1D424, 0x1D425,
+     0x1D426, 0x1D427, 0x1D428, 0x1D429, 0x1D42A, 0x1D42B, 0x1D42C, 0x1D42D,
+     0x1D42E, 0x1D42F, 0x1D430, 0x1D431, 0x1D432, 0x1D433, 0x1D434, 0x1D435,
+     0x1D436, 0x1D437, 0x1D438, 0x1D439, 0x1D43A, 0x1D43B, 0x1D43C, 0x1D43D,
+     0x1D43E, 0x1D43F, 0x1D440, 0x1D441, 0x1D442, 0x1D443, 0x1D444, 0x1D445,
+     0x1D446, 0x1D447, 0x1D448, 0x1D449, 0x1D44A, 0x1D44B, 0x1D44C, 0x1D44D,
+     0x1D44E, 0x1D44F, 0x1D450, 0x1D451, 0x1D452, 0x1D453, 0x1D454, 0x1D456,
+     0x1D457, 0x1D458, 0x1D459, 0x1D45A, 0x1D45B, 0x1D45C, 0x1D45D, 0x1D45E,
+     0x1D45F, 0x1D460, 0x1D461, 0x1D462, 0x1D463, 0x1D464, 0x1D465, 0x1D466,
+     0x1D467, 0x1D468, 0x1D469, 0x1D46A, 0x1D46B, 0x1D46C, 0x1D46D, 0x1D46E,
+     0x1D46F, 0x1D470, 0x1D471, 0x1D472, 0x1D473, 0x1D474, 0x1D475, 0x1D476,
+     0x1D477, 0x1D478, 0x1D479, 0x1D47A, 0x1D47B, 0x1D47C, 0x1D47D, 0x1D47E,
+     0x1D47F, 0x1D480, 0x1D481, 0x1D482, 0x1D483, 0x1D484, 0x1D485, 0x1D486,
+     0x1D487, 0x1D488, 0x1D489, 0x1D48A, 0x1D48B, 0x1D48C, 0x1D48D, 0x1D48E,
+     0x1D48F, 0x1D490, 0x1D491, 0x1D492, 0x1D493, 0x1D494, 0x1D495, 0x1D496,
+     0x1D497, 0x1D498, 0x1D499, 0x1D49A, 0x1D49B, 0x1D49C, 0x1D49E, 0x1D49F,
+     0x1D4A2, 0x1D4A5, 0x1D4A6, 0x1D4A9, 0x1D4AA, 0x1D4AB, 0x1D4AC, 0x1D4AE,
+     0x1D4AF, 0x1D4B0, 0x1D4B1, 0x1D4B2, 0x1D4B3, 0x1D4B4, 0x1D4B5, 0x1D4B6,
+     0x1D4B7, 0x1D4B8, 0x1D4B9, 0x1D4BB, 0x1D4BD, 0x1D4BE, 0x1D4BF, 0x1D4C0,
+     0x1D4C1, 0x1D4C2, 0x1D4C3, 0x1D4C5, 0x1D4C6, 0x1D4C7, 0x1D4C8, 0x1D4C9,
+     0x1D4CA, 0x1D4CB, 0x1D4CC, 0x1D4CD, 0x1D4CE, 0x1D4CF, 0x1D4D0, 0x1D4D1,
+     0x1D4D2, 0x1D4D3, 0x1D4D4, 0x1D4D5, 0x1D4D6, 0x1D4D7, 0x1D4D8, 0x1D4D9,
+     0x1D4DA, 0x1D4DB, 0x1D4DC, 0x1D4DD, 0x1D4DE, 0x1D4DF, 0x1D4E0, 0x1D4E1,
+     0x1D4E2, 0x1D4E3, 0x1D4E4, 0x1D4E5, 0x1D4E6, 0x1D4E7, 0x1D4E8, 0x1D4E9,
+     0x1D4EA, 0x1D4EB, 0x1D4EC, 0x1D4ED, 0x1D4EE, 0x1D4EF, 0x1D4F0, 0x1D4F1,
+     0x1D4F2, 0x1D4F3, 0x1D4F4, 0x1D4F5, 0x1D4F6, 0x1D4F7, 0x1D4F8, 0x1D4F9,
+     0x1D4FA, 0x1D4FB, 0x1D4FC, 0x1D4FD, 0x1D4FE, 0x1D4FF, 0x1D500, 0x1D501,
+     0x1D502, 0x1D503, 0x1D504, 0x1D505, 0x1D507, 0x1D508, 0x1D509, 0x1D50A,
+     0x1D50D, 0x1D50E, 0x1D50F, 0x1D510, 0x1D511, 0x1D512, 0x1D513, 0x1D514,
+     0x1D516, 0x1D517, 0x1D518, 0x1D519, 0x1D51A, 0x1D51B, 0x1D51C, 0x1D51E,
+     0x1D51F, 0x1D520, 0x1D521, 0x1D522, 0x1D523, 0x1D524, 0x1D525, 0x1D526,
+     0x1D527, 0x1D528, 0x1D529, 0x1D52A, 0x1D52B, 0x1D52C, 0x1D52D, 0x1D52E,
+     0x1D52F, 0x1D530, 0x1D531, 0x1D532, 0x1D533, 0x1D534, 0x1D535, 0x1D536,
+     0x1D537, 0x1D538, 0x1D539, 0x1D53B, 0x1D53C, 0x1D53D, 0x1D53E, 0x1D540,
+     0x1D541, 0x1D542, 0x1D543, 0x1D544, 0x1D546, 0x1D54A, 0x1D54B, 0x1D54C,
+     0x1D54D, 0x1D54E, 0x1D54F, 0x1D550, 0x1D552, 0x1D553, 0x1D554, 0x1D555,
+     0x1D556, 0x1D557, 0x1D558, 0x1D559, 0x1D55A, 0x1D55B, 0x1D55C, 0x1D55D,
+     0x1D55E, 0x1D55F, 0x1D560, 0x1D561, 0x1D562, 0x1D563, 0x1D564, 0x1D565,
+     0x1D566, 0x1D567, 0x1D568, 0x1D569, 0x1D56A, 0x1D56B, 0x1D56C, 0x1D56D,
+     0x1D56E, 0x1D56F, 0x1D570, 0x1D571, 0x1D572, 0x1D573, 0x1D574, 0x1D575,
+     0x1D576, 0x1D577, 0x1D578, 0x1D579, 0x1D57A, 0x1D57B, 0x1D57C, 0x1D57D,
+     0x1D57E, 0x1D57F, 0x1D580, 0x1D581, 0x1D582, 0x1D583, 0x1D584, 0x1D585,
+     0x1D586, 0x1D587, 0x1D588, 0x1D589, 0x1D58A, 0x1D58B, 0x1D58C, 0x1D58D,
+     0x1D58E, 0x1D58F, 0x1D590, 0x1D591, 0x1D592, 0x1D593, 0x1D594, 0x1D595,
+     0x1D596, 0x1D597, 0x1D598, 0x1D599, 0x1D59A, 0x1D59B, 0x1D59C, 0x1D59D,
+     0x1D59E, 0x1D59F, 0x1D5A0, 0x1D5A1, 0x1D5A2, 0x1D5A3, 0x1D5A4, 0x1D5A5,
+     0x1D5A6, 0x1D5A7, 0x1D5A8, 0x1D5A9, 0x1D5AA, 0x1D5AB, 0x1D5AC, 0x1D5AD,
+     0x1D5AE, 0x1D5AF, 0x1D5B0, 0x1D5B1, 0x1D5B2, 0x1D5B3, 0x1D5B4, 0x1D5B5,
+     0x1D5B6, 0x1D5B7, 0x1D5B8, 0x1D5B9, 0x1D5BA, 0x1D5BB, 0x1D5BC, 0x1D5BD,
+     0x1D5BE, 0x1D5BF, 0x1D5C0, 0x1D5C1, 0x1D5C2, 0x1D5C3, 0x1D5C4, 0x1D5C5,
+     0x1D5C6, 0x1D5C7, 0x1D5C8, 0x1D5C9, 0x1D5CA, 0x1D5CB, 0x1D5CC, 0x1D5CD,
+     0x1D5CE, 0x1D5CF, 0x1D5D0, 0x1D5D1, 0x1D5D2, 0x1D5D3, 0x1D5D4, 0x1D5D5,
+     0x1D5D6, 0x1D5D7, 0x1D5D8, 0x1D5D9, 0x1D5DA, 0x1D5DB, 0x1D5DC, 0x1D5DD,
+     0x1D5DE, 0x1D5DF, 0x1D5E0, 0x1D5E1, 0x1D5E2, 0x1D5E3, 0x1D5E4, 0x1D5E5,
+     0x1D5E6, 0x1D5E7, 0x1D5E8, 0x1D5E9, 0x1D5EA, 0x1D5EB, 0x1D5EC, 0x1D5ED,
+     0x1D5EE, 0x1D5EF, 0x1D5F0, 0x1D5F1, 0x1D5F2, 0x1D5F3, 0x1D5F4, 0x1D5F5,
+     0x1D5F6, 0x1D5F7, 0x1D5F8, 0x1D5F9, 0x1D5FA, 0x1D5FB, 0x1D5FC, 0x1D5FD,
+     0x1D5FE, 0x1D5FF, 0x1D600, 0x1D601, 0x1D602, 0x1D603, 0x1D604, 0x1D605,
+     0x1D606, 0x1D607, 0x1D608, 0x1D609, 0x1D60A, 0x1D60B, 0x1D60C, 0x1D60D,
+     0x1D60E, 0x1D60F, 0x1D610, 0x1D611, 0x1D612, 0x1D613, 0x1D614, 0x1D615,
+     0x1D616, 0x1D617, 0x1D618, 0x1D619, 0x1D61A, 0x1D61B, 0x1D61C, 0x1D61D,
+     0x1D61E, 0x1D61F, 0x1D620, 0x1D621, 0x1D622, 0x1D623, 0x1D624, 0x1D625,
+     0x1D626, 0x1D627, 0x1D628, 0x1D629, 0x1D62A, 0x1D62B, 0x1D62C, 0x1D62D,
+     0x1D62E, 0x1D62F, 0x1D630, 0x1D631, 0x1D632, 0x1D633, 0x1D634, 0x1D635,
+     0x1D636, 0x1D637, 0x1D638, 0x1D639, 0x1D63A, 0x1D63B, 0x1D63C, 0x1D63D,
+     0x1D63E, 0x1D63F, 0x1D640, 0x1D641, 0x1D642, 0x1D643, 0x1D644, 0x1D645,
+     0x1D646, 0x1D647, 0x1D648, 0x1D649, 0x1D64A, 0x1D64B, 0x1D64C, 0x1D64D,
+     0x1D64E, 0x1D64F, 0x1D650, 0x1D651, 0x1D652, 0x1D653, 0x1D654, 0x1D655,
+     0x1D656, 0x1D657, 0x1D658, 0x1D659, 0x1D65A, 0x1D65B, 0x1D65C, 0x1D65D,
+     0x1D65E, 0x1D65F, 0x1D660, 0x1D661, 0x1D662, 0x1D663, 0x1D664, 0x1D665,
+     0x1D666, 0x1D667, 0x1D668, 0x1D669, 0x1D66A, 0x1D66B, 0x1D66C, 0x1D66D,
+     0x1D66E, 0x1D66F, 0x1D670, 0x1D671, 0x1D672, 0x1D673, 0x1D674, 0x1D675,
+     0x1D676, 0x1D677, 0x1D678, 0x1D679, 0x1D67A, 0x1D67B, 0x1D67C, 0x1D67D,
+     0x1D67E, 0x1D67F, 0x1D680, 0x1D681, 0x1D682, 0x1D683, 0x1D684, 0x1D685,
+     0x1D686, 0x1D687, 0x1D688, 0x1D689, 0x1D68A, 0x1D68B, 0x1D68C, 0x1D68D,
+     0x1D68E, 0x1D68F, 0x1D690, 0x1D691, 0x1D692, 0x1D693, 0x1D694, 0x1D695,
+     0x1D696, 0x1D697, 0x1D698, 0x1D699, 0x1D69A, 0x1D69B, 0x1D69C, 0x1D69D,
+     0x1D69E, 0x1D69F, 0x1D6A0, 0x1D6A1, 0x1D6A2, 0x1D6A3, 0x1D6A4, 0x1D6A5,
+     0x1D6A8, 0x1D6A9, 0x1D6AA, 0x1D6AB, 0x1D6AC, 0x1D6AD, 0x1D6AE, 0x1D6AF,
+     0x1D6B0, 0x1D6B1, 0x1D6B2, 0x1D6B3, 0x1D6B4, 0x1D6B5, 0x1D6B6, 0x1D6B7,
+     0x1D6B8, 0x1D6B9, 0x1D6BA, 0x1D6BB, 0x1D6BC, 0x1D6BD, 0x1D6BE, 0x1D6BF,
+     0x1D6C0, 0x1D6C1, 0x1D6C2, 0x1D6C3, 0x1D6C4, 0x1D6C5, 0x1D6C6, 0x1D6C7,
+     0x1D6C8, 0x1D6C9, 0x1D6CA, 0x1D6CB, 0x1D6CC, 0x1D6CD, 0x1D6CE, 0x1D6CF,
+     0x1D6D0, 0x1D6D1, 0x1D6D2, 0x1D6D3, 0x1D6D4, 0x1D6D5, 0x1D6D6, 0x1D6D7,
+     0x1D6D8, 0x1D6D9, 0x1D6DA, 0x1D6DB, 0x1D6DC, 0x1D6DD, 0x1D6DE, 0x1D6DF,
+     0x1D6E0, 0x1D6E1, 0x1D6E2, 0x1D6E3, 0x1D6E4, 0x1D6E5, 0x1D6E6, 0x1D6E7,
+     0x1D6E8, 0x1D6E9, 0x1D6EA, 0x1D6EB, 0x1D6EC, 0x1D6ED, 0x1D6EE, 0x1D6EF,
+     0x1D6F0, 0x1D6F1, 0x1D6F2, 0x1D6F3, 0x1D6F4, 0x1D6F5, 0x1D6F6, 0x1D6F7,
+     0x1D6F8, 0x1D6F9, 0x1D6FA, 0x1D6FB, 0x1D6FC, 0x1D6FD, 0x1D6FE, 0x1D6FF,
+     0x1D700, 0x1D701, 0x1D702, 0x1D703, 0x1D704, 0x1D705, 0x1D706, 0x1D707,
+     0x1D708, 0x1D709, 0x1D70A, 0x1D70B, 0x1D70C, 0x1D70D, 0x1D70E, 0x1D70F,
+     0x1D710, 0x1D711, 0x1D712, 0x1D713, 0x1D714, 0x1D715, 0x1D716, 0x1D717,
+     0x1D718, 0x1D719, 0x1D71A, 0x1D71B, 0x1D71C, 0x1D71D, 0x1D71E, 0x1D71F,
+     0x1D720, 0x1D721, 0x1D722, 0x1D723, 0x1D724, 0x1D725, 0x1D726, 0x1D727,
+     0x1D728, 0x1D729, 0x1D72A, 0x1D72B, 0x1D72C, 0x1D72D, 0x1D72E, 0x1D72F,
+     0x1D730, 0x1D731, 0x1D732, 0x1D733, 0x1D734, 0x1D735, 0x1D736, 0x1D737,
+     0x1D738, 0x1D739, 0x1D73A, 0x1D73B, 0x1D73C, 0x1D73D, 0x1D73E, 0x1D73F,
+     0x1D740, 0x1D741, 0x1D742, 0x1D743, 0x1D744, 0x1D745, 0x1D746, 0x1D747,
+     0x1D748, 0x1D749, 0x1D74A, 0x1D74B, 0x1D74C, 0x1D74D, 0x1D74E, 0x1D74F,
+     0x1D750, 0x1D751, 0x1D752, 0x1D753, 0x1D754, 0x1D755, 0x1D756, 0x1D757,
+     0x1D758, 0x1D759, 0x1D75A, 0x1D75B, 0x1D75C, 0x1D75D, 0x1D75E, 0x1D75F,
+     0x1D760, 0x1D761, 0x1D762, 0x1D763, 0x1D764, 0x1D765, 0x1D766, 0x1D767,
+     0x1D768, 0x1D769, 0x1D76A, 0x1D76B, 0x1D76C, 0x1D76D, 0x1D76E, 0x1D76F,
+     0x1D770, 0x1D771, 0x1D772, 0x1D773, 0x1D774, 0x1D775, 0x1D776, 0x1D777,
+     0x1D778, 0x1D779, 0x1D77A, 0x1D77B, 0x1D77C, 0x1D77D, 0x1D77E, 0x1D77F,
+     0x1D780, 0x1D781, 0x1D782, 0x1D783, 0x1D784, 0x1D785, 0x1D786, 0x1D787,
+     0x1D788, 0x1D789, 0x1D78A, 0x1D78B, 0x1D78C, 0x1D78D, 0x1D78E, 0x1D78F,
+     0x1D790, 0x1D791, 0x1D792, 0x1D793, 0x1D794, 0x1D795, 0x1D796, 0x1D797,
+     0x1D798, 0x1D799, 0x1D79A, 0x1D79B, 0x1D79C, 0x1D79D, 0x1D79E, 0x1D79F,
+     0x1D7A0, 0x1D7A1, 0x1D7A2, 0x1D7A3, 0x1D7A4, 0x1D7A5, 0x1D7A6, 0x1D7A7,
+     0x1D7A8, 0x1D7A9, 0x1D7AA, 0x1D7AB, 0x1D7AC, 0x1D7AD, 0x1D7AE, 0x1D7AF,
+     0x1D7B0, 0x1D7B1, 0x1D7B2, 0x1D7B3, 0x1D7B4, 0x1D7B5, 0x1D7B6, 0x1D7B7,
+     0x1D7B8, 0x1D7B9, 0x1D7BA, 0x1D7BB, 0x1D7BC, 0x1D7BD, 0x1D7BE, 0x1D7BF,
+     0x1D7C0, 0x1D7C1, 0x1D7C2, 0x1D7C3, 0x1D7C4, 0x1D7C5, 0x1D7C6, 0x1D7C7,
+     0x1D7C8, 0x1D7C9, 0x1D7CA, 0x1D7CB, 0x1D7CE, 0x1D7CF, 0x1D7D0, 0x1D7D1,
+     0x1D7D2, 0x1D7D3, 0x1D7D4, 0x1D7D5, 0x1D7D6, 0x1D7D7, 0x1D7D8, 0x1D7D9,
+     0x1D7DA, 0x1D7DB, 0x1D7DC, 0x1D7DD, 0x1D7DE, 0x1D7DF, 0x1D7E0, 0x1D7E1,
+     0x1D7E2, 0x1D7E3, 0x1D7E4, 0x1D7E5, 0x1D7E6, 0x1D7E7, 0x1D7E8, 0x1D7E9,
+     0x1D7EA, 0x1D7EB, 0x1D7EC, 0x1D7ED, 0x1D7EE, 0x1D7EF, 0x1D7F0, 0x1D7F1,
+     0x1D7F2, 0x1D7F3, 0x1D7F4, 0x1D7F5, 0x1D7F6, 0x1D7F7, 0x1D7F8, 0x1D7F9,
+     0x1D7FA, 0x1D7FB, 0x1D7FC, 0x1D7FD, 0x1D7FE, 0x1D7FF, 0x1EE00, 0x1EE01,
+     0x1EE02, 0x1EE03, 0x1EE05, 0x1EE06, 0x1EE07, 0x1EE08, 0x1EE09, 0x1EE0A,
+     0x1EE0B, 0x1EE0C, 0x1EE0D, 0x1EE0E, 0x1EE0F, 0x1EE10, 0x1EE11, 0x1EE12,
+     0x1EE13, 0x1EE14, 0x1EE15, 0x1EE16, 0x1EE17, 0x1EE18, 0x1EE19, 0x1EE1A,
+     0x1EE1B, 0x1EE1C, 0x1EE1D, 0x1EE1E, 0x1EE1F, 0x1EE21, 0x1EE22, 0x1EE24,
+     0x1EE27, 0x1EE29, 0x1EE2A, 0x1EE2B, 0x1EE2C, 0x1EE2D, 0x1EE2E, 0x1EE2F,
+     0x1EE30, 0x1EE31, 0x1EE32, 0x1EE34, 0x1EE35, 0x1EE36, 0x1EE37, 0x1EE39,
+     0x1EE3B, 0x1EE42, 0x1EE47, 0x1EE49, 0x1EE4B, 0x1EE4D, 0x1EE4E, 0x1EE4F,
+     0x1EE51, 0x1EE52, 0x1EE54, 0x1EE57, 0x1EE59, 0x1EE5B, 0x1EE5D, 0x1EE5F,
+     0x1EE61, 0x1EE62, 0x1EE64, 0x1EE67, 0x1EE68, 0x1EE69, 0x1EE6A, 0x1EE6C,
+     0x1EE6D, 0x1EE6E, 0x1EE6F, 0x1EE70, 0x1EE71, 0x1EE72, 0x1EE74, 0x1EE75,
+     0x1EE76, 0x1EE77, 0x1EE79, 0x1EE7A, 0x1EE7B, 0x1EE7C, 0x1EE7E, 0x1EE80,
+     0x1EE81, 0x1EE82, 0x1EE83, 0x1EE84, 0x1EE85, 0x1EE86, 0x1EE87, 0x1EE88,
+     0x1EE89, 0x1EE8B, 0x1EE8C, 0x1EE8D, 0x1EE8E, 0x1EE8F, 0x1EE90, 0x1EE91,
+     0x1EE92, 0x1EE93, 0x1EE94, 0x1EE95, 0x1EE96, 0x1EE97, 0x1EE98, 0x1EE99,
+     0x1EE9A, 0x1EE9B, 0x1EEA1, 0x1EEA2, 0x1EEA3, 0x1EEA5, 0x1EEA6, 0x1EEA7,
+     0x1EEA8, 0x1EEA9, 0x1EEAB, 0x1EEAC, 0x1EEAD, 0x1EEAE, 0x1EEAF, 0x1EEB0,
+     0x1EEB1, 0x1EEB2, 0x1EEB3, 0x1EEB4, 0x1EEB5, 0x1EEB6, 0x1EEB7, 0x1EEB8,
+     0x1EEB9, 0x1EEBA, 0x1EEBB, 0x1F100, 0x1F101, 0x1F102, 0x1F103, 0x1F104,
+     0x1F105, 0x1F106, 0x1F107, 0x1F108, 0x1F109, 0x1F10A, 0x1F110, 0x1F111,
+     0x1F112, 0x1F113, 0x1F114, 0x1F115, 0x1F116, 0x1F117, 0x1F118, 0x1F119,
+     0x1F11A, 0x1F11B, 0x1F11C, 0x1F11D, 0x1F11E, 0x1F11F, 0x1F120, 0x1F121,
+     0x1F122, 0x1F123, 0x1F124, 0x1F125, 0x1F126, 0x1F127, 0x1F128, 0x1F129,
+     0x1F12A, 0x1F12B, 0x1F12C, 0x1F12D, 0x1F12E, 0x1F130, 0x1F131, 0x1F132,
+     0x1F133, 0x1F134, 0x1F135, 0x1F136, 0x1F137, 0x1F138, 0x1F139, 0x1F13A,
+     0x1F13B, 0x1F13C, 0x1F13D, 0x1F13E, 0x1F13F, 0x1F140, 0x1F141, 0x1F142,
+     0x1F143, 0x1F144, 0x1F145, 0x1F146, 0x1F147, 0x1F148, 0x1F149, 0x1F14A,
+     0x1F14B, 0x1F14C, 0x1F14D, 0x1F14E, 0x1F14F, 0x1F16A, 0x1F16B, 0x1F16C,
+     0x1F190, 0x1F200, 0x1F201, 0x1F202, 0x1F210, 0x1F211, 0x1F212, 0x1F213,
+     0x1F214, 0x1F215, 0x1F216, 0x1F217, 0x1F218, 0x1F219, 0x1F21A, 0x1F21B,
+     0x1F21C, 0x1F21D, 0x1F21E, 0x1F21F, 0x1F220, 0x1F221, 0x1F222, 0x1F223,
+     0x1F224, 0x1F225, 0x1F226, 0x1F227, 0x1F228, 0x1F229, 0x1F22A, 0x1F22B,
+     0x1F22C, 0x1F22D, 0x1F22E, 0x1F22F, 0x1F230, 0x1F231, 0x1F232, 0x1F233,
+     0x1F234, 0x1F235, 0x1F236, 0x1F237, 0x1F238, 0x1F239, 0x1F23A, 0x1F23B,
+     0x1F240, 0x1F241, 0x1F242, 0x1F243, 0x1F244, 0x1F245, 0x1F246, 0x1F247,
+     0x1F248, 0x1F250, 0x1F251, 0x1FBF0, 0x1FBF1, 0x1FBF2, 0x1FBF3, 0x1FBF4,
+     0x1FBF5, 0x1FBF6, 0x1FBF7, 0x1FBF8, 0x1FBF9, 0x2F800, 0x2F801, 0x2F802,
+     0x2F803, 0x2F804, 0x2F805, 0x2F806, 0x2F807, 0x2F808, 0x2F809, 0x2F80A,
+     0x2F80B, 0x2F80C, 0x2F80D, 0x2F80E, 0x2F80F, 0x2F810, 0x2F811, 0x2F812,
+     0x2F813, 0x2F814, 0x2F815, 0x2F816, 0x2F817, 0x2F818, 0x2F819, 0x2F81A,
+     0x2F81B, 0x2F81C, 0x2F81D, 0x2F81E, 0x2F81F, 0x2F820, 0x2F821, 0x2F822,
+     0x2F823, 0x2F824, 0x2F825, 0x2F826, 0x2F827, 0x2F828, 0x2F829, 0x2F82A,
+     0x2F82B, 0x2F82C, 0x2F82D, 0x2F82E, 0x2F82F, 0x2F830, 0x2F831, 0x2F832,
+     0x2F833, 0x2F834, 0x2F835, 0x2F836, 0x2F837, 0x2F838, 0x2F839, 0x2F83A,
+     0x2F83B, 0x2F83C, 0x2F83D, 0x2F83E, 0x2F83F, 0x2F840, 0x2F841, 0x2F842,
+     0x2F843, 0x2F844, 0x2F845, 0x2F846, 0x2F847, 0x2F848, 0x2F849, 0x2F84A,
+     0x2F84B, 0x2F84C, 0x2F84D, 0x2F84E, 0x2F84F, 0x2F850, 0x2F851, 0x2F852,
+     0x2F853, 0x2F854, 0x2F855, 0x2F856, 0x2F857, 0x2F858, 0x2F859, 0x2F85A,
+     0x2F85B, 0x2F85C, 0x2F85D, 0x2F85E, 0x2F85F, 0x2F860, 0x2F861, 0x2F862,
+     0x2F863, 0x2F864, 0x2F865, 0x2F866, 0x2F867, 0x2F868, 0x2F869, 0x2F86A,
+     0x2F86B, 0x2F86C, 0x2F86D, 0x2F86E, 0x2F86F, 0x2F870, 0x2F871, 0x2F872,
+     0x2F873, 0x2F874, 0x2F875, 0x2F876, 0x2F877, 0x2F878, 0x2F879, 0x2F87A,
+     0x2F87B, 0x2F87C, 0x2F87D, 0x2F87E, 0x2F87F, 0x2F880, 0x2F881, 0x2F882,
+     0x2F883, 0x2F884, 0x2F885, 0x2F886, 0x2F887, 0x2F888, 0x2F889, 0x2F88A,
+     0x2F88B, 0x2F88C, 0x2F88D, 0x2F88E, 0x2F88F, 0x2F890, 0x2F891, 0x2F892,
+     0x2F893, 0x2F894, 0x2F895, 0x2F896, 0x2F897, 0x2F898, 0x2F899, 0x2F89A,
+     0x2F89B, 0x2F89C, 0x2F89D, 0x2F89E, 0x2F89F, 0x2F8A0, 0x2F8A1, 0x2F8A2,
+     0x2F8A3, 0x2F8A4, 0x2F8A5, 0x2F8A6, 0x2F8A7, 0x2F8A8, 0x2F8A9, 0x2F8AA,
+     0x2F8AB, 0x2F8AC, 0x2F8AD, 0x2F8AE, 0x2F8AF, 0x2F8B0, 0x2F8B1, 0x2F8B2,
+     0x2F8B3, 0x2F8B4, 0x2F8B5, 0x2F8B6, 0x2F8B7, 0x2F8B8, 0x2F8B9, 0x2F8BA,
+     0x2F8BB, 0x2F8BC, 0x2F8BD, 0x2F8BE, 0x2F8BF, 0x2F8C0, 0x2F8C1, 0x2F8C2,
+     0x2F8C3, 0x2F8C4, 0x2F8C5, 0x2F8C6, 0x2F8C7, 0x2F8C8, 0x2F8C9, 0x2F8CA,
+     0x2F8CB, 0x2F8CC, 0x2F8CD, 0x2F8CE, 0x2F8CF, 0x2F8D0, 0x2F8D1, 0x2F8D2,
+     0x2F8D3, 0x2F8D4, 0x2F8D5, 0x2F8D6, 0x2F8D7, 0x2F8D8, 0x2F8D9, 0x2F8DA,
+     0x2F8DB, 0x2F8DC, 0x2F8DD, 0x2F8DE, 0x2F8DF, 0x2F8E0, 0x2F8E1, 0x2F8E2,
+     0x2F8E3, 0x2F8E4, 0x2F8E5, 0x2F8E6, 0x2F8E7, 0x2F8E8, 0x2F8E9, 0x2F8EA,
+     0x2F8EB, 0x2F8EC, 0x2F8ED, 0x2F8EE, 0x2F8EF, 0x2F8F0, 0x2F8F1, 0x2F8F2,
+     0x2F8F3, 0x2F8F4, 0x2F8F5, 0x2F8F6, 0x2F8F7, 0x2F8F8, 0x2F8F9, 0x2F8FA,
+     0x2F8FB, 0x2F8FC, 0x2F8FD, 0x2F8FE, 0x2F8FF, 0x2F900, 0x2F901, 0x2F902,
+     0x2F903, 0x2F904, 0x2F905, 0x2F906, 0x2F907, 0x2F908, 0x2F909, 0x2F90A,
+     0x2F90B, 0x2F90C, 0x2F90D, 0x2F90E, 0x2F90F, 0x2F910, 0x2F911, 0x2F912,
+     0x2F913, 0x2F914, 0x2F915, 0x2F916, 0x2F917, 0x2F918, 0x2F919, 0x2F91A,
+     0x2F91B, 0x2F91C, 0x2F91D, 0x2F91E, 0x2F91F, 0x2F920, 0x2F921, 0x2F922,
+     0x2F923, 0x2F924, 0x2F925, 0x2F926, 0x2F927, 0x2F928, 0x2F929, 0x2F92A,
+     0x2F92B, 0x2F92C, 0x2F92D, 0x2F92E, 0x2F92F, 0x2F930, 0x2F931, 0x2F932,
+     0x2F933, 0x2F934, 0x2F935, 0x2F936, 0x2F937, 0x2F938, 0x2F939, 0x2F93A,
+     0x2F93B, 0x2F93C, 0x2F93D, 0x2F93E, 0x2F93F, 0x2F940, 0x2F941, 0x2F942,
+     0x2F943, 0x2F944, 0x2F945, 0x2F946, 0x2F947, 0x2F948, 0x2F949, 0x2F94A,
+     0x2F94B, 0x2F94C, 0x2F94D, 0x2F94E, 0x2F94F, 0x2F950, 0x2F951, 0x2F952,
+     0x2F953, 0x2F954, 0x2F955, 0x2F956, 0x2F957, 0x2F958, 0x2F959, 0x2F95A,
+     0x2F95B, 0x2F95C, 0x2F95D, 0x2F95E, 0x2F95F, 0x2F960, 0x2F961, 0x2F962,
+     0x2F963, 0x2F964, 0x2F965, 0x2F966, 0x2F967, 0x2F968, 0x2F969, 0x2F96A,
+     0x2F96B, 0x2F96C, 0x2F96D, 0x2F96E, 0x2F96F, 0x2F970, 0x2F971, 0x2F972,
+     0x2F973, 0x2F974, 0x2F975, 0x2F976, 0x2F977, 0x2F978, 0x2F979, 0x2F97A,
+     0x2F97B, 0x2F97C, 0x2F97D, 0x2F97E, 0x2F97F, 0x2F980, 0x2F981, 0x2F982,
+     0x2F983, 0x2F984, 0x2F985, 0x2F986, 0x2F987, 0x2F988, 0x2F989, 0x2F98A,
+     0x2F98B, 0x2F98C, 0x2F98D, 0x2F98E, 0x2F98F, 0x2F990, 0x2F991, 0x2F992,
+     0x2F993, 0x2F994, 0x2F995, 0x2F996, 0x2F997, 0x2F998, 0x2F999, 0x2F99A,
+     0x2F99B, 0x2F99C, 0x2F99D, 0x2F99E, 0x2F99F, 0x2F9A0, 0x2F9A1, 0x2F9A2,
+     0x2F9A3, 0x2F9A4, 0x2F9A5, 0x2F9A6, 0x2F9A7, 0x2F9A8, 0x2F9A9, 0x2F9AA,
+     0x2F9AB, 0x2F9AC, 0x2F9AD, 0x2F9AE, 0x2F9AF, 0x2F9B0, 0x2F9B1, 0x2F9B2,
+     0x2F9B3, 0x2F9B4, 0x2F9B5, 0x2F9B6, 0x2F9B7, 0x2F9B8, 0x2F9B9, 0x2F9BA,
+     0x2F9BB, 0x2F9BC, 0x2F9BD, 0x2F9BE, 0x2F9BF, 0x2F9C0, 0x2F9C1, 0x2F9C2,
+     0x2F9C3, 0x2F9C4, 0x2F9C5, 0x2F9C6, 0x2F9C7, 0x2F9C8, 0x2F9C9, 0x2F9CA,
+     0x2F9CB, 0x2F9CC, 0x2F9CD, 0x2F9CE, 0x2F9CF, 0x2F9D0, 0x2F9D1, 0x2F9D2,
+     0x2F9D3, 0x2F9D4, 0x2F9D5, 0x2F9D6, 0x2F9D7, 0x2F9D8, 0x2F9D9, 0x2F9DA,
+     0x2F9DB, 0x2F9DC, 0x2F9DD, 0x2F9DE, 0x2F9DF, 0x2F9E0, 0x2F9E1, 0x2F9E2,
+     0x2F9E3, 0x2F9E4, 0x2F9E5, 0x2F9E6, 0x2F9E7, 0x2F9E8, 0x2F9E9, 0x2F9EA,
+     0x2F9EB, 0x2F9EC, 0x2F9ED, 0x2F9EE, 0x2F9EF, 0x2F9F0, 0x2F9F1, 0x2F9F2,
+     0x2F9F3, 0x2F9F4, 0x2F9F5, 0x2F9F6, 0x2F9F7, 0x2F9F8, 0x2F9F9, 0x2F9FA,
+     0x2F9FB, 0x2F9FC, 0x2F9FD, 0x2F9FE, 0x2F9FF, 0x2FA00, 0x2FA01, 0x2FA02,
+     0x2FA03, 0x2FA04, 0x2FA05, 0x2FA06, 0x2FA07, 0x2FA08, 0x2FA09, 0x2FA0A,
+     0x2FA0B, 0x2FA0C, 0x2FA0D, 0x2FA0E, 0x2FA0F, 0x2FA10, 0x2FA11, 0x2FA12,
+     0x2FA13, 0x2FA14, 0x2FA15, 0x2FA16, 0x2FA17, 0x2FA18, 0x2FA19, 0x2FA1A,
+     0x2FA1B, 0x2FA1C, 0x2FA1D,
+ };
+ 
+ /* Decomposition of decompositionKeys[i] is decompositionData[starts[i] .. starts[i + 1]) */
+ static const uint16_t decompositionStarts[5796] = {
+     0, 1, 3, 4, 6, 7, 8, 10, 11, 13, 14, 15,
+     18, 21, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42,
+     44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66,
+     68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90,
+     92, 94, 96, 98, 100, 102, 104, 106, 108, 110, 112, 114,
+     116, 118, 120, 122, 124, 126, 128, 130, 132, 134, 136, 138,
+     140, 142, 144, 146, 148, 150, 152, 154, 156, 158, 160, 162,
+     164, 166, 168, 170, 172, 174, 176, 178, 180, 182, 184, 186,
+     188, 190, 192, 194, 196, 198, 200, 202, 204, 206, 208, 210,
+     212, 214, 216, 218, 220, 222, 224, 226, 228, 230, 232, 234,
+     236, 238, 240, 242, 244, 246, 248, 250, 252, 254, 256, 258,
+     260, 262, 264, 266, 268, 270, 272, 274, 276, 278, 280, 282,
+     284, 286, 288, 290, 292, 294, 296, 298, 300, 302, 304, 306,
+     308, 310, 312, 314, 316, 318, 320, 322, 324, 326, 328, 330,
+     332, 334, 336, 338, 340, 342, 344, 346, 348, 350, 352, 354,
+     356, 357, 359, 361, 363, 365, 368, 371, 374, 376, 378, 380,
+     382, 384, 386, 388, 390, 392, 394, 396, 398, 400, 402, 405,
+     408, 411, 414, 417, 420, 423, 426, 429, 432, 435, 438, 440,
+     442, 444, 446, 448, 450, 452, 454, 457, 460, 462, 464, 466,
+     468, 470, 472, 474, 476, 478, 480, 483, 486, 488, 490, 492,
+     494, 496, 498, 500, 502, 504, 506, 508, 510, 512, 514, 516,
+     518, 520, 522, 524, 526, 528, 530, 532, 534, 536, 538, 540,
+     542, 544, 546, 548, 550, 552, 554, 556, 558, 560, 562, 565,
+     568, 571, 574, 576, 578, 581, 584, 586, 588, 589, 590, 591,
+     592, 593, 594, 595, 596, 597, 599, 601, 603, 605, 607, 609,
+     610, 611, 612, 613, 614, 615, 616, 617, 619, 620, 622, 623,
+     625, 628, 630, 631, 633, 635, 637, 639, 641, 643, 646, 648,
+     650, 652, 654, 656, 658, 661, 663, 665, 667, 669, 671, 672,
+     673, 674, 676, 678, 679, 680, 681, 682, 683, 684, 685, 686,
+     688, 690, 692, 694, 696, 698, 700, 702, 704, 706, 708, 710,
+     712, 714, 716, 718, 720, 722, 724, 726, 728, 730, 732, 734,
+     736, 738, 740, 742, 744, 746, 748, 750, 752, 754, 756, 758,
+     760, 762, 764, 766, 768, 770, 772, 774, 776, 778, 780, 782,
+     784, 786, 788, 790, 792, 794, 796, 798, 800, 802, 804, 806,
+     808, 810, 812, 814, 816, 818, 820, 822, 824, 826, 828, 830,
+     832, 834, 836, 838, 840, 842, 844, 846, 848, 850, 852, 854,
+     856, 858, 860, 862, 864, 866, 868, 870, 872, 874, 876, 878,
+     880, 882, 884, 886, 888, 891, 893, 895, 897, 899, 901, 904,
+     906, 908, 910, 912, 914, 915, 917, 919, 921, 923, 925, 927,
+     929, 931, 933, 936, 938, 941, 943, 945, 947, 949, 951, 953,
+     955, 957, 958, 960, 962, 964, 966, 968, 970, 972, 974, 976,
+     978, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990,
+     991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002,
+     1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014,
+     1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026,
+     1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038,
+     1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050,
+     1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062,
+     1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074,
+     1075, 1076, 1077, 1078, 1080, 1082, 1084, 1086, 1088, 1090, 1092, 1094,
+     1097, 1100, 1102, 1104, 1106, 1108, 1110, 1112, 1114, 1116, 1118, 1120,
+     1123, 1126, 1129, 1132, 1134, 1136, 1138, 1140, 1143, 1146, 1148, 1150,
+     1152, 1154, 1156, 1158, 1160, 1162, 1164, 1166, 1168, 1170, 1172, 1174,
+     1176, 1178, 1181, 1184, 1186, 1188, 1190, 1192, 1194, 1196, 1198, 1200,
+     1203, 1206, 1208, 1210, 1212, 1214, 1216, 1218, 1220, 1222, 1224, 1226,
+     1228, 1230, 1232, 1234, 1236, 1238, 1240, 1242, 1245, 1248, 1251, 1254,
+     1257, 1260, 1263, 1266, 1268, 1270, 1272, 1274, 1276, 1278, 1280, 1282,
+     1285, 1288, 1290, 1292, 1294, 1296, 1298, 1300, 1303, 1306, 1309, 1312,
+     1315, 1318, 1320, 1322, 1324, 1326, 1328, 1330, 1332, 1334, 1336, 1338,
+     1340, 1342, 1344, 1346, 1349, 1352, 1355, 1358, 1360, 1362, 1364, 1366,
+     1368, 1370, 1372, 1374, 1376, 1378, 1380, 1382, 1384, 1386, 1388, 1390,
+     1392, 1394, 1396, 1398, 1400, 1402, 1404, 1406, 1408, 1410, 1412, 1414,
+     1416, 1418, 1420, 1422, 1424, 1426, 1428, 1430, 1433, 1436, 1439, 1442,
+     1445, 1448, 1451, 1454, 1457, 1460, 1463, 1466, 1469, 1472, 1475, 1478,
+     1481, 1484, 1487, 1490, 1492, 1494, 1496, 1498, 1500, 1502, 1505, 1508,
+     1511, 1514, 1517, 1520, 1523, 1526, 1529, 1532, 1534, 1536, 1538, 1540,
+     1542, 1544, 1546, 1548, 1551, 1554, 1557, 1560, 1563, 1566, 1569, 1572,
+     1575, 1578, 1581, 1584, 1587, 1590, 1593, 1596, 1599, 1602, 1605, 1608,
+     1610, 1612, 1614, 1616, 1619, 1622, 1625, 1628, 1631, 1634, 1637, 1640,
+     1643, 1646, 1648, 1650, 1652, 1654, 1656, 1658, 1660, 1662, 1664, 1666,
+     1669, 1672, 1675, 1678, 1681, 1684, 1686, 1688, 1691, 1694, 1697, 1700,
+     1703, 1706, 1708, 1710, 1713, 1716, 1719, 1722, 1724, 1726, 1729, 1732,
+     1735, 1738, 1740, 1742, 1745, 1748, 1751, 1754, 1757, 1760, 1762, 1764,
+     1767, 1770, 1773, 1776, 1779, 1782, 1784, 1786, 1789, 1792, 1795, 1798,
+     1801, 1804, 1806, 1808, 1811, 1814, 1817, 1820, 1823, 1826, 1828, 1830,
+     1833, 1836, 1839, 1842, 1844, 1846, 1849, 1852, 1855, 1858, 1860, 1862,
+     1865, 1868, 1871, 1874, 1877, 1880, 1882, 1885, 1888, 1891, 1893, 1895,
+     1898, 1901, 1904, 1907, 1910, 1913, 1915, 1917, 1920, 1923, 1926, 1929,
+     1932, 1935, 1937, 1939, 1941, 1943, 1945, 1947, 1949, 1951, 1953, 1955,
+     1957, 1959, 1961, 1963, 1966, 1969, 1973, 1977, 1981, 1985, 1989, 1993,
+     1996, 1999, 2003, 2007, 2011, 2015, 2019, 2023, 2026, 2029, 2033, 2037,
+     2041, 2045, 2049, 2053, 2056, 2059, 2063, 2067, 2071, 2075, 2079, 2083,
+     2086, 2089, 2093, 2097, 2101, 2105, 2109, 2113, 2116, 2119, 2123, 2127,
+     2131, 2135, 2139, 2143, 2145, 2147, 2150, 2152, 2155, 2157, 2160, 2162,
+     2164, 2166, 2168, 2170, 2172, 2173, 2175, 2177, 2180, 2183, 2185, 2188,
+     2190, 2193, 2195, 2197, 2199, 2201, 2203, 2206, 2209, 2212, 2214, 2216,
+     2219, 2222, 2224, 2227, 2229, 2231, 2233, 2235, 2238, 2241, 2244, 2246,
+     2248, 2251, 2254, 2256, 2258, 2260, 2263, 2265, 2267, 2269, 2271, 2273,
+     2276, 2279, 2280, 2283, 2285, 2288, 2290, 2293, 2295, 2297, 2299, 2301,
+     2303, 2305, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316,
+     2317, 2318, 2319, 2321, 2322, 2324, 2327, 2328, 2330, 2333, 2335, 2338,
+     2340, 2342, 2344, 2346, 2348, 2352, 2353, 2354, 2355, 2356, 2357, 2358,
+     2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367, 2368, 2369, 2370,
+     2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382,
+     2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394,
+     2395, 2397, 2400, 2403, 2404, 2406, 2409, 2412, 2413, 2415, 2416, 2417,
+     2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2428, 2429, 2430,
+     2431, 2432, 2433, 2435, 2438, 2440, 2441, 2442, 2443, 2444, 2446, 2447,
+     2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2461,
+     2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2474, 2477,
+     2481, 2484, 2487, 2490, 2493, 2496, 2499, 2502, 2505, 2508, 2511, 2514,
+     2517, 2519, 2520, 2522, 2525, 2527, 2528, 2530, 2533, 2537, 2539, 2540,
+     2542, 2545, 2546, 2547, 2548, 2549, 2550, 2552, 2555, 2557, 2558, 2560,
+     2563, 2567, 2569, 2570, 2572, 2575, 2576, 2577, 2578, 2579, 2582, 2584,
+     2586, 2588, 2590, 2592, 2594, 2596, 2598, 2600, 2602, 2604, 2606, 2609,
+     2611, 2614, 2616, 2618, 2620, 2622, 2624, 2626, 2628, 2630, 2632, 2634,
+     2636, 2638, 2640, 2642, 2644, 2646, 2648, 2650, 2652, 2654, 2656, 2658,
+     2660, 2662, 2664, 2666, 2668, 2670, 2672, 2674, 2676, 2678, 2680, 2681,
+     2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2693, 2695,
+     2697, 2699, 2701, 2703, 2705, 2707, 2709, 2711, 2713, 2716, 2719, 2722,
+     2725, 2728, 2731, 2734, 2737, 2740, 2744, 2748, 2752, 2756, 2760, 2764,
+     2768, 2772, 2776, 2780, 2784, 2786, 2788, 2790, 2792, 2794, 2796, 2798,
+     2800, 2802, 2805, 2808, 2811, 2814, 2817, 2820, 2823, 2826, 2829, 2832,
+     2835, 2838, 2841, 2844, 2847, 2850, 2853, 2856, 2859, 2862, 2865, 2868,
+     2871, 2874, 2877, 2880, 2883, 2886, 2889, 2892, 2895, 2898, 2901, 2904,
+     2907, 2910, 2913, 2914, 2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922,
+     2923, 2924, 2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934,
+     2935, 2936, 2937, 2938, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946,
+     2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956, 2957, 2958,
+     2959, 2960, 2961, 2962, 2963, 2964, 2965, 2966, 2970, 2973, 2975, 2978,
+     2980, 2981, 2982, 2983, 2984, 2985, 2986, 2987, 2988, 2989, 2990, 2991,
+     2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003,
+     3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015,
+     3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027,
+     3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036, 3037, 3038, 3039,
+     3040, 3041, 3042, 3043, 3044, 3045, 3046, 3047, 3048, 3049, 3050, 3051,
+     3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063,
+     3064, 3065, 3066, 3067, 3068, 3069, 3070, 3071, 3072, 3073, 3074, 3075,
+     3076, 3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087,
+     3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096, 3097, 3098, 3099,
+     3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111,
+     3112, 3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123,
+     3124, 3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3133, 3134, 3135,
+     3136, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147,
+     3148, 3149, 3150, 3151, 3152, 3153, 3154, 3155, 3156, 3157, 3158, 3159,
+     3160, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 3168, 3169, 3170, 3171,
+     3172, 3173, 3174, 3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183,
+     3184, 3185, 3186, 3187, 3188, 3189, 3190, 3191, 3192, 3193, 3194, 3195,
+     3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204, 3206, 3208, 3210,
+     3212, 3214, 3216, 3218, 3220, 3222, 3224, 3226, 3228, 3230, 3232, 3234,
+     3236, 3238, 3240, 3242, 3244, 3246, 3248, 3250, 3252, 3254, 3256, 3258,
+     3260, 3262, 3264, 3266, 3268, 3270, 3272, 3274, 3276, 3278, 3280, 3282,
+     3284, 3286, 3288, 3290, 3292, 3294, 3296, 3298, 3300, 3302, 3304, 3306,
+     3308, 3310, 3312, 3314, 3316, 3318, 3320, 3322, 3324, 3326, 3328, 3329,
+     3330, 3331, 3332, 3333, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341,
+     3342, 3343, 3344, 3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352, 3353,
+     3354, 3355, 3356, 3357, 3358, 3359, 3360, 3361, 3362, 3363, 3364, 3365,
+     3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373, 3374, 3375, 3376, 3377,
+     3378, 3379, 3380, 3381, 3382, 3383, 3384, 3385, 3386, 3387, 3388, 3389,
+     3390, 3391, 3392, 3393, 3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401,
+     3402, 3403, 3404, 3405, 3406, 3407, 3408, 3409, 3410, 3411, 3412, 3413,
+     3414, 3415, 3416, 3417, 3418, 3419, 3420, 3421, 3422, 3423, 3424, 3425,
+     3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3439,
+     3442, 3445, 3448, 3451, 3454, 3457, 3460, 3463, 3466, 3469, 3472, 3475,
+     3478, 3482, 3486, 3490, 3494, 3498, 3502, 3506, 3510, 3514, 3518, 3522,
+     3526, 3530, 3534, 3538, 3545, 3551, 3554, 3557, 3560, 3563, 3566, 3569,
+     3572, 3575, 3578, 3581, 3584, 3587, 3590, 3593, 3596, 3599, 3602, 3605,
+     3608, 3611, 3614, 3617, 3620, 3623, 3626, 3629, 3632, 3635, 3638, 3641,
+     3644, 3647, 3650, 3653, 3656, 3659, 3660, 3661, 3662, 3663, 3666, 3668,
+     3670, 3672, 3674, 3676, 3678, 3680, 3682, 3684, 3686, 3688, 3690, 3692,
+     3694, 3696, 3697, 3698, 3699, 3700, 3701, 3702, 3703, 3704, 3705, 3706,
+     3707, 3708, 3709, 3710, 3712, 3714, 3716, 3718, 3720, 3722, 3724, 3726,
+     3728, 3730, 3732, 3734, 3736, 3738, 3743, 3747, 3749, 3750, 3751, 3752,
+     3753, 3754, 3755, 3756, 3757, 3758, 3759, 3760, 3761, 3762, 3763, 3764,
+     3765, 3766, 3767, 3768, 3769, 3770, 3771, 3772, 3773, 3774, 3775, 3776,
+     3777, 3778, 3779, 3780, 3781, 3782, 3783, 3784, 3785, 3786, 3787, 3788,
+     3789, 3790, 3791, 3792, 3793, 3794, 3795, 3796, 3797, 3798, 3800, 3802,
+     3804, 3806, 3808, 3810, 3812, 3814, 3816, 3818, 3820, 3822, 3824, 3826,
+     3828, 3830, 3832, 3834, 3836, 3838, 3840, 3842, 3844, 3846, 3849, 3852,
+     3855, 3857, 3860, 3862, 3865, 3866, 3867, 3868, 3869, 3870, 3871, 3872,
+     3873, 3874, 3875, 3876, 3877, 3878, 3879, 3880, 3881, 3882, 3883, 3884,
+     3885, 3886, 3887, 3888, 3889, 3890, 3891, 3892, 3893, 3894, 3895, 3896,
+     3897, 3898, 3899, 3900, 3901, 3902, 3903, 3904, 3905, 3906, 3907, 3908,
+     3909, 3910, 3911, 3912, 3914, 3919, 3923, 3928, 3931, 3936, 3939, 3942,
+     3948, 3952, 3955, 3958, 3961, 3965, 3969, 3973, 3977, 3981, 3985, 3989,
+     3995, 3997, 4003, 4009, 4014, 4018, 4024, 4030, 4034, 4037, 4040, 4044,
+     4048, 4053, 4058, 4061, 4064, 4068, 4071, 4074, 4076, 4078, 4081, 4084,
+     4090, 4094, 4099, 4105, 4109, 4112, 4115, 4121, 4125, 4131, 4134, 4139,
+     4142, 4146, 4149, 4153, 4158, 4162, 4167, 4171, 4173, 4178, 4181, 4184,
+     4188, 4191, 4194, 4197, 4202, 4206, 4208, 4214, 4217, 4222, 4226, 4230,
+     4233, 4236, 4240, 4242, 4246, 4251, 4253, 4259, 4262, 4264, 4266, 4268,
+     4270, 4272, 4274, 4276, 4278, 4280, 4282, 4285, 4288, 4291, 4294, 4297,
+     4300, 4303, 4306, 4309, 4312, 4315, 4318, 4321, 4324, 4327, 4330, 4332,
+     4334, 4337, 4339, 4341, 4343, 4346, 4349, 4351, 4353, 4355, 4357, 4359,
+     4363, 4365, 4367, 4369, 4371, 4373, 4375, 4377, 4379, 4382, 4386, 4388,
+     4390, 4392, 4394, 4396, 4398, 4400, 4403, 4406, 4409, 4412, 4414, 4416,
+     4418, 4420, 4422, 4424, 4426, 4428, 4430, 4432, 4435, 4438, 4440, 4443,
+     4446, 4449, 4451, 4454, 4457, 4461, 4463, 4466, 4469, 4472, 4475, 4480,
+     4486, 4488, 4490, 4492, 4494, 4496, 4498, 4500, 4502, 4504, 4506, 4508,
+     4510, 4512, 4514, 4516, 4518, 4520, 4522, 4526, 4528, 4530, 4532, 4536,
+     4539, 4541, 4543, 4545, 4547, 4549, 4551, 4553, 4555, 4557, 4559, 4562,
+     4564, 4566, 4569, 4572, 4574, 4578, 4581, 4583, 4585, 4587, 4589, 4592,
+     4595, 4597, 4599, 4601, 4603, 4605, 4607, 4609, 4611, 4613, 4616, 4619,
+     4622, 4625, 4628, 4631, 4634, 4637, 4640, 4643, 4646, 4649, 4652, 4655,
+     4658, 4661, 4664, 4667, 4670, 4673, 4676, 4679, 4682, 4683, 4684, 4685,
+     4686, 4687, 4688, 4689, 4690, 4691, 4692, 4693, 4694, 4695, 4696, 4697,
+     4698, 4699, 4700, 4701, 4702, 4703, 4704, 4705, 4706, 4707, 4708, 4709,
+     4710, 4711, 4712, 4713, 4714, 4715, 4716, 4717, 4718, 4719, 4720, 4721,
+     4722, 4723, 4724, 4725, 4726, 4727, 4728, 4729, 4730, 4731, 4732, 4733,
+     4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741, 4742, 4743, 4744, 4745,
+     4746, 4747, 4748, 4749, 4750, 4751, 4752, 4753, 4754, 4755, 4756, 4757,
+     4758, 4759, 4760, 4761, 4762, 4763, 4764, 4765, 4766, 4767, 4768, 4769,
+     4770, 4771, 4772, 4773, 4774, 4775, 4776, 4777, 4778, 4779, 4780, 4781,
+     4782, 4783, 4784, 4785, 4786, 4787, 4788, 4789, 4790, 4791, 4792, 4793,
+     4794, 4795, 4796, 4797, 4798, 4799, 4800, 4801, 4802, 4803, 4804, 4805,
+     4806, 4807, 4808, 4809, 4810, 4811, 4812, 4813, 4814, 4815, 4816, 4817,
+     4818, 4819, 4820, 4821, 4822, 4823, 4824, 4825, 4826, 4827, 4828, 4829,
+     4830, 4831, 4832, 4833, 4834, 4835, 4836, 4837, 4838, 4839, 4840, 4841,
+     4842, 4843, 4844, 4845, 4846, 4847, 4848, 4849, 4850, 4851, 4852, 4853,
+     4854, 4855, 4856, 4857, 4858, 4859, 4860, 4861, 4862, 4863, 4864, 4865,
+     4866, 4867, 4868, 4869, 4870, 4871, 4872, 4873, 4874, 4875, 4876, 4877,
+     4878, 4879, 4880, 4881, 4882, 4883, 4884, 4885, 4886, 4887, 4888, 4889,
+     4890, 4891, 4892, 4893, 4894, 4895, 4896, 4897, 4898, 4899, 4900, 4901,
+     4902, 4903, 4904, 4905, 4906, 4907, 4908, 4909, 4910, 4911, 4912, 4913,
+     4914, 4915, 4916, 4917, 4918, 4919, 4920, 4921, 4922, 4923, 4924, 4925,
+     4926, 4927, 4928, 4929, 4930, 4931, 4932, 4933, 4934, 4935, 4936, 4937,
+     4938, 4939, 4940, 4941, 4942, 4943, 4944, 4945, 4946, 4947, 4948, 4949,
+     4950, 4951, 4952, 4953, 4954, 4955, 4956, 4957, 4958, 4959, 4960, 4961,
+     4962, 4963, 4964, 4965, 4966, 4967, 4968, 4969, 4970, 4971, 4972, 4973,
+     4974, 4975, 4976, 4977, 4978, 4979, 4980, 4981, 4982, 4983, 4984, 4985,
+     4986, 4987, 4988, 4989, 4990, 4991, 4992, 4993, 4994, 4995, 4996, 4997,
+     4998, 4999, 5000, 5001, 5002, 5003, 5004, 5005, 5006, 5007, 5008, 5009,
+     5010, 5011, 5012, 5013, 5014, 5015, 5016, 5017, 5018, 5019, 5020, 5021,
+     5022, 5023, 5024, 5025, 5026, 5027, 5028, 5029, 5030, 5031, 5032, 5033,
+     5034, 5035, 5036, 5037, 5038, 5039, 5040, 5041, 5042, 5043, 5044, 5045,
+     5046, 5047, 5048, 5049, 5050, 5051, 5052, 5053, 5054, 5055, 5056, 5057,
+     5058, 5059, 5060, 5061, 5062, 5063, 5064, 5065, 5066, 5067, 5068, 5069,
+     5070, 5071, 5072, 5073, 5074, 5075, 5076, 5077, 5078, 5079, 5080, 5081,
+     5082, 5083, 5084, 5085, 5086, 5087, 5088, 5089, 5090, 5091, 5092, 5093,
+     5094, 5095, 5096, 5097, 5098, 5099, 5100, 5101, 5102, 5103, 5104, 5105,
+     5106, 5107, 5108, 5109, 5110, 5111, 5112, 5113, 5114, 5115, 5116, 5117,
+     5118, 5119, 5120, 5121, 5122, 5123, 5124, 5125, 5126, 5127, 5128, 5129,
+     5130, 5131, 5132, 5133, 5134, 5135, 5136, 5137, 5138, 5139, 5140, 5141,
+     5142, 5143, 5144, 5145, 5146, 5147, 5148, 5149, 5150, 5151, 5152, 5153,
+     5154, 5155, 5157, 5159, 5161, 5164, 5167, 5169, 5171, 5173, 5175, 5177,
+     5179, 5181, 5183, 5185, 5186, 5187, 5188, 5189, 5190, 5191, 5192, 5193,
+     5194, 5195, 5197, 5199, 5202, 5205, 5207, 5209, 5211, 5213, 5215, 5217,
+     5219, 5221, 5223, 5225, 5227, 5229, 5231, 5233, 5235, 5237, 5239, 5241,
+     5243, 5245, 5247, 5249, 5251, 5253, 5255, 5257, 5259, 5261, 5263, 5264,
+     5265, 5266, 5267, 5268, 5269, 5270, 5271, 5272, 5273, 5274, 5275, 5276,
+     5277, 5278, 5279, 5280, 5281, 5282, 5283, 5284, 5285, 5286, 5287, 5288,
+     5289, 5290, 5291, 5292, 5293, 5294, 5295, 5296, 5297, 5298, 5299, 5300,
+     5301, 5302, 5303, 5304, 5305, 5306, 5307, 5308, 5309, 5310, 5311, 5312,
+     5313, 5314, 5315, 5316, 5317, 5318, 5319, 5320, 5321, 5322, 5323, 5324,
+     5325, 5326, 5327, 5328, 5329, 5330, 5331, 5332, 5333, 5334, 5335, 5336,
+     5337, 5338, 5339, 5340, 5341, 5342, 5343, 5344, 5345, 5346, 5347, 5349,
+     5351, 5352, 5353, 5354, 5355, 5356, 5357, 5358, 5359, 5360, 5361, 5363,
+     5365, 5366, 5367, 5368, 5369, 5370, 5371, 5372, 5373, 5374, 5375, 5377,
+     5378, 5379, 5380, 5381, 5382, 5383, 5384, 5385, 5386, 5387, 5388, 5389,
+     5392, 5395, 5398, 5401, 5404, 5407, 5410, 5413, 5416, 5419, 5422, 5425,
+     5428, 5431, 5434, 5437, 5440, 5443, 5444, 5445, 5446, 5447, 5450, 5453,
+     5456, 5459, 5462, 5464, 5466, 5468, 5470, 5472, 5474, 5476, 5478, 5480,
+     5482, 5484, 5486, 5488, 5490, 5492, 5494, 5496, 5498, 5500, 5502, 5504,
+     5506, 5508, 5510, 5512, 5514, 5516, 5518, 5520, 5522, 5524, 5526, 5528,
+     5530, 5532, 5534, 5536, 5538, 5540, 5542, 5544, 5546, 5548, 5550, 5552,
+     5554, 5556, 5558, 5560, 5562, 5564, 5566, 5568, 5570, 5572, 5574, 5576,
+     5578, 5580, 5582, 5584, 5586, 5588, 5590, 5592, 5594, 5596, 5598, 5600,
+     5602, 5604, 5606, 5608, 5610, 5612, 5614, 5616, 5618, 5620, 5622, 5624,
+     5626, 5628, 5630, 5632, 5634, 5636, 5638, 5640, 5643, 5646, 5649, 5652,
+     5655, 5658, 5661, 5664, 5667, 5670, 5673, 5676, 5678, 5680, 5682, 5684,
+     5686, 5688, 5690, 5692, 5694, 5696, 5698, 5700, 5702, 5704, 5706, 5708,
+     5710, 5712, 5714, 5716, 5718, 5720, 5722, 5724, 5726, 5728, 5730, 5732,
+     5734, 5736, 5738, 5740, 5742, 5744, 5746, 5748, 5750, 5752, 5754, 5756,
+     5758, 5760, 5762, 5764, 5766, 5769, 5772, 5775, 5778, 5781, 5783, 5785,
+     5787, 5789, 5791, 5793, 5795, 5797, 5799, 5801, 5803, 5805, 5807, 5809,
+     5811, 5813, 5815, 5817, 5819, 5821, 5823, 5825, 5827, 5829, 5831, 5833,
+     5835, 5837, 5839, 5841, 5843, 5845, 5847, 5849, 5851, 5853, 5855, 5857,
+     5859, 5861, 5863, 5865, 5867, 5869, 5871, 5873, 5875, 5877, 5879, 5881,
+     5883, 5885, 5887, 5889, 5891, 5893, 5895, 5897, 5899, 5901, 5903, 5905,
+     5907, 5909, 5911, 5913, 5915, 5918, 5921, 5923, 5925, 5927, 5929, 5931,
+     5933, 5935, 5937, 5939, 5941, 5943, 5945, 5947, 5949, 5951, 5953, 5955,
+     5958, 5961, 5964, 5966, 5968, 5970, 5972, 5974, 5976, 5978, 5980, 5982,
+     5984, 5986, 5988, 5990, 5992, 5994, 5996, 5998, 6000, 6002, 6004, 6006,
+     6008, 6010, 6012, 6014, 6016, 6018, 6020, 6022, 6024, 6026, 6028, 6030,
+     6032, 6034, 6036, 6038, 6040, 6042, 6044, 6046, 6048, 6050, 6052, 6054,
+     6056, 6058, 6060, 6062, 6064, 6066, 6068, 6070, 6072, 6074, 6076, 6078,
+     6080, 6082, 6084, 6086, 6088, 6090, 6092, 6094, 6096, 6098, 6100, 6102,
+     6104, 6106, 6108, 6110, 6113, 6116, 6119, 6122, 6125, 6128, 6131, 6134,
+     6137, 6140, 6143, 6146, 6149, 6152, 6155, 6158, 6161, 6164, 6167, 6170,
+     6173, 6176, 6179, 6182, 6185, 6188, 6191, 6194, 6197, 6200, 6203, 6206,
+     6209, 6212, 6215, 6218, 6221, 6224, 6227, 6230, 6233, 6236, 6239, 6242,
+     6245, 6248, 6251, 6254, 6257, 6260, 6263, 6266, 6269, 6272, 6275, 6278,
+     6281, 6284, 6287, 6290, 6293, 6296, 6299, 6302, 6305, 6308, 6311, 6314,
+     6317, 6320, 6323, 6326, 6329, 6332, 6335, 6338, 6341, 6344, 6347, 6350,
+     6353, 6356, 6359, 6362, 6365, 6368, 6371, 6374, 6377, 6380, 6383, 6386,
+     6389, 6392, 6395, 6398, 6401, 6404, 6407, 6410, 6413, 6416, 6419, 6422,
+     6425, 6428, 6431, 6434, 6437, 6440, 6443, 6446, 6449, 6452, 6455, 6458,
+     6461, 6464, 6467, 6470, 6474, 6478, 6482, 6486, 6490, 6494, 6498, 6501,
+     6519, 6527, 6531, 6532, 6533, 6534, 6535, 6536, 6537, 6538, 6539, 6540,
+     6543, 6545, 6546, 6547, 6548, 6549, 6550, 6551, 6552, 6553, 6554, 6555,
+     6556, 6557, 6558, 6559, 6560, 6561, 6562, 6563, 6564, 6565, 6566, 6567,
+     6569, 6571, 6573, 6575, 6576, 6577, 6578, 6579, 6580, 6581, 6582, 6583,
+     6584, 6585, 6586, 6587, 6588, 6589, 6590, 6591, 6592, 6593, 6594, 6595,
+     6596, 6597, 6598, 6599, 6600, 6601, 6602, 6603, 6604, 6606, 6608, 6610,
+     6612, 6614, 6616, 6618, 6620, 6622, 6624, 6626, 6628, 6630, 6632, 6633,
+     6635, 6637, 6639, 6641, 6643, 6645, 6647, 6649, 6651, 6653, 6655, 6657,
+     6658, 6659, 6660, 6661, 6662, 6663, 6664, 6665, 6666, 6667, 6668, 6669,
+     6670, 6671, 6672, 6673, 6674, 6675, 6676, 6677, 6678, 6679, 6680, 6681,
+     6682, 6683, 6684, 6685, 6686, 6687, 6688, 6689, 6690, 6691, 6692, 6693,
+     6694, 6695, 6696, 6697, 6698, 6699, 6700, 6701, 6702, 6703, 6704, 6705,
+     6706, 6707, 6708, 6709, 6710, 6711, 6712, 6713, 6714, 6715, 6716, 6717,
+     6718, 6719, 6720, 6721, 6722, 6723, 6724, 6725, 6726, 6727, 6728, 6729,
+     6730, 6731, 6732, 6733, 6734, 6735, 6736, 6737, 6738, 6739, 6740, 6741,
+     6742, 6743, 6744, 6745, 6746, 6747, 6748, 6749, 6750, 6751, 6752, 6753,
+     6754, 6755, 6756, 6757, 6758, 6759, 6760, 6761, 6764, 6767, 6770, 6773,
+     6776, 6779, 6781, 6783, 6784, 6785, 6786, 6787, 6788, 6789, 6790, 6791,
+     6792, 6793, 6794, 6795, 6796, 6797, 6798, 6799, 6800, 6801, 6802, 6803,
+     6804, 6805, 6806, 6807, 6808, 6809, 6810, 6811, 6812, 6813, 6814, 6815,
+     6816, 6817, 6818, 6819, 6820, 6821, 6822, 6823, 6824, 6825, 6826, 6827,
+     6828, 6829, 6830, 6831, 6832, 6833, 6834, 6835, 6836, 6837, 6838, 6839,
+     6840, 6841, 6842, 6843, 6844, 6845, 6846, 6847, 6848, 6849, 6850, 6851,
+     6852, 6853, 6854, 6855, 6856, 6857, 6858, 6859, 6860, 6861, 6862, 6863,
+     6864, 6865, 6866, 6867, 6868, 6869, 6870, 6871, 6872, 6873, 6874, 6875,
+     6876, 6877, 6878, 6879, 6880, 6881, 6882, 6883, 6884, 6885, 6886, 6887,
+     6888, 6889, 6890, 6891, 6892, 6893, 6894, 6895, 6896, 6897, 6898, 6899,
+     6900, 6901, 6902, 6903, 6904, 6905, 6906, 6907, 6908, 6909, 6910, 6911,
+     6912, 6913, 6914, 6915, 6916, 6917, 6918, 6919, 6920, 6921, 6922, 6923,
+     6924, 6925, 6926, 6927, 6928, 6929, 6930, 6931, 6932, 6933, 6934, 6935,
+     6936, 6937, 6938, 6939, 6940, 6941, 6942, 6943, 6944, 6945, 6946, 6947,
+     6948, 6949, 6950, 6951, 6952, 6953, 6954, 6955, 6956, 6957, 6958, 6959,
+     6960, 6961, 6962, 6963, 6964, 6965, 6966, 6967, 6968, 6969, 6970, 6971,
+     6972, 6973, 6974, 6975, 6976, 6977, 6978, 6979, 6980, 6981, 6982, 6983,
+     6984, 6985, 6986, 6987, 6988, 6989, 6990, 6991, 6992, 6993, 6994, 6995,
+     6996, 6997, 6999, 7000, 7001, 7002, 7003, 7004, 7005, 7006, 7007, 7008,
+     7009, 7010, 7011, 7012, 7013, 7014, 7015, 7016, 7017, 7018, 7019, 7020,
+     7021, 7022, 7023, 7024, 7025, 7026, 7027, 7028, 7029, 7030, 7031, 7032,
+     7033, 7034, 7035, 7036, 7037, 7038, 7039, 7040, 7041, 7042, 7043, 7044,
+     7045, 7046, 7047, 7048, 7049, 7050, 7051, 7052, 7053, 7054, 7055, 7056,
+     7057, 7058, 7059, 7060, 7061, 7062, 7063, 7064, 7065, 7067, 7069, 7071,
+     7073, 7075, 7077, 7079, 7081, 7083, 7085, 7087, 7089, 7091, 7093, 7095,
+     7098, 7101, 7104, 7107, 7110, 7112, 7114, 7117, 7120, 7123, 7126, 7127,
+     7128, 7129, 7130, 7131, 7132, 7133, 7134, 7135, 7136, 7137, 7138, 7139,
+     7140, 7141, 7142, 7143, 7144, 7145, 7146, 7147, 7148, 7149, 7150, 7151,
+     7152, 7153, 7154, 7155, 7156, 7157, 7158, 7159, 7160, 7161, 7162, 7163,
+     7164, 7165, 7166, 7167, 7168, 7169, 7170, 7171, 7172, 7173, 7174, 7175,
+     7176, 7177, 7178, 7179, 7180, 7181, 7182, 7183, 7184, 7185, 7186, 7187,
+     7188, 7189, 7190, 7191, 7192, 7193, 7194, 7195, 7196, 7197, 7198, 7199,
+     7200, 7201, 7202, 7203, 7204, 7205, 7206, 7207, 7208, 7209, 7210, 7211,
+     7212, 7213, 7214, 7215, 7216, 7217, 7218, 7219, 7220, 7221, 7222, 7223,
+     7224, 7225, 7226, 7227, 7228, 7229, 7230, 7231, 7232, 7233, 7234, 7235,
+     7236, 7237, 7238, 7239, 7240, 7241, 7242, 7243, 7244, 7245, 7246, 7247,
+     7248, 7249, 7250, 7251, 7252, 7253, 7254, 7255, 7256, 7257, 7258, 7259,
+     7260, 7261, 7262, 7263, 7264, 7265, 7266, 7267, 7268, 7269, 7270, 7271,
+     7272, 7273, 7274, 7275, 7276, 7277, 7278, 7279, 7280, 7281, 7282, 7283,
+     7284, 7285, 7286, 7287, 7288, 7289, 7290, 7291, 7292, 7293, 7294, 7295,
+     7296, 7297, 7298, 7299, 7300, 7301, 7302, 7303, 7304, 7305, 7306, 7307,
+     7308, 7309, 7310, 7311, 7312, 7313, 7314, 7315, 7316, 7317, 7318, 7319,
+     7320, 7321, 7322, 7323, 7324, 7325, 7326, 7327, 7328, 7329, 7330, 7331,
+     7332, 7333, 7334, 7335, 7336, 7337, 7338, 7339, 7340, 7341, 7342, 7343,
+     7344, 7345, 7346, 7347, 7348, 7349, 7350, 7351, 7352, 7353, 7354, 7355,
+     7356, 7357, 7358, 7359, 7360, 7361, 7362, 7363, 7364, 7365, 7366, 7367,
+     7368, 7369, 7370, 7371, 7372, 7373, 7374, 7375, 7376, 7377, 7378, 7379,
+     7380, 7381, 7382, 7383, 7384, 7385, 7386, 7387, 7388, 7389, 7390, 7391,
+     7392, 7393, 7394, 7395, 7396, 7397, 7398, 7399, 7400, 7401, 7402, 7403,
+     7404, 7405, 7406, 7407, 7408, 7409, 7410, 7411, 7412, 7413, 7414, 7415,
+     7416, 7417, 7418, 7419, 7420, 7421, 7422, 7423, 7424, 7425, 7426, 7427,
+     7428, 7429, 7430, 7431, 7432, 7433, 7434, 7435, 7436, 7437, 7438, 7439,
+     7440, 7441, 7442, 7443, 7444, 7445, 7446, 7447, 7448, 7449, 7450, 7451,
+     7452, 7453, 7454, 7455, 7456, 7457, 7458, 7459, 7460, 7461, 7462, 7463,
+     7464, 7465, 7466, 7467, 7468, 7469, 7470, 7471, 7472, 7473, 7474, 7475,
+     7476, 7477, 7478, 7479, 7480, 7481, 7482, 7483, 7484, 7485, 7486, 7487,
+     7488, 7489, 7490, 7491, 7492, 7493, 7494, 7495, 7496, 7497, 7498, 7499,
+     7500, 7501, 7502, 7503, 7504, 7505, 7506, 7507, 7508, 7509, 7510, 7511,
+     7512, 7513, 7514, 7515, 7516, 7517, 7518, 7519, 7520, 7521, 7522, 7523,
+     7524, 7525, 7526, 7527, 7528, 7529, 7530, 7531, 7532, 7533, 7534, 7535,
+     7536, 7537, 7538, 7539, 7540, 7541, 7542, 7543, 7544, 7545, 7546, 7547,
+     7548, 7549, 7550, 7551, 7552, 7553, 7554, 7555, 7556, 7557, 7558, 7559,
+     7560, 7561, 7562, 7563, 7564, 7565, 7566, 7567, 7568, 7569, 7570, 7571,
+     7572, 7573, 7574, 7575, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583,
+     7584, 7585, 7586, 7587, 7588, 7589, 7590, 7591, 7592, 7593, 7594, 7595,
+     7596, 7597, 7598, 7599, 7600, 7601, 7602, 7603, 7604, 7605, 7606, 7607,
+     7608, 7609, 7610, 7611, 7612, 7613, 7614, 7615, 7616, 7617, 7618, 7619,
+     7620, 7621, 7622, 7623, 7624, 7625, 7626, 7627, 7628, 7629, 7630, 7631,
+     7632, 7633, 7634, 7635, 7636, 7637, 7638, 7639, 7640, 7641, 7642, 7643,
+     7644, 7645, 7646, 7647, 7648, 7649, 7650, 7651, 7652, 7653, 7654, 7655,
+     7656, 7657, 7658, 7659, 7660, 7661, 7662, 7663, 7664, 7665, 7666, 7667,
+     7668, 7669, 7670, 7671, 7672, 7673, 7674, 7675, 7676, 7677, 7678, 7679,
+     7680, 7681, 7682, 7683, 7684, 7685, 7686, 7687, 7688, 7689, 7690, 7691,
+     7692, 7693, 7694, 7695, 7696, 7697, 7698, 7699, 7700, 7701, 7702, 7703,
+     7704, 7705, 7706, 7707, 7708, 7709, 7710, 7711, 7712, 7713, 7714, 7715,
+     7716, 7717, 7718, 7719, 7720, 7721, 7722, 7723, 7724, 7725, 7726, 7727,
+     7728, 7729, 7730, 7731, 7732, 7733, 7734, 7735, 7736, 7737, 7738, 7739,
+     7740, 7741, 7742, 7743, 7744, 7745, 7746, 7747, 7748, 7749, 7750, 7751,
+     7752, 7753, 7754, 7755, 7756, 7757, 7758, 7759, 7760, 7761, 7762, 7763,
+     7764, 7765, 7766, 7767, 7768, 7769, 7770, 7771, 7772, 7773, 7774, 7775,
+     7776, 7777, 7778, 7779, 7780, 7781, 7782, 7783, 7784, 7785, 7786, 7787,
+     7788, 7789, 7790, 7791, 7792, 7793, 7794, 7795, 7796, 7797, 7798, 7799,
+     7800, 7801, 7802, 7803, 7804, 7805, 7806, 7807, 7808, 7809, 7810, 7811,
+     7812, 7813, 7814, 7815, 7816, 7817, 7818, 7819, 7820, 7821, 7822, 7823,
+     7824, 7825, 7826, 7827, 7828, 7829, 7830, 7831, 7832, 7833, 7834, 7835,
+     7836, 7837, 7838, 7839, 7840, 7841, 7842, 7843, 7844, 7845, 7846, 7847,
+     7848, 7849, 7850, 7851, 7852, 7853, 7854, 7855, 7856, 7857, 7858, 7859,
+     7860, 7861, 7862, 7863, 7864, 7865, 7866, 7867, 7868, 7869, 7870, 7871,
+     7872, 7873, 7874, 7875, 7876, 7877, 7878, 7879, 7880, 7881, 7882, 7883,
+     7884, 7885, 7886, 7887, 7888, 7889, 7890, 7891, 7892, 7893, 7894, 7895,
+     7896, 7897, 7898, 7899, 7900, 7901, 7902, 7903, 7904, 7905, 7906, 7907,
+     7908, 7909, 7910, 7911, 7912, 7913, 7914, 7915, 7916, 7917, 7918, 7919,
+     7920, 7921, 7922, 7923, 7924, 7925, 7926, 7927, 7928, 7929, 7930, 7931,
+     7932, 7933, 7934, 7935, 7936, 7937, 7938, 7939, 7940, 7941, 7942, 7943,
+     7944, 7945, 7946, 7947, 7948, 7949, 7950, 7951, 7952, 7953, 7954, 7955,
+     7956, 7957, 7958, 7959, 7960, 7961, 7962, 7963, 7964, 7965, 7966, 7967,
+     7968, 7969, 7970, 7971, 7972, 7973, 7974, 7975, 7976, 7977, 7978, 7979,
+     7980, 7981, 7982, 7983, 7984, 7985, 7986, 7987, 7988, 7989, 7990, 7991,
+     7992, 7993, 7994, 7995, 7996, 7997, 7998, 7999, 8000, 8001, 8002, 8003,
+     8004, 8005, 8006, 8007, 8008, 8009, 8010, 8011, 8012, 8013, 8014, 8015,
+     8016, 8017, 8018, 8019, 8020, 8021, 8022, 8023, 8024, 8025, 8026, 8027,
+     8028, 8029, 8030, 8031, 8032, 8033, 8034, 8035, 8036, 8037, 8038, 8039,
+     8040, 8041, 8042, 8043, 8044, 8045, 8046, 8047, 8048, 8049, 8050, 8051,
+     8052, 8053, 8054, 8055, 8056, 8057, 8058, 8059, 8060, 8061, 8062, 8063,
+     8064, 8065, 8066, 8067, 8068, 8069, 8070, 8071, 8072, 8073, 8074, 8075,
+     8076, 8077, 8078, 8079, 8080, 8081, 8082, 8083, 8084, 8085, 8086, 8087,
+     8088, 8089, 8090, 8091, 8092, 8093, 8094, 8095, 8096, 8097, 8098, 8099,
+     8100, 8101, 8102, 8103, 8104, 8105, 8106, 8107, 8108, 8109, 8110, 8111,
+     8112, 8113, 8114, 8115, 8116, 8117, 8118, 8119, 8120, 8121, 8122, 8123,
+     8124, 8125, 8126, 8127, 8128, 8129, 8130, 8131, 8132, 8133, 8134, 8135,
+     8136, 8137, 8138, 8139, 8140, 8141, 8142, 8143, 8144, 8145, 8146, 8147,
+     8148, 8149, 8150, 8151, 8152, 8153, 8154, 8155, 8156, 8157, 8158, 8159,
+     8160, 8161, 8162, 8163, 8164, 8165, 8166, 8167, 8168, 8169, 8170, 8171,
+     8172, 8173, 8174, 8175, 8176, 8177, 8178, 8179, 8180, 8181, 8182, 8183,
+     8184, 8185, 8186, 8187, 8188, 8189, 8190, 8191, 8192, 8193, 8194, 8195,
+     8196, 8197, 8198, 8199, 8200, 8201, 8202, 8203, 8204, 8205, 8206, 8207,
+     8208, 8209, 8210, 8211, 8212, 8213, 8214, 8215, 8216, 8217, 8218, 8219,
+     8220, 8221, 8222, 8223, 8224, 8225, 8226, 8227, 8228, 8229, 8230, 8231,
+     8232, 8233, 8234, 8235, 8236, 8237, 8238, 8239, 8240, 8241, 8242, 8243,
+     8244, 8245, 8246, 8247, 8248, 8249, 8250, 8251, 8252, 8253, 8254, 8255,
+     8256, 8257, 8258, 8259, 8260, 8261, 8262, 8263, 8265, 8267, 8269, 8271,
+     8273, 8275, 8277, 8279, 8281, 8283, 8285, 8288, 8291, 8294, 8297, 8300,
+     8303, 8306, 8309, 8312, 8315, 8318, 8321, 8324, 8327, 8330, 8333, 8336,
+     8339, 8342, 8345, 8348, 8351, 8354, 8357, 8360, 8363, 8366, 8367, 8368,
+     8370, 8372, 8373, 8374, 8375, 8376, 8377, 8378, 8379, 8380, 8381, 8382,
+     8383, 8384, 8385, 8386, 8387, 8388, 8389, 8390, 8391, 8392, 8393, 8394,
+     8395, 8396, 8397, 8398, 8400, 8402, 8404, 8406, 8409, 8411, 8413, 8415,
+     8417, 8419, 8421, 8423, 8424, 8425, 8426, 8427, 8429, 8430, 8431, 8432,
+     8433, 8434, 8435, 8436, 8437, 8438, 8439, 8440, 8441, 8442, 8443, 8444,
+     8445, 8446, 8447, 8448, 8449, 8450, 8451, 8452, 8453, 8454, 8455, 8456,
+     8457, 8458, 8459, 8460, 8461, 8462, 8463, 8464, 8465, 8466, 8467, 8468,
+     8469, 8472, 8475, 8478, 8481, 8484, 8487, 8490, 8493, 8496, 8497, 8498,
+     8499, 8500, 8501, 8502, 8503, 8504, 8505, 8506, 8507, 8508, 8509, 8510,
+     8511, 8512, 8513, 8514, 8515, 8516, 8517, 8518, 8519, 8520, 8521, 8522,
+     8523, 8524, 8525, 8526, 8527, 8528, 8529, 8530, 8531, 8532, 8533, 8534,
+     8535, 8536, 8537, 8538, 8539, 8540, 8541, 8542, 8543, 8544, 8545, 8546,
+     8547, 8548, 8549, 8550, 8551, 8552, 8553, 8554, 8555, 8556, 8557, 8558,
+     8559, 8560, 8561, 8562, 8563, 8564, 8565, 8566, 8567, 8568, 8569, 8570,
+     8571, 8572, 8573, 8574, 8575, 8576, 8577, 8578, 8579, 8580, 8581, 8582,
+     8583, 8584, 8585, 8586, 8587, 8588, 8589, 8590, 8591, 8592, 8593, 8594,
+     8595, 8596, 8597, 8598, 8599, 8600, 8601, 8602, 8603, 8604, 8605, 8606,
+     8607, 8608, 8609, 8610, 8611, 8612, 8613, 8614, 8615, 8616, 8617, 8618,
+     8619, 8620, 8621, 8622, 8623, 8624, 8625, 8626, 8627, 8628, 8629, 8630,
+     8631, 8632, 8633, 8634, 8635, 8636, 8637, 8638, 8639, 8640, 8641, 8642,
+     8643, 8644, 8645, 8646, 8647, 8648, 8649, 8650, 8651, 8652, 8653, 8654,
+     8655, 8656, 8657, 8658, 8659, 8660, 8661, 8662, 8663, 8664, 8665, 8666,
+     8667, 8668, 8669, 8670, 8671, 8672, 8673, 8674, 8675, 8676, 8677, 8678,
+     8679, 8680, 8681, 8682, 8683, 8684, 8685, 8686, 8687, 8688, 8689, 8690,
+     8691, 8692, 8693, 8694, 8695, 8696, 8697, 8698, 8699, 8700, 8701, 8702,
+     8703, 8704, 8705, 8706, 8707, 8708, 8709, 8710, 8711, 8712, 8713, 8714,
+     8715, 8716, 8717, 8718, 8719, 8720, 8721, 8722, 8723, 8724, 8725, 8726,
+     8727, 8728, 8729, 8730, 8731, 8732, 8733, 8734, 8735, 8736, 8737, 8738,
+     8739, 8740, 8741, 8742, 8743, 8744, 8745, 8746, 8747, 8748, 8749, 8750,
+     8751, 8752, 8753, 8754, 8755, 8756, 8757, 8758, 8759, 8760, 8761, 8762,
+     8763, 8764, 8765, 8766, 8767, 8768, 8769, 8770, 8771, 8772, 8773, 8774,
+     8775, 8776, 8777, 8778, 8779, 8780, 8781, 8782, 8783, 8784, 8785, 8786,
+     8787, 8788, 8789, 8790, 8791, 8792, 8793, 8794, 8795, 8796, 8797, 8798,
+     8799, 8800, 8801, 8802, 8803, 8804, 8805, 8806, 8807, 8808, 8809, 8810,
+     8811, 8812, 8813, 8814, 8815, 8816, 8817, 8818, 8819, 8820, 8821, 8822,
+     8823, 8824, 8825, 8826, 8827, 8828, 8829, 8830, 8831, 8832, 8833, 8834,
+     8835, 8836, 8837, 8838, 8839, 8840, 8841, 8842, 8843, 8844, 8845, 8846,
+     8847, 8848, 8849, 8850, 8851, 8852, 8853, 8854, 8855, 8856, 8857, 8858,
+     8859, 8860, 8861, 8862, 8863, 8864, 8865, 8866, 8867, 8868, 8869, 8870,
+     8871, 8872, 8873, 8874, 8875, 8876, 8877, 8878, 8879, 8880, 8881, 8882,
+     8883, 8884, 8885, 8886, 8887, 8888, 8889, 8890, 8891, 8892, 8893, 8894,
+     8895, 8896, 8897, 8898, 8899, 8900, 8901, 8902, 8903, 8904, 8905, 8906,
+     8907, 8908, 8909, 8910, 8911, 8912, 8913, 8914, 8915, 8916, 8917, 8918,
+     8919, 8920, 8921, 8922, 8923, 8924, 8925, 8926, 8927, 8928, 8929, 8930,
+     8931, 8932, 8933, 8934, 8935, 8936, 8937, 8938, 8939, 8940, 8941, 8942,
+     8943, 8944, 8945, 8946, 8947, 8948, 8949, 8950, 8951, 8952, 8953, 8954,
+     8955, 8956, 8957, 8958, 8959, 8960, 8961, 8962, 8963, 8964, 8965, 8966,
+     8967, 8968, 8969, 8970, 8971, 8972, 8973, 8974, 8975, 8976, 8977, 8978,
+     8979, 8980, 8981, 8982, 8983, 8984, 8985, 8986, 8987, 8988, 8989, 8990,
+     8991, 8992, 8993, 8994, 8995, 8996, 8997, 8998, 8999, 9000, 9001, 9002,
+     9003, 9004, 9005, 9006, 9007, 9008, 9009, 9010, 9011, 9012, 9013, 9014,
+     9015, 9016, 9017, 9018, 9019, 9020, 9021, 9022, 9023, 9024, 9025, 9026,
+     9027, 9028, 9029, 9030, 9031, 9032, 9033, 9034, 9035, 9036, 9037, 9038,
+     9039, 9040, 9041, 9042, 9043, 9044, 9045, 9046, 9047, 9048, 9049, 9050,
+ };
+ 
+ /* Fully decomposed, canonically ordered code points */
+ static const uint32_t decompositionData[9050] = {
+     0x20, 0x20, 0x308, 0x61, 0x20, 0x304, 0x32, 0x33,
+     0x20, 0x301, 0x3BC, 0x20, 0x327, 0x31, 0x6F, 0x31,
+     0x2044, 0x34, 0x31, 0x2044, 0x32, 0x33, 0x2044, 0x34,
+     0x41, 0x300, 0x41, 0x301, 0x41, 0x302, 0x41, 0x303,
+     0x41, 0x308, 0x41, 0x30A, 0x43, 0x327, 0x45, 0x300,
+     0x45, 0x301, 0x45, 0x302, 0x45, 0x308, 0x49, 0x300,
+     0x49, 0x301, 0x49, 0x302, 0x49, 0x308, 0x4E, 0x303,
+     0x4F, 0x300, 0x4F, 0x301, 0x4F, 0x302, 0x4F, 0x303,
+     0x4F, 0x308, 0x55, 0x300, 0x55, 0x301, 0x55, 0x302,
+     0x55, 0x308, 0x59, 0x301, 0x61, 0x300, 0x61, 0x301,
+     0x61, 0x302, 0x61, 0x303, 0x61, 0x308, 0x61, 0x30A,
+     0x63, 0x327, 0x65, 0x300, 0x65, 0x301, 0x65, 0x302,
+     0x65, 0x308, 0x69, 0x300, 0x69, 0x301, 0x69, 0x302,
+     0x69, 0x308, 0x6E, 0x303, 0x6F, 0x300, 0x6F, 0x301,
+     0x6F, 0x302, 0x6F, 0x303, 0x6F, 0x308, 0x75, 0x300,
+     0x75, 0x301, 0x75, 0x302, 0x75, 0x308, 0x79, 0x301,
+     0x79, 0x308, 0x41, 0x304, 0x61, 0x304, 0x41, 0x306,
+     0x61, 0x306, 0x41, 0x328, 0x61, 0x328, 0x43, 0x301,
+     0x63, 0x301, 0x43, 0x302, 0x63, 0x302, 0x43, 0x307,
+     0x63, 0x307, 0x43, 0x30C, 0x63, 0x30C, 0x44, 0x30C,
+     0x64, 0x30C, 0x45, 0x304, 0x65, 0x304, 0x45, 0x306,
+     0x65, 0x306, 0x45, 0x307, 0x65, 0x307, 0x45, 0x328,
+     0x65, 0x328, 0x45, 0x30C, 0x65, 0x30C, 0x47, 0x302,
+     0x67, 0x302, 0x47, 0x306, 0x67, 0x306, 0x47, 0x307,
+     0x67, 0x307, 0x47, 0x327, 0x67, 0x327, 0x48, 0x302,
+     0x68, 0x302, 0x49, 0x303, 0x69, 0x303, 0x49, 0x304,
+     0x69, 0x304, 0x49, 0x306, 0x69, 0x306, 0x49, 0x328,
+     0x69, 0x328, 0x49, 0x307, 0x49, 0x4A, 0x69, 0x6A,
+     0x4A, 0x302, 0x6A, 0x302, 0x4B, 0x327, 0x6B, 0x327,
+     0x4C, 0x301, 0x6C, 0x301, 0x4C, 0x327, 0x6C, 0x327,
+     0x4C, 0x30C, 0x6C, 0x30C, 0x4C, 0xB7, 0x6C, 0xB7,
+     0x4E, 0x301, 0x6E, 0x301, 0x4E, 0x327, 0x6E, 0x327,
+     0x4E, 0x30C, 0x6E, 0x30C, 0x2BC, 0x6E, 0x4F, 0x304,
+     0x6F, 0x304, 0x4F, 0x306, 0x6F, 0x306, 0x4F, 0x30B,
+     0x6F, 0x30B, 0x52, 0x301, 0x72, 0x301, 0x52, 0x327,
+     0x72, 0x327, 0x52, 0x30C, 0x72, 0x30C, 0x53, 0x301,
+     0x73, 0x301, 0x53, 0x302, 0x73, 0x302, 0x53, 0x327,
+     0x73, 0x327, 0x53, 0x30C, 0x73, 0x30C, 0x54, 0x327,
+     0x74, 0x327, 0x54, 0x30C, 0x74, 0x30C, 0x55, 0x303,
+     0x75, 0x303, 0x55, 0x304, 0x75, 0x304, 0x55, 0x306,
+     0x75, 0x306, 0x55, 0x30A, 0x75, 0x30A, 0x55, 0x30B,
+     0x75, 0x30B, 0x55, 0x328, 0x75, 0x328, 0x57, 0x302,
+     0x77, 0x302, 0x59, 0x302, 0x79, 0x302, 0x59, 0x308,
+     0x5A, 0x301, 0x7A, 0x301, 0x5A, 0x307, 0x7A, 0x307,
+     0x5A, 0x30C, 0x7A, 0x30C, 0x73, 0x4F, 0x31B, 0x6F,
+     0x31B, 0x55, 0x31B, 0x75, 0x31B, 0x44, 0x5A, 0x30C,
+     0x44, 0x7A, 0x30C, 0x64, 0x7A, 0x30C, 0x4C, 0x4A,
+     0x4C, 0x6A, 0x6C, 0x6A, 0x4E, 0x4A, 0x4E, 0x6A,
+     0x6E, 0x6A, 0x41, 0x30C, 0x61, 0x30C, 0x49, 0x30C,
+     0x69, 0x30C, 0x4F, 0x30C, 0x6F, 0x30C, 0x55, 0x30C,
+     0x75, 0x30C, 0x55, 0x308, 0x304, 0x75, 0x308, 0x304,
+     0x55, 0x308, 0x301, 0x75, 0x308, 0x301, 0x55, 0x308,
+     0x30C, 0x75, 0x308, 0x30C, 0x55, 0x308, 0x300, 0x75,
+     0x308, 0x300, 0x41, 0x308, 0x304, 0x61, 0x308, 0x304,
+     0x41, 0x307, 0x304, 0x61, 0x307, 0x304, 0xC6, 0x304,
+     0xE6, 0x304, 0x47, 0x30C, 0x67, 0x30C, 0x4B, 0x30C,
+     0x6B, 0x30C, 0x4F, 0x328, 0x6F, 0x328, 0x4F, 0x328,
+     0x304, 0x6F, 0x328, 0x304, 0x1B7, 0x30C, 0x292, 0x30C,
+     0x6A, 0x30C, 0x44, 0x5A, 0x44, 0x7A, 0x64, 0x7A,
+     0x47, 0x301, 0x67, 0x301, 0x4E, 0x300, 0x6E, 0x300,
+     0x41, 0x30A, 0x301, 0x61, 0x30A, 0x301, 0xC6, 0x301,
+     0xE6, 0x301, 0xD8, 0x301, 0xF8, 0x301, 0x41, 0x30F,
+     0x61, 0x30F, 0x41, 0x311, 0x61, 0x311, 0x45, 0x30F,
+     0x65, 0x30F, 0x45, 0x311, 0x65, 0x311, 0x49, 0x30F,
+     0x69, 0x30F, 0x49, 0x311, 0x69, 0x311, 0x4F, 0x30F,
+     0x6F, 0x30F, 0x4F, 0x311, 0x6F, 0x311, 0x52, 0x30F,
+     0x72, 0x30F, 0x52, 0x311, 0x72, 0x311, 0x55, 0x30F,
+     0x75, 0x30F, 0x55, 0x311, 0x75, 0x311, 0x53, 0x326,
+     0x73, 0x326, 0x54, 0x326, 0x74, 0x326, 0x48, 0x30C,
+     0x68, 0x30C, 0x41, 0x307, 0x61, 0x307, 0x45, 0x327,
+     0x65, 0x327, 0x4F, 0x308, 0x304, 0x6F, 0x308, 0x304,
+     0x4F, 0x303, 0x304, 0x6F, 0x303, 0x304, 0x4F, 0x307,
+     0x6F, 0x307, 0x4F, 0x307, 0x304, 0x6F, 0x307, 0x304,
+     0x59, 0x304, 0x79, 0x304, 0x68, 0x266, 0x6A, 0x72,
+     0x279, 0x27B, 0x281, 0x77, 0x79, 0x20, 0x306, 0x20,
+     0x307, 0x20, 0x30A, 0x20, 0x328, 0x20, 0x303, 0x20,
+     0x30B, 0x263, 0x6C, 0x73, 0x78, 0x295, 0x300, 0x301,
+     0x313, 0x308, 0x301, 0x2B9, 0x20, 0x345, 0x3B, 0x20,
+     0x301, 0x20, 0x308, 0x301, 0x391, 0x301, 0xB7, 0x395,
+     0x301, 0x397, 0x301, 0x399, 0x301, 0x39F, 0x301, 0x3A5,
+     0x301, 0x3A9, 0x301, 0x3B9, 0x308, 0x301, 0x399, 0x308,
+     0x3A5, 0x308, 0x3B1, 0x301, 0x3B5, 0x301, 0x3B7, 0x301,
+     0x3B9, 0x301, 0x3C5, 0x308, 0x301, 0x3B9, 0x308, 0x3C5,
+     0x308, 0x3BF, 0x301, 0x3C5, 0x301, 0x3C9, 0x301, 0x3B2,
+     0x3B8, 0x3A5, 0x3A5, 0x301, 0x3A5, 0x308, 0x3C6, 0x3C0,
+     0x3BA, 0x3C1, 0x3C2, 0x398, 0x3B5, 0x3A3, 0x415, 0x300,
+     0x415, 0x308, 0x413, 0x301, 0x406, 0x308, 0x41A, 0x301,
+     0x418, 0x300, 0x423, 0x306, 0x418, 0x306, 0x438, 0x306,
+     0x435, 0x300, 0x435, 0x308, 0x433, 0x301, 0x456, 0x308,
+     0x43A, 0x301, 0x438, 0x300, 0x443, 0x306, 0x474, 0x30F,
+     0x475, 0x30F, 0x416, 0x306, 0x436, 0x306, 0x410, 0x306,
+     0x430, 0x306, 0x410, 0x308, 0x430, 0x308, 0x415, 0x306,
+     0x435, 0x306, 0x4D8, 0x308, 0x4D9, 0x308, 0x416, 0x308,
+     0x436, 0x308, 0x417, 0x308, 0x437, 0x308, 0x418, 0x304,
+     0x438, 0x304, 0x418, 0x308, 0x438, 0x308, 0x41E, 0x308,
+     0x43E, 0x308, 0x4E8, 0x308, 0x4E9, 0x308, 0x42D, 0x308,
+     0x44D, 0x308, 0x423, 0x304, 0x443, 0x304, 0x423, 0x308,
+     0x443, 0x308, 0x423, 0x30B, 0x443, 0x30B, 0x427, 0x308,
+     0x447, 0x308, 0x42B, 0x308, 0x44B, 0x308, 0x565, 0x582,
+     0x627, 0x653, 0x627, 0x654, 0x648, 0x654, 0x627, 0x655,
+     0x64A, 0x654, 0x627, 0x674, 0x648, 0x674, 0x6C7, 0x674,
+     0x64A, 0x674, 0x6D5, 0x654, 0x6C1, 0x654, 0x6D2, 0x654,
+     0x928, 0x93C, 0x930, 0x93C, 0x933, 0x93C, 0x915, 0x93C,
+     0x916, 0x93C, 0x917, 0x93C, 0x91C, 0x93C, 0x921, 0x93C,
+     0x922, 0x93C, 0x92B, 0x93C, 0x92F, 0x93C, 0x9C7, 0x9BE,
+     0x9C7, 0x9D7, 0x9A1, 0x9BC, 0x9A2, 0x9BC, 0x9AF, 0x9BC,
+     0xA32, 0xA3C, 0xA38, 0xA3C, 0xA16, 0xA3C, 0xA17, 0xA3C,
+     0xA1C, 0xA3C, 0xA2B, 0xA3C, 0xB47, 0xB56, 0xB47, 0xB3E,
+     0xB47, 0xB57, 0xB21, 0xB3C, 0xB22, 0xB3C, 0xB92, 0xBD7,
+     0xBC6, 0xBBE, 0xBC7, 0xBBE, 0xBC6, 0xBD7, 0xC46, 0xC56,
+     0xCBF, 0xCD5, 0xCC6, 0xCD5, 0xCC6, 0xCD6, 0xCC6, 0xCC2,
+     0xCC6, 0xCC2, 0xCD5, 0xD46, 0xD3E, 0xD47, 0xD3E, 0xD46,
+     0xD57, 0xDD9, 0xDCA, 0xDD9, 0xDCF, 0xDD9, 0xDCF, 0xDCA,
+     0xDD9, 0xDDF, 0xE4D, 0xE32, 0xECD, 0xEB2, 0xEAB, 0xE99,
+     0xEAB, 0xEA1, 0xF0B, 0xF42, 0xFB7, 0xF4C, 0xFB7, 0xF51,
+     0xFB7, 0xF56, 0xFB7, 0xF5B, 0xFB7, 0xF40, 0xFB5, 0xF71,
+     0xF72, 0xF71, 0xF74, 0xFB2, 0xF80, 0xFB2, 0xF71, 0xF80,
+     0xFB3, 0xF80, 0xFB3, 0xF71, 0xF80, 0xF71, 0xF80, 0xF92,
+     0xFB7, 0xF9C, 0xFB7, 0xFA1, 0xFB7, 0xFA6, 0xFB7, 0xFAB,
+     0xFB7, 0xF90, 0xFB5, 0x1025, 0x102E, 0x10DC, 0x1B05, 0x1B35,
+     0x1B07, 0x1B35, 0x1B09, 0x1B35, 0x1B0B, 0x1B35, 0x1B0D, 0x1B35,
+     0x1B11, 0x1B35, 0x1B3A, 0x1B35, 0x1B3C, 0x1B35, 0x1B3E, 0x1B35,
+     0x1B3F, 0x1B35, 0x1B42, 0x1B35, 0x41, 0xC6, 0x42, 0x44,
+     0x45, 0x18E, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C,
+     0x4D, 0x4E, 0x4F, 0x222, 0x50, 0x52, 0x54, 0x55,
+     0x57, 0x61, 0x250, 0x251, 0x1D02, 0x62, 0x64, 0x65,
+     0x259, 0x25B, 0x25C, 0x67, 0x6B, 0x6D, 0x14B, 0x6F,
+     0x254, 0x1D16, 0x1D17, 0x70, 0x74, 0x75, 0x1D1D, 0x26F,
+     0x76, 0x1D25, 0x3B2, 0x3B3, 0x3B4, 0x3C6, 0x3C7, 0x69,
+     0x72, 0x75, 0x76, 0x3B2, 0x3B3, 0x3C1, 0x3C6, 0x3C7,
+     0x43D, 0x252, 0x63, 0x255, 0xF0, 0x25C, 0x66, 0x25F,
+     0x261, 0x265, 0x268, 0x269, 0x26A, 0x1D7B, 0x29D, 0x26D,
+     0x1D85, 0x29F, 0x271, 0x270, 0x272, 0x273, 0x274, 0x275,
+     0x278, 0x282, 0x283, 0x1AB, 0x289, 0x28A, 0x1D1C, 0x28B,
+     0x28C, 0x7A, 0x290, 0x291, 0x292, 0x3B8, 0x41, 0x325,
+     0x61, 0x325, 0x42, 0x307, 0x62, 0x307, 0x42, 0x323,
+     0x62, 0x323, 0x42, 0x331, 0x62, 0x331, 0x43, 0x327,
+     0x301, 0x63, 0x327, 0x301, 0x44, 0x307, 0x64, 0x307,
+     0x44, 0x323, 0x64, 0x323, 0x44, 0x331, 0x64, 0x331,
+     0x44, 0x327, 0x64, 0x327, 0x44, 0x32D, 0x64, 0x32D,
+     0x45, 0x304, 0x300, 0x65, 0x304, 0x300, 0x45, 0x304,
+     0x301, 0x65, 0x304, 0x301, 0x45, 0x32D, 0x65, 0x32D,
+     0x45, 0x330, 0x65, 0x330, 0x45, 0x327, 0x306, 0x65,
+     0x327, 0x306, 0x46, 0x307, 0x66, 0x307, 0x47, 0x304,
+     0x67, 0x304, 0x48, 0x307, 0x68, 0x307, 0x48, 0x323,
+     0x68, 0x323, 0x48, 0x308, 0x68, 0x308, 0x48, 0x327,
+     0x68, 0x327, 0x48, 0x32E, 0x68, 0x32E, 0x49, 0x330,
+     0x69, 0x330, 0x49, 0x308, 0x301, 0x69, 0x308, 0x301,
+     0x4B, 0x301, 0x6B, 0x301, 0x4B, 0x323, 0x6B, 0x323,
+     0x4B, 0x331, 0x6B, 0x331, 0x4C, 0x323, 0x6C, 0x323,
+     0x4C, 0x323, 0x304, 0x6C, 0x323, 0x304, 0x4C, 0x331,
+     0x6C, 0x331, 0x4C, 0x32D, 0x6C, 0x32D, 0x4D, 0x301,
+     0x6D, 0x301, 0x4D, 0x307, 0x6D, 0x307, 0x4D, 0x323,
+     0x6D, 0x323, 0x4E, 0x307, 0x6E, 0x307, 0x4E, 0x323,
+     0x6E, 0x323, 0x4E, 0x331, 0x6E, 0x331, 0x4E, 0x32D,
+     0x6E, 0x32D, 0x4F, 0x303, 0x301, 0x6F, 0x303, 0x301,
+     0x4F, 0x303, 0x308, 0x6F, 0x303, 0x308, 0x4F, 0x304,
+     0x300, 0x6F, 0x304, 0x300, 0x4F, 0x304, 0x301, 0x6F,
+     0x304, 0x301, 0x50, 0x301, 0x70, 0x301, 0x50, 0x307,
+     0x70, 0x307, 0x52, 0x307, 0x72, 0x307, 0x52, 0x323,
+     0x72, 0x323, 0x52, 0x323, 0x304, 0x72, 0x323, 0x304,
+     0x52, 0x331, 0x72, 0x331, 0x53, 0x307, 0x73, 0x307,
+     0x53, 0x323, 0x73, 0x323, 0x53, 0x301, 0x307, 0x73,
+     0x301, 0x307, 0x53, 0x30C, 0x307, 0x73, 0x30C, 0x307,
+     0x53, 0x323, 0x307, 0x73, 0x323, 0x307, 0x54, 0x307,
+     0x74, 0x307, 0x54, 0x323, 0x74, 0x323, 0x54, 0x331,
+     0x74, 0x331, 0x54, 0x32D, 0x74, 0x32D, 0x55, 0x324,
+     0x75, 0x324, 0x55, 0x330, 0x75, 0x330, 0x55, 0x32D,
+     0x75, 0x32D, 0x55, 0x303, 0x301, 0x75, 0x303, 0x301,
+     0x55, 0x304, 0x308, 0x75, 0x304, 0x308, 0x56, 0x303,
+     0x76, 0x303, 0x56, 0x323, 0x76, 0x323, 0x57, 0x300,
+     0x77, 0x300, 0x57, 0x301, 0x77, 0x301, 0x57, 0x308,
+     0x77, 0x308, 0x57, 0x307, 0x77, 0x307, 0x57, 0x323,
+     0x77, 0x323, 0x58, 0x307, 0x78, 0x307, 0x58, 0x308,
+     0x78, 0x308, 0x59, 0x307, 0x79, 0x307, 0x5A, 0x302,
+     0x7A, 0x302, 0x5A, 0x323, 0x7A, 0x323, 0x5A, 0x331,
+     0x7A, 0x331, 0x68, 0x331, 0x74, 0x308, 0x77, 0x30A,
+     0x79, 0x30A, 0x61, 0x2BE, 0x73, 0x307, 0x41, 0x323,
+     0x61, 0x323, 0x41, 0x309, 0x61, 0x309, 0x41, 0x302,
+     0x301, 0x61, 0x302, 0x301, 0x41, 0x302, 0x300, 0x61,
+     0x302, 0x300, 0x41, 0x302, 0x309, 0x61, 0x302, 0x309,
+     0x41, 0x302, 0x303, 0x61, 0x302, 0x303, 0x41, 0x323,
+     0x302, 0x61, 0x323, 0x302, 0x41, 0x306, 0x301, 0x61,
+     0x306, 0x301, 0x41, 0x306, 0x300, 0x61, 0x306, 0x300,
+     0x41, 0x306, 0x309, 0x61, 0x306, 0x309, 0x41, 0x306,
+     0x303, 0x61, 0x306, 0x303, 0x41, 0x323, 0x306, 0x61,
+     0x323, 0x306, 0x45, 0x323, 0x65, 0x323, 0x45, 0x309,
+     0x65, 0x309, 0x45, 0x303, 0x65, 0x303, 0x45, 0x302,
+     0x301, 0x65, 0x302, 0x301, 0x45, 0x302, 0x300, 0x65,
+     0x302, 0x300, 0x45, 0x302, 0x309, 0x65, 0x302, 0x309,
+     0x45, 0x302, 0x303, 0x65, 0x302, 0x303, 0x45, 0x323,
+     0x302, 0x65, 0x323, 0x302, 0x49, 0x309, 0x69, 0x309,
+     0x49, 0x323, 0x69, 0x323, 0x4F, 0x323, 0x6F, 0x323,
+     0x4F, 0x309, 0x6F, 0x309, 0x4F, 0x302, 0x301, 0x6F,
+     0x302, 0x301, 0x4F, 0x302, 0x300, 0x6F, 0x302, 0x300,
+     0x4F, 0x302, 0x309, 0x6F, 0x302, 0x309, 0x4F, 0x302,
+     0x303, 0x6F, 0x302, 0x303, 0x4F, 0x323, 0x302, 0x6F,
+     0x323, 0x302, 0x4F, 0x31B, 0x301, 0x6F, 0x31B, 0x301,
+     0x4F, 0x31B, 0x300, 0x6F, 0x31B, 0x300, 0x4F, 0x31B,
+     0x309, 0x6F, 0x31B, 0x309, 0x4F, 0x31B, 0x303, 0x6F,
+     0x31B, 0x303, 0x4F, 0x31B, 0x323, 0x6F, 0x31B, 0x323,
+     0x55, 0x323, 0x75, 0x323, 0x55, 0x309, 0x75, 0x309,
+     0x55, 0x31B, 0x301, 0x75, 0x31B, 0x301, 0x55, 0x31B,
+     0x300, 0x75, 0x31B, 0x300, 0x55, 0x31B, 0x309, 0x75,
+     0x31B, 0x309, 0x55, 0x31B, 0x303, 0x75, 0x31B, 0x303,
+     0x55, 0x31B, 0x323, 0x75, 0x31B, 0x323, 0x59, 0x300,
+     0x79, 0x300, 0x59, 0x323, 0x79, 0x323, 0x59, 0x309,
+     0x79, 0x309, 0x59, 0x303, 0x79, 0x303, 0x3B1, 0x313,
+     0x3B1, 0x314, 0x3B1, 0x313, 0x300, 0x3B1, 0x314, 0x300,
+     0x3B1, 0x313, 0x301, 0x3B1, 0x314, 0x301, 0x3B1, 0x313,
+     0x342, 0x3B1, 0x314, 0x342, 0x391, 0x313, 0x391, 0x314,
+     0x391, 0x313, 0x300, 0x391, 0x314, 0x300, 0x391, 0x313,
+     0x301, 0x391, 0x314, 0x301, 0x391, 0x313, 0x342, 0x391,
+     0x314, 0x342, 0x3B5, 0x313, 0x3B5, 0x314, 0x3B5, 0x313,
+     0x300, 0x3B5, 0x314, 0x300, 0x3B5, 0x313, 0x301, 0x3B5,
+     0x314, 0x301, 0x395, 0x313, 0x395, 0x314, 0x395, 0x313,
+     0x300, 0x395, 0x314, 0x300, 0x395, 0x313, 0x301, 0x395,
+     0x314, 0x301, 0x3B7, 0x313, 0x3B7, 0x314, 0x3B7, 0x313,
+     0x300, 0x3B7, 0x314, 0x300, 0x3B7, 0x313, 0x301, 0x3B7,
+     0x314, 0x301, 0x3B7, 0x313, 0x342, 0x3B7, 0x314, 0x342,
+     0x397, 0x313, 0x397, 0x314, 0x397, 0x313, 0x300, 0x397,
+     0x314, 0x300, 0x397, 0x313, 0x301, 0x397, 0x314, 0x301,
+     0x397, 0x313, 0x342, 0x397, 0x314, 0x342, 0x3B9, 0x313,
+     0x3B9, 0x314, 0x3B9, 0x313, 0x300, 0x3B9, 0x314, 0x300,
+     0x3B9, 0x313, 0x301, 0x3B9, 0x314, 0x301, 0x3B9, 0x313,
+     0x342, 0x3B9, 0x314, 0x342, 0x399, 0x313, 0x399, 0x314,
+     0x399, 0x313, 0x300, 0x399, 0x314, 0x300, 0x399, 0x313,
+     0x301, 0x399, 0x314, 0x301, 0x399, 0x313, 0x342, 0x399,
+     0x314, 0x342, 0x3BF, 0x313, 0x3BF, 0x314, 0x3BF, 0x313,
+     0x300, 0x3BF, 0x314, 0x300, 0x3BF, 0x313, 0x301, 0x3BF,
+     0x314, 0x301, 0x39F, 0x313, 0x39F, 0x314, 0x39F, 0x313,
+     0x300, 0x39F, 0x314, 0x300, 0x39F, 0x313, 0x301, 0x39F,
+     0x314, 0x301, 0x3C5, 0x313, 0x3C5, 0x314, 0x3C5, 0x313,
+     0x300, 0x3C5, 0x314, 0x300, 0x3C5, 0x313, 0x301, 0x3C5,
+     0x314, 0x301, 0x3C5, 0x313, 0x342, 0x3C5, 0x314, 0x342,
+     0x3A5, 0x314, 0x3A5, 0x314, 0x300, 0x3A5, 0x314, 0x301,
+     0x3A5, 0x314, 0x342, 0x3C9, 0x313, 0x3C9, 0x314, 0x3C9,
+     0x313, 0x300, 0x3C9, 0x314, 0x300, 0x3C9, 0x313, 0x301,
+     0x3C9, 0x314, 0x301, 0x3C9, 0x313, 0x342, 0x3C9, 0x314,
+     0x342, 0x3A9, 0x313, 0x3A9, 0x314, 0x3A9, 0x313, 0x300,
+     0x3A9, 0x314, 0x300, 0x3A9, 0x313, 0x301, 0x3A9, 0x314,
+     0x301, 0x3A9, 0x313, 0x342, 0x3A9, 0x314, 0x342, 0x3B1,
+     0x300, 0x3B1, 0x301, 0x3B5, 0x300, 0x3B5, 0x301, 0x3B7,
+     0x300, 0x3B7, 0x301, 0x3B9, 0x300, 0x3B9, 0x301, 0x3BF,
+     0x300, 0x3BF, 0x301, 0x3C5, 0x300, 0x3C5, 0x301, 0x3C9,
+     0x300, 0x3C9, 0x301, 0x3B1, 0x313, 0x345, 0x3B1, 0x314,
+     0x345, 0x3B1, 0x313, 0x300, 0x345, 0x3B1, 0x314, 0x300,
+     0x345, 0x3B1, 0x313, 0x301, 0x345, 0x3B1, 0x314, 0x301,
+     0x345, 0x3B1, 0x313, 0x342, 0x345, 0x3B1, 0x314, 0x342,
+     0x345, 0x391, 0x313, 0x345, 0x391, 0x314, 0x345, 0x391,
+     0x313, 0x300, 0x345, 0x391, 0x314, 0x300, 0x345, 0x391,
+     0x313, 0x301, 0x345, 0x391, 0x314, 0x301, 0x345, 0x391,
+     0x313, 0x342, 0x345, 0x391, 0x314, 0x342, 0x345, 0x3B7,
+     0x313, 0x345, 0x3B7, 0x314, 0x345, 0x3B7, 0x313, 0x300,
+     0x345, 0x3B7, 0x314, 0x300, 0x345, 0x3B7, 0x313, 0x301,
+     0x345, 0x3B7, 0x314, 0x301, 0x345, 0x3B7, 0x313, 0x342,
+     0x345, 0x3B7, 0x314, 0x342, 0x345, 0x397, 0x313, 0x345,
+     0x397, 0x314, 0x345, 0x397, 0x313, 0x300, 0x345, 0x397,
+     0x314, 0x300, 0x345, 0x397, 0x313, 0x301, 0x345, 0x397,
+     0x314, 0x301, 0x345, 0x397, 0x313, 0x342, 0x345, 0x397,
+     0x314, 0x342, 0x345, 0x3C9, 0x313, 0x345, 0x3C9, 0x314,
+     0x345, 0x3C9, 0x313, 0x300, 0x345, 0x3C9, 0x314, 0x300,
+     0x345, 0x3C9, 0x313, 0x301, 0x345, 0x3C9, 0x314, 0x301,
+     0x345, 0x3C9, 0x313, 0x342, 0x345, 0x3C9, 0x314, 0x342,
+     0x345, 0x3A9, 0x313, 0x345, 0x3A9, 0x314, 0x345, 0x3A9,
+     0x313, 0x300, 0x345, 0x3A9, 0x314, 0x300, 0x345, 0x3A9,
+     0x313, 0x301, 0x345, 0x3A9, 0x314, 0x301, 0x345, 0x3A9,
+     0x313, 0x342, 0x345, 0x3A9, 0x314, 0x342, 0x345, 0x3B1,
+     0x306, 0x3B1, 0x304, 0x3B1, 0x300, 0x345, 0x3B1, 0x345,
+     0x3B1, 0x301, 0x345, 0x3B1, 0x342, 0x3B1, 0x342, 0x345,
+     0x391, 0x306, 0x391, 0x304, 0x391, 0x300, 0x391, 0x301,
+     0x391, 0x345, 0x20, 0x313, 0x3B9, 0x20, 0x313, 0x20,
+     0x342, 0x20, 0x308, 0x342, 0x3B7, 0x300, 0x345, 0x3B7,
+     0x345, 0x3B7, 0x301, 0x345, 0x3B7, 0x342, 0x3B7, 0x342,
+     0x345, 0x395, 0x300, 0x395, 0x301, 0x397, 0x300, 0x397,
+     0x301, 0x397, 0x345, 0x20, 0x313, 0x300, 0x20, 0x313,
+     0x301, 0x20, 0x313, 0x342, 0x3B9, 0x306, 0x3B9, 0x304,
+     0x3B9, 0x308, 0x300, 0x3B9, 0x308, 0x301, 0x3B9, 0x342,
+     0x3B9, 0x308, 0x342, 0x399, 0x306, 0x399, 0x304, 0x399,
+     0x300, 0x399, 0x301, 0x20, 0x314, 0x300, 0x20, 0x314,
+     0x301, 0x20, 0x314, 0x342, 0x3C5, 0x306, 0x3C5, 0x304,
+     0x3C5, 0x308, 0x300, 0x3C5, 0x308, 0x301, 0x3C1, 0x313,
+     0x3C1, 0x314, 0x3C5, 0x342, 0x3C5, 0x308, 0x342, 0x3A5,
+     0x306, 0x3A5, 0x304, 0x3A5, 0x300, 0x3A5, 0x301, 0x3A1,
+     0x314, 0x20, 0x308, 0x300, 0x20, 0x308, 0x301, 0x60,
+     0x3C9, 0x300, 0x345, 0x3C9, 0x345, 0x3C9, 0x301, 0x345,
+     0x3C9, 0x342, 0x3C9, 0x342, 0x345, 0x39F, 0x300, 0x39F,
+     0x301, 0x3A9, 0x300, 0x3A9, 0x301, 0x3A9, 0x345, 0x20,
+     0x301, 0x20, 0x314, 0x20, 0x20, 0x20, 0x20, 0x20,
+     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2010, 0x20,
+     0x333, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x20,
+     0x2032, 0x2032, 0x2032, 0x2032, 0x2032, 0x2035, 0x2035, 0x2035,
+     0x2035, 0x2035, 0x21, 0x21, 0x20, 0x305, 0x3F, 0x3F,
+     0x3F, 0x21, 0x21, 0x3F, 0x2032, 0x2032, 0x2032, 0x2032,
+     0x20, 0x30, 0x69, 0x34, 0x35, 0x36, 0x37, 0x38,
+     0x39, 0x2B, 0x2212, 0x3D, 0x28, 0x29, 0x6E, 0x30,
+     0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+     0x39, 0x2B, 0x2212, 0x3D, 0x28, 0x29, 0x61, 0x65,
+     0x6F, 0x78, 0x259, 0x68, 0x6B, 0x6C, 0x6D, 0x6E,
+     0x70, 0x73, 0x74, 0x52, 0x73, 0x61, 0x2F, 0x63,
+     0x61, 0x2F, 0x73, 0x43, 0xB0, 0x43, 0x63, 0x2F,
+     0x6F, 0x63, 0x2F, 0x75, 0x190, 0xB0, 0x46, 0x67,
+     0x48, 0x48, 0x48, 0x68, 0x127, 0x49, 0x49, 0x4C,
+     0x6C, 0x4E, 0x4E, 0x6F, 0x50, 0x51, 0x52, 0x52,
+     0x52, 0x53, 0x4D, 0x54, 0x45, 0x4C, 0x54, 0x4D,
+     0x5A, 0x3A9, 0x5A, 0x4B, 0x41, 0x30A, 0x42, 0x43,
+     0x65, 0x45, 0x46, 0x4D, 0x6F, 0x5D0, 0x5D1, 0x5D2,
+     0x5D3, 0x69, 0x46, 0x41, 0x58, 0x3C0, 0x3B3, 0x393,
+     0x3A0, 0x2211, 0x44, 0x64, 0x65, 0x69, 0x6A, 0x31,
+     0x2044, 0x37, 0x31, 0x2044, 0x39, 0x31, 0x2044, 0x31,
+     0x30, 0x31, 0x2044, 0x33, 0x32, 0x2044, 0x33, 0x31,
+     0x2044, 0x35, 0x32, 0x2044, 0x35, 0x33, 0x2044, 0x35,
+     0x34, 0x2044, 0x35, 0x31, 0x2044, 0x36, 0x35, 0x2044,
+     0x36, 0x31, 0x2044, 0x38, 0x33, 0x2044, 0x38, 0x35,
+     0x2044, 0x38, 0x37, 0x2044, 0x38, 0x31, 0x2044, 0x49,
+     0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x56, 0x56,
+     0x56, 0x49, 0x56, 0x49, 0x49, 0x56, 0x49, 0x49,
+     0x49, 0x49, 0x58, 0x58, 0x58, 0x49, 0x58, 0x49,
+     0x49, 0x4C, 0x43, 0x44, 0x4D, 0x69, 0x69, 0x69,
+     0x69, 0x69, 0x69, 0x69, 0x76, 0x76, 0x76, 0x69,
+     0x76, 0x69, 0x69, 0x76, 0x69, 0x69, 0x69, 0x69,
+     0x78, 0x78, 0x78, 0x69, 0x78, 0x69, 0x69, 0x6C,
+     0x63, 0x64, 0x6D, 0x30, 0x2044, 0x33, 0x2190, 0x338,
+     0x2192, 0x338, 0x2194, 0x338, 0x21D0, 0x338, 0x21D4, 0x338,
+     0x21D2, 0x338, 0x2203, 0x338, 0x2208, 0x338, 0x220B, 0x338,
+     0x2223, 0x338, 0x2225, 0x338, 0x222B, 0x222B, 0x222B, 0x222B,
+     0x222B, 0x222E, 0x222E, 0x222E, 0x222E, 0x222E, 0x223C, 0x338,
+     0x2243, 0x338, 0x2245, 0x338, 0x2248, 0x338, 0x3D, 0x338,
+     0x2261, 0x338, 0x224D, 0x338, 0x3C, 0x338, 0x3E, 0x338,
+     0x2264, 0x338, 0x2265, 0x338, 0x2272, 0x338, 0x2273, 0x338,
+     0x2276, 0x338, 0x2277, 0x338, 0x227A, 0x338, 0x227B, 0x338,
+     0x2282, 0x338, 0x2283, 0x338, 0x2286, 0x338, 0x2287, 0x338,
+     0x22A2, 0x338, 0x22A8, 0x338, 0x22A9, 0x338, 0x22AB, 0x338,
+     0x227C, 0x338, 0x227D, 0x338, 0x2291, 0x338, 0x2292, 0x338,
+     0x22B2, 0x338, 0x22B3, 0x338, 0x22B4, 0x338, 0x22B5, 0x338,
+     0x3008, 0x3009, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+     0x37, 0x38, 0x39, 0x31, 0x30, 0x31, 0x31, 0x31,
+     0x32, 0x31, 0x33, 0x31, 0x34, 0x31, 0x35, 0x31,
+     0x36, 0x31, 0x37, 0x31, 0x38, 0x31, 0x39, 0x32,
+     0x30, 0x28, 0x31, 0x29, 0x28, 0x32, 0x29, 0x28,
+     0x33, 0x29, 0x28, 0x34, 0x29, 0x28, 0x35, 0x29,
+     0x28, 0x36, 0x29, 0x28, 0x37, 0x29, 0x28, 0x38,
+     0x29, 0x28, 0x39, 0x29, 0x28, 0x31, 0x30, 0x29,
+     0x28, 0x31, 0x31, 0x29, 0x28, 0x31, 0x32, 0x29,
+     0x28, 0x31, 0x33, 0x29, 0x28, 0x31, 0x34, 0x29,
+     0x28, 0x31, 0x35, 0x29, 0x28, 0x31, 0x36, 0x29,
+     0x28, 0x31, 0x37, 0x29, 0x28, 0x31, 0x38, 0x29,
+     0x28, 0x31, 0x39, 0x29, 0x28, 0x32, 0x30, 0x29,
+     0x31, 0x2E, 0x32, 0x2E, 0x33, 0x2E, 0x34, 0x2E,
+     0x35, 0x2E, 0x36, 0x2E, 0x37, 0x2E, 0x38, 0x2E,
+     0x39, 0x2E, 0x31, 0x30, 0x2E, 0x31, 0x31, 0x2E,
+     0x31, 0x32, 0x2E, 0x31, 0x33, 0x2E, 0x31, 0x34,
+     0x2E, 0x31, 0x35, 0x2E, 0x31, 0x36, 0x2E, 0x31,
+     0x37, 0x2E, 0x31, 0x38, 0x2E, 0x31, 0x39, 0x2E,
+     0x32, 0x30, 0x2E, 0x28, 0x61, 0x29, 0x28, 0x62,
+     0x29, 0x28, 0x63, 0x29, 0x28, 0x64, 0x29, 0x28,
+     0x65, 0x29, 0x28, 0x66, 0x29, 0x28, 0x67, 0x29,
+     0x28, 0x68, 0x29, 0x28, 0x69, 0x29, 0x28, 0x6A,
+     0x29, 0x28, 0x6B, 0x29, 0x28, 0x6C, 0x29, 0x28,
+     0x6D, 0x29, 0x28, 0x6E, 0x29, 0x28, 0x6F, 0x29,
+     0x28, 0x70, 0x29, 0x28, 0x71, 0x29, 0x28, 0x72,
+     0x29, 0x28, 0x73, 0x29, 0x28, 0x74, 0x29, 0x28,
+     0x75, 0x29, 0x28, 0x76, 0x29, 0x28, 0x77, 0x29,
+     0x28, 0x78, 0x29, 0x28, 0x79, 0x29, 0x28, 0x7A,
+     0x29, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+     0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+     0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+     0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65,
+     0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+     0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+     0x76, 0x77, 0x78, 0x79, 0x7A, 0x30, 0x222B, 0x222B,
+     0x222B, 0x222B, 0x3A, 0x3A, 0x3D, 0x3D, 0x3D, 0x3D,
+     0x3D, 0x3D, 0x2ADD, 0x338, 0x6A, 0x56, 0x2D61, 0x6BCD,
+     0x9F9F, 0x4E00, 0x4E28, 0x4E36, 0x4E3F, 0x4E59, 0x4E85, 0x4E8C,
+     0x4EA0, 0x4EBA, 0x513F, 0x5165, 0x516B, 0x5182, 0x5196, 0x51AB,
+     0x51E0, 0x51F5, 0x5200, 0x529B, 0x52F9, 0x5315, 0x531A, 0x5338,
+     0x5341, 0x535C, 0x5369, 0x5382, 0x53B6, 0x53C8, 0x53E3, 0x56D7,
+     0x571F, 0x58EB, 0x5902, 0x590A, 0x5915, 0x5927, 0x5973, 0x5B50,
+     0x5B80, 0x5BF8, 0x5C0F, 0x5C22, 0x5C38, 0x5C6E, 0x5C71, 0x5DDB,
+     0x5DE5, 0x5DF1, 0x5DFE, 0x5E72, 0x5E7A, 0x5E7F, 0x5EF4, 0x5EFE,
+     0x5F0B, 0x5F13, 0x5F50, 0x5F61, 0x5F73, 0x5FC3, 0x6208, 0x6236,
+     0x624B, 0x652F, 0x6534, 0x6587, 0x6597, 0x65A4, 0x65B9, 0x65E0,
+     0x65E5, 0x66F0, 0x6708, 0x6728, 0x6B20, 0x6B62, 0x6B79, 0x6BB3,
+     0x6BCB, 0x6BD4, 0x6BDB, 0x6C0F, 0x6C14, 0x6C34, 0x706B, 0x722A,
+     0x7236, 0x723B, 0x723F, 0x7247, 0x7259, 0x725B, 0x72AC, 0x7384,
+     0x7389, 0x74DC, 0x74E6, 0x7518, 0x751F, 0x7528, 0x7530, 0x758B,
+     0x7592, 0x7676, 0x767D, 0x76AE, 0x76BF, 0x76EE, 0x77DB, 0x77E2,
+     0x77F3, 0x793A, 0x79B8, 0x79BE, 0x7A74, 0x7ACB, 0x7AF9, 0x7C73,
+     0x7CF8, 0x7F36, 0x7F51, 0x7F8A, 0x7FBD, 0x8001, 0x800C, 0x8012,
+     0x8033, 0x807F, 0x8089, 0x81E3, 0x81EA, 0x81F3, 0x81FC, 0x820C,
+     0x821B, 0x821F, 0x826E, 0x8272, 0x8278, 0x864D, 0x866B, 0x8840,
+     0x884C, 0x8863, 0x897E, 0x898B, 0x89D2, 0x8A00, 0x8C37, 0x8C46,
+     0x8C55, 0x8C78, 0x8C9D, 0x8D64, 0x8D70, 0x8DB3, 0x8EAB, 0x8ECA,
+     0x8F9B, 0x8FB0, 0x8FB5, 0x9091, 0x9149, 0x91C6, 0x91CC, 0x91D1,
+     0x9577, 0x9580, 0x961C, 0x96B6, 0x96B9, 0x96E8, 0x9751, 0x975E,
+     0x9762, 0x9769, 0x97CB, 0x97ED, 0x97F3, 0x9801, 0x98A8, 0x98DB,
+     0x98DF, 0x9996, 0x9999, 0x99AC, 0x9AA8, 0x9AD8, 0x9ADF, 0x9B25,
+     0x9B2F, 0x9B32, 0x9B3C, 0x9B5A, 0x9CE5, 0x9E75, 0x9E7F, 0x9EA5,
+     0x9EBB, 0x9EC3, 0x9ECD, 0x9ED1, 0x9EF9, 0x9EFD, 0x9F0E, 0x9F13,
+     0x9F20, 0x9F3B, 0x9F4A, 0x9F52, 0x9F8D, 0x9F9C, 0x9FA0, 0x20,
+     0x3012, 0x5341, 0x5344, 0x5345, 0x304B, 0x3099, 0x304D, 0x3099,
+     0x304F, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099, 0x3055, 0x3099,
+     0x3057, 0x3099, 0x3059, 0x3099, 0x305B, 0x3099, 0x305D, 0x3099,
+     0x305F, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066, 0x3099,
+     0x3068, 0x3099, 0x306F, 0x3099, 0x306F, 0x309A, 0x3072, 0x3099,
+     0x3072, 0x309A, 0x3075, 0x3099, 0x3075, 0x309A, 0x3078, 0x3099,
+     0x3078, 0x309A, 0x307B, 0x3099, 0x307B, 0x309A, 0x3046, 0x3099,
+     0x20, 0x3099, 0x20, 0x309A, 0x309D, 0x3099, 0x3088, 0x308A,
+     0x30AB, 0x3099, 0x30AD, 0x3099, 0x30AF, 0x3099, 0x30B1, 0x3099,
+     0x30B3, 0x3099, 0x30B5, 0x3099, 0x30B7, 0x3099, 0x30B9, 0x3099,
+     0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF, 0x3099, 0x30C1, 0x3099,
+     0x30C4, 0x3099, 0x30C6, 0x3099, 0x30C8, 0x3099, 0x30CF, 0x3099,
+     0x30CF, 0x309A, 0x30D2, 0x3099, 0x30D2, 0x309A, 0x30D5, 0x3099,
+     0x30D5, 0x309A, 0x30D8, 0x3099, 0x30D8, 0x309A, 0x30DB, 0x3099,
+     0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF, 0x3099, 0x30F0, 0x3099,
+     0x30F1, 0x3099, 0x30F2, 0x3099, 0x30FD, 0x3099, 0x30B3, 0x30C8,
+     0x1100, 0x1101, 0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103, 0x1104,
+     0x1105, 0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5, 0x111A,
+     0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110A, 0x110B, 0x110C,
+     0x110D, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1161, 0x1162,
+     0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169, 0x116A,
+     0x116B, 0x116C, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171, 0x1172,
+     0x1173, 0x1174, 0x1175, 0x1160, 0x1114, 0x1115, 0x11C7, 0x11C8,
+     0x11CC, 0x11CE, 0x11D3, 0x11D7, 0x11D9, 0x111C, 0x11DD, 0x11DF,
+     0x111D, 0x111E, 0x1120, 0x1122, 0x1123, 0x1127, 0x1129, 0x112B,
+     0x112C, 0x112D, 0x112E, 0x112F, 0x1132, 0x1136, 0x1140, 0x1147,
+     0x114C, 0x11F1, 0x11F2, 0x1157, 0x1158, 0x1159, 0x1184, 0x1185,
+     0x1188, 0x1191, 0x1192, 0x1194, 0x119E, 0x11A1, 0x4E00, 0x4E8C,
+     0x4E09, 0x56DB, 0x4E0A, 0x4E2D, 0x4E0B, 0x7532, 0x4E59, 0x4E19,
+     0x4E01, 0x5929, 0x5730, 0x4EBA, 0x28, 0x1100, 0x29, 0x28,
+     0x1102, 0x29, 0x28, 0x1103, 0x29, 0x28, 0x1105, 0x29,
+     0x28, 0x1106, 0x29, 0x28, 0x1107, 0x29, 0x28, 0x1109,
+     0x29, 0x28, 0x110B, 0x29, 0x28, 0x110C, 0x29, 0x28,
+     0x110E, 0x29, 0x28, 0x110F, 0x29, 0x28, 0x1110, 0x29,
+     0x28, 0x1111, 0x29, 0x28, 0x1112, 0x29, 0x28, 0x1100,
+     0x1161, 0x29, 0x28, 0x1102, 0x1161, 0x29, 0x28, 0x1103,
+     0x1161, 0x29, 0x28, 0x1105, 0x1161, 0x29, 0x28, 0x1106,
+     0x1161, 0x29, 0x28, 0x1107, 0x1161, 0x29, 0x28, 0x1109,
+     0x1161, 0x29, 0x28, 0x110B, 0x1161, 0x29, 0x28, 0x110C,
+     0x1161, 0x29, 0x28, 0x110E, 0x1161, 0x29, 0x28, 0x110F,
+     0x1161, 0x29, 0x28, 0x1110, 0x1161, 0x29, 0x28, 0x1111,
+     0x1161, 0x29, 0x28, 0x1112, 0x1161, 0x29, 0x28, 0x110C,
+     0x116E, 0x29, 0x28, 0x110B, 0x1169, 0x110C, 0x1165, 0x11AB,
+     0x29, 0x28, 0x110B, 0x1169, 0x1112, 0x116E, 0x29, 0x28,
+     0x4E00, 0x29, 0x28, 0x4E8C, 0x29, 0x28, 0x4E09, 0x29,
+     0x28, 0x56DB, 0x29, 0x28, 0x4E94, 0x29, 0x28, 0x516D,
+     0x29, 0x28, 0x4E03, 0x29, 0x28, 0x516B, 0x29, 0x28,
+     0x4E5D, 0x29, 0x28, 0x5341, 0x29, 0x28, 0x6708, 0x29,
+     0x28, 0x706B, 0x29, 0x28, 0x6C34, 0x29, 0x28, 0x6728,
+     0x29, 0x28, 0x91D1, 0x29, 0x28, 0x571F, 0x29, 0x28,
+     0x65E5, 0x29, 0x28, 0x682A, 0x29, 0x28, 0x6709, 0x29,
+     0x28, 0x793E, 0x29, 0x28, 0x540D, 0x29, 0x28, 0x7279,
+     0x29, 0x28, 0x8CA1, 0x29, 0x28, 0x795D, 0x29, 0x28,
+     0x52B4, 0x29, 0x28, 0x4EE3, 0x29, 0x28, 0x547C, 0x29,
+     0x28, 0x5B66, 0x29, 0x28, 0x76E3, 0x29, 0x28, 0x4F01,
+     0x29, 0x28, 0x8CC7, 0x29, 0x28, 0x5354, 0x29, 0x28,
+     0x796D, 0x29, 0x28, 0x4F11, 0x29, 0x28, 0x81EA, 0x29,
+     0x28, 0x81F3, 0x29, 0x554F, 0x5E7C, 0x6587, 0x7B8F, 0x50,
+     0x54, 0x45, 0x32, 0x31, 0x32, 0x32, 0x32, 0x33,
+     0x32, 0x34, 0x32, 0x35, 0x32, 0x36, 0x32, 0x37,
+     0x32, 0x38, 0x32, 0x39, 0x33, 0x30, 0x33, 0x31,
+     0x33, 0x32, 0x33, 0x33, 0x33, 0x34, 0x33, 0x35,
+     0x1100, 0x1102, 0x1103, 0x1105, 0x1106, 0x1107, 0x1109, 0x110B,
+     0x110C, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1100, 0x1161,
+     0x1102, 0x1161, 0x1103, 0x1161, 0x1105, 0x1161, 0x1106, 0x1161,
+     0x1107, 0x1161, 0x1109, 0x1161, 0x110B, 0x1161, 0x110C, 0x1161,
+     0x110E, 0x1161, 0x110F, 0x1161, 0x1110, 0x1161, 0x1111, 0x1161,
+     0x1112, 0x1161, 0x110E, 0x1161, 0x11B7, 0x1100, 0x1169, 0x110C,
+     0x116E, 0x110B, 0x1174, 0x110B, 0x116E, 0x4E00, 0x4E8C, 0x4E09,
+     0x56DB, 0x4E94, 0x516D, 0x4E03, 0x516B, 0x4E5D, 0x5341, 0x6708,
+     0x706B, 0x6C34, 0x6728, 0x91D1, 0x571F, 0x65E5, 0x682A, 0x6709,
+     0x793E, 0x540D, 0x7279, 0x8CA1, 0x795D, 0x52B4, 0x79D8, 0x7537,
+     0x5973, 0x9069, 0x512A, 0x5370, 0x6CE8, 0x9805, 0x4F11, 0x5199,
+     0x6B63, 0x4E0A, 0x4E2D, 0x4E0B, 0x5DE6, 0x53F3, 0x533B, 0x5B97,
+     0x5B66, 0x76E3, 0x4F01, 0x8CC7, 0x5354, 0x591C, 0x33, 0x36,
+     0x33, 0x37, 0x33, 0x38, 0x33, 0x39, 0x34, 0x30,
+     0x34, 0x31, 0x34, 0x32, 0x34, 0x33, 0x34, 0x34,
+     0x34, 0x35, 0x34, 0x36, 0x34, 0x37, 0x34, 0x38,
+     0x34, 0x39, 0x35, 0x30, 0x31, 0x6708, 0x32, 0x6708,
+     0x33, 0x6708, 0x34, 0x6708, 0x35, 0x6708, 0x36, 0x6708,
+     0x37, 0x6708, 0x38, 0x6708, 0x39, 0x6708, 0x31, 0x30,
+     0x6708, 0x31, 0x31, 0x6708, 0x31, 0x32, 0x6708, 0x48,
+     0x67, 0x65, 0x72, 0x67, 0x65, 0x56, 0x4C, 0x54,
+     0x44, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD,
+     0x30AF, 0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD,
+     0x30BF, 0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC,
+     0x30CD, 0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE,
+     0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9,
+     0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F0, 0x30F1, 0x30F2,
+     0x4EE4, 0x548C, 0x30A2, 0x30CF, 0x309A, 0x30FC, 0x30C8, 0x30A2,
+     0x30EB, 0x30D5, 0x30A1, 0x30A2, 0x30F3, 0x30D8, 0x309A, 0x30A2,
+     0x30A2, 0x30FC, 0x30EB, 0x30A4, 0x30CB, 0x30F3, 0x30AF, 0x3099,
+     0x30A4, 0x30F3, 0x30C1, 0x30A6, 0x30A9, 0x30F3, 0x30A8, 0x30B9,
+     0x30AF, 0x30FC, 0x30C8, 0x3099, 0x30A8, 0x30FC, 0x30AB, 0x30FC,
+     0x30AA, 0x30F3, 0x30B9, 0x30AA, 0x30FC, 0x30E0, 0x30AB, 0x30A4,
+     0x30EA, 0x30AB, 0x30E9, 0x30C3, 0x30C8, 0x30AB, 0x30ED, 0x30EA,
+     0x30FC, 0x30AB, 0x3099, 0x30ED, 0x30F3, 0x30AB, 0x3099, 0x30F3,
+     0x30DE, 0x30AD, 0x3099, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30CB,
+     0x30FC, 0x30AD, 0x30E5, 0x30EA, 0x30FC, 0x30AD, 0x3099, 0x30EB,
+     0x30BF, 0x3099, 0x30FC, 0x30AD, 0x30ED, 0x30AD, 0x30ED, 0x30AF,
+     0x3099, 0x30E9, 0x30E0, 0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8,
+     0x30EB, 0x30AD, 0x30ED, 0x30EF, 0x30C3, 0x30C8, 0x30AF, 0x3099,
+     0x30E9, 0x30E0, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x30C8, 0x30F3,
+     0x30AF, 0x30EB, 0x30BB, 0x3099, 0x30A4, 0x30ED, 0x30AF, 0x30ED,
+     0x30FC, 0x30CD, 0x30B1, 0x30FC, 0x30B9, 0x30B3, 0x30EB, 0x30CA,
+     0x30B3, 0x30FC, 0x30DB, 0x309A, 0x30B5, 0x30A4, 0x30AF, 0x30EB,
+     0x30B5, 0x30F3, 0x30C1, 0x30FC, 0x30E0, 0x30B7, 0x30EA, 0x30F3,
+     0x30AF, 0x3099, 0x30BB, 0x30F3, 0x30C1, 0x30BB, 0x30F3, 0x30C8,
+     0x30BF, 0x3099, 0x30FC, 0x30B9, 0x30C6, 0x3099, 0x30B7, 0x30C8,
+     0x3099, 0x30EB, 0x30C8, 0x30F3, 0x30CA, 0x30CE, 0x30CE, 0x30C3,
+     0x30C8, 0x30CF, 0x30A4, 0x30C4, 0x30CF, 0x309A, 0x30FC, 0x30BB,
+     0x30F3, 0x30C8, 0x30CF, 0x309A, 0x30FC, 0x30C4, 0x30CF, 0x3099,
+     0x30FC, 0x30EC, 0x30EB, 0x30D2, 0x309A, 0x30A2, 0x30B9, 0x30C8,
+     0x30EB, 0x30D2, 0x309A, 0x30AF, 0x30EB, 0x30D2, 0x309A, 0x30B3,
+     0x30D2, 0x3099, 0x30EB, 0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C8,
+     0x3099, 0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x30D5, 0x3099, 0x30C3,
+     0x30B7, 0x30A7, 0x30EB, 0x30D5, 0x30E9, 0x30F3, 0x30D8, 0x30AF,
+     0x30BF, 0x30FC, 0x30EB, 0x30D8, 0x309A, 0x30BD, 0x30D8, 0x309A,
+     0x30CB, 0x30D2, 0x30D8, 0x30EB, 0x30C4, 0x30D8, 0x309A, 0x30F3,
+     0x30B9, 0x30D8, 0x309A, 0x30FC, 0x30B7, 0x3099, 0x30D8, 0x3099,
+     0x30FC, 0x30BF, 0x30DB, 0x309A, 0x30A4, 0x30F3, 0x30C8, 0x30DB,
+     0x3099, 0x30EB, 0x30C8, 0x30DB, 0x30F3, 0x30DB, 0x309A, 0x30F3,
+     0x30C8, 0x3099, 0x30DB, 0x30FC, 0x30EB, 0x30DB, 0x30FC, 0x30F3,
+     0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x30DE, 0x30A4, 0x30EB, 0x30DE,
+     0x30C3, 0x30CF, 0x30DE, 0x30EB, 0x30AF, 0x30DE, 0x30F3, 0x30B7,
+     0x30E7, 0x30F3, 0x30DF, 0x30AF, 0x30ED, 0x30F3, 0x30DF, 0x30EA,
+     0x30DF, 0x30EA, 0x30CF, 0x3099, 0x30FC, 0x30EB, 0x30E1, 0x30AB,
+     0x3099, 0x30E1, 0x30AB, 0x3099, 0x30C8, 0x30F3, 0x30E1, 0x30FC,
+     0x30C8, 0x30EB, 0x30E4, 0x30FC, 0x30C8, 0x3099, 0x30E4, 0x30FC,
+     0x30EB, 0x30E6, 0x30A2, 0x30F3, 0x30EA, 0x30C3, 0x30C8, 0x30EB,
+     0x30EA, 0x30E9, 0x30EB, 0x30D2, 0x309A, 0x30FC, 0x30EB, 0x30FC,
+     0x30D5, 0x3099, 0x30EB, 0x30EC, 0x30E0, 0x30EC, 0x30F3, 0x30C8,
+     0x30B1, 0x3099, 0x30F3, 0x30EF, 0x30C3, 0x30C8, 0x30, 0x70B9,
+     0x31, 0x70B9, 0x32, 0x70B9, 0x33, 0x70B9, 0x34, 0x70B9,
+     0x35, 0x70B9, 0x36, 0x70B9, 0x37, 0x70B9, 0x38, 0x70B9,
+     0x39, 0x70B9, 0x31, 0x30, 0x70B9, 0x31, 0x31, 0x70B9,
+     0x31, 0x32, 0x70B9, 0x31, 0x33, 0x70B9, 0x31, 0x34,
+     0x70B9, 0x31, 0x35, 0x70B9, 0x31, 0x36, 0x70B9, 0x31,
+     0x37, 0x70B9, 0x31, 0x38, 0x70B9, 0x31, 0x39, 0x70B9,
+     0x32, 0x30, 0x70B9, 0x32, 0x31, 0x70B9, 0x32, 0x32,
+     0x70B9, 0x32, 0x33, 0x70B9, 0x32, 0x34, 0x70B9, 0x68,
+     0x50, 0x61, 0x64, 0x61, 0x41, 0x55, 0x62, 0x61,
+     0x72, 0x6F, 0x56, 0x70, 0x63, 0x64, 0x6D, 0x64,
+     0x6D, 0x32, 0x64, 0x6D, 0x33, 0x49, 0x55, 0x5E73,
+     0x6210, 0x662D, 0x548C, 0x5927, 0x6B63, 0x660E, 0x6CBB, 0x682A,
+     0x5F0F, 0x4F1A, 0x793E, 0x70, 0x41, 0x6E, 0x41, 0x3BC,
+     0x41, 0x6D, 0x41, 0x6B, 0x41, 0x4B, 0x42, 0x4D,
+     0x42, 0x47, 0x42, 0x63, 0x61, 0x6C, 0x6B, 0x63,
+     0x61, 0x6C, 0x70, 0x46, 0x6E, 0x46, 0x3BC, 0x46,
+     0x3BC, 0x67, 0x6D, 0x67, 0x6B, 0x67, 0x48, 0x7A,
+     0x6B, 0x48, 0x7A, 0x4D, 0x48, 0x7A, 0x47, 0x48,
+     0x7A, 0x54, 0x48, 0x7A, 0x3BC, 0x6C, 0x6D, 0x6C,
+     0x64, 0x6C, 0x6B, 0x6C, 0x66, 0x6D, 0x6E, 0x6D,
+     0x3BC, 0x6D, 0x6D, 0x6D, 0x63, 0x6D, 0x6B, 0x6D,
+     0x6D, 0x6D, 0x32, 0x63, 0x6D, 0x32, 0x6D, 0x32,
+     0x6B, 0x6D, 0x32, 0x6D, 0x6D, 0x33, 0x63, 0x6D,
+     0x33, 0x6D, 0x33, 0x6B, 0x6D, 0x33, 0x6D, 0x2215,
+     0x73, 0x6D, 0x2215, 0x73, 0x32, 0x50, 0x61, 0x6B,
+     0x50, 0x61, 0x4D, 0x50, 0x61, 0x47, 0x50, 0x61,
+     0x72, 0x61, 0x64, 0x72, 0x61, 0x64, 0x2215, 0x73,
+     0x72, 0x61, 0x64, 0x2215, 0x73, 0x32, 0x70, 0x73,
+     0x6E, 0x73, 0x3BC, 0x73, 0x6D, 0x73, 0x70, 0x56,
+     0x6E, 0x56, 0x3BC, 0x56, 0x6D, 0x56, 0x6B, 0x56,
+     0x4D, 0x56, 0x70, 0x57, 0x6E, 0x57, 0x3BC, 0x57,
+     0x6D, 0x57, 0x6B, 0x57, 0x4D, 0x57, 0x6B, 0x3A9,
+     0x4D, 0x3A9, 0x61, 0x2E, 0x6D, 0x2E, 0x42, 0x71,
+     0x63, 0x63, 0x63, 0x64, 0x43, 0x2215, 0x6B, 0x67,
+     0x43, 0x6F, 0x2E, 0x64, 0x42, 0x47, 0x79, 0x68,
+     0x61, 0x48, 0x50, 0x69, 0x6E, 0x4B, 0x4B, 0x4B,
+     0x4D, 0x6B, 0x74, 0x6C, 0x6D, 0x6C, 0x6E, 0x6C,
+     0x6F, 0x67, 0x6C, 0x78, 0x6D, 0x62, 0x6D, 0x69,
+     0x6C, 0x6D, 0x6F, 0x6C, 0x50, 0x48, 0x70, 0x2E,
+     0x6D, 0x2E, 0x50, 0x50, 0x4D, 0x50, 0x52, 0x73,
+     0x72, 0x53, 0x76, 0x57, 0x62, 0x56, 0x2215, 0x6D,
+     0x41, 0x2215, 0x6D, 0x31, 0x65E5, 0x32, 0x65E5, 0x33,
+     0x65E5, 0x34, 0x65E5, 0x35, 0x65E5, 0x36, 0x65E5, 0x37,
+     0x65E5, 0x38, 0x65E5, 0x39, 0x65E5, 0x31, 0x30, 0x65E5,
+     0x31, 0x31, 0x65E5, 0x31, 0x32, 0x65E5, 0x31, 0x33,
+     0x65E5, 0x31, 0x34, 0x65E5, 0x31, 0x35, 0x65E5, 0x31,
+     0x36, 0x65E5, 0x31, 0x37, 0x65E5, 0x31, 0x38, 0x65E5,
+     0x31, 0x39, 0x65E5, 0x32, 0x30, 0x65E5, 0x32, 0x31,
+     0x65E5, 0x32, 0x32, 0x65E5, 0x32, 0x33, 0x65E5, 0x32,
+     0x34, 0x65E5, 0x32, 0x35, 0x65E5, 0x32, 0x36, 0x65E5,
+     0x32, 0x37, 0x65E5, 0x32, 0x38, 0x65E5, 0x32, 0x39,
+     0x65E5, 0x33, 0x30, 0x65E5, 0x33, 0x31, 0x65E5, 0x67,
+     0x61, 0x6C, 0x44A, 0x44C, 0xA76F, 0x43, 0x46, 0x51,
+     0x126, 0x153, 0xA727, 0xAB37, 0x26B, 0xAB52, 0x28D, 0x8C48,
+     0x66F4, 0x8ECA, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5, 0x9F9C, 0x9F9C,
+     0x5951, 0x91D1, 0x5587, 0x5948, 0x61F6, 0x7669, 0x7F85, 0x863F,
+     0x87BA, 0x88F8, 0x908F, 0x6A02, 0x6D1B, 0x70D9, 0x73DE, 0x843D,
+     0x916A, 0x99F1, 0x4E82, 0x5375, 0x6B04, 0x721B, 0x862D, 0x9E1E,
+     0x5D50, 0x6FEB, 0x85CD, 0x8964, 0x62C9, 0x81D8, 0x881F, 0x5ECA,
+     0x6717, 0x6D6A, 0x72FC, 0x90CE, 0x4F86, 0x51B7, 0x52DE, 0x64C4,
+     0x6AD3, 0x7210, 0x76E7, 0x8001, 0x8606, 0x865C, 0x8DEF, 0x9732,
+     0x9B6F, 0x9DFA, 0x788C, 0x797F, 0x7DA0, 0x83C9, 0x9304, 0x9E7F,
+     0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E, 0x7262, 0x78CA, 0x8CC2,
+     0x96F7, 0x58D8, 0x5C62, 0x6A13, 0x6DDA, 0x6F0F, 0x7D2F, 0x7E37,
+     0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C, 0x7DBE, 0x83F1,
+     0x9675, 0x8B80, 0x62CF, 0x6A02, 0x8AFE, 0x4E39, 0x5BE7, 0x6012,
+     0x7387, 0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9, 0x4E0D, 0x6CCC,
+     0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449, 0x8AAA, 0x6BBA,
+     0x8FB0, 0x6C88, 0x62FE, 0x82E5, 0x63A0, 0x7565, 0x4EAE, 0x5169,
+     0x51C9, 0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF, 0x52F5, 0x5442,
+     0x5973, 0x5EEC, 0x65C5, 0x6FFE, 0x792A, 0x95AD, 0x9A6A, 0x9E97,
+     0x9ECE, 0x529B, 0x66C6, 0x6B77, 0x8F62, 0x5E74, 0x6190, 0x6200,
+     0x649A, 0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4, 0x806F, 0x8F26,
+     0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD, 0x70C8, 0x88C2,
+     0x8AAA, 0x5EC9, 0x5FF5, 0x637B, 0x6BAE, 0x7C3E, 0x7375, 0x4EE4,
+     0x56F9, 0x5BE7, 0x5DBA, 0x601C, 0x73B2, 0x7469, 0x7F9A, 0x8046,
+     0x9234, 0x96F6, 0x9748, 0x9818, 0x4F8B, 0x79AE, 0x91B4, 0x96B8,
+     0x60E1, 0x4E86, 0x50DA, 0x5BEE, 0x5C3F, 0x6599, 0x6A02, 0x71CE,
+     0x7642, 0x84FC, 0x907C, 0x9F8D, 0x6688, 0x962E, 0x5289, 0x677B,
+     0x67F3, 0x6D41, 0x6E9C, 0x7409, 0x7559, 0x786B, 0x7D10, 0x985E,
+     0x516D, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA, 0x8F2A, 0x5F8B,
+     0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540F, 0x5C65, 0x6613,
+     0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2, 0x7F79, 0x88CF, 0x88E1,
+     0x91CC, 0x96E2, 0x533F, 0x6EBA, 0x541D, 0x71D0, 0x7498, 0x85FA,
+     0x96A3, 0x9C57, 0x9E9F, 0x6797, 0x6DCB, 0x81E8, 0x7ACB, 0x7B20,
+     0x7C92, 0x72C0, 0x7099, 0x8B58, 0x4EC0, 0x8336, 0x523A, 0x5207,
+     0x5EA6, 0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4, 0x8F3B, 0x884C,
+     0x964D, 0x898B, 0x5ED3, 0x5140, 0x55C0, 0x585A, 0x6674, 0x51DE,
+     0x732A, 0x76CA, 0x793C, 0x795E, 0x7965, 0x798F, 0x9756, 0x7CBE,
+     0x7FBD, 0x8612, 0x8AF8, 0x9038, 0x90FD, 0x98EF, 0x98FC, 0x9928,
+     0x9DB4, 0x90DE, 0x96B7, 0x4FAE, 0x50E7, 0x514D, 0x52C9, 0x52E4,
+     0x5351, 0x559D, 0x5606, 0x5668, 0x5840, 0x58A8, 0x5C64, 0x5C6E,
+     0x6094, 0x6168, 0x618E, 0x61F2, 0x654F, 0x65E2, 0x6691, 0x6885,
+     0x6D77, 0x6E1A, 0x6F22, 0x716E, 0x722B, 0x7422, 0x7891, 0x793E,
+     0x7949, 0x7948, 0x7950, 0x7956, 0x795D, 0x798D, 0x798E, 0x7A40,
+     0x7A81, 0x7BC0, 0x7DF4, 0x7E09, 0x7E41, 0x7F72, 0x8005, 0x81ED,
+     0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8B01, 0x8B39, 0x8CD3,
+     0x8D08, 0x8FB6, 0x9038, 0x96E3, 0x97FF, 0x983B, 0x6075, 0x242EE,
+     0x8218, 0x4E26, 0x51B5, 0x5168, 0x4F80, 0x5145, 0x5180, 0x52C7,
+     0x52FA, 0x559D, 0x5555, 0x5599, 0x55E2, 0x585A, 0x58B3, 0x5944,
+     0x5954, 0x5A62, 0x5B28, 0x5ED2, 0x5ED9, 0x5F69, 0x5FAD, 0x60D8,
+     0x614E, 0x6108, 0x618E, 0x6160, 0x61F2, 0x6234, 0x63C4, 0x641C,
+     0x6452, 0x6556, 0x6674, 0x6717, 0x671B, 0x6756, 0x6B79, 0x6BBA,
+     0x6D41, 0x6EDB, 0x6ECB, 0x6F22, 0x701E, 0x716E, 0x77A7, 0x7235,
+     0x72AF, 0x732A, 0x7471, 0x7506, 0x753B, 0x761D, 0x761F, 0x76CA,
+     0x76DB, 0x76F4, 0x774A, 0x7740, 0x78CC, 0x7AB1, 0x7BC0, 0x7C7B,
+     0x7D5B, 0x7DF4, 0x7F3E, 0x8005, 0x8352, 0x83EF, 0x8779, 0x8941,
+     0x8986, 0x8996, 0x8ABF, 0x8AF8, 0x8ACB, 0x8B01, 0x8AFE, 0x8AED,
+     0x8B39, 0x8B8A, 0x8D08, 0x8F38, 0x9072, 0x9199, 0x9276, 0x967C,
+     0x96E3, 0x9756, 0x97DB, 0x97FF, 0x980B, 0x983B, 0x9B12, 0x9F9C,
+     0x2284A, 0x22844, 0x233D5, 0x3B9D, 0x4018, 0x4039, 0x25249, 0x25CD0,
+     0x27ED3, 0x9F43, 0x9F8E, 0x66, 0x66, 0x66, 0x69, 0x66,
+     0x6C, 0x66, 0x66, 0x69, 0x66, 0x66, 0x6C, 0x73,
+     0x74, 0x73, 0x74, 0x574, 0x576, 0x574, 0x565, 0x574,
+     0x56B, 0x57E, 0x576, 0x574, 0x56D, 0x5D9, 0x5B4, 0x5F2,
+     0x5B7, 0x5E2, 0x5D0, 0x5D3, 0x5D4, 0x5DB, 0x5DC, 0x5DD,
+     0x5E8, 0x5EA, 0x2B, 0x5E9, 0x5C1, 0x5E9, 0x5C2, 0x5E9,
+     0x5BC, 0x5C1, 0x5E9, 0x5BC, 0x5C2, 0x5D0, 0x5B7, 0x5D0,
+     0x5B8, 0x5D0, 0x5BC, 0x5D1, 0x5BC, 0x5D2, 0x5BC, 0x5D3,
+     0x5BC, 0x5D4, 0x5BC, 0x5D5, 0x5BC, 0x5D6, 0x5BC, 0x5D8,
+     0x5BC, 0x5D9, 0x5BC, 0x5DA, 0x5BC, 0x5DB, 0x5BC, 0x5DC,
+     0x5BC, 0x5DE, 0x5BC, 0x5E0, 0x5BC, 0x5E1, 0x5BC, 0x5E3,
+     0x5BC, 0x5E4, 0x5BC, 0x5E6, 0x5BC, 0x5E7, 0x5BC, 0x5E8,
+     0x5BC, 0x5E9, 0x5BC, 0x5EA, 0x5BC, 0x5D5, 0x5B9, 0x5D1,
+     0x5BF, 0x5DB, 0x5BF, 0x5E4, 0x5BF, 0x5D0, 0x5DC, 0x671,
+     0x671, 0x67B, 0x67B, 0x67B, 0x67B, 0x67E, 0x67E, 0x67E,
+     0x67E, 0x680, 0x680, 0x680, 0x680, 0x67A, 0x67A, 0x67A,
+     0x67A, 0x67F, 0x67F, 0x67F, 0x67F, 0x679, 0x679, 0x679,
+     0x679, 0x6A4, 0x6A4, 0x6A4, 0x6A4, 0x6A6, 0x6A6, 0x6A6,
+     0x6A6, 0x684, 0x684, 0x684, 0x684, 0x683, 0x683, 0x683,
+     0x683, 0x686, 0x686, 0x686, 0x686, 0x687, 0x687, 0x687,
+     0x687, 0x68D, 0x68D, 0x68C, 0x68C, 0x68E, 0x68E, 0x688,
+     0x688, 0x698, 0x698, 0x691, 0x691, 0x6A9, 0x6A9, 0x6A9,
+     0x6A9, 0x6AF, 0x6AF, 0x6AF, 0x6AF, 0x6B3, 0x6B3, 0x6B3,
+     0x6B3, 0x6B1, 0x6B1, 0x6B1, 0x6B1, 0x6BA, 0x6BA, 0x6BB,
+     0x6BB, 0x6BB, 0x6BB, 0x6D5, 0x654, 0x6D5, 0x654, 0x6C1,
+     0x6C1, 0x6C1, 0x6C1, 0x6BE, 0x6BE, 0x6BE, 0x6BE, 0x6D2,
+     0x6D2, 0x6D2, 0x654, 0x6D2, 0x654, 0x6AD, 0x6AD, 0x6AD,
+     0x6AD, 0x6C7, 0x6C7, 0x6C6, 0x6C6, 0x6C8, 0x6C8, 0x6C7,
+     0x674, 0x6CB, 0x6CB, 0x6C5, 0x6C5, 0x6C9, 0x6C9, 0x6D0,
+     0x6D0, 0x6D0, 0x6D0, 0x649, 0x649, 0x64A, 0x654, 0x627,
+     0x64A, 0x654, 0x627, 0x64A, 0x654, 0x6D5, 0x64A, 0x654,
+     0x6D5, 0x64A, 0x654, 0x648, 0x64A, 0x654, 0x648, 0x64A,
+     0x654, 0x6C7, 0x64A, 0x654, 0x6C7, 0x64A, 0x654, 0x6C6,
+     0x64A, 0x654, 0x6C6, 0x64A, 0x654, 0x6C8, 0x64A, 0x654,
+     0x6C8, 0x64A, 0x654, 0x6D0, 0x64A, 0x654, 0x6D0, 0x64A,
+     0x654, 0x6D0, 0x64A, 0x654, 0x649, 0x64A, 0x654, 0x649,
+     0x64A, 0x654, 0x649, 0x6CC, 0x6CC, 0x6CC, 0x6CC, 0x64A,
+     0x654, 0x62C, 0x64A, 0x654, 0x62D, 0x64A, 0x654, 0x645,
+     0x64A, 0x654, 0x649, 0x64A, 0x654, 0x64A, 0x628, 0x62C,
+     0x628, 0x62D, 0x628, 0x62E, 0x628, 0x645, 0x628, 0x649,
+     0x628, 0x64A, 0x62A, 0x62C, 0x62A, 0x62D, 0x62A, 0x62E,
+     0x62A, 0x645, 0x62A, 0x649, 0x62A, 0x64A, 0x62B, 0x62C,
+     0x62B, 0x645, 0x62B, 0x649, 0x62B, 0x64A, 0x62C, 0x62D,
+     0x62C, 0x645, 0x62D, 0x62C, 0x62D, 0x645, 0x62E, 0x62C,
+     0x62E, 0x62D, 0x62E, 0x645, 0x633, 0x62C, 0x633, 0x62D,
+     0x633, 0x62E, 0x633, 0x645, 0x635, 0x62D, 0x635, 0x645,
+     0x636, 0x62C, 0x636, 0x62D, 0x636, 0x62E, 0x636, 0x645,
+     0x637, 0x62D, 0x637, 0x645, 0x638, 0x645, 0x639, 0x62C,
+     0x639, 0x645, 0x63A, 0x62C, 0x63A, 0x645, 0x641, 0x62C,
+     0x641, 0x62D, 0x641, 0x62E, 0x641, 0x645, 0x641, 0x649,
+     0x641, 0x64A, 0x642, 0x62D, 0x642, 0x645, 0x642, 0x649,
+     0x642, 0x64A, 0x643, 0x627, 0x643, 0x62C, 0x643, 0x62D,
+     0x643, 0x62E, 0x643, 0x644, 0x643, 0x645, 0x643, 0x649,
+     0x643, 0x64A, 0x644, 0x62C, 0x644, 0x62D, 0x644, 0x62E,
+     0x644, 0x645, 0x644, 0x649, 0x644, 0x64A, 0x645, 0x62C,
+     0x645, 0x62D, 0x645, 0x62E, 0x645, 0x645, 0x645, 0x649,
+     0x645, 0x64A, 0x646, 0x62C, 0x646, 0x62D, 0x646, 0x62E,
+     0x646, 0x645, 0x646, 0x649, 0x646, 0x64A, 0x647, 0x62C,
+     0x647, 0x645, 0x647, 0x649, 0x647, 0x64A, 0x64A, 0x62C,
+     0x64A, 0x62D, 0x64A, 0x62E, 0x64A, 0x645, 0x64A, 0x649,
+     0x64A, 0x64A, 0x630, 0x670, 0x631, 0x670, 0x649, 0x670,
+     0x20, 0x64C, 0x651, 0x20, 0x64D, 0x651, 0x20, 0x64E,
+     0x651, 0x20, 0x64F, 0x651, 0x20, 0x650, 0x651, 0x20,
+     0x651, 0x670, 0x64A, 0x654, 0x631, 0x64A, 0x654, 0x632,
+     0x64A, 0x654, 0x645, 0x64A, 0x654, 0x646, 0x64A, 0x654,
+     0x649, 0x64A, 0x654, 0x64A, 0x628, 0x631, 0x628, 0x632,
+     0x628, 0x645, 0x628, 0x646, 0x628, 0x649, 0x628, 0x64A,
+     0x62A, 0x631, 0x62A, 0x632, 0x62A, 0x645, 0x62A, 0x646,
+     0x62A, 0x649, 0x62A, 0x64A, 0x62B, 0x631, 0x62B, 0x632,
+     0x62B, 0x645, 0x62B, 0x646, 0x62B, 0x649, 0x62B, 0x64A,
+     0x641, 0x649, 0x641, 0x64A, 0x642, 0x649, 0x642, 0x64A,
+     0x643, 0x627, 0x643, 0x644, 0x643, 0x645, 0x643, 0x649,
+     0x643, 0x64A, 0x644, 0x645, 0x644, 0x649, 0x644, 0x64A,
+     0x645, 0x627, 0x645, 0x645, 0x646, 0x631, 0x646, 0x632,
+     0x646, 0x645, 0x646, 0x646, 0x646, 0x649, 0x646, 0x64A,
+     0x649, 0x670, 0x64A, 0x631, 0x64A, 0x632, 0x64A, 0x645,
+     0x64A, 0x646, 0x64A, 0x649, 0x64A, 0x64A, 0x64A, 0x654,
+     0x62C, 0x64A, 0x654, 0x62D, 0x64A, 0x654, 0x62E, 0x64A,
+     0x654, 0x645, 0x64A, 0x654, 0x647, 0x628, 0x62C, 0x628,
+     0x62D, 0x628, 0x62E, 0x628, 0x645, 0x628, 0x647, 0x62A,
+     0x62C, 0x62A, 0x62D, 0x62A, 0x62E, 0x62A, 0x645, 0x62A,
+     0x647, 0x62B, 0x645, 0x62C, 0x62D, 0x62C, 0x645, 0x62D,
+     0x62C, 0x62D, 0x645, 0x62E, 0x62C, 0x62E, 0x645, 0x633,
+     0x62C, 0x633, 0x62D, 0x633, 0x62E, 0x633, 0x645, 0x635,
+     0x62D, 0x635, 0x62E, 0x635, 0x645, 0x636, 0x62C, 0x636,
+     0x62D, 0x636, 0x62E, 0x636, 0x645, 0x637, 0x62D, 0x638,
+     0x645, 0x639, 0x62C, 0x639, 0x645, 0x63A, 0x62C, 0x63A,
+     0x645, 0x641, 0x62C, 0x641, 0x62D, 0x641, 0x62E, 0x641,
+     0x645, 0x642, 0x62D, 0x642, 0x645, 0x643, 0x62C, 0x643,
+     0x62D, 0x643, 0x62E, 0x643, 0x644, 0x643, 0x645, 0x644,
+     0x62C, 0x644, 0x62D, 0x644, 0x62E, 0x644, 0x645, 0x644,
+     0x647, 0x645, 0x62C, 0x645, 0x62D, 0x645, 0x62E, 0x645,
+     0x645, 0x646, 0x62C, 0x646, 0x62D, 0x646, 0x62E, 0x646,
+     0x645, 0x646, 0x647, 0x647, 0x62C, 0x647, 0x645, 0x647,
+     0x670, 0x64A, 0x62C, 0x64A, 0x62D, 0x64A, 0x62E, 0x64A,
+     0x645, 0x64A, 0x647, 0x64A, 0x654, 0x645, 0x64A, 0x654,
+     0x647, 0x628, 0x645, 0x628, 0x647, 0x62A, 0x645, 0x62A,
+     0x647, 0x62B, 0x645, 0x62B, 0x647, 0x633, 0x645, 0x633,
+     0x647, 0x634, 0x645, 0x634, 0x647, 0x643, 0x644, 0x643,
+     0x645, 0x644, 0x645, 0x646, 0x645, 0x646, 0x647, 0x64A,
+     0x645, 0x64A, 0x647, 0x640, 0x64E, 0x651, 0x640, 0x64F,
+     0x651, 0x640, 0x650, 0x651, 0x637, 0x649, 0x637, 0x64A,
+     0x639, 0x649, 0x639, 0x64A, 0x63A, 0x649, 0x63A, 0x64A,
+     0x633, 0x649, 0x633, 0x64A, 0x634, 0x649, 0x634, 0x64A,
+     0x62D, 0x649, 0x62D, 0x64A, 0x62C, 0x649, 0x62C, 0x64A,
+     0x62E, 0x649, 0x62E, 0x64A, 0x635, 0x649, 0x635, 0x64A,
+     0x636, 0x649, 0x636, 0x64A, 0x634, 0x62C, 0x634, 0x62D,
+     0x634, 0x62E, 0x634, 0x645, 0x634, 0x631, 0x633, 0x631,
+     0x635, 0x631, 0x636, 0x631, 0x637, 0x649, 0x637, 0x64A,
+     0x639, 0x649, 0x639, 0x64A, 0x63A, 0x649, 0x63A, 0x64A,
+     0x633, 0x649, 0x633, 0x64A, 0x634, 0x649, 0x634, 0x64A,
+     0x62D, 0x649, 0x62D, 0x64A, 0x62C, 0x649, 0x62C, 0x64A,
+     0x62E, 0x649, 0x62E, 0x64A, 0x635, 0x649, 0x635, 0x64A,
+     0x636, 0x649, 0x636, 0x64A, 0x634, 0x62C, 0x634, 0x62D,
+     0x634, 0x62E, 0x634, 0x645, 0x634, 0x631, 0x633, 0x631,
+     0x635, 0x631, 0x636, 0x631, 0x634, 0x62C, 0x634, 0x62D,
+     0x634, 0x62E, 0x634, 0x645, 0x633, 0x647, 0x634, 0x647,
+     0x637, 0x645, 0x633, 0x62C, 0x633, 0x62D, 0x633, 0x62E,
+     0x634, 0x62C, 0x634, 0x62D, 0x634, 0x62E, 0x637, 0x645,
+     0x638, 0x645, 0x627, 0x64B, 0x627, 0x64B, 0x62A, 0x62C,
+     0x645, 0x62A, 0x62D, 0x62C, 0x62A, 0x62D, 0x62C, 0x62A,
+     0x62D, 0x645, 0x62A, 0x62E, 0x645, 0x62A, 0x645, 0x62C,
+     0x62A, 0x645, 0x62D, 0x62A, 0x645, 0x62E, 0x62C, 0x645,
+     0x62D, 0x62C, 0x645, 0x62D, 0x62D, 0x645, 0x64A, 0x62D,
+     0x645, 0x649, 0x633, 0x62D, 0x62C, 0x633, 0x62C, 0x62D,
+     0x633, 0x62C, 0x649, 0x633, 0x645, 0x62D, 0x633, 0x645,
+     0x62D, 0x633, 0x645, 0x62C, 0x633, 0x645, 0x645, 0x633,
+     0x645, 0x645, 0x635, 0x62D, 0x62D, 0x635, 0x62D, 0x62D,
+     0x635, 0x645, 0x645, 0x634, 0x62D, 0x645, 0x634, 0x62D,
+     0x645, 0x634, 0x62C, 0x64A, 0x634, 0x645, 0x62E, 0x634,
+     0x645, 0x62E, 0x634, 0x645, 0x645, 0x634, 0x645, 0x645,
+     0x636, 0x62D, 0x649, 0x636, 0x62E, 0x645, 0x636, 0x62E,
+     0x645, 0x637, 0x645, 0x62D, 0x637, 0x645, 0x62D, 0x637,
+     0x645, 0x645, 0x637, 0x645, 0x64A, 0x639, 0x62C, 0x645,
+     0x639, 0x645, 0x645, 0x639, 0x645, 0x645, 0x639, 0x645,
+     0x649, 0x63A, 0x645, 0x645, 0x63A, 0x645, 0x64A, 0x63A,
+     0x645, 0x649, 0x641, 0x62E, 0x645, 0x641, 0x62E, 0x645,
+     0x642, 0x645, 0x62D, 0x642, 0x645, 0x645, 0x644, 0x62D,
+     0x645, 0x644, 0x62D, 0x64A, 0x644, 0x62D, 0x649, 0x644,
+     0x62C, 0x62C, 0x644, 0x62C, 0x62C, 0x644, 0x62E, 0x645,
+     0x644, 0x62E, 0x645, 0x644, 0x645, 0x62D, 0x644, 0x645,
+     0x62D, 0x645, 0x62D, 0x62C, 0x645, 0x62D, 0x645, 0x645,
+     0x62D, 0x64A, 0x645, 0x62C, 0x62D, 0x645, 0x62C, 0x645,
+     0x645, 0x62E, 0x62C, 0x645, 0x62E, 0x645, 0x645, 0x62C,
+     0x62E, 0x647, 0x645, 0x62C, 0x647, 0x645, 0x645, 0x646,
+     0x62D, 0x645, 0x646, 0x62D, 0x649, 0x646, 0x62C, 0x645,
+     0x646, 0x62C, 0x645, 0x646, 0x62C, 0x649, 0x646, 0x645,
+     0x64A, 0x646, 0x645, 0x649, 0x64A, 0x645, 0x645, 0x64A,
+     0x645, 0x645, 0x628, 0x62E, 0x64A, 0x62A, 0x62C, 0x64A,
+     0x62A, 0x62C, 0x649, 0x62A, 0x62E, 0x64A, 0x62A, 0x62E,
+     0x649, 0x62A, 0x645, 0x64A, 0x62A, 0x645, 0x649, 0x62C,
+     0x645, 0x64A, 0x62C, 0x62D, 0x649, 0x62C, 0x645, 0x649,
+     0x633, 0x62E, 0x649, 0x635, 0x62D, 0x64A, 0x634, 0x62D,
+     0x64A, 0x636, 0x62D, 0x64A, 0x644, 0x62C, 0x64A, 0x644,
+     0x645, 0x64A, 0x64A, 0x62D, 0x64A, 0x64A, 0x62C, 0x64A,
+     0x64A, 0x645, 0x64A, 0x645, 0x645, 0x64A, 0x642, 0x645,
+     0x64A, 0x646, 0x62D, 0x64A, 0x642, 0x645, 0x62D, 0x644,
+     0x62D, 0x645, 0x639, 0x645, 0x64A, 0x643, 0x645, 0x64A,
+     0x646, 0x62C, 0x62D, 0x645, 0x62E, 0x64A, 0x644, 0x62C,
+     0x645, 0x643, 0x645, 0x645, 0x644, 0x62C, 0x645, 0x646,
+     0x62C, 0x62D, 0x62C, 0x62D, 0x64A, 0x62D, 0x62C, 0x64A,
+     0x645, 0x62C, 0x64A, 0x641, 0x645, 0x64A, 0x628, 0x62D,
+     0x64A, 0x643, 0x645, 0x645, 0x639, 0x62C, 0x645, 0x635,
+     0x645, 0x645, 0x633, 0x62E, 0x64A, 0x646, 0x62C, 0x64A,
+     0x635, 0x644, 0x6D2, 0x642, 0x644, 0x6D2, 0x627, 0x644,
+     0x644, 0x647, 0x627, 0x643, 0x628, 0x631, 0x645, 0x62D,
+     0x645, 0x62F, 0x635, 0x644, 0x639, 0x645, 0x631, 0x633,
+     0x648, 0x644, 0x639, 0x644, 0x64A, 0x647, 0x648, 0x633,
+     0x644, 0x645, 0x635, 0x644, 0x649, 0x635, 0x644, 0x649,
+     0x20, 0x627, 0x644, 0x644, 0x647, 0x20, 0x639, 0x644,
+     0x64A, 0x647, 0x20, 0x648, 0x633, 0x644, 0x645, 0x62C,
+     0x644, 0x20, 0x62C, 0x644, 0x627, 0x644, 0x647, 0x631,
+     0x6CC, 0x627, 0x644, 0x2C, 0x3001, 0x3002, 0x3A, 0x3B,
+     0x21, 0x3F, 0x3016, 0x3017, 0x2E, 0x2E, 0x2E, 0x2E,
+     0x2E, 0x2014, 0x2013, 0x5F, 0x5F, 0x28, 0x29, 0x7B,
+     0x7D, 0x3014, 0x3015, 0x3010, 0x3011, 0x300A, 0x300B, 0x3008,
+     0x3009, 0x300C, 0x300D, 0x300E, 0x300F, 0x5B, 0x5D, 0x20,
+     0x305, 0x20, 0x305, 0x20, 0x305, 0x20, 0x305, 0x5F,
+     0x5F, 0x5F, 0x2C, 0x3001, 0x2E, 0x3B, 0x3A, 0x3F,
+     0x21, 0x2014, 0x28, 0x29, 0x7B, 0x7D, 0x3014, 0x3015,
+     0x23, 0x26, 0x2A, 0x2B, 0x2D, 0x3C, 0x3E, 0x3D,
+     0x5C, 0x24, 0x25, 0x40, 0x20, 0x64B, 0x640, 0x64B,
+     0x20, 0x64C, 0x20, 0x64D, 0x20, 0x64E, 0x640, 0x64E,
+     0x20, 0x64F, 0x640, 0x64F, 0x20, 0x650, 0x640, 0x650,
+     0x20, 0x651, 0x640, 0x651, 0x20, 0x652, 0x640, 0x652,
+     0x621, 0x627, 0x653, 0x627, 0x653, 0x627, 0x654, 0x627,
+     0x654, 0x648, 0x654, 0x648, 0x654, 0x627, 0x655, 0x627,
+     0x655, 0x64A, 0x654, 0x64A, 0x654, 0x64A, 0x654, 0x64A,
+     0x654, 0x627, 0x627, 0x628, 0x628, 0x628, 0x628, 0x629,
+     0x629, 0x62A, 0x62A, 0x62A, 0x62A, 0x62B, 0x62B, 0x62B,
+     0x62B, 0x62C, 0x62C, 0x62C, 0x62C, 0x62D, 0x62D, 0x62D,
+     0x62D, 0x62E, 0x62E, 0x62E, 0x62E, 0x62F, 0x62F, 0x630,
+     0x630, 0x631, 0x631, 0x632, 0x632, 0x633, 0x633, 0x633,
+     0x633, 0x634, 0x634, 0x634, 0x634, 0x635, 0x635, 0x635,
+     0x635, 0x636, 0x636, 0x636, 0x636, 0x637, 0x637, 0x637,
+     0x637, 0x638, 0x638, 0x638, 0x638, 0x639, 0x639, 0x639,
+     0x639, 0x63A, 0x63A, 0x63A, 0x63A, 0x641, 0x641, 0x641,
+     0x641, 0x642, 0x642, 0x642, 0x642, 0x643, 0x643, 0x643,
+     0x643, 0x644, 0x644, 0x644, 0x644, 0x645, 0x645, 0x645,
+     0x645, 0x646, 0x646, 0x646, 0x646, 0x647, 0x647, 0x647,
+     0x647, 0x648, 0x648, 0x649, 0x649, 0x64A, 0x64A, 0x64A,
+     0x64A, 0x644, 0x627, 0x653, 0x644, 0x627, 0x653, 0x644,
+     0x627, 0x654, 0x644, 0x627, 0x654, 0x644, 0x627, 0x655,
+     0x644, 0x627, 0x655, 0x644, 0x627, 0x644, 0x627, 0x21,
+     0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+     0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31,
+     0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+     0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41,
+     0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+     0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51,
+     0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+     0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61,
+     0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+     0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
+     0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+     0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x2985, 0x2986, 0x3002,
+     0x300C, 0x300D, 0x3001, 0x30FB, 0x30F2, 0x30A1, 0x30A3, 0x30A5,
+     0x30A7, 0x30A9, 0x30E3, 0x30E5, 0x30E7, 0x30C3, 0x30FC, 0x30A2,
+     0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF, 0x30B1,
+     0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF, 0x30C1,
+     0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE,
+     0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF, 0x30E0,
+     0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA, 0x30EB,
+     0x30EC, 0x30ED, 0x30EF, 0x30F3, 0x3099, 0x309A, 0x1160, 0x1100,
+     0x1101, 0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103, 0x1104, 0x1105,
+     0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5, 0x111A, 0x1106,
+     0x1107, 0x1108, 0x1121, 0x1109, 0x110A, 0x110B, 0x110C, 0x110D,
+     0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1161, 0x1162, 0x1163,
+     0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169, 0x116A, 0x116B,
+     0x116C, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171, 0x1172, 0x1173,
+     0x1174, 0x1175, 0xA2, 0xA3, 0xAC, 0x20, 0x304, 0xA6,
+     0xA5, 0x20A9, 0x2502, 0x2190, 0x2191, 0x2192, 0x2193, 0x25A0,
+     0x25CB, 0x2D0, 0x2D1, 0xE6, 0x299, 0x253, 0x2A3, 0xAB66,
+     0x2A5, 0x2A4, 0x256, 0x257, 0x1D91, 0x258, 0x25E, 0x2A9,
+     0x264, 0x262, 0x260, 0x29B, 0x127, 0x29C, 0x267, 0x284,
+     0x2AA, 0x2AB, 0x26C, 0x1DF04, 0xA78E, 0x26E, 0x1DF05, 0x28E,
+     0x1DF06, 0xF8, 0x276, 0x277, 0x71, 0x27A, 0x1DF08, 0x27D,
+     0x27E, 0x280, 0x2A8, 0x2A6, 0xAB67, 0x2A7, 0x288, 0x2C71,
+     0x28F, 0x2A1, 0x2A2, 0x298, 0x1C0, 0x1C1, 0x1C2, 0x1DF0A,
+     0x1DF1E, 0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5, 0x110BA, 0x11131,
+     0x11127, 0x11132, 0x11127, 0x11347, 0x1133E, 0x11347, 0x11357, 0x114B9,
+     0x114BA, 0x114B9, 0x114B0, 0x114B9, 0x114BD, 0x115B8, 0x115AF, 0x115B9,
+     0x115AF, 0x11935, 0x11930, 0x1D157, 0x1D165, 0x1D158, 0x1D165, 0x1D158,
+     0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158, 0x1D165, 0x1D170,
+     0x1D158, 0x1D165, 0x1D171, 0x1D158, 0x1D165, 0x1D172, 0x1D1B9, 0x1D165,
+     0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA, 0x1D165, 0x1D16E,
+     0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F, 0x41, 0x42,
+     0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A,
+     0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52,
+     0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+     0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+     0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+     0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+     0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+     0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E,
+     0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+     0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64,
+     0x65, 0x66, 0x67, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+     0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+     0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x43,
+     0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+     0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53,
+     0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61,
+     0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+     0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
+     0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+     0x7A, 0x41, 0x43, 0x44, 0x47, 0x4A, 0x4B, 0x4E,
+     0x4F, 0x50, 0x51, 0x53, 0x54, 0x55, 0x56, 0x57,
+     0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x66,
+     0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70,
+     0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+     0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+     0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E,
+     0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+     0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64,
+     0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+     0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
+     0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42,
+     0x44, 0x45, 0x46, 0x47, 0x4A, 0x4B, 0x4C, 0x4D,
+     0x4E, 0x4F, 0x50, 0x51, 0x53, 0x54, 0x55, 0x56,
+     0x57, 0x58, 0x59, 0x61, 0x62, 0x63, 0x64, 0x65,
+     0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+     0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+     0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x44,
+     0x45, 0x46, 0x47, 0x49, 0x4A, 0x4B, 0x4C, 0x4D,
+     0x4F, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+     0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+     0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+     0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+     0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+     0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E,
+     0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+     0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64,
+     0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+     0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
+     0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42,
+     0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A,
+     0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52,
+     0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+     0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+     0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+     0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+     0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+     0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E,
+     0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+     0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64,
+     0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+     0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
+     0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42,
+     0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A,
+     0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52,
+     0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+     0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+     0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+     0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+     0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+     0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E,
+     0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+     0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64,
+     0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+     0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
+     0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42,
+     0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A,
+     0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52,
+     0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+     0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+     0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+     0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+     0x79, 0x7A, 0x131, 0x237, 0x391, 0x392, 0x393, 0x394,
+     0x395, 0x396, 0x397, 0x398, 0x399, 0x39A, 0x39B, 0x39C,
+     0x39D, 0x39E, 0x39F, 0x3A0, 0x3A1, 0x398, 0x3A3, 0x3A4,
+     0x3A5, 0x3A6, 0x3A7, 0x3A8, 0x3A9, 0x2207, 0x3B1, 0x3B2,
+     0x3B3, 0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA,
+     0x3BB, 0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C2,
+     0x3C3, 0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x2202,
+     0x3B5, 0x3B8, 0x3BA, 0x3C6, 0x3C1, 0x3C0, 0x391, 0x392,
+     0x393, 0x394, 0x395, 0x396, 0x397, 0x398, 0x399, 0x39A,
+     0x39B, 0x39C, 0x39D, 0x39E, 0x39F, 0x3A0, 0x3A1, 0x398,
+     0x3A3, 0x3A4, 0x3A5, 0x3A6, 0x3A7, 0x3A8, 0x3A9, 0x2207,
+     0x3B1, 0x3B2, 0x3B3, 0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8,
+     0x3B9, 0x3BA, 0x3BB, 0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0,
+     0x3C1, 0x3C2, 0x3C3, 0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8,
+     0x3C9, 0x2202, 0x3B5, 0x3B8, 0x3BA, 0x3C6, 0x3C1, 0x3C0,
+     0x391, 0x392, 0x393, 0x394, 0x395, 0x396, 0x397, 0x398,
+     0x399, 0x39A, 0x39B, 0x39C, 0x39D, 0x39E, 0x39F, 0x3A0,
+     0x3A1, 0x398, 0x3A3, 0x3A4, 0x3A5, 0x3A6, 0x3A7, 0x3A8,
+     0x3A9, 0x2207, 0x3B1, 0x3B2, 0x3B3, 0x3B4, 0x3B5, 0x3B6,
+     0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB, 0x3BC, 0x3BD, 0x3BE,
+     0x3BF, 0x3C0, 0x3C1, 0x3C2, 0x3C3, 0x3C4, 0x3C5, 0x3C6,
+     0x3C7, 0x3C8, 0x3C9, 0x2202, 0x3B5, 0x3B8, 0x3BA, 0x3C6,
+     0x3C1, 0x3C0, 0x391, 0x392, 0x393, 0x394, 0x395, 0x396,
+     0x397, 0x398, 0x399, 0x39A, 0x39B, 0x39C, 0x39D, 0x39E,
+     0x39F, 0x3A0, 0x3A1, 0x398, 0x3A3, 0x3A4, 0x3A5, 0x3A6,
+     0x3A7, 0x3A8, 0x3A9, 0x2207, 0x3B1, 0x3B2, 0x3B3, 0x3B4,
+     0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB, 0x3BC,
+     0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C2, 0x3C3, 0x3C4,
+     0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x2202, 0x3B5, 0x3B8,
+     0x3BA, 0x3C6, 0x3C1, 0x3C0, 0x391, 0x392, 0x393, 0x394,
+     0x395, 0x396, 0x397, 0x398, 0x399, 0x39A, 0x39B, 0x39C,
+     0x39D, 0x39E, 0x39F, 0x3A0, 0x3A1, 0x398, 0x3A3, 0x3A4,
+     0x3A5, 0x3A6, 0x3A7, 0x3A8, 0x3A9, 0x2207, 0x3B1, 0x3B2,
+     0x3B3, 0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA,
+     0x3BB, 0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C2,
+     0x3C3, 0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x2202,
+     0x3B5, 0x3B8, 0x3BA, 0x3C6, 0x3C1, 0x3C0, 0x3DC, 0x3DD,
+     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+     0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+     0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33,
+     0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x31,
+     0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+     0x38, 0x39, 0x627, 0x628, 0x62C, 0x62F, 0x648, 0x632,
+     0x62D, 0x637, 0x64A, 0x643, 0x644, 0x645, 0x646, 0x633,
+     0x639, 0x641, 0x635, 0x642, 0x631, 0x634, 0x62A, 0x62B,
+     0x62E, 0x630, 0x636, 0x638, 0x63A, 0x66E, 0x6BA, 0x6A1,
+     0x66F, 0x628, 0x62C, 0x647, 0x62D, 0x64A, 0x643, 0x644,
+     0x645, 0x646, 0x633, 0x639, 0x641, 0x635, 0x642, 0x634,
+     0x62A, 0x62B, 0x62E, 0x636, 0x63A, 0x62C, 0x62D, 0x64A,
+     0x644, 0x646, 0x633, 0x639, 0x635, 0x642, 0x634, 0x62E,
+     0x636, 0x63A, 0x6BA, 0x66F, 0x628, 0x62C, 0x647, 0x62D,
+     0x637, 0x64A, 0x643, 0x645, 0x646, 0x633, 0x639, 0x641,
+     0x635, 0x642, 0x634, 0x62A, 0x62B, 0x62E, 0x636, 0x638,
+     0x63A, 0x66E, 0x6A1, 0x627, 0x628, 0x62C, 0x62F, 0x647,
+     0x648, 0x632, 0x62D, 0x637, 0x64A, 0x644, 0x645, 0x646,
+     0x633, 0x639, 0x641, 0x635, 0x642, 0x631, 0x634, 0x62A,
+     0x62B, 0x62E, 0x630, 0x636, 0x638, 0x63A, 0x628, 0x62C,
+     0x62F, 0x648, 0x632, 0x62D, 0x637, 0x64A, 0x644, 0x645,
+     0x646, 0x633, 0x639, 0x641, 0x635, 0x642, 0x631, 0x634,
+     0x62A, 0x62B, 0x62E, 0x630, 0x636, 0x638, 0x63A, 0x30,
+     0x2E, 0x30, 0x2C, 0x31, 0x2C, 0x32, 0x2C, 0x33,
+     0x2C, 0x34, 0x2C, 0x35, 0x2C, 0x36, 0x2C, 0x37,
+     0x2C, 0x38, 0x2C, 0x39, 0x2C, 0x28, 0x41, 0x29,
+     0x28, 0x42, 0x29, 0x28, 0x43, 0x29, 0x28, 0x44,
+     0x29, 0x28, 0x45, 0x29, 0x28, 0x46, 0x29, 0x28,
+     0x47, 0x29, 0x28, 0x48, 0x29, 0x28, 0x49, 0x29,
+     0x28, 0x4A, 0x29, 0x28, 0x4B, 0x29, 0x28, 0x4C,
+     0x29, 0x28, 0x4D, 0x29, 0x28, 0x4E, 0x29, 0x28,
+     0x4F, 0x29, 0x28, 0x50, 0x29, 0x28, 0x51, 0x29,
+     0x28, 0x52, 0x29, 0x28, 0x53, 0x29, 0x28, 0x54,
+     0x29, 0x28, 0x55, 0x29, 0x28, 0x56, 0x29, 0x28,
+     0x57, 0x29, 0x28, 0x58, 0x29, 0x28, 0x59, 0x29,
+     0x28, 0x5A, 0x29, 0x3014, 0x53, 0x3015, 0x43, 0x52,
+     0x43, 0x44, 0x57, 0x5A, 0x41, 0x42, 0x43, 0x44,
+     0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C,
+     0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54,
+     0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x48, 0x56,
+     0x4D, 0x56, 0x53, 0x44, 0x53, 0x53, 0x50, 0x50,
+     0x56, 0x57, 0x43, 0x4D, 0x43, 0x4D, 0x44, 0x4D,
+     0x52, 0x44, 0x4A, 0x307B, 0x304B, 0x30B3, 0x30B3, 0x30B5,
+     0x624B, 0x5B57, 0x53CC, 0x30C6, 0x3099, 0x4E8C, 0x591A, 0x89E3,
+     0x5929, 0x4EA4, 0x6620, 0x7121, 0x6599, 0x524D, 0x5F8C, 0x518D,
+     0x65B0, 0x521D, 0x7D42, 0x751F, 0x8CA9, 0x58F0, 0x5439, 0x6F14,
+     0x6295, 0x6355, 0x4E00, 0x4E09, 0x904A, 0x5DE6, 0x4E2D, 0x53F3,
+     0x6307, 0x8D70, 0x6253, 0x7981, 0x7A7A, 0x5408, 0x6E80, 0x6709,
+     0x6708, 0x7533, 0x5272, 0x55B6, 0x914D, 0x3014, 0x672C, 0x3015,
+     0x3014, 0x4E09, 0x3015, 0x3014, 0x4E8C, 0x3015, 0x3014, 0x5B89,
+     0x3015, 0x3014, 0x70B9, 0x3015, 0x3014, 0x6253, 0x3015, 0x3014,
+     0x76D7, 0x3015, 0x3014, 0x52DD, 0x3015, 0x3014, 0x6557, 0x3015,
+     0x5F97, 0x53EF, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+     0x36, 0x37, 0x38, 0x39, 0x4E3D, 0x4E38, 0x4E41, 0x20122,
+     0x4F60, 0x4FAE, 0x4FBB, 0x5002, 0x507A, 0x5099, 0x50E7, 0x50CF,
+     0x349E, 0x2063A, 0x514D, 0x5154, 0x5164, 0x5177, 0x2051C, 0x34B9,
+     0x5167, 0x518D, 0x2054B, 0x5197, 0x51A4, 0x4ECC, 0x51AC, 0x51B5,
+     0x291DF, 0x51F5, 0x5203, 0x34DF, 0x523B, 0x5246, 0x5272, 0x5277,
+     0x3515, 0x52C7, 0x52C9, 0x52E4, 0x52FA, 0x5305, 0x5306, 0x5317,
+     0x5349, 0x5351, 0x535A, 0x5373, 0x537D, 0x537F, 0x537F, 0x537F,
+     0x20A2C, 0x7070, 0x53CA, 0x53DF, 0x20B63, 0x53EB, 0x53F1, 0x5406,
+     0x549E, 0x5438, 0x5448, 0x5468, 0x54A2, 0x54F6, 0x5510, 0x5553,
+     0x5563, 0x5584, 0x5584, 0x5599, 0x55AB, 0x55B3, 0x55C2, 0x5716,
+     0x5606, 0x5717, 0x5651, 0x5674, 0x5207, 0x58EE, 0x57CE, 0x57F4,
+     0x580D, 0x578B, 0x5832, 0x5831, 0x58AC, 0x214E4, 0x58F2, 0x58F7,
+     0x5906, 0x591A, 0x5922, 0x5962, 0x216A8, 0x216EA, 0x59EC, 0x5A1B,
+     0x5A27, 0x59D8, 0x5A66, 0x36EE, 0x36FC, 0x5B08, 0x5B3E, 0x5B3E,
+     0x219C8, 0x5BC3, 0x5BD8, 0x5BE7, 0x5BF3, 0x21B18, 0x5BFF, 0x5C06,
+     0x5F53, 0x5C22, 0x3781, 0x5C60, 0x5C6E, 0x5CC0, 0x5C8D, 0x21DE4,
+     0x5D43, 0x21DE6, 0x5D6E, 0x5D6B, 0x5D7C, 0x5DE1, 0x5DE2, 0x382F,
+     0x5DFD, 0x5E28, 0x5E3D, 0x5E69, 0x3862, 0x22183, 0x387C, 0x5EB0,
+     0x5EB3, 0x5EB6, 0x5ECA, 0x2A392, 0x5EFE, 0x22331, 0x22331, 0x8201,
+     0x5F22, 0x5F22, 0x38C7, 0x232B8, 0x261DA, 0x5F62, 0x5F6B, 0x38E3,
+     0x5F9A, 0x5FCD, 0x5FD7, 0x5FF9, 0x6081, 0x393A, 0x391C, 0x6094,
+     0x226D4, 0x60C7, 0x6148, 0x614C, 0x614E, 0x614C, 0x617A, 0x618E,
+     0x61B2, 0x61A4, 0x61AF, 0x61DE, 0x61F2, 0x61F6, 0x6210, 0x621B,
+     0x625D, 0x62B1, 0x62D4, 0x6350, 0x22B0C, 0x633D, 0x62FC, 0x6368,
+     0x6383, 0x63E4, 0x22BF1, 0x6422, 0x63C5, 0x63A9, 0x3A2E, 0x6469,
+     0x647E, 0x649D, 0x6477, 0x3A6C, 0x654F, 0x656C, 0x2300A, 0x65E3,
+     0x66F8, 0x6649, 0x3B19, 0x6691, 0x3B08, 0x3AE4, 0x5192, 0x5195,
+     0x6700, 0x669C, 0x80AD, 0x43D9, 0x6717, 0x671B, 0x6721, 0x675E,
+     0x6753, 0x233C3, 0x3B49, 0x67FA, 0x6785, 0x6852, 0x6885, 0x2346D,
+     0x688E, 0x681F, 0x6914, 0x3B9D, 0x6942, 0x69A3, 0x69EA, 0x6AA8,
+     0x236A3, 0x6ADB, 0x3C18, 0x6B21, 0x238A7, 0x6B54, 0x3C4E, 0x6B72,
+     0x6B9F, 0x6BBA, 0x6BBB, 0x23A8D, 0x21D0B, 0x23AFA, 0x6C4E, 0x23CBC,
+     0x6CBF, 0x6CCD, 0x6C67, 0x6D16, 0x6D3E, 0x6D77, 0x6D41, 0x6D69,
+     0x6D78, 0x6D85, 0x23D1E, 0x6D34, 0x6E2F, 0x6E6E, 0x3D33, 0x6ECB,
+     0x6EC7, 0x23ED1, 0x6DF9, 0x6F6E, 0x23F5E, 0x23F8E, 0x6FC6, 0x7039,
+     0x701E, 0x701B, 0x3D96, 0x704A, 0x707D, 0x7077, 0x70AD, 0x20525,
+     0x7145, 0x24263, 0x719C, 0x243AB, 0x7228, 0x7235, 0x7250, 0x24608,
+     0x7280, 0x7295, 0x24735, 0x24814, 0x737A, 0x738B, 0x3EAC, 0x73A5,
+     0x3EB8, 0x3EB8, 0x7447, 0x745C, 0x7471, 0x7485, 0x74CA, 0x3F1B,
+     0x7524, 0x24C36, 0x753E, 0x24C92, 0x7570, 0x2219F, 0x7610, 0x24FA1,
+     0x24FB8, 0x25044, 0x3FFC, 0x4008, 0x76F4, 0x250F3, 0x250F2, 0x25119,
+     0x25133, 0x771E, 0x771F, 0x771F, 0x774A, 0x4039, 0x778B, 0x4046,
+     0x4096, 0x2541D, 0x784E, 0x788C, 0x78CC, 0x40E3, 0x25626, 0x7956,
+     0x2569A, 0x256C5, 0x798F, 0x79EB, 0x412F, 0x7A40, 0x7A4A, 0x7A4F,
+     0x2597C, 0x25AA7, 0x25AA7, 0x7AEE, 0x4202, 0x25BAB, 0x7BC6, 0x7BC9,
+     0x4227, 0x25C80, 0x7CD2, 0x42A0, 0x7CE8, 0x7CE3, 0x7D00, 0x25F86,
+     0x7D63, 0x4301, 0x7DC7, 0x7E02, 0x7E45, 0x4334, 0x26228, 0x26247,
+     0x4359, 0x262D9, 0x7F7A, 0x2633E, 0x7F95, 0x7FFA, 0x8005, 0x264DA,
+     0x26523, 0x8060, 0x265A8, 0x8070, 0x2335F, 0x43D5, 0x80B2, 0x8103,
+     0x440B, 0x813E, 0x5AB5, 0x267A7, 0x267B5, 0x23393, 0x2339C, 0x8201,
+     0x8204, 0x8F9E, 0x446B, 0x8291, 0x828B, 0x829D, 0x52B3, 0x82B1,
+     0x82B3, 0x82BD, 0x82E6, 0x26B3C, 0x82E5, 0x831D, 0x8363, 0x83AD,
+     0x8323, 0x83BD, 0x83E7, 0x8457, 0x8353, 0x83CA, 0x83CC, 0x83DC,
+     0x26C36, 0x26D6B, 0x26CD5, 0x452B, 0x84F1, 0x84F3, 0x8516, 0x273CA,
+     0x8564, 0x26F2C, 0x455D, 0x4561, 0x26FB1, 0x270D2, 0x456B, 0x8650,
+     0x865C, 0x8667, 0x8669, 0x86A9, 0x8688, 0x870E, 0x86E2, 0x8779,
+     0x8728, 0x876B, 0x8786, 0x45D7, 0x87E1, 0x8801, 0x45F9, 0x8860,
+     0x8863, 0x27667, 0x88D7, 0x88DE, 0x4635, 0x88FA, 0x34BB, 0x278AE,
+     0x27966, 0x46BE, 0x46C7, 0x8AA0, 0x8AED, 0x8B8A, 0x8C55, 0x27CA8,
+     0x8CAB, 0x8CC1, 0x8D1B, 0x8D77, 0x27F2F, 0x20804, 0x8DCB, 0x8DBC,
+     0x8DF0, 0x208DE, 0x8ED4, 0x8F38, 0x285D2, 0x285ED, 0x9094, 0x90F1,
+     0x9111, 0x2872E, 0x911B, 0x9238, 0x92D7, 0x92D8, 0x927C, 0x93F9,
+     0x9415, 0x28BFA, 0x958B, 0x4995, 0x95B7, 0x28D77, 0x49E6, 0x96C3,
+     0x5DB2, 0x9723, 0x29145, 0x2921A, 0x4A6E, 0x4A76, 0x97E0, 0x2940A,
+     0x4AB2, 0x29496, 0x980B, 0x980B, 0x9829, 0x295B6, 0x98E2, 0x4B33,
+     0x9929, 0x99A7, 0x99C2, 0x99FE, 0x4BCE, 0x29B30, 0x9B12, 0x9C40,
+     0x9CFD, 0x4CCE, 0x4CED, 0x9D67, 0x2A0CE, 0x4CF8, 0x2A105, 0x2A20E,
+     0x2A291, 0x9EBB, 0x4D56, 0x9EF9, 0x9EFE, 0x9F05, 0x9F0F, 0x9F16,
+     0x9F3B, 0x2A600,
+ };
+ 
+ /* (first << 21) | second of each primary composite's canonical pair */
+ static const uint64_t compositionKeys[941] = {
+     0x7800338ull, 0x7A00338ull, 0x7C00338ull, 0x8200300ull,
+     0x8200301ull, 0x8200302ull, 0x8200303ull, 0x8200304ull,
+     0x8200306ull, 0x8200307ull, 0x8200308ull, 0x8200309ull,
+     0x820030Aull, 0x820030Cull, 0x820030Full, 0x8200311ull,
+     0x8200323ull, 0x8200325ull, 0x8200328ull, 0x8400307ull,
+     0x8400323ull, 0x8400331ull, 0x8600301ull, 0x8600302ull,
+     0x8600307ull, 0x860030Cull, 0x8600327ull, 0x8800307ull,
+     0x880030Cull, 0x8800323ull, 0x8800327ull, 0x880032Dull,
+     0x8800331ull, 0x8A00300ull, 0x8A00301ull, 0x8A00302ull,
+     0x8A00303ull, 0x8A00304ull, 0x8A00306ull, 0x8A00307ull,
+     0x8A00308ull, 0x8A00309ull, 0x8A0030Cull, 0x8A0030Full,
+     0x8A00311ull, 0x8A00323ull, 0x8A00327ull, 0x8A00328ull,
+     0x8A0032Dull, 0x8A00330ull, 0x8C00307ull, 0x8E00301ull,
+     0x8E00302ull, 0x8E00304ull, 0x8E00306ull, 0x8E00307ull,
+     0x8E0030Cull, 0x8E00327ull, 0x9000302ull, 0x9000307ull,
+     0x9000308ull, 0x900030Cull, 0x9000323ull, 0x9000327ull,
+     0x900032Eull, 0x9200300ull, 0x9200301ull, 0x9200302ull,
+     0x9200303ull, 0x9200304ull, 0x9200306ull, 0x9200307ull,
+     0x9200308ull, 0x9200309ull, 0x920030Cull, 0x920030Full,
+     0x9200311ull, 0x9200323ull, 0x9200328ull, 0x9200330ull,
+     0x9400302ull, 0x9600301ull, 0x960030Cull, 0x9600323ull,
+     0x9600327ull, 0x9600331ull, 0x9800301ull, 0x980030Cull,
+     0x9800323ull, 0x9800327ull, 0x980032Dull, 0x9800331ull,
+     0x9A00301ull, 0x9A00307ull, 0x9A00323ull, 0x9C00300ull,
+     0x9C00301ull, 0x9C00303ull, 0x9C00307ull, 0x9C0030Cull,
+     0x9C00323ull, 0x9C00327ull, 0x9C0032Dull, 0x9C00331ull,
+     0x9E00300ull, 0x9E00301ull, 0x9E00302ull, 0x9E00303ull,
+     0x9E00304ull, 0x9E00306ull, 0x9E00307ull, 0x9E00308ull,
+     0x9E00309ull, 0x9E0030Bull, 0x9E0030Cull, 0x9E0030Full,
+     0x9E00311ull, 0x9E0031Bull, 0x9E00323ull, 0x9E00328ull,
+     0xA000301ull, 0xA000307ull, 0xA400301ull, 0xA400307ull,
+     0xA40030Cull, 0xA40030Full, 0xA400311ull, 0xA400323ull,
+     0xA400327ull, 0xA400331ull, 0xA600301ull, 0xA600302ull,
+     0xA600307ull, 0xA60030Cull, 0xA600323ull, 0xA600326ull,
+     0xA600327ull, 0xA800307ull, 0xA80030Cull, 0xA800323ull,
+     0xA800326ull, 0xA800327ull, 0xA80032Dull, 0xA800331ull,
+     0xAA00300ull, 0xAA00301ull, 0xAA00302ull, 0xAA00303ull,
+     0xAA00304ull, 0xAA00306ull, 0xAA00308ull, 0xAA00309ull,
+     0xAA0030Aull, 0xAA0030Bull, 0xAA0030Cull, 0xAA0030Full,
+     0xAA00311ull, 0xAA0031Bull, 0xAA00323ull, 0xAA00324ull,
+     0xAA00328ull, 0xAA0032Dull, 0xAA00330ull, 0xAC00303ull,
+     0xAC00323ull, 0xAE00300ull, 0xAE00301ull, 0xAE00302ull,
+     0xAE00307ull, 0xAE00308ull, 0xAE00323ull, 0xB000307ull,
+     0xB000308ull, 0xB200300ull, 0xB200301ull, 0xB200302ull,
+     0xB200303ull, 0xB200304ull, 0xB200307ull, 0xB200308ull,
+     0xB200309ull, 0xB200323ull, 0xB400301ull, 0xB400302ull,
+     0xB400307ull, 0xB40030Cull, 0xB400323ull, 0xB400331ull,
+     0xC200300ull, 0xC200301ull, 0xC200302ull, 0xC200303ull,
+     0xC200304ull, 0xC200306ull, 0xC200307ull, 0xC200308ull,
+     0xC200309ull, 0xC20030Aull, 0xC20030Cull, 0xC20030Full,
+     0xC200311ull, 0xC200323ull, 0xC200325ull, 0xC200328ull,
+     0xC400307ull, 0xC400323ull, 0xC400331ull, 0xC600301ull,
+     0xC600302ull, 0xC600307ull, 0xC60030Cull, 0xC600327ull,
+     0xC800307ull, 0xC80030Cull, 0xC800323ull, 0xC800327ull,
+     0xC80032Dull, 0xC800331ull, 0xCA00300ull, 0xCA00301ull,
+     0xCA00302ull, 0xCA00303ull, 0xCA00304ull, 0xCA00306ull,
+     0xCA00307ull, 0xCA00308ull, 0xCA00309ull, 0xCA0030Cull,
+     0xCA0030Full, 0xCA00311ull, 0xCA00323ull, 0xCA00327ull,
+     0xCA00328ull, 0xCA0032Dull, 0xCA00330ull, 0xCC00307ull,
+     0xCE00301ull, 0xCE00302ull, 0xCE00304ull, 0xCE00306ull,
+     0xCE00307ull, 0xCE0030Cull, 0xCE00327ull, 0xD000302ull,
+     0xD000307ull, 0xD000308ull, 0xD00030Cull, 0xD000323ull,
+     0xD000327ull, 0xD00032Eull, 0xD000331ull, 0xD200300ull,
+     0xD200301ull, 0xD200302ull, 0xD200303ull, 0xD200304ull,
+     0xD200306ull, 0xD200308ull, 0xD200309ull, 0xD20030Cull,
+     0xD20030Full, 0xD200311ull, 0xD200323ull, 0xD200328ull,
+     0xD200330ull, 0xD400302ull, 0xD40030Cull, 0xD600301ull,
+     0xD60030Cull, 0xD600323ull, 0xD600327ull, 0xD600331ull,
+     0xD800301ull, 0xD80030Cull, 0xD800323ull, 0xD800327ull,
+     0xD80032Dull, 0xD800331ull, 0xDA00301ull, 0xDA00307ull,
+     0xDA00323ull, 0xDC00300ull, 0xDC00301ull, 0xDC00303ull,
+     0xDC00307ull, 0xDC0030Cull, 0xDC00323ull, 0xDC00327ull,
+     0xDC0032Dull, 0xDC00331ull, 0xDE00300ull, 0xDE00301ull,
+     0xDE00302ull, 0xDE00303ull, 0xDE00304ull, 0xDE00306ull,
+     0xDE00307ull, 0xDE00308ull, 0xDE00309ull, 0xDE0030Bull,
+     0xDE0030Cull, 0xDE0030Full, 0xDE00311ull, 0xDE0031Bull,
+     0xDE00323ull, 0xDE00328ull, 0xE000301ull, 0xE000307ull,
+     0xE400301ull, 0xE400307ull, 0xE40030Cull, 0xE40030Full,
+     0xE400311ull, 0xE400323ull, 0xE400327ull, 0xE400331ull,
+     0xE600301ull, 0xE600302ull, 0xE600307ull, 0xE60030Cull,
+     0xE600323ull, 0xE600326ull, 0xE600327ull, 0xE800307ull,
+     0xE800308ull, 0xE80030Cull, 0xE800323ull, 0xE800326ull,
+     0xE800327ull, 0xE80032Dull, 0xE800331ull, 0xEA00300ull,
+     0xEA00301ull, 0xEA00302ull, 0xEA00303ull, 0xEA00304ull,
+     0xEA00306ull, 0xEA00308ull, 0xEA00309ull, 0xEA0030Aull,
+     0xEA0030Bull, 0xEA0030Cull, 0xEA0030Full, 0xEA00311ull,
+     0xEA0031Bull, 0xEA00323ull, 0xEA00324ull, 0xEA00328ull,
+     0xEA0032Dull, 0xEA00330ull, 0xEC00303ull, 0xEC00323ull,
+     0xEE00300ull, 0xEE00301ull, 0xEE00302ull, 0xEE00307ull,
+     0xEE00308ull, 0xEE0030Aull, 0xEE00323ull, 0xF000307ull,
+     0xF000308ull, 0xF200300ull, 0xF200301ull, 0xF200302ull,
+     0xF200303ull, 0xF200304ull, 0xF200307ull, 0xF200308ull,
+     0xF200309ull, 0xF20030Aull, 0xF200323ull, 0xF400301ull,
+     0xF400302ull, 0xF400307ull, 0xF40030Cull, 0xF400323ull,
+     0xF400331ull, 0x15000300ull, 0x15000301ull, 0x15000342ull,
+     0x18400300ull, 0x18400301ull, 0x18400303ull, 0x18400309ull,
+     0x18800304ull, 0x18A00301ull, 0x18C00301ull, 0x18C00304ull,
+     0x18E00301ull, 0x19400300ull, 0x19400301ull, 0x19400303ull,
+     0x19400309ull, 0x19E00301ull, 0x1A800300ull, 0x1A800301ull,
+     0x1A800303ull, 0x1A800309ull, 0x1AA00301ull, 0x1AA00304ull,
+     0x1AA00308ull, 0x1AC00304ull, 0x1B000301ull, 0x1B800300ull,
+     0x1B800301ull, 0x1B800304ull, 0x1B80030Cull, 0x1C400300ull,
+     0x1C400301ull, 0x1C400303ull, 0x1C400309ull, 0x1C800304ull,
+     0x1CA00301ull, 0x1CC00301ull, 0x1CC00304ull, 0x1CE00301ull,
+     0x1D400300ull, 0x1D400301ull, 0x1D400303ull, 0x1D400309ull,
+     0x1DE00301ull, 0x1E800300ull, 0x1E800301ull, 0x1E800303ull,
+     0x1E800309ull, 0x1EA00301ull, 0x1EA00304ull, 0x1EA00308ull,
+     0x1EC00304ull, 0x1F000301ull, 0x1F800300ull, 0x1F800301ull,
+     0x1F800304ull, 0x1F80030Cull, 0x20400300ull, 0x20400301ull,
+     0x20400303ull, 0x20400309ull, 0x20600300ull, 0x20600301ull,
+     0x20600303ull, 0x20600309ull, 0x22400300ull, 0x22400301ull,
+     0x22600300ull, 0x22600301ull, 0x29800300ull, 0x29800301ull,
+     0x29A00300ull, 0x29A00301ull, 0x2B400307ull, 0x2B600307ull,
+     0x2C000307ull, 0x2C200307ull, 0x2D000301ull, 0x2D200301ull,
+     0x2D400308ull, 0x2D600308ull, 0x2FE00307ull, 0x34000300ull,
+     0x34000301ull, 0x34000303ull, 0x34000309ull, 0x34000323ull,
+     0x34200300ull, 0x34200301ull, 0x34200303ull, 0x34200309ull,
+     0x34200323ull, 0x35E00300ull, 0x35E00301ull, 0x35E00303ull,
+     0x35E00309ull, 0x35E00323ull, 0x36000300ull, 0x36000301ull,
+     0x36000303ull, 0x36000309ull, 0x36000323ull, 0x36E0030Cull,
+     0x3D400304ull, 0x3D600304ull, 0x44C00304ull, 0x44E00304ull,
+     0x45000306ull, 0x45200306ull, 0x45C00304ull, 0x45E00304ull,
+     0x5240030Cull, 0x72200300ull, 0x72200301ull, 0x72200304ull,
+     0x72200306ull, 0x72200313ull, 0x72200314ull, 0x72200345ull,
+     0x72A00300ull, 0x72A00301ull, 0x72A00313ull, 0x72A00314ull,
+     0x72E00300ull, 0x72E00301ull, 0x72E00313ull, 0x72E00314ull,
+     0x72E00345ull, 0x73200300ull, 0x73200301ull, 0x73200304ull,
+     0x73200306ull, 0x73200308ull, 0x73200313ull, 0x73200314ull,
+     0x73E00300ull, 0x73E00301ull, 0x73E00313ull, 0x73E00314ull,
+     0x74200314ull, 0x74A00300ull, 0x74A00301ull, 0x74A00304ull,
+     0x74A00306ull, 0x74A00308ull, 0x74A00314ull, 0x75200300ull,
+     0x75200301ull, 0x75200313ull, 0x75200314ull, 0x75200345ull,
+     0x75800345ull, 0x75C00345ull, 0x76200300ull, 0x76200301ull,
+     0x76200304ull, 0x76200306ull, 0x76200313ull, 0x76200314ull,
+     0x76200342ull, 0x76200345ull, 0x76A00300ull, 0x76A00301ull,
+     0x76A00313ull, 0x76A00314ull, 0x76E00300ull, 0x76E00301ull,
+     0x76E00313ull, 0x76E00314ull, 0x76E00342ull, 0x76E00345ull,
+     0x77200300ull, 0x77200301ull, 0x77200304ull, 0x77200306ull,
+     0x77200308ull, 0x77200313ull, 0x77200314ull, 0x77200342ull,
+     0x77E00300ull, 0x77E00301ull, 0x77E00313ull, 0x77E00314ull,
+     0x78200313ull, 0x78200314ull, 0x78A00300ull, 0x78A00301ull,
+     0x78A00304ull, 0x78A00306ull, 0x78A00308ull, 0x78A00313ull,
+     0x78A00314ull, 0x78A00342ull, 0x79200300ull, 0x79200301ull,
+     0x79200313ull, 0x79200314ull, 0x79200342ull, 0x79200345ull,
+     0x79400300ull, 0x79400301ull, 0x79400342ull, 0x79600300ull,
+     0x79600301ull, 0x79600342ull, 0x79C00345ull, 0x7A400301ull,
+     0x7A400308ull, 0x80C00308ull, 0x82000306ull, 0x82000308ull,
+     0x82600301ull, 0x82A00300ull, 0x82A00306ull, 0x82A00308ull,
+     0x82C00306ull, 0x82C00308ull, 0x82E00308ull, 0x83000300ull,
+     0x83000304ull, 0x83000306ull, 0x83000308ull, 0x83400301ull,
+     0x83C00308ull, 0x84600304ull, 0x84600306ull, 0x84600308ull,
+     0x8460030Bull, 0x84E00308ull, 0x85600308ull, 0x85A00308ull,
+     0x86000306ull, 0x86000308ull, 0x86600301ull, 0x86A00300ull,
+     0x86A00306ull, 0x86A00308ull, 0x86C00306ull, 0x86C00308ull,
+     0x86E00308ull, 0x87000300ull, 0x87000304ull, 0x87000306ull,
+     0x87000308ull, 0x87400301ull, 0x87C00308ull, 0x88600304ull,
+     0x88600306ull, 0x88600308ull, 0x8860030Bull, 0x88E00308ull,
+     0x89600308ull, 0x89A00308ull, 0x8AC00308ull, 0x8E80030Full,
+     0x8EA0030Full, 0x9B000308ull, 0x9B200308ull, 0x9D000308ull,
+     0x9D200308ull, 0xC4E00653ull, 0xC4E00654ull, 0xC4E00655ull,
+     0xC9000654ull, 0xC9400654ull, 0xD8200654ull, 0xDA400654ull,
+     0xDAA00654ull, 0x12500093Cull, 0x12600093Cull, 0x12660093Cull,
+     0x138E009BEull, 0x138E009D7ull, 0x168E00B3Eull, 0x168E00B56ull,
+     0x168E00B57ull, 0x172400BD7ull, 0x178C00BBEull, 0x178C00BD7ull,
+     0x178E00BBEull, 0x188C00C56ull, 0x197E00CD5ull, 0x198C00CC2ull,
+     0x198C00CD5ull, 0x198C00CD6ull, 0x199400CD5ull, 0x1A8C00D3Eull,
+     0x1A8C00D57ull, 0x1A8E00D3Eull, 0x1BB200DCAull, 0x1BB200DCFull,
+     0x1BB200DDFull, 0x1BB800DCAull, 0x204A0102Eull, 0x360A01B35ull,
+     0x360E01B35ull, 0x361201B35ull, 0x361601B35ull, 0x361A01B35ull,
+     0x362201B35ull, 0x367401B35ull, 0x367801B35ull, 0x367C01B35ull,
+     0x367E01B35ull, 0x368401B35ull, 0x3C6C00304ull, 0x3C6E00304ull,
+     0x3CB400304ull, 0x3CB600304ull, 0x3CC400307ull, 0x3CC600307ull,
+     0x3D4000302ull, 0x3D4000306ull, 0x3D4200302ull, 0x3D4200306ull,
+     0x3D7000302ull, 0x3D7200302ull, 0x3D9800302ull, 0x3D9A00302ull,
+     0x3E0000300ull, 0x3E0000301ull, 0x3E0000342ull, 0x3E0000345ull,
+     0x3E0200300ull, 0x3E0200301ull, 0x3E0200342ull, 0x3E0200345ull,
+     0x3E0400345ull, 0x3E0600345ull, 0x3E0800345ull, 0x3E0A00345ull,
+     0x3E0C00345ull, 0x3E0E00345ull, 0x3E1000300ull, 0x3E1000301ull,
+     0x3E1000342ull, 0x3E1000345ull, 0x3E1200300ull, 0x3E1200301ull,
+     0x3E1200342ull, 0x3E1200345ull, 0x3E1400345ull, 0x3E1600345ull,
+     0x3E1800345ull, 0x3E1A00345ull, 0x3E1C00345ull, 0x3E1E00345ull,
+     0x3E2000300ull, 0x3E2000301ull, 0x3E2200300ull, 0x3E2200301ull,
+     0x3E3000300ull, 0x3E3000301ull, 0x3E3200300ull, 0x3E3200301ull,
+     0x3E4000300ull, 0x3E4000301ull, 0x3E4000342ull, 0x3E4000345ull,
+     0x3E4200300ull, 0x3E4200301ull, 0x3E4200342ull, 0x3E4200345ull,
+     0x3E4400345ull, 0x3E4600345ull, 0x3E4800345ull, 0x3E4A00345ull,
+     0x3E4C00345ull, 0x3E4E00345ull, 0x3E5000300ull, 0x3E5000301ull,
+     0x3E5000342ull, 0x3E5000345ull, 0x3E5200300ull, 0x3E5200301ull,
+     0x3E5200342ull, 0x3E5200345ull, 0x3E5400345ull, 0x3E5600345ull,
+     0x3E5800345ull, 0x3E5A00345ull, 0x3E5C00345ull, 0x3E5E00345ull,
+     0x3E6000300ull, 0x3E6000301ull, 0x3E6000342ull, 0x3E6200300ull,
+     0x3E6200301ull, 0x3E6200342ull, 0x3E7000300ull, 0x3E7000301ull,
+     0x3E7000342ull, 0x3E7200300ull, 0x3E7200301ull, 0x3E7200342ull,
+     0x3E8000300ull, 0x3E8000301ull, 0x3E8200300ull, 0x3E8200301ull,
+     0x3E9000300ull, 0x3E9000301ull, 0x3E9200300ull, 0x3E9200301ull,
+     0x3EA000300ull, 0x3EA000301ull, 0x3EA000342ull, 0x3EA200300ull,
+     0x3EA200301ull, 0x3EA200342ull, 0x3EB200300ull, 0x3EB200301ull,
+     0x3EB200342ull, 0x3EC000300ull, 0x3EC000301ull, 0x3EC000342ull,
+     0x3EC000345ull, 0x3EC200300ull, 0x3EC200301ull, 0x3EC200342ull,
+     0x3EC200345ull, 0x3EC400345ull, 0x3EC600345ull, 0x3EC800345ull,
+     0x3ECA00345ull, 0x3ECC00345ull, 0x3ECE00345ull, 0x3ED000300ull,
+     0x3ED000301ull, 0x3ED000342ull, 0x3ED000345ull, 0x3ED200300ull,
+     0x3ED200301ull, 0x3ED200342ull, 0x3ED200345ull, 0x3ED400345ull,
+     0x3ED600345ull, 0x3ED800345ull, 0x3EDA00345ull, 0x3EDC00345ull,
+     0x3EDE00345ull, 0x3EE000345ull, 0x3EE800345ull, 0x3EF800345ull,
+     0x3F6C00345ull, 0x3F7E00300ull, 0x3F7E00301ull, 0x3F7E00342ull,
+     0x3F8C00345ull, 0x3FEC00345ull, 0x3FFC00300ull, 0x3FFC00301ull,
+     0x3FFC00342ull, 0x432000338ull, 0x432400338ull, 0x432800338ull,
+     0x43A000338ull, 0x43A400338ull, 0x43A800338ull, 0x440600338ull,
+     0x441000338ull, 0x441600338ull, 0x444600338ull, 0x444A00338ull,
+     0x447800338ull, 0x448600338ull, 0x448A00338ull, 0x449000338ull,
+     0x449A00338ull, 0x44C200338ull, 0x44C800338ull, 0x44CA00338ull,
+     0x44E400338ull, 0x44E600338ull, 0x44EC00338ull, 0x44EE00338ull,
+     0x44F400338ull, 0x44F600338ull, 0x44F800338ull, 0x44FA00338ull,
+     0x450400338ull, 0x450600338ull, 0x450C00338ull, 0x450E00338ull,
+     0x452200338ull, 0x452400338ull, 0x454400338ull, 0x455000338ull,
+     0x455200338ull, 0x455600338ull, 0x456400338ull, 0x456600338ull,
+     0x456800338ull, 0x456A00338ull, 0x608C03099ull, 0x609603099ull,
+     0x609A03099ull, 0x609E03099ull, 0x60A203099ull, 0x60A603099ull,
+     0x60AA03099ull, 0x60AE03099ull, 0x60B203099ull, 0x60B603099ull,
+     0x60BA03099ull, 0x60BE03099ull, 0x60C203099ull, 0x60C803099ull,
+     0x60CC03099ull, 0x60D003099ull, 0x60DE03099ull, 0x60DE0309Aull,
+     0x60E403099ull, 0x60E40309Aull, 0x60EA03099ull, 0x60EA0309Aull,
+     0x60F003099ull, 0x60F00309Aull, 0x60F603099ull, 0x60F60309Aull,
+     0x613A03099ull, 0x614C03099ull, 0x615603099ull, 0x615A03099ull,
+     0x615E03099ull, 0x616203099ull, 0x616603099ull, 0x616A03099ull,
+     0x616E03099ull, 0x617203099ull, 0x617603099ull, 0x617A03099ull,
+     0x617E03099ull, 0x618203099ull, 0x618803099ull, 0x618C03099ull,
+     0x619003099ull, 0x619E03099ull, 0x619E0309Aull, 0x61A403099ull,
+     0x61A40309Aull, 0x61AA03099ull, 0x61AA0309Aull, 0x61B003099ull,
+     0x61B00309Aull, 0x61B603099ull, 0x61B60309Aull, 0x61DE03099ull,
+     0x61E003099ull, 0x61E203099ull, 0x61E403099ull, 0x61FA03099ull,
+     0x22132110BAull, 0x22136110BAull, 0x2214A110BAull, 0x2226211127ull,
+     0x2226411127ull, 0x2268E1133Eull, 0x2268E11357ull, 0x22972114B0ull,
+     0x22972114BAull, 0x22972114BDull, 0x22B70115AFull, 0x22B72115AFull,
+     0x2326A11930ull,
+ };
+ 
+ /* Composite for each compositionKeys entry */
+ static const uint32_t compositionValues[941] = {
+     0x226E, 0x2260, 0x226F, 0xC0, 0xC1, 0xC2, 0xC3, 0x100,
+     0x102, 0x226, 0xC4, 0x1EA2, 0xC5, 0x1CD, 0x200, 0x202,
+     0x1EA0, 0x1E00, 0x104, 0x1E02, 0x1E04, 0x1E06, 0x106, 0x108,
+     0x10A, 0x10C, 0xC7, 0x1E0A, 0x10E, 0x1E0C, 0x1E10, 0x1E12,
+     0x1E0E, 0xC8, 0xC9, 0xCA, 0x1EBC, 0x112, 0x114, 0x116,
+     0xCB, 0x1EBA, 0x11A, 0x204, 0x206, 0x1EB8, 0x228, 0x118,
+     0x1E18, 0x1E1A, 0x1E1E, 0x1F4, 0x11C, 0x1E20, 0x11E, 0x120,
+     0x1E6, 0x122, 0x124, 0x1E22, 0x1E26, 0x21E, 0x1E24, 0x1E28,
+     0x1E2A, 0xCC, 0xCD, 0xCE, 0x128, 0x12A, 0x12C, 0x130,
+     0xCF, 0x1EC8, 0x1CF, 0x208, 0x20A, 0x1ECA, 0x12E, 0x1E2C,
+     0x134, 0x1E30, 0x1E8, 0x1E32, 0x136, 0x1E34, 0x139, 0x13D,
+     0x1E36, 0x13B, 0x1E3C, 0x1E3A, 0x1E3E, 0x1E40, 0x1E42, 0x1F8,
+     0x143, 0xD1, 0x1E44, 0x147, 0x1E46, 0x145, 0x1E4A, 0x1E48,
+     0xD2, 0xD3, 0xD4, 0xD5, 0x14C, 0x14E, 0x22E, 0xD6,
+     0x1ECE, 0x150, 0x1D1, 0x20C, 0x20E, 0x1A0, 0x1ECC, 0x1EA,
+     0x1E54, 0x1E56, 0x154, 0x1E58, 0x158, 0x210, 0x212, 0x1E5A,
+     0x156, 0x1E5E, 0x15A, 0x15C, 0x1E60, 0x160, 0x1E62, 0x218,
+     0x15E, 0x1E6A, 0x164, 0x1E6C, 0x21A, 0x162, 0x1E70, 0x1E6E,
+     0xD9, 0xDA, 0xDB, 0x168, 0x16A, 0x16C, 0xDC, 0x1EE6,
+     0x16E, 0x170, 0x1D3, 0x214, 0x216, 0x1AF, 0x1EE4, 0x1E72,
+     0x172, 0x1E76, 0x1E74, 0x1E7C, 0x1E7E, 0x1E80, 0x1E82, 0x174,
+     0x1E86, 0x1E84, 0x1E88, 0x1E8A, 0x1E8C, 0x1EF2, 0xDD, 0x176,
+     0x1EF8, 0x232, 0x1E8E, 0x178, 0x1EF6, 0x1EF4, 0x179, 0x1E90,
+     0x17B, 0x17D, 0x1E92, 0x1E94, 0xE0, 0xE1, 0xE2, 0xE3,
+     0x101, 0x103, 0x227, 0xE4, 0x1EA3, 0xE5, 0x1CE, 0x201,
+     0x203, 0x1EA1, 0x1E01, 0x105, 0x1E03, 0x1E05, 0x1E07, 0x107,
+     0x109, 0x10B, 0x10D, 0xE7, 0x1E0B, 0x10F, 0x1E0D, 0x1E11,
+     0x1E13, 0x1E0F, 0xE8, 0xE9, 0xEA, 0x1EBD, 0x113, 0x115,
+     0x117, 0xEB, 0x1EBB, 0x11B, 0x205, 0x207, 0x1EB9, 0x229,
+     0x119, 0x1E19, 0x1E1B, 0x1E1F, 0x1F5, 0x11D, 0x1E21, 0x11F,
+     0x121, 0x1E7, 0x123, 0x125, 0x1E23, 0x1E27, 0x21F, 0x1E25,
+     0x1E29, 0x1E2B, 0x1E96, 0xEC, 0xED, 0xEE, 0x129, 0x12B,
+     0x12D, 0xEF, 0x1EC9, 0x1D0, 0x209, 0x20B, 0x1ECB, 0x12F,
+     0x1E2D, 0x135, 0x1F0, 0x1E31, 0x1E9, 0x1E33, 0x137, 0x1E35,
+     0x13A, 0x13E, 0x1E37, 0x13C, 0x1E3D, 0x1E3B, 0x1E3F, 0x1E41,
+     0x1E43, 0x1F9, 0x144, 0xF1, 0x1E45, 0x148, 0x1E47, 0x146,
+     0x1E4B, 0x1E49, 0xF2, 0xF3, 0xF4, 0xF5, 0x14D, 0x14F,
+     0x22F, 0xF6, 0x1ECF, 0x151, 0x1D2, 0x20D, 0x20F, 0x1A1,
+     0x1ECD, 0x1EB, 0x1E55, 0x1E57, 0x155, 0x1E59, 0x159, 0x211,
+     0x213, 0x1E5B, 0x157, 0x1E5F, 0x15B, 0x15D, 0x1E61, 0x161,
+     0x1E63, 0x219, 0x15F, 0x1E6B, 0x1E97, 0x165, 0x1E6D, 0x21B,
+     0x163, 0x1E71, 0x1E6F, 0xF9, 0xFA, 0xFB, 0x169, 0x16B,
+     0x16D, 0xFC, 0x1EE7, 0x16F, 0x171, 0x1D4, 0x215, 0x217,
+     0x1B0, 0x1EE5, 0x1E73, 0x173, 0x1E77, 0x1E75, 0x1E7D, 0x1E7F,
+     0x1E81, 0x1E83, 0x175, 0x1E87, 0x1E85, 0x1E98, 0x1E89, 0x1E8B,
+     0x1E8D, 0x1EF3, 0xFD, 0x177, 0x1EF9, 0x233, 0x1E8F, 0xFF,
+     0x1EF7, 0x1E99, 0x1EF5, 0x17A, 0x1E91, 0x17C, 0x17E, 0x1E93,
+     0x1E95, 0x1FED, 0x385, 0x1FC1, 0x1EA6, 0x1EA4, 0x1EAA, 0x1EA8,
+     0x1DE, 0x1FA, 0x1FC, 0x1E2, 0x1E08, 0x1EC0, 0x1EBE, 0x1EC4,
+     0x1EC2, 0x1E2E, 0x1ED2, 0x1ED0, 0x1ED6, 0x1ED4, 0x1E4C, 0x22C,
+     0x1E4E, 0x22A, 0x1FE, 0x1DB, 0x1D7, 0x1D5, 0x1D9, 0x1EA7,
+     0x1EA5, 0x1EAB, 0x1EA9, 0x1DF, 0x1FB, 0x1FD, 0x1E3, 0x1E09,
+     0x1EC1, 0x1EBF, 0x1EC5, 0x1EC3, 0x1E2F, 0x1ED3, 0x1ED1, 0x1ED7,
+     0x1ED5, 0x1E4D, 0x22D, 0x1E4F, 0x22B, 0x1FF, 0x1DC, 0x1D8,
+     0x1D6, 0x1DA, 0x1EB0, 0x1EAE, 0x1EB4, 0x1EB2, 0x1EB1, 0x1EAF,
+     0x1EB5, 0x1EB3, 0x1E14, 0x1E16, 0x1E15, 0x1E17, 0x1E50, 0x1E52,
+     0x1E51, 0x1E53, 0x1E64, 0x1E65, 0x1E66, 0x1E67, 0x1E78, 0x1E79,
+     0x1E7A, 0x1E7B, 0x1E9B, 0x1EDC, 0x1EDA, 0x1EE0, 0x1EDE, 0x1EE2,
+     0x1EDD, 0x1EDB, 0x1EE1, 0x1EDF, 0x1EE3, 0x1EEA, 0x1EE8, 0x1EEE,
+     0x1EEC, 0x1EF0, 0x1EEB, 0x1EE9, 0x1EEF, 0x1EED, 0x1EF1, 0x1EE,
+     0x1EC, 0x1ED, 0x1E0, 0x1E1, 0x1E1C, 0x1E1D, 0x230, 0x231,
+     0x1EF, 0x1FBA, 0x386, 0x1FB9, 0x1FB8, 0x1F08, 0x1F09, 0x1FBC,
+     0x1FC8, 0x388, 0x1F18, 0x1F19, 0x1FCA, 0x389, 0x1F28, 0x1F29,
+     0x1FCC, 0x1FDA, 0x38A, 0x1FD9, 0x1FD8, 0x3AA, 0x1F38, 0x1F39,
+     0x1FF8, 0x38C, 0x1F48, 0x1F49, 0x1FEC, 0x1FEA, 0x38E, 0x1FE9,
+     0x1FE8, 0x3AB, 0x1F59, 0x1FFA, 0x38F, 0x1F68, 0x1F69, 0x1FFC,
+     0x1FB4, 0x1FC4, 0x1F70, 0x3AC, 0x1FB1, 0x1FB0, 0x1F00, 0x1F01,
+     0x1FB6, 0x1FB3, 0x1F72, 0x3AD, 0x1F10, 0x1F11, 0x1F74, 0x3AE,
+     0x1F20, 0x1F21, 0x1FC6, 0x1FC3, 0x1F76, 0x3AF, 0x1FD1, 0x1FD0,
+     0x3CA, 0x1F30, 0x1F31, 0x1FD6, 0x1F78, 0x3CC, 0x1F40, 0x1F41,
+     0x1FE4, 0x1FE5, 0x1F7A, 0x3CD, 0x1FE1, 0x1FE0, 0x3CB, 0x1F50,
+     0x1F51, 0x1FE6, 0x1F7C, 0x3CE, 0x1F60, 0x1F61, 0x1FF6, 0x1FF3,
+     0x1FD2, 0x390, 0x1FD7, 0x1FE2, 0x3B0, 0x1FE7, 0x1FF4, 0x3D3,
+     0x3D4, 0x407, 0x4D0, 0x4D2, 0x403, 0x400, 0x4D6, 0x401,
+     0x4C1, 0x4DC, 0x4DE, 0x40D, 0x4E2, 0x419, 0x4E4, 0x40C,
+     0x4E6, 0x4EE, 0x40E, 0x4F0, 0x4F2, 0x4F4, 0x4F8, 0x4EC,
+     0x4D1, 0x4D3, 0x453, 0x450, 0x4D7, 0x451, 0x4C2, 0x4DD,
+     0x4DF, 0x45D, 0x4E3, 0x439, 0x4E5, 0x45C, 0x4E7, 0x4EF,
+     0x45E, 0x4F1, 0x4F3, 0x4F5, 0x4F9, 0x4ED, 0x457, 0x476,
+     0x477, 0x4DA, 0x4DB, 0x4EA, 0x4EB, 0x622, 0x623, 0x625,
+     0x624, 0x626, 0x6C2, 0x6D3, 0x6C0, 0x929, 0x931, 0x934,
+     0x9CB, 0x9CC, 0xB4B, 0xB48, 0xB4C, 0xB94, 0xBCA, 0xBCC,
+     0xBCB, 0xC48, 0xCC0, 0xCCA, 0xCC7, 0xCC8, 0xCCB, 0xD4A,
+     0xD4C, 0xD4B, 0xDDA, 0xDDC, 0xDDE, 0xDDD, 0x1026, 0x1B06,
+     0x1B08, 0x1B0A, 0x1B0C, 0x1B0E, 0x1B12, 0x1B3B, 0x1B3D, 0x1B40,
+     0x1B41, 0x1B43, 0x1E38, 0x1E39, 0x1E5C, 0x1E5D, 0x1E68, 0x1E69,
+     0x1EAC, 0x1EB6, 0x1EAD, 0x1EB7, 0x1EC6, 0x1EC7, 0x1ED8, 0x1ED9,
+     0x1F02, 0x1F04, 0x1F06, 0x1F80, 0x1F03, 0x1F05, 0x1F07, 0x1F81,
+     0x1F82, 0x1F83, 0x1F84, 0x1F85, 0x1F86, 0x1F87, 0x1F0A, 0x1F0C,
+     0x1F0E, 0x1F88, 0x1F0B, 0x1F0D, 0x1F0F, 0x1F89, 0x1F8A, 0x1F8B,
+     0x1F8C, 0x1F8D, 0x1F8E, 0x1F8F, 0x1F12, 0x1F14, 0x1F13, 0x1F15,
+     0x1F1A, 0x1F1C, 0x1F1B, 0x1F1D, 0x1F22, 0x1F24, 0x1F26, 0x1F90,
+     0x1F23, 0x1F25, 0x1F27, 0x1F91, 0x1F92, 0x1F93, 0x1F94, 0x1F95,
+     0x1F96, 0x1F97, 0x1F2A, 0x1F2C, 0x1F2E, 0x1F98, 0x1F2B, 0x1F2D,
+     0x1F2F, 0x1F99, 0x1F9A, 0x1F9B, 0x1F9C, 0x1F9D, 0x1F9E, 0x1F9F,
+     0x1F32, 0x1F34, 0x1F36, 0x1F33, 0x1F35, 0x1F37, 0x1F3A, 0x1F3C,
+     0x1F3E, 0x1F3B, 0x1F3D, 0x1F3F, 0x1F42, 0x1F44, 0x1F43, 0x1F45,
+     0x1F4A, 0x1F4C, 0x1F4B, 0x1F4D, 0x1F52, 0x1F54, 0x1F56, 0x1F53,
+     0x1F55, 0x1F57, 0x1F5B, 0x1F5D, 0x1F5F, 0x1F62, 0x1F64, 0x1F66,
+     0x1FA0, 0x1F63, 0x1F65, 0x1F67, 0x1FA1, 0x1FA2, 0x1FA3, 0x1FA4,
+     0x1FA5, 0x1FA6, 0x1FA7, 0x1F6A, 0x1F6C, 0x1F6E, 0x1FA8, 0x1F6B,
+     0x1F6D, 0x1F6F, 0x1FA9, 0x1FAA, 0x1FAB, 0x1FAC, 0x1FAD, 0x1FAE,
+     0x1FAF, 0x1FB2, 0x1FC2, 0x1FF2, 0x1FB7, 0x1FCD, 0x1FCE, 0x1FCF,
+     0x1FC7, 0x1FF7, 0x1FDD, 0x1FDE, 0x1FDF, 0x219A, 0x219B, 0x21AE,
+     0x21CD, 0x21CF, 0x21CE, 0x2204, 0x2209, 0x220C, 0x2224, 0x2226,
+     0x2241, 0x2244, 0x2247, 0x2249, 0x226D, 0x2262, 0x2270, 0x2271,
+     0x2274, 0x2275, 0x2278, 0x2279, 0x2280, 0x2281, 0x22E0, 0x22E1,
+     0x2284, 0x2285, 0x2288, 0x2289, 0x22E2, 0x22E3, 0x22AC, 0x22AD,
+     0x22AE, 0x22AF, 0x22EA, 0x22EB, 0x22EC, 0x22ED, 0x3094, 0x304C,
+     0x304E, 0x3050, 0x3052, 0x3054, 0x3056, 0x3058, 0x305A, 0x305C,
+     0x305E, 0x3060, 0x3062, 0x3065, 0x3067, 0x3069, 0x3070, 0x3071,
+     0x3073, 0x3074, 0x3076, 0x3077, 0x3079, 0x307A, 0x307C, 0x307D,
+     0x309E, 0x30F4, 0x30AC, 0x30AE, 0x30B0, 0x30B2, 0x30B4, 0x30B6,
+     0x30B8, 0x30BA, 0x30BC, 0x30BE, 0x30C0, 0x30C2, 0x30C5, 0x30C7,
+     0x30C9, 0x30D0, 0x30D1, 0x30D3, 0x30D4, 0x30D6, 0x30D7, 0x30D9,
+     0x30DA, 0x30DC, 0x30DD, 0x30F7, 0x30F8, 0x30F9, 0x30FA, 0x30FE,
+     0x1109A, 0x1109C, 0x110AB, 0x1112E, 0x1112F, 0x1134B, 0x1134C, 0x114BC,
+     0x114BB, 0x114BE, 0x115BA, 0x115BB, 0x11938,
+ };
+ 
+ /* Code points with a single code point lowercase form */
+ static const uint32_t lowercaseKeys[1432] = {
+     0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+     0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50,
+     0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+     0x59, 0x5A, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5,
+     0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD,
+     0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5,
+     0xD6, 0xD8, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE,
+     0x100, 0x102, 0x104, 0x106, 0x108, 0x10A, 0x10C, 0x10E,
+     0x110, 0x112, 0x114, 0x116, 0x118, 0x11A, 0x11C, 0x11E,
+     0x120, 0x122, 0x124, 0x126, 0x128, 0x12A, 0x12C, 0x12E,
+     0x132, 0x134, 0x136, 0x139, 0x13B, 0x13D, 0x13F, 0x141,
+     0x143, 0x145, 0x147, 0x14A, 0x14C, 0x14E, 0x150, 0x152,
+     0x154, 0x156, 0x158, 0x15A, 0x15C, 0x15E, 0x160, 0x162,
+     0x164, 0x166, 0x168, 0x16A, 0x16C, 0x16E, 0x170, 0x172,
+     0x174, 0x176, 0x178, 0x179, 0x17B, 0x17D, 0x181, 0x182,
+     0x184, 0x186, 0x187, 0x189, 0x18A, 0x18B, 0x18E, 0x18F,
+     0x190, 0x191, 0x193, 0x194, 0x196, 0x197, 0x198, 0x19C,
+     0x19D, 0x19F, 0x1A0, 0x1A2, 0x1A4, 0x1A6, 0x1A7, 0x1A9,
+     0x1AC, 0x1AE, 0x1AF, 0x1B1, 0x1B2, 0x1B3, 0x1B5, 0x1B7,
+     0x1B8, 0x1BC, 0x1C4, 0x1C5, 0x1C7, 0x1C8, 0x1CA, 0x1CB,
+     0x1CD, 0x1CF, 0x1D1, 0x1D3, 0x1D5, 0x1D7, 0x1D9, 0x1DB,
+     0x1DE, 0x1E0, 0x1E2, 0x1E4, 0x1E6, 0x1E8, 0x1EA, 0x1EC,
+     0x1EE, 0x1F1, 0x1F2, 0x1F4, 0x1F6, 0x1F7, 0x1F8, 0x1FA,
+     0x1FC, 0x1FE, 0x200, 0x202, 0x204, 0x206, 0x208, 0x20A,
+     0x20C, 0x20E, 0x210, 0x212, 0x214, 0x216, 0x218, 0x21A,
+     0x21C, 0x21E, 0x220, 0x222, 0x224, 0x226, 0x228, 0x22A,
+     0x22C, 0x22E, 0x230, 0x232, 0x23A, 0x23B, 0x23D, 0x23E,
+     0x241, 0x243, 0x244, 0x245, 0x246, 0x248, 0x24A, 0x24C,
+     0x24E, 0x370, 0x372, 0x376, 0x37F, 0x386, 0x388, 0x389,
+     0x38A, 0x38C, 0x38E, 0x38F, 0x391, 0x392, 0x393, 0x394,
+     0x395, 0x396, 0x397, 0x398, 0x399, 0x39A, 0x39B, 0x39C,
+     0x39D, 0x39E, 0x39F, 0x3A0, 0x3A1, 0x3A3, 0x3A4, 0x3A5,
+     0x3A6, 0x3A7, 0x3A8, 0x3A9, 0x3AA, 0x3AB, 0x3CF, 0x3D8,
+     0x3DA, 0x3DC, 0x3DE, 0x3E0, 0x3E2, 0x3E4, 0x3E6, 0x3E8,
+     0x3EA, 0x3EC, 0x3EE, 0x3F4, 0x3F7, 0x3F9, 0x3FA, 0x3FD,
+     0x3FE, 0x3FF, 0x400, 0x401, 0x402, 0x403, 0x404, 0x405,
+     0x406, 0x407, 0x408, 0x409, 0x40A, 0x40B, 0x40C, 0x40D,
+     0x40E, 0x40F, 0x410, 0x411, 0x412, 0x413, 0x414, 0x415,
+     0x416, 0x417, 0x418, 0x419, 0x41A, 0x41B, 0x41C, 0x41D,
+     0x41E, 0x41F, 0x420, 0x421, 0x422, 0x423, 0x424, 0x425,
+     0x426, 0x427, 0x428, 0x429, 0x42A, 0x42B, 0x42C, 0x42D,
+     0x42E, 0x42F, 0x460, 0x462, 0x464, 0x466, 0x468, 0x46A,
+     0x46C, 0x46E, 0x470, 0x472, 0x474, 0x476, 0x478, 0x47A,
+     0x47C, 0x47E, 0x480, 0x48A, 0x48C, 0x48E, 0x490, 0x492,
+     0x494, 0x496, 0x498, 0x49A, 0x49C, 0x49E, 0x4A0, 0x4A2,
+     0x4A4, 0x4A6, 0x4A8, 0x4AA, 0x4AC, 0x4AE, 0x4B0, 0x4B2,
+     0x4B4, 0x4B6, 0x4B8, 0x4BA, 0x4BC, 0x4BE, 0x4C0, 0x4C1,
+     0x4C3, 0x4C5, 0x4C7, 0x4C9, 0x4CB, 0x4CD, 0x4D0, 0x4D2,
+     0x4D4, 0x4D6, 0x4D8, 0x4DA, 0x4DC, 0x4DE, 0x4E0, 0x4E2,
+     0x4E4, 0x4E6, 0x4E8, 0x4EA, 0x4EC, 0x4EE, 0x4F0, 0x4F2,
+     0x4F4, 0x4F6, 0x4F8, 0x4FA, 0x4FC, 0x4FE, 0x500, 0x502,
+     0x504, 0x506, 0x508, 0x50A, 0x50C, 0x50E, 0x510, 0x512,
+     0x514, 0x516, 0x518, 0x51A, 0x51C, 0x51E, 0x520, 0x522,
+     0x524, 0x526, 0x528, 0x52A, 0x52C, 0x52E, 0x531, 0x532,
+     0x533, 0x534, 0x535, 0x536, 0x537, 0x538, 0x539, 0x53A,
+     0x53B, 0x53C, 0x53D, 0x53E, 0x53F, 0x540, 0x541, 0x542,
+     0x543, 0x544, 0x545, 0x546, 0x547, 0x548, 0x549, 0x54A,
+     0x54B, 0x54C, 0x54D, 0x54E, 0x54F, 0x550, 0x551, 0x552,
+     0x553, 0x554, 0x555, 0x556, 0x10A0, 0x10A1, 0x10A2, 0x10A3,
+     0x10A4, 0x10A5, 0x10A6, 0x10A7, 0x10A8, 0x10A9, 0x10AA, 0x10AB,
+     0x10AC, 0x10AD, 0x10AE, 0x10AF, 0x10B0, 0x10B1, 0x10B2, 0x10B3,
+     0x10B4, 0x10B5, 0x10B6, 0x10B7, 0x10B8, 0x10B9, 0x10BA, 0x10BB,
+     0x10BC, 0x10BD, 0x10BE, 0x10BF, 0x10C0, 0x10C1, 0x10C2, 0x10C3,
+     0x10C4, 0x10C5, 0x10C7, 0x10CD, 0x13A0, 0x13A1, 0x13A2, 0x13A3,
+     0x13A4, 0x13A5, 0x13A6, 0x13A7, 0x13A8, 0x13A9, 0x13AA, 0x13AB,
+     0x13AC, 0x13AD, 0x13AE, 0x13AF, 0x13B0, 0x13B1, 0x13B2, 0x13B3,
+     0x13B4, 0x13B5, 0x13B6, 0x13B7, 0x13B8, 0x13B9, 0x13BA, 0x13BB,
+     0x13BC, 0x13BD, 0x13BE, 0x13BF, 0x13C0, 0x13C1, 0x13C2, 0x13C3,
+     0x13C4, 0x13C5, 0x13C6, 0x13C7, 0x13C8, 0x13C9, 0x13CA, 0x13CB,
+     0x13CC, 0x13CD, 0x13CE, 0x13CF, 0x13D0, 0x13D1, 0x13D2, 0x13D3,
+     0x13D4, 0x13D5, 0x13D6, 0x13D7, 0x13D8, 0x13D9, 0x13DA, 0x13DB,
+     0x13DC, 0x13DD, 0x13DE, 0x13DF, 0x13E0, 0x13E1, 0x13E2, 0x13E3,
+     0x13E4, 0x13E5, 0x13E6, 0x13E7, 0x13E8, 0x13E9, 0x13EA, 0x13EB,
+     0x13EC, 0x13ED, 0x13EE, 0x13EF, 0x13F0, 0x13F1, 0x13F2, 0x13F3,
+     0x13F4, 0x13F5, 0x1C90, 0x1C91, 0x1C92, 0x1C93, 0x1C94, 0x1C95,
+     0x1C96, 0x1C97, 0x1C98, 0x1C99, 0x1C9A, 0x1C9B, 0x1C9C, 0x1C9D,
+     0x1C9E, 0x1C9F, 0x1CA0, 0x1CA1, 0x1CA2, 0x1CA3, 0x1CA4, 0x1CA5,
+     0x1CA6, 0x1CA7, 0x1CA8, 0x1CA9, 0x1CAA, 0x1CAB, 0x1CAC, 0x1CAD,
+     0x1CAE, 0x1CAF, 0x1CB0, 0x1CB1, 0x1CB2, 0x1CB3, 0x1CB4, 0x1CB5,
+     0x1CB6, 0x1CB7, 0x1CB8, 0x1CB9, 0x1CBA, 0x1CBD, 0x1CBE, 0x1CBF,
+     0x1E00, 0x1E02, 0x1E04, 0x1E06, 0x1E08, 0x1E0A, 0x1E0C, 0x1E0E,
+     0x1E10, 0x1E12, 0x1E14, 0x1E16, 0x1E18, 0x1E1A, 0x1E1C, 0x1E1E,
+     0x1E20, 0x1E22, 0x1E24, 0x1E26, 0x1E28, 0x1E2A, 0x1E2C, 0x1E2E,
+     0x1E30, 0x1E32, 0x1E34, 0x1E36, 0x1E38, 0x1E3A, 0x1E3C, 0x1E3E,
+     0x1E40, 0x1E42, 0x1E44, 0x1E46, 0x1E48, 0x1E4A, 0x1E4C, 0x1E4E,
+     0x1E50, 0x1E52, 0x1E54, 0x1E56, 0x1E58, 0x1E5A, 0x1E5C, 0x1E5E,
+     0x1E60, 0x1E62, 0x1E64, 0x1E66, 0x1E68, 0x1E6A, 0x1E6C, 0x1E6E,
+     0x1E70, 0x1E72, 0x1E74, 0x1E76, 0x1E78, 0x1E7A, 0x1E7C, 0x1E7E,
+     0x1E80, 0x1E82, 0x1E84, 0x1E86, 0x1E88, 0x1E8A, 0x1E8C, 0x1E8E,
+     0x1E90, 0x1E92, 0x1E94, 0x1E9E, 0x1EA0, 0x1EA2, 0x1EA4, 0x1EA6,
+     0x1EA8, 0x1EAA, 0x1EAC, 0x1EAE, 0x1EB0, 0x1EB2, 0x1EB4, 0x1EB6,
+     0x1EB8, 0x1EBA, 0x1EBC, 0x1EBE, 0x1EC0, 0x1EC2, 0x1EC4, 0x1EC6,
+     0x1EC8, 0x1ECA, 0x1ECC, 0x1ECE, 0x1ED0, 0x1ED2, 0x1ED4, 0x1ED6,
+     0x1ED8, 0x1EDA, 0x1EDC, 0x1EDE, 0x1EE0, 0x1EE2, 0x1EE4, 0x1EE6,
+     0x1EE8, 0x1EEA, 0x1EEC, 0x1EEE, 0x1EF0, 0x1EF2, 0x1EF4, 0x1EF6,
+     0x1EF8, 0x1EFA, 0x1EFC, 0x1EFE, 0x1F08, 0x1F09, 0x1F0A, 0x1F0B,
+     0x1F0C, 0x1F0D, 0x1F0E, 0x1F0F, 0x1F18, 0x1F19, 0x1F1A, 0x1F1B,
+     0x1F1C, 0x1F1D, 0x1F28, 0x1F29, 0x1F2A, 0x1F2B, 0x1F2C, 0x1F2D,
+     0x1F2E, 0x1F2F, 0x1F38, 0x1F39, 0x1F3A, 0x1F3B, 0x1F3C, 0x1F3D,
+     0x1F3E, 0x1F3F, 0x1F48, 0x1F49, 0x1F4A, 0x1F4B, 0x1F4C, 0x1F4D,
+     0x1F59, 0x1F5B, 0x1F5D, 0x1F5F, 0x1F68, 0x1F69, 0x1F6A, 0x1F6B,
+     0x1F6C, 0x1F6D, 0x1F6E, 0x1F6F, 0x1F88, 0x1F89, 0x1F8A, 0x1F8B,
+     0x1F8C, 0x1F8D, 0x1F8E, 0x1F8F, 0x1F98, 0x1F99, 0x1F9A, 0x1F9B,
+     0x1F9C, 0x1F9D, 0x1F9E, 0x1F9F, 0x1FA8, 0x1FA9, 0x1FAA, 0x1FAB,
+     0x1FAC, 0x1FAD, 0x1FAE, 0x1FAF, 0x1FB8, 0x1FB9, 0x1FBA, 0x1FBB,
+     0x1FBC, 0x1FC8, 0x1FC9, 0x1FCA, 0x1FCB, 0x1FCC, 0x1FD8, 0x1FD9,
+     0x1FDA, 0x1FDB, 0x1FE8, 0x1FE9, 0x1FEA, 0x1FEB, 0x1FEC, 0x1FF8,
+     0x1FF9, 0x1FFA, 0x1FFB, 0x1FFC, 0x2126, 0x212A, 0x212B, 0x2132,
+     0x2160, 0x2161, 0x2162, 0x2163, 0x2164, 0x2165, 0x2166, 0x2167,
+     0x2168, 0x2169, 0x216A, 0x216B, 0x216C, 0x216D, 0x216E, 0x216F,
+     0x2183, 0x24B6, 0x24B7, 0x24B8, 0x24B9, 0x24BA, 0x24BB, 0x24BC,
+     0x24BD, 0x24BE, 0x24BF, 0x24C0, 0x24C1, 0x24C2, 0x24C3, 0x24C4,
+     0x24C5, 0x24C6, 0x24C7, 0x24C8, 0x24C9, 0x24CA, 0x24CB, 0x24CC,
+     0x24CD, 0x24CE, 0x24CF, 0x2C00, 0x2C01, 0x2C02, 0x2C03, 0x2C04,
+     0x2C05, 0x2C06, 0x2C07, 0x2C08, 0x2C09, 0x2C0A, 0x2C0B, 0x2C0C,
+     0x2C0D, 0x2C0E, 0x2C0F, 0x2C10, 0x2C11, 0x2C12, 0x2C13, 0x2C14,
+     0x2C15, 0x2C16, 0x2C17, 0x2C18, 0x2C19, 0x2C1A, 0x2C1B, 0x2C1C,
+     0x2C1D, 0x2C1E, 0x2C1F, 0x2C20, 0x2C21, 0x2C22, 0x2C23, 0x2C24,
+     0x2C25, 0x2C26, 0x2C27, 0x2C28, 0x2C29, 0x2C2A, 0x2C2B, 0x2C2C,
+     0x2C2D, 0x2C2E, 0x2C2F, 0x2C60, 0x2C62, 0x2C63, 0x2C64, 0x2C67,
+     0x2C69, 0x2C6B, 0x2C6D, 0x2C6E, 0x2C6F, 0x2C70, 0x2C72, 0x2C75,
+     0x2C7E, 0x2C7F, 0x2C80, 0x2C82, 0x2C84, 0x2C86, 0x2C88, 0x2C8A,
+     0x2C8C, 0x2C8E, 0x2C90, 0x2C92, 0x2C94, 0x2C96, 0x2C98, 0x2C9A,
+     0x2C9C, 0x2C9E, 0x2CA0, 0x2CA2, 0x2CA4, 0x2CA6, 0x2CA8, 0x2CAA,
+     0x2CAC, 0x2CAE, 0x2CB0, 0x2CB2, 0x2CB4, 0x2CB6, 0x2CB8, 0x2CBA,
+     0x2CBC, 0x2CBE, 0x2CC0, 0x2CC2, 0x2CC4, 0x2CC6, 0x2CC8, 0x2CCA,
+     0x2CCC, 0x2CCE, 0x2CD0, 0x2CD2, 0x2CD4, 0x2CD6, 0x2CD8, 0x2CDA,
+     0x2CDC, 0x2CDE, 0x2CE0, 0x2CE2, 0x2CEB, 0x2CED, 0x2CF2, 0xA640,
+     0xA642, 0xA644, 0xA646, 0xA648, 0xA64A, 0xA64C, 0xA64E, 0xA650,
+     0xA652, 0xA654, 0xA656, 0xA658, 0xA65A, 0xA65C, 0xA65E, 0xA660,
+     0xA662, 0xA664, 0xA666, 0xA668, 0xA66A, 0xA66C, 0xA680, 0xA682,
+     0xA684, 0xA686, 0xA688, 0xA68A, 0xA68C, 0xA68E, 0xA690, 0xA692,
+     0xA694, 0xA696, 0xA698, 0xA69A, 0xA722, 0xA724, 0xA726, 0xA728,
+     0xA72A, 0xA72C, 0xA72E, 0xA732, 0xA734, 0xA736, 0xA738, 0xA73A,
+     0xA73C, 0xA73E, 0xA740, 0xA742, 0xA744, 0xA746, 0xA748, 0xA74A,
+     0xA74C, 0xA74E, 0xA750, 0xA752, 0xA754, 0xA756, 0xA758, 0xA75A,
+     0xA75C, 0xA75E, 0xA760, 0xA762, 0xA764, 0xA766, 0xA768, 0xA76A,
+     0xA76C, 0xA76E, 0xA779, 0xA77B, 0xA77D, 0xA77E, 0xA780, 0xA782,
+     0xA784, 0xA786, 0xA78B, 0xA78D, 0xA790, 0xA792, 0xA796, 0xA798,
+     0xA79A, 0xA79C, 0xA79E, 0xA7A0, 0xA7A2, 0xA7A4, 0xA7A6, 0xA7A8,
+     0xA7AA, 0xA7AB, 0xA7AC, 0xA7AD, 0xA7AE, 0xA7B0, 0xA7B1, 0xA7B2,
+     0xA7B3, 0xA7B4, 0xA7B6, 0xA7B8, 0xA7BA, 0xA7BC, 0xA7BE, 0xA7C0,
+     0xA7C2, 0xA7C4, 0xA7C5, 0xA7C6, 0xA7C7, 0xA7C9, 0xA7D0, 0xA7D6,
+     0xA7D8, 0xA7F5, 0xFF21, 0xFF22, 0xFF23, 0xFF24, 0xFF25, 0xFF26,
+     0xFF27, 0xFF28, 0xFF29, 0xFF2A, 0xFF2B, 0xFF2C, 0xFF2D, 0xFF2E,
+     0xFF2F, 0xFF30, 0xFF31, 0xFF32, 0xFF33, 0xFF34, 0xFF35, 0xFF36,
+     0xFF37, 0xFF38, 0xFF39, 0xFF3A, 0x10400, 0x10401, 0x10402, 0x10403,
+     0x10404, 0x10405, 0x10406, 0x10407, 0x10408, 0x10409, 0x1040A, 0x1040B,
+     0x1040C, 0x1040D, 0x1040E, 0x1040F, 0x10410, 0x10411, 0x10412, 0x10413,
+     0x10414, 0x10415, 0x10416, 0x10417, 0x10418, 0x10419, 0x1041A, 0x1041B,
+     0x1041C, 0x1041D, 0x1041E, 0x1041F, 0x10420, 0x10421, 0x10422, 0x10423,
+     0x10424, 0x10425, 0x10426, 0x10427, 0x104B0, 0x104B1, 0x104B2, 0x104B3,
+     0x104B4, 0x104B5, 0x104B6, 0x104B7, 0x104B8, 0x104B9, 0x104BA, 0x104BB,
+     0x104BC, 0x104BD, 0x104BE, 0x104BF, 0x104C0, 0x104C1, 0x104C2, 0x104C3,
+     0x104C4, 0x104C5, 0x104C6, 0x104C7, 0x104C8, 0x104C9, 0x104CA, 0x104CB,
+     0x104CC, 0x104CD, 0x104CE, 0x104CF, 0x104D0, 0x104D1, 0x104D2, 0x104D3,
+     0x10570, 0x10571, 0x10572, 0x10573, 0x10574, 0x10575, 0x10576, 0x10577,
+     0x10578, 0x10579, 0x1057A, 0x1057C, 0x1057D, 0x1057E, 0x1057F, 0x10580,
+     0x10581, 0x10582, 0x10583, 0x10584, 0x10585, 0x10586, 0x10587, 0x10588,
+     0x10589, 0x1058A, 0x1058C, 0x1058D, 0x1058E, 0x1058F, 0x10590, 0x10591,
+     0x10592, 0x10594, 0x10595, 0x10C80, 0x10C81, 0x10C82, 0x10C83, 0x10C84,
+     0x10C85, 0x10C86, 0x10C87, 0x10C88, 0x10C89, 0x10C8A, 0x10C8B, 0x10C8C,
+     0x10C8D, 0x10C8E, 0x10C8F, 0x10C90, 0x10C91, 0x10C92, 0x10C93, 0x10C94,
+     0x10C95, 0x10C96, 0x10C97, 0x10C98, 0x10C99, 0x10C9A, 0x10C9B, 0x10C9C,
+     0x10C9D, 0x10C9E, 0x10C9F, 0x10CA0, 0x10CA1, 0x10CA2, 0x10CA3, 0x10CA4,
+     0x10CA5, 0x10CA6, 0x10CA7, 0x10CA8, 0x10CA9, 0x10CAA, 0x10CAB, 0x10CAC,
+     0x10CAD, 0x10CAE, 0x10CAF, 0x10CB0, 0x10CB1, 0x10CB2, 0x118A0, 0x118A1,
+     0x118A2, 0x118A3, 0x118A4, 0x118A5, 0x118A6, 0x118A7, 0x118A8, 0x118A9,
+     0x118AA, 0x118AB, 0x118AC, 0x118AD, 0x118AE, 0x118AF, 0x118B0, 0x118B1,
+     0x118B2, 0x118B3, 0x118B4, 0x118B5, 0x118B6, 0x118B7, 0x118B8, 0x118B9,
+     0x118BA, 0x118BB, 0x118BC, 0x118BD, 0x118BE, 0x118BF, 0x16E40, 0x16E41,
+     0x16E42, 0x16E43, 0x16E44, 0x16E45, 0x16E46, 0x16E47, 0x16E48, 0x16E49,
+     0x16E4A, 0x16E4B, 0x16E4C, 0x16E4D, 0x16E4E, 0x16E4F, 0x16E50, 0x16E51,
+     0x16E52, 0x16E53, 0x16E54, 0x16E55, 0x16E56, 0x16E57, 0x16E58, 0x16E59,
+     0x16E5A, 0x16E5B, 0x16E5C, 0x16E5D, 0x16E5E, 0x16E5F, 0x1E900, 0x1E901,
+     0x1E902, 0x1E903, 0x1E904, 0x1E905, 0x1E906, 0x1E907, 0x1E908, 0x1E909,
+     0x1E90A, 0x1E90B, 0x1E90C, 0x1E90D, 0x1E90E, 0x1E90F, 0x1E910, 0x1E911,
+     0x1E912, 0x1E913, 0x1E914, 0x1E915, 0x1E916, 0x1E917, 0x1E918, 0x1E919,
+     0x1E91A, 0x1E91B, 0x1E91C, 0x1E91D, 0x1E91E, 0x1E91F, 0x1E920, 0x1E921,
+ };
+ 
+ /* Lowercase form of each lowercaseKeys entry */
+ static const uint32_t lowercaseValues[1432] = {
+     0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+     0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+     0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+     0x79, 0x7A, 0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5,
+     0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0xED,
+     0xEE, 0xEF, 0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5,
+     0xF6, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE,
+     0x101, 0x103, 0x105, 0x107, 0x109, 0x10B, 0x10D, 0x10F,
+     0x111, 0x113, 0x115, 0x117, 0x119, 0x11B, 0x11D, 0x11F,
+     0x121, 0x123, 0x125, 0x127, 0x129, 0x12B, 0x12D, 0x12F,
+     0x133, 0x135, 0x137, 0x13A, 0x13C, 0x13E, 0x140, 0x142,
+     0x144, 0x146, 0x148, 0x14B, 0x14D, 0x14F, 0x151, 0x153,
+     0x155, 0x157, 0x159, 0x15B, 0x15D, 0x15F, 0x161, 0x163,
+     0x165, 0x167, 0x169, 0x16B, 0x16D, 0x16F, 0x171, 0x173,
+     0x175, 0x177, 0xFF, 0x17A, 0x17C, 0x17E, 0x253, 0x183,
+     0x185, 0x254, 0x188, 0x256, 0x257, 0x18C, 0x1DD, 0x259,
+     0x25B, 0x192, 0x260, 0x263, 0x269, 0x268, 0x199, 0x26F,
+     0x272, 0x275, 0x1A1, 0x1A3, 0x1A5, 0x280, 0x1A8, 0x283,
+     0x1AD, 0x288, 0x1B0, 0x28A, 0x28B, 0x1B4, 0x1B6, 0x292,
+     0x1B9, 0x1BD, 0x1C6, 0x1C6, 0x1C9, 0x1C9, 0x1CC, 0x1CC,
+     0x1CE, 0x1D0, 0x1D2, 0x1D4, 0x1D6, 0x1D8, 0x1DA, 0x1DC,
+     0x1DF, 0x1E1, 0x1E3, 0x1E5, 0x1E7, 0x1E9, 0x1EB, 0x1ED,
+     0x1EF, 0x1F3, 0x1F3, 0x1F5, 0x195, 0x1BF, 0x1F9, 0x1FB,
+     0x1FD, 0x1FF, 0x201, 0x203, 0x205, 0x207, 0x209, 0x20B,
+     0x20D, 0x20F, 0x211, 0x213, 0x215, 0x217, 0x219, 0x21B,
+     0x21D, 0x21F, 0x19E, 0x223, 0x225, 0x227, 0x229, 0x22B,
+     0x22D, 0x22F, 0x231, 0x233, 0x2C65, 0x23C, 0x19A, 0x2C66,
+     0x242, 0x180, 0x289, 0x28C, 0x247, 0x249, 0x24B, 0x24D,
+     0x24F, 0x371, 0x373, 0x377, 0x3F3, 0x3AC, 0x3AD, 0x3AE,
+     0x3AF, 0x3CC, 0x3CD, 0x3CE, 0x3B1, 0x3B2, 0x3B3, 0x3B4,
+     0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB, 0x3BC,
+     0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C3, 0x3C4, 0x3C5,
+     0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x3CA, 0x3CB, 0x3D7, 0x3D9,
+     0x3DB, 0x3DD, 0x3DF, 0x3E1, 0x3E3, 0x3E5, 0x3E7, 0x3E9,
+     0x3EB, 0x3ED, 0x3EF, 0x3B8, 0x3F8, 0x3F2, 0x3FB, 0x37B,
+     0x37C, 0x37D, 0x450, 0x451, 0x452, 0x453, 0x454, 0x455,
+     0x456, 0x457, 0x458, 0x459, 0x45A, 0x45B, 0x45C, 0x45D,
+     0x45E, 0x45F, 0x430, 0x431, 0x432, 0x433, 0x434, 0x435,
+     0x436, 0x437, 0x438, 0x439, 0x43A, 0x43B, 0x43C, 0x43D,
+     0x43E, 0x43F, 0x440, 0x441, 0x442, 0x443, 0x444, 0x445,
+     0x446, 0x447, 0x448, 0x449, 0x44A, 0x44B, 0x44C, 0x44D,
+     0x44E, 0x44F, 0x461, 0x463, 0x465, 0x467, 0x469, 0x46B,
+     0x46D, 0x46F, 0x471, 0x473, 0x475, 0x477, 0x479, 0x47B,
+     0x47D, 0x47F, 0x481, 0x48B, 0x48D, 0x48F, 0x491, 0x493,
+     0x495, 0x497, 0x499, 0x49B, 0x49D, 0x49F, 0x4A1, 0x4A3,
+     0x4A5, 0x4A7, 0x4A9, 0x4AB, 0x4AD, 0x4AF, 0x4B1, 0x4B3,
+     0x4B5, 0x4B7, 0x4B9, 0x4BB, 0x4BD, 0x4BF, 0x4CF, 0x4C2,
+     0x4C4, 0x4C6, 0x4C8, 0x4CA, 0x4CC, 0x4CE, 0x4D1, 0x4D3,
+     0x4D5, 0x4D7, 0x4D9, 0x4DB, 0x4DD, 0x4DF, 0x4E1, 0x4E3,
+     0x4E5, 0x4E7, 0x4E9, 0x4EB, 0x4ED, 0x4EF, 0x4F1, 0x4F3,
+     0x4F5, 0x4F7, 0x4F9, 0x4FB, 0x4FD, 0x4FF, 0x501, 0x503,
+     0x505, 0x507, 0x509, 0x50B, 0x50D, 0x50F, 0x511, 0x513,
+     0x515, 0x517, 0x519, 0x51B, 0x51D, 0x51F, 0x521, 0x523,
+     0x525, 0x527, 0x529, 0x52B, 0x52D, 0x52F, 0x561, 0x562,
+     0x563, 0x564, 0x565, 0x566, 0x567, 0x568, 0x569, 0x56A,
+     0x56B, 0x56C, 0x56D, 0x56E, 0x56F, 0x570, 0x571, 0x572,
+     0x573, 0x574, 0x575, 0x576, 0x577, 0x578, 0x579, 0x57A,
+     0x57B, 0x57C, 0x57D, 0x57E, 0x57F, 0x580, 0x581, 0x582,
+     0x583, 0x584, 0x585, 0x586, 0x2D00, 0x2D01, 0x2D02, 0x2D03,
+     0x2D04, 0x2D05, 0x2D06, 0x2D07, 0x2D08, 0x2D09, 0x2D0A, 0x2D0B,
+     0x2D0C, 0x2D0D, 0x2D0E, 0x2D0F, 0x2D10, 0x2D11, 0x2D12, 0x2D13,
+     0x2D14, 0x2D15, 0x2D16, 0x2D17, 0x2D18, 0x2D19, 0x2D1A, 0x2D1B,
+     0x2D1C, 0x2D1D, 0x2D1E, 0x2D1F, 0x2D20, 0x2D21, 0x2D22, 0x2D23,
+     0x2D24, 0x2D25, 0x2D27, 0x2D2D, 0xAB70, 0xAB71, 0xAB72, 0xAB73,
+     0xAB74, 0xAB75, 0xAB76, 0xAB77, 0xAB78, 0xAB79, 0xAB7A, 0xAB7B,
+     0xAB7C, 0xAB7D, 0xAB7E, 0xAB7F, 0xAB80, 0xAB81, 0xAB82, 0xAB83,
+     0xAB84, 0xAB85, 0xAB86, 0xAB87, 0xAB88, 0xAB89, 0xAB8A, 0xAB8B,
+     0xAB8C, 0xAB8D, 0xAB8E, 0xAB8F, 0xAB90, 0xAB91, 0xAB92, 0xAB93,
+     0xAB94, 0xAB95, 0xAB96, 0xAB97, 0xAB98, 0xAB99, 0xAB9A, 0xAB9B,
+     0xAB9C, 0xAB9D, 0xAB9E, 0xAB9F, 0xABA0, 0xABA1, 0xABA2, 0xABA3,
+     0xABA4, 0xABA5, 0xABA6, 0xABA7, 0xABA8, 0xABA9, 0xABAA, 0xABAB,
+     0xABAC, 0xABAD, 0xABAE, 0xABAF, 0xABB0, 0xABB1, 0xABB2, 0xABB3,
+     0xABB4, 0xABB5, 0xABB6, 0xABB7, 0xABB8, 0xABB9, 0xABBA, 0xABBB,
+     0xABBC, 0xABBD, 0xABBE, 0xABBF, 0x13F8, 0x13F9, 0x13FA, 0x13FB,
+     0x13FC, 0x13FD, 0x10D0, 0x10D1, 0x10D2, 0x10D3, 0x10D4, 0x10D5,
+     0x10D6, 0x10D7, 0x10D8, 0x10D9, 0x10DA, 0x10DB, 0x10DC, 0x10DD,
+     0x10DE, 0x10DF, 0x10E0, 0x10E1, 0x10E2, 0x10E3, 0x10E4, 0x10E5,
+     0x10E6, 0x10E7, 0x10E8, 0x10E9, 0x10EA, 0x10EB, 0x10EC, 0x10ED,
+     0x10EE, 0x10EF, 0x10F0, 0x10F1, 0x10F2, 0x10F3, 0x10F4, 0x10F5,
+     0x10F6, 0x10F7, 0x10F8, 0x10F9, 0x10FA, 0x10FD, 0x10FE, 0x10FF,
+     0x1E01, 0x1E03, 0x1E05, 0x1E07, 0x1E09, 0x1E0B, 0x1E0D, 0x1E0F,
+     0x1E11, 0x1E13, 0x1E15, 0x1E17, 0x1E19, 0x1E1B, 0x1E1D, 0x1E1F,
+     0x1E21, 0x1E23, 0x1E25, 0x1E27, 0x1E29, 0x1E2B, 0x1E2D, 0x1E2F,
+     0x1E31, 0x1E33, 0x1E35, 0x1E37, 0x1E39, 0x1E3B, 0x1E3D, 0x1E3F,
+     0x1E41, 0x1E43, 0x1E45, 0x1E47, 0x1E49, 0x1E4B, 0x1E4D, 0x1E4F,
+     0x1E51, 0x1E53, 0x1E55, 0x1E57, 0x1E59, 0x1E5B, 0x1E5D, 0x1E5F,
+     0x1E61, 0x1E63, 0x1E65, 0x1E67, 0x1E69, 0x1E6B, 0x1E6D, 0x1E6F,
+     0x1E71, 0x1E73, 0x1E75, 0x1E77, 0x1E79, 0x1E7B, 0x1E7D, 0x1E7F,
+     0x1E81, 0x1E83, 0x1E85, 0x1E87, 0x1E89, 0x1E8B, 0x1E8D, 0x1E8F,
+     0x1E91, 0x1E93, 0x1E95, 0xDF, 0x1EA1, 0x1EA3, 0x1EA5, 0x1EA7,
+     0x1EA9, 0x1EAB, 0x1EAD, 0x1EAF, 0x1EB1, 0x1EB3, 0x1EB5, 0x1EB7,
+     0x1EB9, 0x1EBB, 0x1EBD, 0x1EBF, 0x1EC1, 0x1EC3, 0x1EC5, 0x1EC7,
+     0x1EC9, 0x1ECB, 0x1ECD, 0x1ECF, 0x1ED1, 0x1ED3, 0x1ED5, 0x1ED7,
+     0x1ED9, 0x1EDB, 0x1EDD, 0x1EDF, 0x1EE1, 0x1EE3, 0x1EE5, 0x1EE7,
+     0x1EE9, 0x1EEB, 0x1EED, 0x1EEF, 0x1EF1, 0x1EF3, 0x1EF5, 0x1EF7,
+     0x1EF9, 0x1EFB, 0x1EFD, 0x1EFF, 0x1F00, 0x1F01, 0x1F02, 0x1F03,
+     0x1F04, 0x1F05, 0x1F06, 0x1F07, 0x1F10, 0x1F11, 0x1F12, 0x1F13,
+     0x1F14, 0x1F15, 0x1F20, 0x1F21, 0x1F22, 0x1F23, 0x1F24, 0x1F25,
+     0x1F26, 0x1F27, 0x1F30, 0x1F31, 0x1F32, 0x1F33, 0x1F34, 0x1F35,
+     0x1F36, 0x1F37, 0x1F40, 0x1F41, 0x1F42, 0x1F43, 0x1F44, 0x1F45,
+     0x1F51, 0x1F53, 0x1F55, 0x1F57, 0x1F60, 0x1F61, 0x1F62, 0x1F63,
+     0x1F64, 0x1F65, 0x1F66, 0x1F67, 0x1F80, 0x1F81, 0x1F82, 0x1F83,
+     0x1F84, 0x1F85, 0x1F86, 0x1F87, 0x1F90, 0x1F91, 0x1F92, 0x1F93,
+     0x1F94, 0x1F95, 0x1F96, 0x1F97, 0x1FA0, 0x1FA1, 0x1FA2, 0x1FA3,
+     0x1FA4, 0x1FA5, 0x1FA6, 0x1FA7, 0x1FB0, 0x1FB1, 0x1F70, 0x1F71,
+     0x1FB3, 0x1F72, 0x1F73, 0x1F74, 0x1F75, 0x1FC3, 0x1FD0, 0x1FD1,
+     0x1F76, 0x1F77, 0x1FE0, 0x1FE1, 0x1F7A, 0x1F7B, 0x1FE5, 0x1F78,
+     0x1F79, 0x1F7C, 0x1F7D, 0x1FF3, 0x3C9, 0x6B, 0xE5, 0x214E,
+     0x2170, 0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176, 0x2177,
+     0x2178, 0x2179, 0x217A, 0x217B, 0x217C, 0x217D, 0x217E, 0x217F,
+     0x2184, 0x24D0, 0x24D1, 0x24D2, 0x24D3, 0x24D4, 0x24D5, 0x24D6,
+     0x24D7, 0x24D8, 0x24D9, 0x24DA, 0x24DB, 0x24DC, 0x24DD, 0x24DE,
+     0x24DF, 0x24E0, 0x24E1, 0x24E2, 0x24E3, 0x24E4, 0x24E5, 0x24E6,
+     0x24E7, 0x24E8, 0x24E9, 0x2C30, 0x2C31, 0x2C32, 0x2C33, 0x2C34,
+     0x2C35, 0x2C36, 0x2C37, 0x2C38, 0x2C39, 0x2C3A, 0x2C3B, 0x2C3C,
+     0x2C3D, 0x2C3E, 0x2C3F, 0x2C40, 0x2C41, 0x2C42, 0x2C43, 0x2C44,
+     0x2C45, 0x2C46, 0x2C47, 0x2C48, 0x2C49, 0x2C4A, 0x2C4B, 0x2C4C,
+     0x2C4D, 0x2C4E, 0x2C4F, 0x2C50, 0x2C51, 0x2C52, 0x2C53, 0x2C54,
+     0x2C55, 0x2C56, 0x2C57, 0x2C58, 0x2C59, 0x2C5A, 0x2C5B, 0x2C5C,
+     0x2C5D, 0x2C5E, 0x2C5F, 0x2C61, 0x26B, 0x1D7D, 0x27D, 0x2C68,
+     0x2C6A, 0x2C6C, 0x251, 0x271, 0x250, 0x252, 0x2C73, 0x2C76,
+     0x23F, 0x240, 0x2C81, 0x2C83, 0x2C85, 0x2C87, 0x2C89, 0x2C8B,
+     0x2C8D, 0x2C8F, 0x2C91, 0x2C93, 0x2C95, 0x2C97, 0x2C99, 0x2C9B,
+     0x2C9D, 0x2C9F, 0x2CA1, 0x2CA3, 0x2CA5, 0x2CA7, 0x2CA9, 0x2CAB,
+     0x2CAD, 0x2CAF, 0x2CB1, 0x2CB3, 0x2CB5, 0x2CB7, 0x2CB9, 0x2CBB,
+     0x2CBD, 0x2CBF, 0x2CC1, 0x2CC3, 0x2CC5, 0x2CC7, 0x2CC9, 0x2CCB,
+     0x2CCD, 0x2CCF, 0x2CD1, 0x2CD3, 0x2CD5, 0x2CD7, 0x2CD9, 0x2CDB,
+     0x2CDD, 0x2CDF, 0x2CE1, 0x2CE3, 0x2CEC, 0x2CEE, 0x2CF3, 0xA641,
+     0xA643, 0xA645, 0xA647, 0xA649, 0xA64B, 0xA64D, 0xA64F, 0xA651,
+     0xA653, 0xA655, 0xA657, 0xA659, 0xA65B, 0xA65D, 0xA65F, 0xA661,
+     0xA663, 0xA665, 0xA667, 0xA669, 0xA66B, 0xA66D, 0xA681, 0xA683,
+     0xA685, 0xA687, 0xA689, 0xA68B, 0xA68D, 0xA68F, 0xA691, 0xA693,
+     0xA695, 0xA697, 0xA699, 0xA69B, 0xA723, 0xA725, 0xA727, 0xA729,
+     0xA72B, 0xA72D, 0xA72F, 0xA733, 0xA735, 0xA737, 0xA739, 0xA73B,
+     0xA73D, 0xA73F, 0xA741, 0xA743, 0xA745, 0xA747, 0xA749, 0xA74B,
+     0xA74D, 0xA74F, 0xA751, 0xA753, 0xA755, 0xA757, 0xA759, 0xA75B,
+     0xA75D, 0xA75F, 0xA761, 0xA763, 0xA765, 0xA767, 0xA769, 0xA76B,
+     0xA76D, 0xA76F, 0xA77A, 0xA77C, 0x1D79, 0xA77F, 0xA781, 0xA783,
+     0xA785, 0xA787, 0xA78C, 0x265, 0xA791, 0xA793, 0xA797, 0xA799,
+     0xA79B, 0xA79D, 0xA79F, 0xA7A1, 0xA7A3, 0xA7A5, 0xA7A7, 0xA7A9,
+     0x266, 0x25C, 0x261, 0x26C, 0x26A, 0x29E, 0x287, 0x29D,
+     0xAB53, 0xA7B5, 0xA7B7, 0xA7B9, 0xA7BB, 0xA7BD, 0xA7BF, 0xA7C1,
+     0xA7C3, 0xA794, 0x282, 0x1D8E, 0xA7C8, 0xA7CA, 0xA7D1, 0xA7D7,
+     0xA7D9, 0xA7F6, 0xFF41, 0xFF42, 0xFF43, 0xFF44, 0xFF45, 0xFF46,
+     0xFF47, 0xFF48, 0xFF49, 0xFF4A, 0xFF4B, 0xFF4C, 0xFF4D, 0xFF4E,
+     0xFF4F, 0xFF50, 0xFF51, 0xFF52, 0xFF53, 0xFF54, 0xFF55, 0xFF56,
+     0xFF57, 0xFF58, 0xFF59, 0xFF5A, 0x10428, 0x10429, 0x1042A, 0x1042B,
+     0x1042C, 0x1042D, 0x1042E, 0x1042F, 0x10430, 0x10431, 0x10432, 0x10433,
+     0x10434, 0x10435, 0x10436, 0x10437, 0x10438, 0x10439, 0x1043A, 0x1043B,
+     0x1043C, 0x1043D, 0x1043E, 0x1043F, 0x10440, 0x10441, 0x10442, 0x10443,
+     0x10444, 0x10445, 0x10446, 0x10447, 0x10448, 0x10449, 0x1044A, 0x1044B,
+     0x1044C, 0x1044D, 0x1044E, 0x1044F, 0x104D8, 0x104D9, 0x104DA, 0x104DB,
+     0x104DC, 0x104DD, 0x104DE, 0x104DF, 0x104E0, 0x104E1, 0x104E2, 0x104E3,
+     0x104E4, 0x104E5, 0x104E6, 0x104E7, 0x104E8, 0x104E9, 0x104EA, 0x104EB,
+     0x104EC, 0x104ED, 0x104EE, 0x104EF, 0x104F0, 0x104F1, 0x104F2, 0x104F3,
+     0x104F4, 0x104F5, 0x104F6, 0x104F7, 0x104F8, 0x104F9, 0x104FA, 0x104FB,
+     0x10597, 0x10598, 0x10599, 0x1059A, 0x1059B, 0x1059C, 0x1059D, 0x1059E,
+     0x1059F, 0x105A0, 0x105A1, 0x105A3, 0x105A4, 0x105A5, 0x105A6, 0x105A7,
+     0x105A8, 0x105A9, 0x105AA, 0x105AB, 0x105AC, 0x105AD, 0x105AE, 0x105AF,
+     0x105B0, 0x105B1, 0x105B3, 0x105B4, 0x105B5, 0x105B6, 0x105B7, 0x105B8,
+     0x105B9, 0x105BB, 0x105BC, 0x10CC0, 0x10CC1, 0x10CC2, 0x10CC3, 0x10CC4,
+     0x10CC5, 0x10CC6, 0x10CC7, 0x10CC8, 0x10CC9, 0x10CCA, 0x10CCB, 0x10CCC,
+     0x10CCD, 0x10CCE, 0x10CCF, 0x10CD0, 0x10CD1, 0x10CD2, 0x10CD3, 0x10CD4,
+     0x10CD5, 0x10CD6, 0x10CD7, 0x10CD8, 0x10CD9, 0x10CDA, 0x10CDB, 0x10CDC,
+     0x10CDD, 0x10CDE, 0x10CDF, 0x10CE0, 0x10CE1, 0x10CE2, 0x10CE3, 0x10CE4,
+     0x10CE5, 0x10CE6, 0x10CE7, 0x10CE8, 0x10CE9, 0x10CEA, 0x10CEB, 0x10CEC,
+     0x10CED, 0x10CEE, 0x10CEF, 0x10CF0, 0x10CF1, 0x10CF2, 0x118C0, 0x118C1,
+     0x118C2, 0x118C3, 0x118C4, 0x118C5, 0x118C6, 0x118C7, 0x118C8, 0x118C9,
+     0x118CA, 0x118CB, 0x118CC, 0x118CD, 0x118CE, 0x118CF, 0x118D0, 0x118D1,
+     0x118D2, 0x118D3, 0x118D4, 0x118D5, 0x118D6, 0x118D7, 0x118D8, 0x118D9,
+     0x118DA, 0x118DB, 0x118DC, 0x118DD, 0x118DE, 0x118DF, 0x16E60, 0x16E61,
+     0x16E62, 0x16E63, 0x16E64, 0x16E65, 0x16E66, 0x16E67, 0x16E68, 0x16E69,
+     0x16E6A, 0x16E6B, 0x16E6C, 0x16E6D, 0x16E6E, 0x16E6F, 0x16E70, 0x16E71,
+     0x16E72, 0x16E73, 0x16E74, 0x16E75, 0x16E76, 0x16E77, 0x16E78, 0x16E79,
+     0x16E7A, 0x16E7B, 0x16E7C, 0x16E7D, 0x16E7E, 0x16E7F, 0x1E922, 0x1E923,
+     0x1E924, 0x1E925, 0x1E926, 0x1E927, 0x1E928, 0x1E929, 0x1E92A, 0x1E92B,
+     0x1E92C, 0x1E92D, 0x1E92E, 0x1E92F, 0x1E930, 0x1E931, 0x1E932, 0x1E933,
+     0x1E934, 0x1E935, 0x1E936, 0x1E937, 0x1E938, 0x1E939, 0x1E93A, 0x1E93B,
+     0x1E93C, 0x1E93D, 0x1E93E, 0x1E93F, 0x1E940, 0x1E941, 0x1E942, 0x1E943,
+ };
+ 
+ #endif /* PASSWORD_STRENGTH_UNICODE_H */